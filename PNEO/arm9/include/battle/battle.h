@@ -28,7 +28,6 @@
 #pragma once
 #include <cstring>
 #include <map>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -36,6 +35,8 @@
 
 #include "battle/battleDefines.h"
 #include "battle/battleField.h"
+#include "battle/battleRandom.h"
+#include "battle/battleReplay.h"
 #include "battle/battleTrainer.h"
 #include "battle/battleUI.h"
 #include "battle/move.h"
@@ -72,8 +73,9 @@ namespace BATTLE {
 
         battleTrainer _opponent;
         pokemon       _opponentTeam[ SAVE::NUM_PARTY_SLOTS ];
-        std::set<u8>  _yieldEXP[ SAVE::NUM_PARTY_SLOTS ]; // idx's of the player's pkmn that will
-                                                          // receive EXP when the pkmn faints
+        u8            _yieldEXP[ SAVE::NUM_PARTY_SLOTS ]; // bit mask of the (initial) idx's of
+                                                          // the player's pkmn that will receive
+                                                          // EXP when the pkmn faints
         u8 _opponentTeamSize;
         u8 _opponentPkmnPerm[ SAVE::NUM_PARTY_SLOTS ];
 
@@ -89,6 +91,27 @@ namespace BATTLE {
 
         u8 _lastMoveChoice = 0;
 
+        battleRandom  _playerAIRng;                     // choices of the AI for the player
+        battleReplay* _replay    = &LAST_BATTLE_REPLAY; // log that is recorded / replayed
+        bool          _replaying = false;
+
+        // what the ai knows about a pkmn to estimate its matchups; pkmn are indexed by
+        // side and their position in the team at the start of the battle (cf. the perms)
+        struct matchupPkmn {
+            type m_types[ 2 ];
+            type m_moveTypes[ 4 ];
+            u8   m_moveCategory[ 4 ];
+            u8   m_movePower[ 4 ];
+            u8   m_status;       // status the pkmn's matchups were computed with
+            bool m_active;       // pkmn was on the field when its matchups were computed
+            u16  m_enteredRound; // round the pkmn was last sent out
+        };
+
+        matchupPkmn _matchupPkmn[ field::NUM_SIDES ][ SAVE::NUM_PARTY_SLOTS ];
+        // expected damage of a pkmn's best move against each foe, in % of the foe's max HP
+        u8 _matchup[ field::NUM_SIDES ][ SAVE::NUM_PARTY_SLOTS ][ SAVE::NUM_PARTY_SLOTS ];
+        u8 _plannedSwitches[ field::NUM_SIDES ]; // bench pkmn the ai sends out this turn
+
         /*
          * @brief: Initializes the battle.
          */
@@ -123,14 +146,63 @@ namespace BATTLE {
         battleMoveSelection chooseAttack( u8 p_slot, bool p_allowMegaEvolution );
 
         /*
-         * @brief: Computes an AI move for the opposing pokemon in slot p_slot.
+         * @brief: Computes an AI move for the pokemon in slot p_slot of the opponent's
+         * side (or of the player's side in headless battles).
+         */
+        battleMoveSelection getAIMove( u8 p_slot, bool p_opponent = true );
+
+        /*
+         * @brief: Improves the ai's choice p_fallback for high ai levels by simulating
+         * every possible choice a few turns ahead on copies of the field (see
+         * battleSearch.h). Returns p_fallback if there is nothing to choose from.
+         */
+        battleMoveSelection searchAIMove( u8 p_slot, bool p_opponent,
+                                          const battleMoveSelection& p_fallback,
+                                          battleRandom& p_rng, u16 p_aiLevel );
+
+        /*
+         * @brief: Computes the matchups of all pkmn. Reads the moves and types of all
+         * pkmn, so it should be called only once per battle.
+         */
+        void initMatchups( );
+
+        /*
+         * @brief: Reads the types and moves of the p_idx-th pkmn of the given side
+         * (e.g. after it mega evolved).
+         */
+        void initMatchupPkmn( u8 p_side, u8 p_idx );
+
+        /*
+         * @brief: Recomputes the matchups of all pkmn that are or were on the field or
+         * whose status changed since the last update (or of all pkmn, if p_all is set).
          */
-        battleMoveSelection getAIMove( u8 p_slot );
+        void updateMatchups( bool p_all = false );
+
+        /*
+         * @brief: Estimates the damage the p_attacker-th pkmn of side p_side deals to the
+         * p_defender-th pkmn of the other side with its best move, in % of the latter's
+         * max HP. Uses the current stats (and boosts) of pkmn on the field.
+         */
+        u8 estimateMatchup( u8 p_side, u8 p_attacker, u8 p_defender );
+
+        /*
+         * @brief: Rates how well the p_idx-th pkmn of side p_side fares against the
+         * pkmn currently on the field: share of the foes' remaining HP it takes per
+         * turn minus the share of its own HP it loses (the latter including a hit while
+         * switching in, if p_switchIn is set).
+         */
+        s16 rateMatchup( u8 p_side, u8 p_idx, bool p_switchIn );
+
+        /*
+         * @brief: Returns the bench pkmn the ai switches the pkmn in slot p_slot for, if
+         * the pkmn is in a bad matchup and a much better one is available, or 255.
+         */
+        u8 getAISwitch( u8 p_slot, bool p_opponent, u16 p_aiLevel );
 
         /*
          * @brief: Chooses which pokemon the ai sends out when one of its pokemon fainted.
          */
-        u8 getNextAIPokemon( ) const;
+        u8 getNextAIPokemon( bool p_opponent = true ) const;
 
         /*
          * @brief: Checks whether the battle hit an end
@@ -202,10 +274,12 @@ namespace BATTLE {
 
       public:
         /*
-         * @brief: Creates a new trainer battle.
+         * @brief: Creates a new trainer battle; if p_headless is set, the AI also plays
+         * for the player (at the policy's ai level) and the battle runs without drawing
+         * anything or waiting (no money, learned moves or evolutions afterwards).
          */
         battle( pokemon* p_playerTeam, u8 p_playerTeamSize, const battleTrainer& p_opponent,
-                battlePolicy = DEFAULT_TRAINER_POLICY );
+                battlePolicy p_policy = DEFAULT_TRAINER_POLICY, bool p_headless = false );
 
         /*
          * @brief: Creates a new trainer battle, reads trainer data from FS.
@@ -227,9 +301,67 @@ namespace BATTLE {
          */
         battleEndReason start( );
 
+        /*
+         * @brief: Starts the battle with the given seed for all random decisions.
+         */
+        battleEndReason start( u32 p_seed );
+
+        /*
+         * @brief: Plays the battle recorded in the given log instead of asking the player;
+         * the battle needs to be set up with the same teams and policy as the recorded
+         * one. Returns BATTLE_NONE without playing if the log is incomplete.
+         */
+        battleEndReason replay( battleReplay& p_replay );
+
         /*
          * @brief: Returns messages of the battle trainer.
          */
         const char* getMessage( u8 p_stringId );
+
+        /*
+         * @brief: Returns the number of rounds played so far.
+         */
+        constexpr u16 getRound( ) const {
+            return _round;
+        }
     };
+
+    struct simulationResult {
+        u16 m_playerWins;
+        u16 m_opponentWins;
+        u16 m_draws; // battles that hit the round limit
+        u32 m_rounds;
+#ifdef DESQUID
+        bool m_replayMatches; // replaying the last battle from its log had the same outcome
+#endif
+    };
+
+#ifdef DESQUID
+    struct matchupStats {
+        u32 m_initTicks; // longest initMatchups
+        u32 m_updateTicks;
+        u32 m_updates;
+        u32 m_switches; // switches chosen based on matchups
+    };
+
+    extern matchupStats MATCHUP_STATS;
+    extern bool         DISABLE_AI_SWITCHES; // for comparisons
+#endif
+
+    // round limit of simulated battles whose policy doesn't specify one
+    constexpr u16 SIMULATION_ROUND_LIMIT = 100;
+
+    constexpr u16 MAX_MOVE_USAGE_ID = 1024;
+    // if set, battles count how often each move (id < MAX_MOVE_USAGE_ID) is used
+    extern u32* MOVE_USAGE;
+
+    /*
+     * @brief: Plays p_count headless battles of (a copy of) the given team against the
+     * given trainer, with the AI controlling both sides. The i-th battle uses the seed
+     * p_seed + i. With DESQUID, the last battle is replayed from its log unless
+     * p_checkReplay is false (for callers that play a batch one battle at a time).
+     */
+    simulationResult simulateBattles( const pokemon* p_team, u8 p_teamSize,
+                                      const battleTrainer& p_opponent, battlePolicy p_policy,
+                                      u16 p_count, u32 p_seed, bool p_checkReplay = true );
 } // namespace BATTLE
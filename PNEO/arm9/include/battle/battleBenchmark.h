@@ -0,0 +1,88 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleBenchmark.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#ifdef DESQUID
+#include <nds.h>
+#include <nds/ndstypes.h>
+
+#include "battle/battleDefines.h"
+#include "pokemon.h"
+#include "prof/profiler.h"
+
+namespace BATTLE {
+    constexpr u8  MAX_BENCHMARK_PKMN = 4;
+    constexpr u16 BENCHMARK_BATTLES  = 20; // per scenario
+
+    // phases of a turn that the benchmark reports
+    constexpr PROF::phase FIRST_BATTLE_PHASE = PROF::BATTLE_TURN;
+    constexpr PROF::phase LAST_BATTLE_PHASE  = PROF::BATTLE_END_OF_TURN;
+
+    /*
+     * @brief: A battle setup for the benchmark; both sides are played by the AI.
+     */
+    struct benchmarkScenario {
+        const char*    m_name;
+        battleMode     m_mode;
+        weather        m_weather;
+        u8             m_numPkmn;
+        trainerPokemon m_player[ MAX_BENCHMARK_PKMN ];
+        trainerPokemon m_opponent[ MAX_BENCHMARK_PKMN ];
+    };
+
+    constexpr u8 NUM_BENCHMARK_SCENARIOS = 5;
+
+    // singles, doubles, weather and terrain wars, multi-hit moves and status heavy turns
+    extern const benchmarkScenario BENCHMARK_SCENARIOS[ NUM_BENCHMARK_SCENARIOS ];
+
+    struct benchmarkResult {
+        u16  m_scenarios;
+        u16  m_regressions;     // phases at least 10% slower than in the baseline
+        u16  m_changed;         // phases that ran a different number of times than before
+        u32  m_turnAllocations; // heap allocations per 10 turns (all scenarios)
+        bool m_hasBaseline;
+    };
+
+    /*
+     * @brief: Plays BENCHMARK_BATTLES headless battles (with fixed seeds) of each
+     * scenario (singles, doubles, weather and terrain wars, multi-hit moves and status
+     * heavy turns) and writes the min/avg/max time and the number of heap allocations of
+     * the phases of a turn (sorting the moves, using a move, end-of-turn effects, whole
+     * turns) per scenario as csv to BATTLEBENCH.prof.csv next to p_path.
+     *
+     * The results are compared against BATTLEBENCH.base.csv, which is created from the
+     * results if it doesn't exist yet; delete it to start a new baseline. Since the
+     * seeds are fixed, the number of times each phase runs only changes if the battle
+     * logic changes. Clears the collected phase stats.
+     *
+     * tools/hosttest/battleBench.base.csv holds the results of a host run; the host
+     * test battleBench compares against it.
+     */
+    benchmarkResult benchmarkBattleTurns( const char* p_path );
+} // namespace BATTLE
+#endif
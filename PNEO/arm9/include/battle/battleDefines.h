@@ -26,9 +26,11 @@
     */
 
 #pragma once
+#include <initializer_list>
 #include <vector>
 #include <nds.h>
 #include "battle/type.h"
+#include "defines.h"
 
 namespace BATTLE {
     constexpr u8 HP              = 0;
@@ -493,6 +495,71 @@ namespace BATTLE {
         MT_MESSAGE_MOVE, // Extra message for certain moves
     };
 
+    /*
+     * @brief: Vector with a fixed capacity that lives inline (e.g. on the stack), for the
+     * lists a battle fills every turn; filling it never allocates. Elements beyond the
+     * capacity are dropped; DESQUID builds halt instead.
+     */
+    template <typename T, u8 N>
+    class fixedVector {
+        T  _data[ N ];
+        u8 _size = 0;
+
+      public:
+        constexpr fixedVector( ) : _data{ } {
+        }
+
+        constexpr fixedVector( std::initializer_list<T> p_values ) : _data{ } {
+            for( const auto& v : p_values ) { push_back( v ); }
+        }
+
+        constexpr void push_back( const T& p_value ) {
+            DESQUID_ASSERT( _size < N, "fixedVector: capacity exceeded" );
+            if( _size < N ) { _data[ _size++ ] = p_value; }
+        }
+
+        constexpr void clear( ) {
+            _size = 0;
+        }
+
+        constexpr u8 size( ) const {
+            return _size;
+        }
+
+        constexpr bool empty( ) const {
+            return !_size;
+        }
+
+        constexpr T& operator[]( u8 p_idx ) {
+            return _data[ p_idx ];
+        }
+
+        constexpr const T& operator[]( u8 p_idx ) const {
+            return _data[ p_idx ];
+        }
+
+        constexpr T* begin( ) {
+            return _data;
+        }
+
+        constexpr T* end( ) {
+            return _data + _size;
+        }
+
+        constexpr const T* begin( ) const {
+            return _data;
+        }
+
+        constexpr const T* end( ) const {
+            return _data + _size;
+        }
+    };
+
+    constexpr u8 MAX_BATTLERS     = 4; // pkmn on the field at once
+    constexpr u8 MAX_MOVE_TARGETS = MAX_BATTLERS;
+    // each battler's move, plus up to 2 messages (item, move) before it
+    constexpr u8 MAX_BATTLE_MOVES = 3 * MAX_BATTLERS;
+
     struct battleMoveSelection {
         battleMoveType m_type;
         u16            m_param; // move id for attack/ m attack; target pkmn
@@ -509,13 +576,14 @@ namespace BATTLE {
     struct battleMove {
         battleMoveType             m_type;
         u16                        m_param;
-        std::vector<fieldPosition> m_target; // List of all pkmn targeted (empty if field or side)
-        fieldPosition              m_user;
-        s8                         m_priority;
-        s16                        m_userSpeed;
-        u8                         m_pertubation; // random number to break speed ties
-        moveData                   m_moveData;
-        bool                       m_megaEvolve;
+        fixedVector<fieldPosition, MAX_MOVE_TARGETS>
+                      m_target; // List of all pkmn targeted (empty if field or side)
+        fieldPosition m_user;
+        s8            m_priority;
+        s16           m_userSpeed;
+        u8            m_pertubation; // random number to break speed ties
+        moveData      m_moveData;
+        bool          m_megaEvolve;
 
         std::strong_ordering operator<=>( const battleMove& p_other ) {
             if( auto cmp = p_other.m_priority <=> this->m_priority; cmp != 0 ) return cmp;
@@ -523,4 +591,7 @@ namespace BATTLE {
             return this->m_pertubation <=> p_other.m_pertubation;
         }
     };
+
+    typedef fixedVector<battleMoveSelection, MAX_BATTLERS> battleMoveSelections;
+    typedef fixedVector<battleMove, MAX_BATTLE_MOVES>      battleMoves;
 } // namespace BATTLE
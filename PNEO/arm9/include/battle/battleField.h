@@ -35,6 +35,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include <nds.h>
 
 #include "battle/battleDefines.h"
+#include "battle/battleRandom.h"
 #include "battle/battleSide.h"
 #include "battle/move.h"
 #include "fs/data.h"
@@ -44,6 +45,33 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "pokemon.h"
 
 namespace BATTLE {
+    constexpr u8 NUM_DAMAGE_ROLLS     = 16; // damage is multiplied by 85% to 100%
+    constexpr u8 MAX_DAMAGE_MODIFIERS = 16;
+
+    /*
+     * @brief: The multipliers that are applied to the damage of a move after the random
+     * roll, in order; the damage is rounded down after each of them.
+     */
+    struct damageModifiers {
+        u16 m_mul[ MAX_DAMAGE_MODIFIERS ];
+        u16 m_div[ MAX_DAMAGE_MODIFIERS ];
+        u8  m_count = 0;
+
+        /*
+         * @brief: Adds the multiplier p_mul / p_div; multipliers of 1 are dropped.
+         */
+        constexpr void add( u16 p_mul, u16 p_div ) {
+            if( p_mul == p_div || m_count >= MAX_DAMAGE_MODIFIERS ) { return; }
+            m_mul[ m_count ]   = p_mul;
+            m_div[ m_count++ ] = p_div;
+        }
+
+        constexpr u32 apply( u32 p_damage ) const {
+            for( u8 i = 0; i < m_count; ++i ) { p_damage = p_damage * m_mul[ i ] / m_div[ i ]; }
+            return p_damage;
+        }
+    };
+
     /*
      * @brief: The overall field where the battle takes place.
      */
@@ -72,6 +100,8 @@ namespace BATTLE {
         bool       _isWildBattle;
         battleMode _mode;
 
+        battleRandom _rng; // source of all random decisions of the battle
+
       public:
         field( battleMode p_battleMode = BM_SINGLE, bool p_isWildBattle = false,
                weather p_initialWeather = WE_NONE, pseudoWeather p_initialPseudoWeather = PW_NONE,
@@ -86,6 +116,10 @@ namespace BATTLE {
          */
         void age( battleUI* p_ui );
 
+        constexpr battleRandom& rng( ) {
+            return _rng;
+        }
+
         constexpr u16 getTurnsInPlay( bool p_opponent, u8 p_slot ) {
             return _sides[ p_opponent ? OPPONENT_SIDE : PLAYER_SIDE ].getTurnsInPlay( p_slot );
         }
@@ -287,7 +321,7 @@ namespace BATTLE {
             _sides[ p_opponent ? OPPONENT_SIDE : PLAYER_SIDE ].setLastUsedMove( p_slot, p_move );
         }
 
-        inline battleMove getLastUsedMove( bool p_opponent, u8 p_slot ) const {
+        constexpr battleMoveSelection getLastUsedMove( bool p_opponent, u8 p_slot ) const {
             return _sides[ p_opponent ? OPPONENT_SIDE : PLAYER_SIDE ].getLastUsedMove( p_slot );
         }
 
@@ -334,9 +368,8 @@ namespace BATTLE {
         /*
          * @brief: Sorts the give moves, computes targets. May use up I_CUSTAP_BERRY
          */
-        std::vector<battleMove>
-        computeSortedBattleMoves( battleUI*                               p_ui,
-                                  const std::vector<battleMoveSelection>& p_selectedMoves );
+        battleMoves computeSortedBattleMoves( battleUI*                   p_ui,
+                                              const battleMoveSelections& p_selectedMoves );
 
         /*
          * @brief: Deduces the specified number of PP from the first move of the specified
@@ -373,6 +406,44 @@ namespace BATTLE {
          */
         bool executeCriticalCheck( battleUI* p_ui, battleMove p_move, fieldPosition p_target );
 
+        /*
+         * @brief: First stage of the damage calculation: the damage of the given move
+         * before the random roll (level, power, stats, spread moves, weather and critical
+         * hits). Has no side effects.
+         */
+        u32 computeBaseDamage( battleMove p_move, fieldPosition p_target, bool p_critical );
+
+        /*
+         * @brief: Second stage of the damage calculation: collects the modifiers that are
+         * applied after the random roll (STAB, effectiveness, burn, screens, abilities,
+         * items) in p_out. Has no side effects.
+         * @returns: The berry the target eats to weaken the move, or 0.
+         */
+        u16 computeDamageModifiers( battleMove p_move, fieldPosition p_target, bool p_critical,
+                                    u8 p_damageModifier, u16 p_effectiveness,
+                                    damageModifiers& p_out );
+
+        /*
+         * @brief: Third stage of the damage calculation: the damage of the given roll
+         * (0 to 15, 85% to 100%).
+         */
+        static constexpr u32 computeRolledDamage( u32 p_baseDamage, u8 p_roll,
+                                                  const damageModifiers& p_modifiers ) {
+            u32 damage = p_modifiers.apply( p_baseDamage * ( 85 + p_roll ) / 100 );
+            if( !damage ) { damage = 1; }
+            if( damage > 9000 ) { damage = 9000; }
+            return damage;
+        }
+
+        /*
+         * @brief: Computes the damage the given move would deal to the target for each of
+         * the 16 random rolls (in increasing order, not capped by the target's HP),
+         * without executing the move. Used by the AI.
+         * @returns: The effectiveness of the move; if it is 0, so are all rolls.
+         */
+        u16 computeDamageRolls( battleMove p_move, fieldPosition p_target,
+                                u16 p_out[ NUM_DAMAGE_ROLLS ], bool p_critical = false );
+
         /*
          * @brief: Executes the specified damaging move, dealing damage/heal to the
          * specified target. (Only deals damage/recoil)
@@ -409,9 +480,7 @@ namespace BATTLE {
         /*
          * @brief: Executes the given battle move and all effects related to it.
          */
-        void executeBattleMove( battleUI* p_ui, battleMove p_move,
-                                const std::vector<battleMove>& p_targetsMoves,
-                                const std::vector<battleMove>& p_tergetedMoves );
+        void executeBattleMove( battleUI* p_ui, battleMove p_move );
 
         /*
          * @brief: Sets the pokemon of the specified slot. Only used at battle start
@@ -424,6 +493,15 @@ namespace BATTLE {
             _sides[ p_opponent ? OPPONENT_SIDE : PLAYER_SIDE ].setSlotDisguise( p_slot, p_pokemon );
         }
 
+        /*
+         * @brief: Makes the slots of the given side use the pkmn in p_to instead of the
+         * ones in p_from (e.g. after copying the field and the teams).
+         */
+        inline void relocate( bool p_opponent, const pokemon* p_from, pokemon* p_to,
+                              u8 p_count ) {
+            _sides[ p_opponent ? OPPONENT_SIDE : PLAYER_SIDE ].relocate( p_from, p_to, p_count );
+        }
+
         inline u8 willDisguise( pokemon*      p_pokemon,
                                 const pokemon p_teamContext[ SAVE::NUM_PARTY_SLOTS ] ) {
             if( p_pokemon->getAbility( ) != A_ILLUSION ) { return 0; }
@@ -474,10 +552,11 @@ namespace BATTLE {
                                 u16 p_damage, u8 p_effectiveness );
 
         /*
-         * @brief: Returns a list of all types the pkmn currently has. May be empty
+         * @brief: Returns the types the pkmn currently has as a bit mask (bit i is set iff
+         * the pkmn has type i). May be 0.
          */
-        inline std::vector<type> getTypes( bool p_opponent, u8 p_slot ) const {
-            return _sides[ p_opponent ? OPPONENT_SIDE : PLAYER_SIDE ].getTypes( p_slot );
+        constexpr u32 getTypeMask( bool p_opponent, u8 p_slot ) const {
+            return _sides[ p_opponent ? OPPONENT_SIDE : PLAYER_SIDE ].getTypeMask( p_slot );
         }
 
         /*
@@ -781,7 +860,7 @@ namespace BATTLE {
                         .c_str( ),
                     itemname.c_str( ), itemname.c_str( ) );
                 p_ui->log( buffer );
-                WAIT( HALF_SEC );
+                p_ui->wait( HALF_SEC );
                 boosts bt = boosts( );
                 bt.setBoost( DEF, 7 );
                 auto res = addBoosts( p_sourceOpp, p_sorceSlot, bt );
@@ -797,7 +876,7 @@ namespace BATTLE {
                         .c_str( ),
                     itemname.c_str( ), itemname.c_str( ) );
                 p_ui->log( buffer );
-                WAIT( HALF_SEC );
+                p_ui->wait( HALF_SEC );
                 boosts bt = boosts( );
                 bt.setBoost( SDEF, 7 );
                 auto res = addBoosts( p_sourceOpp, p_sorceSlot, bt );
@@ -813,7 +892,7 @@ namespace BATTLE {
                         .c_str( ),
                     itemname.c_str( ), itemname.c_str( ) );
                 p_ui->log( buffer );
-                WAIT( HALF_SEC );
+                p_ui->wait( HALF_SEC );
                 boosts bt = boosts( );
                 bt.setBoost( ATK, 7 );
                 auto res = addBoosts( p_sourceOpp, p_sorceSlot, bt );
@@ -829,7 +908,7 @@ namespace BATTLE {
                         .c_str( ),
                     itemname.c_str( ), itemname.c_str( ) );
                 p_ui->log( buffer );
-                WAIT( HALF_SEC );
+                p_ui->wait( HALF_SEC );
                 boosts bt = boosts( );
                 bt.setBoost( SATK, 7 );
                 auto res = addBoosts( p_sourceOpp, p_sorceSlot, bt );
@@ -845,7 +924,7 @@ namespace BATTLE {
                         .c_str( ),
                     itemname.c_str( ), itemname.c_str( ) );
                 p_ui->log( buffer );
-                WAIT( HALF_SEC );
+                p_ui->wait( HALF_SEC );
                 boosts bt = boosts( );
                 bt.setBoost( SPEED, 7 );
                 auto res = addBoosts( p_sourceOpp, p_sorceSlot, bt );
@@ -861,14 +940,14 @@ namespace BATTLE {
                         .c_str( ),
                     itemname.c_str( ), itemname.c_str( ) );
                 p_ui->log( buffer );
-                WAIT( HALF_SEC );
+                p_ui->wait( HALF_SEC );
                 addVolatileStatus( p_ui, p_sourceOpp, p_sorceSlot, VS_PROTECT, 1 );
                 snprintf(
                     buffer, TMP_BUFFER_SIZE, GET_STRING( IO::STR_UI_BATTLE_PASS_ITEM_PROTECT_PKMN ),
                     itemname.c_str( ),
                     p_ui->getPkmnName( getPkmnOrDisguise( p_sourceOpp, p_sorceSlot ), p_sourceOpp )
                         .c_str( ) );
-                WAIT( HALF_SEC );
+                p_ui->wait( HALF_SEC );
                 return;
             }
                 [[likely]] default : break;
@@ -888,7 +967,7 @@ namespace BATTLE {
                 p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_slot ), p_opponent ).c_str( ),
                 FS::getItemName( p_item ).c_str( ) );
             p_ui->log( buffer );
-            WAIT( HALF_SEC );
+            p_ui->wait( HALF_SEC );
         }
 
         /*
@@ -0,0 +1,79 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleRandom.h
+author      : Philip Wellnitz
+description : Seedable pseudo random number generator for battles.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <nds/ndstypes.h>
+
+namespace BATTLE {
+    /*
+     * @brief: xoshiro128** generator; all random decisions of a battle are drawn from
+     * such a generator, so that a battle with the same seed and the same player choices
+     * plays out the same way (see battleReplay). Only uses 32 bit operations.
+     */
+    class battleRandom {
+        u32 _state[ 4 ];
+
+        static constexpr u32 rotl( u32 p_x, u8 p_k ) {
+            return ( p_x << p_k ) | ( p_x >> ( 32 - p_k ) );
+        }
+
+      public:
+        constexpr battleRandom( u32 p_seed = 0 ) : _state{ } {
+            seed( p_seed );
+        }
+
+        /*
+         * @brief: Resets the generator; the state is derived from the seed via
+         * splitmix32, so that similar seeds yield unrelated sequences.
+         */
+        constexpr void seed( u32 p_seed ) {
+            for( u8 i = 0; i < 4; ++i ) {
+                u32 z = ( p_seed += 0x9E3779B9 );
+                z     = ( z ^ ( z >> 16 ) ) * 0x85EBCA6B;
+                z     = ( z ^ ( z >> 13 ) ) * 0xC2B2AE35;
+
+                _state[ i ] = z ^ ( z >> 16 );
+            }
+        }
+
+        /*
+         * @brief: Returns the next 31 bit random number (like rand( )).
+         */
+        constexpr u32 next( ) {
+            u32 res = rotl( _state[ 1 ] * 5, 7 ) * 9;
+            u32 t   = _state[ 1 ] << 9;
+
+            _state[ 2 ] ^= _state[ 0 ];
+            _state[ 3 ] ^= _state[ 1 ];
+            _state[ 1 ] ^= _state[ 2 ];
+            _state[ 0 ] ^= _state[ 3 ];
+            _state[ 2 ] ^= t;
+            _state[ 3 ] = rotl( _state[ 3 ], 11 );
+            return res >> 1;
+        }
+    };
+} // namespace BATTLE
@@ -0,0 +1,115 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleReplay.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <nds/ndstypes.h>
+
+#include "battle/battleDefines.h"
+
+namespace BATTLE {
+    constexpr u16 MAX_REPLAY_CHOICES = 512;
+
+    /*
+     * @brief: A choice of the player, packed into 4 bytes.
+     */
+    struct battleChoice {
+        u16 m_param;
+        u8  m_type;
+        u8  m_positions; // user (bits 0-2), target (bits 3-5), mega evolution (bit 6)
+    };
+
+    /*
+     * @brief: Log of a battle: the seed of the battle's random number generators and the
+     * choices of the player (moves, switches, runs and captures, in the order in which
+     * the battle asked for them). Starting a battle with the same teams and policy from
+     * the log plays out exactly like the recorded battle. Medicine that the bag applies
+     * right away isn't part of the log; using it makes the log incomplete.
+     */
+    class battleReplay {
+        u32          _seed       = 0;
+        u16          _count      = 0;
+        u16          _next       = 0; // choice to be returned by the next call to next
+        bool         _incomplete = false;
+        battleChoice _choices[ MAX_REPLAY_CHOICES ];
+
+      public:
+        /*
+         * @brief: Clears the log; the battle to be recorded uses the given seed.
+         */
+        void reset( u32 p_seed );
+
+        /*
+         * @brief: Makes next start over at the first choice.
+         */
+        constexpr void rewind( ) {
+            _next = 0;
+        }
+
+        constexpr u32 getSeed( ) const {
+            return _seed;
+        }
+
+        constexpr u16 getChoiceCount( ) const {
+            return _count;
+        }
+
+        /*
+         * @brief: Returns false if the battle made more than MAX_REPLAY_CHOICES choices
+         * (the surplus choices weren't recorded) or if the player used an item from the
+         * bag outside of the log. Incomplete logs can't be replayed.
+         */
+        constexpr bool isComplete( ) const {
+            return !_incomplete;
+        }
+
+        /*
+         * @brief: Marks the log as incomplete, e.g. after the bag changed the player's
+         * team without a choice of its own.
+         */
+        constexpr void invalidate( ) {
+            _incomplete = true;
+        }
+
+        /*
+         * @brief: Appends the given choice to the log.
+         */
+        void record( const battleMoveSelection& p_choice );
+
+        /*
+         * @brief: Reads the next recorded choice. Returns false (and leaves p_out
+         * untouched) if all choices have been read.
+         */
+        bool next( battleMoveSelection& p_out );
+
+        /*
+         * @brief: Reads the next recorded choice only if it is of the given type.
+         */
+        bool next( battleMoveSelection& p_out, battleMoveType p_type );
+    };
+
+    extern battleReplay LAST_BATTLE_REPLAY; // log of the most recent battle
+} // namespace BATTLE
@@ -0,0 +1,132 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleSearch.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <nds/ndstypes.h>
+
+#include "battle/battleDefines.h"
+#include "battle/battleField.h"
+#include "battle/battleRandom.h"
+#include "battle/battleUI.h"
+#include "pokemon.h"
+#include "save/saveGame.h"
+
+namespace BATTLE {
+    constexpr u16 SEARCH_MIN_AI_LEVEL  = 8; // AI levels from here on search for their moves
+    constexpr u16 SEARCH_DEEP_AI_LEVEL = 9; // AI levels from here on look 2 turns ahead
+
+    // Simulated turns per decision. Counted in turns rather than in cpu cycles, so that
+    // the choices of the AI don't depend on timing and battles stay replayable.
+    constexpr u16 SEARCH_NODE_BUDGET    = 32;
+    constexpr u8  MAX_SEARCH_CANDIDATES = 12; // 4 moves with up to 2 targets, 4 switches
+    constexpr u8  SEARCH_MIN_ROLLOUTS   = 3;  // per candidate; fewer are mostly noise
+
+    /*
+     * @brief: Copy of everything a turn of a battle changes: the field and both teams.
+     * Copying a snapshot doesn't allocate; the slots of the copy refer to the copy's
+     * teams.
+     */
+    class battleSnapshot {
+        field      _field;
+        pokemon    _teams[ field::NUM_SIDES ][ SAVE::NUM_PARTY_SLOTS ];
+        u8         _teamSizes[ field::NUM_SIDES ];
+        battleMode _mode;
+
+        void copy( const battleSnapshot& p_other );
+
+        /*
+         * @brief: Switches the pkmn at the given position with the p_newIndex-th pkmn of
+         * its team.
+         */
+        void switchPokemon( battleUI* p_ui, fieldPosition p_toSwitch, u8 p_newIndex );
+
+        /*
+         * @brief: Sends out the next pkmn that can battle for slots with the given
+         * status.
+         */
+        void refill( battleUI* p_ui, slot::status p_checkType );
+
+      public:
+        battleSnapshot( ) {
+        }
+
+        battleSnapshot( const battleSnapshot& p_other ) {
+            copy( p_other );
+        }
+
+        battleSnapshot& operator=( const battleSnapshot& p_other ) {
+            copy( p_other );
+            return *this;
+        }
+
+        /*
+         * @brief: Copies the given field and teams.
+         */
+        void set( const field& p_field, battleMode p_mode, const pokemon* p_playerTeam,
+                  u8 p_playerTeamSize, const pokemon* p_opponentTeam, u8 p_opponentTeamSize );
+
+        constexpr field& getField( ) {
+            return _field;
+        }
+
+        /*
+         * @brief: Returns whether the given side has a pkmn that can still battle.
+         */
+        bool canBattle( u8 p_side ) const;
+
+        /*
+         * @brief: Rates the state for the given side: remaining pkmn and their HP, minus
+         * the same for the other side.
+         */
+        s32 evaluate( u8 p_side ) const;
+
+        /*
+         * @brief: Returns an attack with a sensible target for the pkmn in the given slot,
+         * drawn uniformly from its usable moves (Struggle if there is none).
+         */
+        battleMoveSelection randomChoice( u8 p_side, u8 p_slot, battleRandom& p_rng );
+
+        /*
+         * @brief: Plays one turn with the given choices, using the ui only for the
+         * calls the battle pipeline makes (pass a headless one). Returns false if the
+         * battle ended.
+         */
+        bool playTurn( battleUI* p_ui,
+                       battleMoveSelection p_moves[ field::NUM_SIDES ][ side::MAX_PKMN_PER_SIDE ] );
+    };
+
+#ifdef DESQUID
+    struct searchStats {
+        u32 m_decisions;
+        u32 m_nodes;     // simulated turns
+        u32 m_cuts;      // decisions that searched only some of the candidates
+        u32 m_ticks;
+    };
+
+    extern searchStats SEARCH_STATS;
+#endif
+} // namespace BATTLE
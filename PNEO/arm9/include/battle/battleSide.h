@@ -37,6 +37,7 @@
 #include "battle/battleDefines.h"
 #include "battle/battleSlot.h"
 #include "battle/move.h"
+#include "battle/moveTable.h"
 #include "defines.h"
 #include "gen/abilityNames.h"
 #include "gen/pokemonNames.h"
@@ -102,10 +103,10 @@ namespace BATTLE {
         }
 
         /*
-         * @brief: Returns a list of all types the pkmn currently has. May be empty
+         * @brief: Returns the types the pkmn currently has as a bit mask. May be 0.
          */
-        inline std::vector<type> getTypes( u8 p_slot ) const {
-            return _slots[ p_slot ].getTypes( );
+        constexpr u32 getTypeMask( u8 p_slot ) const {
+            return _slots[ p_slot ].getTypeMask( );
         }
 
         /*
@@ -128,7 +129,7 @@ namespace BATTLE {
 #ifdef DESQUID_MORE
                         // TODO: proper log
                         p_ui->log( "Set side condition " + std::to_string( 1LLU << i ) );
-                        WAIT( HALF_SEC );
+                        p_ui->wait( HALF_SEC );
 #else
                         (void) p_ui;
 #endif
@@ -148,7 +149,7 @@ namespace BATTLE {
 #ifdef DESQUID_MORE
                     // TODO: proper log
                     p_ui->log( "Remove side condition " + std::to_string( 1LLU << i ) );
-                    WAIT( HALF_SEC );
+                    p_ui->wait( HALF_SEC );
 #else
                     (void) p_ui;
 #endif
@@ -238,6 +239,12 @@ namespace BATTLE {
             _slots[ p_slot ].setDisguise( p_pokemon );
         }
 
+        inline void relocate( const pokemon* p_from, pokemon* p_to, u8 p_count ) {
+            for( u8 i = 0; i < MAX_PKMN_PER_SIDE; ++i ) {
+                _slots[ i ].relocate( p_from, p_to, p_count );
+            }
+        }
+
         /*
          * @brief: Returns the pkmn in the specified slot or nullptr if the slot is empty.
          */
@@ -332,7 +339,7 @@ namespace BATTLE {
             _slots[ p_slot ].setLastUsedMove( p_move );
         }
 
-        inline battleMove getLastUsedMove( u8 p_slot ) const {
+        constexpr battleMoveSelection getLastUsedMove( u8 p_slot ) const {
             return _slots[ p_slot ].getLastUsedMove( );
         }
 
@@ -407,7 +414,7 @@ namespace BATTLE {
         constexpr bool canSelectMove( u8 p_slot, u8 p_moveIdx ) {
 
             if( getPkmn( !p_slot ) == nullptr
-                && FS::getMoveData( getPkmn( p_slot )->getMove( p_moveIdx ) ).m_target == TG_ALLY )
+                && MOVE_TABLE.get( getPkmn( p_slot )->getMove( p_moveIdx ) ).m_target == TG_ALLY )
                 [[unlikely]] {
                 return false;
             }
@@ -37,6 +37,7 @@
 #include "battle/battleDefines.h"
 #include "battle/battleUI.h"
 #include "battle/move.h"
+#include "battle/moveTable.h"
 #include "fs/data.h"
 #include "gen/abilityNames.h"
 #include "gen/pokemonNames.h"
@@ -72,12 +73,13 @@ namespace BATTLE {
 
         battleMoveSelection _lockedMove; // move that a pkmn is forced to execute (no op if hib)
         u8                  _lockedMoveTurns; // remaining turns the pkmn is locked into _lockedMove
-        battleMove          _lastMove;        // Last used moves
+        battleMoveSelection _lastMove;        // Last used moves
         u8                  _consecutiveMoveCount;
         u16                 _disabledMove; // move that was disabled
         pkmnData            _pkmnData;
-        std::vector<type>   _altTypes;  // Type(s) the pkmn changed into
-        type                _extraType; // Additional type due to forest's curse or trick-or-treat
+        type                _altType;    // Type the pkmn changed into
+        bool                _hasAltType; // false: the pkmn lost all its types
+        type                _extraType;  // Additional type due to forest's curse or trick-or-treat
 
         u16 _usedItem = 0; // (held) item the pkmn used
 
@@ -128,10 +130,10 @@ namespace BATTLE {
             _slotCondition        = slotCondition( 0 );
             _isTransformed        = false;
             _boosts               = boosts( );
-            _lastMove             = battleMove( );
+            _lastMove             = NO_OP_SELECTION;
             _disabledMove         = 0;
             _disguise             = nullptr;
-            _altTypes.clear( );
+            _hasAltType           = false;
             std::memset( &_transformedPkmn, 0, sizeof( pokemon ) );
             std::memset( _volatileStatusCounter, 0, sizeof( _volatileStatusCounter ) );
             std::memset( _slotConditionCounter, 0, sizeof( _slotConditionCounter ) );
@@ -142,7 +144,8 @@ namespace BATTLE {
          * @brief: Sets the type of the specified pkmn.
          */
         inline void setType( battleUI* p_ui, type p_type ) {
-            _altTypes = { p_type };
+            _altType    = p_type;
+            _hasAltType = true;
             addVolatileStatus( p_ui, VS_REPLACETYPE, -1 );
         }
 
@@ -155,15 +158,14 @@ namespace BATTLE {
         }
 
         /*
-         * @brief: Returns a list of all types the pkmn currently has. May be empty
+         * @brief: Returns the types the pkmn currently has as a bit mask (bit i is set iff
+         * the pkmn has type i). May be 0.
          */
-        inline std::vector<type> getTypes( ) const {
-            std::vector<type> res = std::vector<type>( );
-
+        constexpr u32 getTypeMask( ) const {
+            u32 res = 0;
             for( u8 i = 0; i < NUM_TYPES; ++i ) {
-                if( hasType( type( i ) ) ) { res.push_back( type( i ) ); }
+                if( hasType( type( i ) ) ) { res |= 1 << i; }
             }
-
             return res;
         }
 
@@ -171,8 +173,12 @@ namespace BATTLE {
             return _extraType;
         }
 
-        inline std::vector<type> getAltTypes( ) const {
-            return _altTypes;
+        constexpr type getAltType( ) const {
+            return _altType;
+        }
+
+        constexpr bool hasAltType( ) const {
+            return _hasAltType;
         }
 
         /*
@@ -201,10 +207,7 @@ namespace BATTLE {
             }
 
             if( _volatileStatusCounter[ 56 ] ) [[unlikely]] { // replace type
-                for( auto t : _altTypes ) {
-                    if( p_type == t ) { return true; }
-                }
-                return false;
+                return _hasAltType && p_type == _altType;
             }
 
             if( _pkmnData.m_baseForme.m_types[ 0 ] == p_type
@@ -217,16 +220,18 @@ namespace BATTLE {
         /*
          * @brief: Sets the move the specified pkmn used last.
          */
-        inline void setLastUsedMove( battleMove p_move ) {
+        inline void setLastUsedMove( const battleMove& p_move ) {
             if( _lastMove.m_param == p_move.m_param ) {
                 _consecutiveMoveCount++;
             } else {
                 _consecutiveMoveCount = 0;
             }
-            _lastMove = p_move;
+            _lastMove = { p_move.m_type, p_move.m_param, fieldPosition( 255, 255 ),
+                          p_move.m_user, p_move.m_megaEvolve, p_move.m_moveData };
+            if( !p_move.m_target.empty( ) ) { _lastMove.m_target = p_move.m_target[ 0 ]; }
         }
 
-        inline battleMove getLastUsedMove( ) const {
+        constexpr battleMoveSelection getLastUsedMove( ) const {
             return _lastMove;
         }
 
@@ -244,10 +249,10 @@ namespace BATTLE {
                 _lockedMoveTurns      = 0;
                 _slotCondition        = slotCondition( 0 );
                 _isTransformed        = false;
-                _lastMove             = battleMove( );
+                _lastMove             = NO_OP_SELECTION;
                 _consecutiveMoveCount = 0;
                 _disabledMove         = 0;
-                _altTypes.clear( );
+                _hasAltType           = false;
                 std::memset( &_transformedPkmn, 0, sizeof( pokemon ) );
             }
             _status = RECALLED;
@@ -775,7 +780,7 @@ namespace BATTLE {
             auto volstat = getVolatileStatus( );
 
             if( ( volstat & VS_TAUNT ) || pkmn->getItem( ) == I_ASSAULT_VEST ) [[unlikely]] {
-                if( FS::getMoveData( mv ).m_category == MH_STATUS ) { return false; }
+                if( MOVE_TABLE.get( mv ).m_category == MH_STATUS ) { return false; }
             }
 
             if( volstat & VS_DISABLE ) [[unlikely]] { // Disable
@@ -887,6 +892,19 @@ namespace BATTLE {
             _disguise = p_pokemon;
         }
 
+        /*
+         * @brief: Makes the slot use the copies in p_to of its pkmn and its disguise if
+         * they are part of the team p_from (of p_count pkmn).
+         */
+        inline void relocate( const pokemon* p_from, pokemon* p_to, u8 p_count ) {
+            if( _pokemon >= p_from && _pokemon < p_from + p_count ) {
+                _pokemon = p_to + ( _pokemon - p_from );
+            }
+            if( _disguise >= p_from && _disguise < p_from + p_count ) {
+                _disguise = p_to + ( _disguise - p_from );
+            }
+        }
+
         /*
          * @brief: Returns the pkmn currently in the slot (or nullptr if the slot is
          * empty)
@@ -973,9 +991,10 @@ namespace BATTLE {
                     }
                 }
 
-                _extraType = p_target->getExtraType( );
-                _altTypes  = p_target->getAltTypes( );
-                _boosts    = p_target->getBoosts( );
+                _extraType  = p_target->getExtraType( );
+                _altType    = p_target->getAltType( );
+                _hasAltType = p_target->hasAltType( );
+                _boosts     = p_target->getBoosts( );
             } else {
                 _isTransformed = false;
                 std::memset( &_transformedPkmn, 0, sizeof( pokemon ) );
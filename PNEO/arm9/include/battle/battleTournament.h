@@ -0,0 +1,80 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleTournament.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <cstdio>
+#include <nds.h>
+#include <nds/ndstypes.h>
+
+#include "pokemon.h"
+
+namespace BATTLE {
+    constexpr u8 TOURNAMENT_DIFFICULTIES   = 3; // directories of trainer teams
+    constexpr u8 TOURNAMENT_FACILITY_RULES = 2; // single battles at lv 50 and lv 100
+    constexpr u8 TOURNAMENT_STREAKS        = 2;
+
+    constexpr u16 TOURNAMENT_STREAK[ TOURNAMENT_STREAKS ] = { 50, 100 };
+
+    struct tournamentResult {
+        u16 m_matchups; // matchups played (by this shard)
+        u16 m_failed;   // facility matchups skipped since the sets of the tier ran out
+        u32 m_battles;
+        u32 m_playerWins;
+        u32 m_rounds;
+#ifdef DESQUID
+        u16 m_replayMismatches; // matchups whose last battle replayed differently
+#endif
+    };
+
+    /*
+     * @brief: Returns the seed of the first battle of the given matchup. Seeds depend
+     * only on the matchup, so a matchup yields the same results no matter which shard
+     * plays it or which matchups were played before.
+     */
+    u32 tournamentSeed( u8 p_kind, u16 p_id, u8 p_variant );
+
+    /*
+     * @brief: Plays p_battles simulated battles of the given team for every matchup of
+     * a balance sweep: each trainer [1, p_lastTrainer] at each difficulty that has a team
+     * for the trainer, and the battle facility at streaks of 50 and 100 (with a freshly
+     * drawn opponent team per battle; the player's team is set to the level of the
+     * facility). As in the game, opponent teams are drawn from random species of the tier
+     * if the ROM has no sets for it; facility matchups whose sets don't suffice for a
+     * team are skipped and counted as failed.
+     *
+     * Matchups are numbered in the above order; only those whose number is p_shard
+     * modulo p_numShards are played, so that a sweep can be split between several
+     * consoles or emulator instances.
+     *
+     * Writes one CSV row per matchup to p_out, followed by the number of times each
+     * move was used in the battles of this shard. The matchup rows of several shards
+     * can be concatenated; the move counts need to be summed per move.
+     */
+    tournamentResult runTournament( const pokemon* p_team, u8 p_teamSize, u16 p_lastTrainer,
+                                    u16 p_battles, FILE* p_out, u16 p_shard = 0,
+                                    u16 p_numShards = 1 );
+} // namespace BATTLE
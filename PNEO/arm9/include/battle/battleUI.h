@@ -37,12 +37,27 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "save/saveGame.h"
 
 namespace BATTLE {
+    /*
+     * @brief: Name of a pkmn as used in battle messages. Lives on the stack, so that
+     * building a message doesn't allocate.
+     */
+    struct pkmnName {
+        static constexpr u8 MAX_LENGTH = 50;
+
+        char m_name[ MAX_LENGTH ];
+
+        constexpr const char* c_str( ) const {
+            return m_name;
+        }
+    };
+
     class battleUI {
         u8             _platform;
         u8             _platform2;
         u8             _background;
         battleMode     _mode;
         bool           _isWildBattle;
+        bool           _headless      = false; // neither draws anything nor waits
         battleTrainer* _battleTrainer = nullptr;
 
         u8 _currentLogLine = 0;
@@ -97,9 +112,25 @@ namespace BATTLE {
         }
 
         battleUI( u8 p_platform, u8 p_platform2, u8 p_background, battleMode p_mode,
-                  bool p_isWildBattle )
+                  bool p_isWildBattle, bool p_headless = false )
             : _platform( p_platform ), _platform2( p_platform2 ), _background( p_background ),
-              _mode( p_mode ), _isWildBattle( p_isWildBattle ) {
+              _mode( p_mode ), _isWildBattle( p_isWildBattle ), _headless( p_headless ) {
+        }
+
+        /*
+         * @brief: Returns whether the UI is headless, i.e. all drawing, animations, logs
+         * and waits are skipped (used to simulate battles without any output).
+         */
+        constexpr bool isHeadless( ) const {
+            return _headless;
+        }
+
+        /*
+         * @brief: Waits for the given number of frames (no-op if the UI is headless).
+         */
+        inline void wait( u16 p_frames ) const {
+            if( _headless ) { return; }
+            WAIT( p_frames );
         }
 
         /*
@@ -113,8 +144,8 @@ namespace BATTLE {
         /*
          * @brief: Returns a string correctly describing the given pkmn.
          */
-        std::string getPkmnName( pokemon* p_pokemon, bool p_opponent,
-                                 bool p_sentenceStart = true ) const;
+        pkmnName getPkmnName( pokemon* p_pokemon, bool p_opponent,
+                              bool p_sentenceStart = true ) const;
 
         /*
          * @brief: Plays an animation that the pkmn at the specified slot obtains
@@ -157,7 +188,11 @@ namespace BATTLE {
         /*
          * @brief: prints the given message to the battle log.
          */
-        void log( std::string p_message );
+        void log( const char* p_message );
+
+        inline void log( const std::string& p_message ) {
+            log( p_message.c_str( ) );
+        }
 
         /*
          * @brief: Logs the boosts the given pkmn obtains.
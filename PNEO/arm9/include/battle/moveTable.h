@@ -0,0 +1,107 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : moveTable.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <nds/ndstypes.h>
+
+#include "battle/battleDefines.h"
+#include "pokemon.h"
+#include "save/saveGame.h"
+
+namespace BATTLE {
+    // every move of up to 2 teams, struggle, and room for moves that only come up
+    // during the battle (e.g. via metronome)
+    constexpr u8 MAX_TABLE_MOVES = 2 * SAVE::NUM_PARTY_SLOTS * 4 + 16;
+
+    /*
+     * @brief: Data of all moves the pkmn of the current battle know, read in one pass
+     * when the battle starts, so that battle code doesn't need to access the move data
+     * file during turns. Moves that aren't in the table are read from the file (and
+     * added to the table while there is room). Outside of battles, get just reads the
+     * file.
+     */
+    class moveTable {
+        u16      _ids[ MAX_TABLE_MOVES ]; // sorted
+        moveData _data[ MAX_TABLE_MOVES ];
+        u8       _count  = 0;
+        bool     _loaded = false;
+
+#ifdef DESQUID
+        u32 _hits      = 0;
+        u32 _fileReads = 0; // reads while the table was loaded
+#endif
+
+        /*
+         * @brief: Returns the position of the given move in _ids or the position where
+         * it needs to be inserted.
+         */
+        u8 find( u16 p_moveId ) const;
+
+        /*
+         * @brief: Reads the given move from the file and adds it to the table.
+         */
+        const moveData& insert( u8 p_pos, u16 p_moveId );
+
+      public:
+        /*
+         * @brief: Fills the table with the moves of the given teams (and struggle).
+         */
+        void load( const pokemon* p_team1, u8 p_teamSize1, const pokemon* p_team2,
+                   u8 p_teamSize2 );
+
+        /*
+         * @brief: Empties the table; get reads from the file again.
+         */
+        void clear( );
+
+        /*
+         * @brief: Returns the data of the given move.
+         */
+        moveData get( u16 p_moveId );
+
+#ifdef DESQUID
+        /*
+         * @brief: Returns the number of moves that had to be read from the file while
+         * the table was loaded, i.e. during turns.
+         */
+        constexpr u32 getFileReads( ) const {
+            return _fileReads;
+        }
+
+        constexpr u32 getHits( ) const {
+            return _hits;
+        }
+
+        void resetStats( ) {
+            _hits      = 0;
+            _fileReads = 0;
+        }
+#endif
+    };
+
+    extern moveTable MOVE_TABLE;
+} // namespace BATTLE
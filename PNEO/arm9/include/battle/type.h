@@ -108,4 +108,50 @@ namespace BATTLE {
     constexpr u8 getTypeEffectiveness( type p_t1, type p_t2 ) { // t1 is moving
         return TypeEffectiveness[ (u8) p_t1 ][ (u8) p_t2 ];
     }
+
+    /*
+     * @brief: Effectiveness (in percent) of moves of each type on pkmn of each pair of
+     * types; the same as applying the effectiveness of both types one after the other
+     * (rounding down). Pkmn with a single type use it for both.
+     */
+    struct dualTypeEffectiveness {
+        u16 m_values[ NUM_TYPES ][ NUM_TYPES ][ NUM_TYPES ];
+
+        constexpr dualTypeEffectiveness( ) : m_values( ) {
+            for( u8 a = 0; a < NUM_TYPES; ++a ) {
+                for( u8 t1 = 0; t1 < NUM_TYPES; ++t1 ) {
+                    for( u8 t2 = 0; t2 < NUM_TYPES; ++t2 ) {
+                        m_values[ a ][ t1 ][ t2 ]
+                            = t1 == t2 ? TypeEffectiveness[ a ][ t1 ]
+                                       : TypeEffectiveness[ a ][ t1 ] * TypeEffectiveness[ a ][ t2 ]
+                                             / 100;
+                    }
+                }
+            }
+        }
+    };
+
+    inline constexpr dualTypeEffectiveness DUAL_TYPE_EFFECTIVENESS = dualTypeEffectiveness( );
+
+    /*
+     * @brief: Computes how effective a move of type p_t1 is on a pkmn with the types in
+     * the bit mask p_types (bit i set: pkmn has type i), in percent.
+     */
+    constexpr u16 getEffectivenessOnTypes( type p_t1, u32 p_types ) {
+        if( !p_types ) { return 100; }
+
+        u8 first = __builtin_ctz( p_types );
+        p_types &= p_types - 1;
+        if( !p_types ) { return DUAL_TYPE_EFFECTIVENESS.m_values[ p_t1 ][ first ][ first ]; }
+
+        u8 second = __builtin_ctz( p_types );
+        p_types &= p_types - 1;
+        u16 res   = DUAL_TYPE_EFFECTIVENESS.m_values[ p_t1 ][ first ][ second ];
+
+        // a third type (e.g. due to forest's curse)
+        for( ; p_types; p_types &= p_types - 1 ) {
+            res = res * TypeEffectiveness[ p_t1 ][ __builtin_ctz( p_types ) ] / 100;
+        }
+        return res;
+    }
 } // namespace BATTLE
@@ -28,6 +28,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 #include <vector>
 #include "box/box.h"
+#include "io/spriteAllocator.h"
 #include "io/uio.h"
 
 namespace BOX {
@@ -38,6 +39,8 @@ namespace BOX {
         u8         _currentSelection;
         boxPokemon _heldPkmn;
         u16        _outlineColor = 0xF4A0;
+        u16        _placeholderTile;
+        u8         _iconAssets[ MAX_PKMN_PER_BOX + 6 ]; // box pkmn, then team pkmn
 
         void initTop( );
         void initSub( );
@@ -56,6 +59,18 @@ namespace BOX {
         void writeLineTop( const char* p_string, u8 p_line, u8 p_color = 252,
                            bool p_bottom = false );
 
+        /*
+         * @brief: Shows the icon of the given pkmn at position p_index (hides the icon
+         * if p_pokemon is nullptr). Icons stay in vram after their pkmn left, so that
+         * they don't need to be loaded again if the pkmn reappears.
+         */
+        void drawPkmnIcon( boxPokemon* p_pokemon, u8 p_index, ObjPriority p_priority );
+
+        /*
+         * @brief: Shows the placeholder icon at position p_index.
+         */
+        void drawPlaceholderIcon( u8 p_index, ObjPriority p_priority );
+
       public:
         enum button {
             BUTTON_LEFT,
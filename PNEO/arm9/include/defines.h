@@ -44,9 +44,13 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 
 #ifdef DESQUID
 #define DESQUID_LOG( p_msg ) IO::printMessage( p_msg )
+// halts with an error screen if the condition doesn't hold
+#define DESQUID_ASSERT( p_cond, p_msg ) sassert( p_cond, p_msg )
 #else
 #define DESQUID_LOG( p_msg ) \
     {}
+#define DESQUID_ASSERT( p_cond, p_msg ) \
+    {}
 #endif
 
 struct fsdataInfo {
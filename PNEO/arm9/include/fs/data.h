@@ -169,7 +169,13 @@ namespace FS {
 
     BATTLE::battleTrainer getBattleTrainer( u16 p_battleTrainerId );
     BATTLE::battleTrainer getBattleTrainer( u16 p_battleTrainerId, u8 p_language );
-    bool getBattleTrainer( u16 p_battleTrainerId, u8 p_language, BATTLE::battleTrainer* p_out );
+    /*
+     * @brief: Loads the specified trainer; the team is read from the directory of the
+     * given difficulty, or of the normal difficulty if the trainer has no team there.
+     * If p_directory is given, the index of the directory actually used is stored in it.
+     */
+    bool getBattleTrainer( u16 p_battleTrainerId, u8 p_language, BATTLE::battleTrainer* p_out,
+                           u8 p_difficulty, u8* p_directory = nullptr );
 
     bool getBattleFacilityTrainer( u16 p_battleTrainerId, u8 p_language,
                                    BATTLE::battleTrainer* p_out );
@@ -233,12 +239,22 @@ namespace FS {
     const char* getRibbonDescr( const u16 p_ribbonId );
 
     /*
-     * @brief: loads the specified variant of the specified pkmn.
-     * @param p_streak: Determines IVs given to the pkmn.
+     * @brief: Loads up to p_maxCount pre-built battle facility sets of the given tier.
+     * @returns: The number of sets loaded.
+     */
+    u16 loadBattleFacilitySets( u8 p_tier, MAP::facilitySet* p_out, u16 p_maxCount );
+
+    /*
+     * @brief: loads the specified variant of the specified pkmn. If the ROM has no sets
+     * for the streak's tier, a placeholder set of the species is used.
+     * @param p_streak: Determines IVs given to the pkmn and the tier of the set.
      */
     bool loadBattleFacilityPkmn( u16 p_species, u8 p_variant, u8 p_level, u16 p_streak,
                                  trainerPokemon* p_out );
 
+    /*
+     * @brief: Loads the p_team-th team of the given trainer class for the given streak.
+     */
     bool loadBattleFacilityTrainerTeam( const MAP::ruleSet& p_rules, u8 p_trainerClass, u8 p_team,
                                         u16 p_streak, BATTLE::battleTrainer* p_out );
 
@@ -0,0 +1,151 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : backBuffer.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <nds.h>
+#include <nds/ndstypes.h>
+
+#include "defines.h"
+
+namespace IO {
+    constexpr u8 BACK_BUFFER_DMA_CHANNEL = 1;
+
+    /*
+     * @brief: Main RAM copy of a single 8bpp bitmap layer that UI screens can opt in
+     * to. While enabled, setPixel, printRectangle(s), blit8 and font::printChar draw
+     * to the copy and record the changed span of every line; the changed spans are
+     * copied to vram once nothing has been drawn for a whole frame (or on flush).
+     * This only hides partially drawn frames if the drawing code doesn't pause for a
+     * whole frame in between (e.g. to wait for a vblank or to read from the file
+     * system); such code should call flush once it is done.
+     *
+     * Only the visible lines are tracked: drawing to lines SCREEN_HEIGHT and below of
+     * the layer ends up in the copy, but never in vram.
+     */
+    class backBuffer {
+        u16  _buffer[ SCREEN_WIDTH * 256 / 2 ];
+        u8   _dirtyFrom[ SCREEN_HEIGHT ]; // first changed pixel of each line
+        u8   _dirtyTo[ SCREEN_HEIGHT ];   // last changed pixel of each line
+        u8   _dirtyMinY = SCREEN_HEIGHT;
+        u8   _dirtyMaxY = 0;
+        bool _active    = false;
+        bool _bottom    = false;
+        u8   _layer     = 0;
+
+        volatile bool _drawnThisFrame = false;
+
+#ifdef DESQUID
+        u32 _flushes    = 0;
+        u32 _totalBytes = 0;
+        u32 _lastBytes  = 0;
+#endif
+
+        void _markDirty( u16 p_x1, u16 p_y1, u16 p_x2, u16 p_y2 );
+
+        void _clearDirty( );
+
+        void _copy( );
+
+        static u16* _vram( bool p_bottom, u8 p_layer ) {
+            return p_bottom ? BG_BMP_RAM_SUB( p_layer ) : BG_BMP_RAM( p_layer );
+        }
+
+      public:
+        /*
+         * @brief: Redirects all drawing to the specified layer to the back buffer,
+         * which is initialized with the layer's current contents.
+         */
+        void enable( bool p_bottom, u8 p_layer = 1 );
+
+        /*
+         * @brief: Copies all pending changes to vram (unless p_flush is false, e.g. if
+         * the layer is about to be cleared anyway) and lets all drawing go to vram
+         * directly again.
+         */
+        void disable( bool p_flush = true );
+
+        constexpr bool isActive( ) const {
+            return _active;
+        }
+
+        constexpr bool isActive( bool p_bottom ) const {
+            return _active && _bottom == p_bottom;
+        }
+
+        constexpr bool isActive( bool p_bottom, u8 p_layer ) const {
+            return _active && _bottom == p_bottom && _layer == p_layer;
+        }
+
+        constexpr bool contains( const void* p_ptr ) const {
+            return p_ptr >= _buffer && p_ptr < _buffer + sizeof( _buffer ) / sizeof( u16 );
+        }
+
+        /*
+         * @brief: Returns the bitmap that drawing to the rectangle (p_x1, p_y1) -
+         * (p_x2, p_y2) (inclusive bounds) of the specified layer has to go to and marks
+         * the rectangle (clipped to the visible lines) as changed if that is the back
+         * buffer.
+         */
+        inline u16* bitmap( bool p_bottom, u8 p_layer, u16 p_x1, u16 p_y1, u16 p_x2,
+                            u16 p_y2 ) {
+            if( !isActive( p_bottom, p_layer ) ) { return _vram( p_bottom, p_layer ); }
+            _markDirty( p_x1, p_y1, p_x2, p_y2 );
+            return _buffer;
+        }
+
+        /*
+         * @brief: Copies the changed spans to vram. If p_waitForVBlank is set, the copy
+         * starts at the next vblank.
+         */
+        void flush( bool p_waitForVBlank = true );
+
+        /*
+         * @brief: To be called from the vblank interrupt; flushes the changes once
+         * nothing has been drawn for a whole frame.
+         */
+        void vblank( );
+
+#ifdef DESQUID
+        /*
+         * @brief: Shows the number of flushes and the number of bytes copied to vram
+         * in the message box.
+         */
+        void printStats( ) const;
+#endif
+    };
+
+    extern backBuffer BACK_BUFFER;
+
+    /*
+     * @brief: Disables the back buffer once it goes out of scope.
+     */
+    struct backBufferScope {
+        ~backBufferScope( ) {
+            BACK_BUFFER.disable( );
+        }
+    };
+} // namespace IO
@@ -0,0 +1,102 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : decodedSpriteCache.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <nds.h>
+#include <nds/ndstypes.h>
+
+#include "defines.h"
+
+namespace IO {
+    constexpr u32 DECODED_SPRITE_CACHE_BYTES   = 48 * 1024;
+    constexpr u8  DECODED_SPRITE_CACHE_ENTRIES = 24;
+
+    // bits of the pid that affect the color variation and spinda's spots
+    constexpr u32 SPRITE_PID_VARIANT_MASK = 0x7FF;
+
+    constexpr u64 decodedSpriteKey( u8 p_source, const pkmnSpriteInfo& p_pkmn ) {
+        return ( u64( p_source ) << 40 ) | ( u64( p_pkmn.m_pkmnIdx & 0x7FF ) << 29 )
+               | ( u64( p_pkmn.m_forme ) << 21 ) | ( u64( !!p_pkmn.m_female ) << 20 )
+               | ( u64( !!p_pkmn.m_shiny ) << 19 ) | ( p_pkmn.m_pid & SPRITE_PID_VARIANT_MASK );
+    }
+
+    /*
+     * @brief: LRU cache (in main RAM) of pkmn sprites that have been read from the file
+     * system and recolored according to their pid, so that sprites that are shown
+     * again don't need any I/O. Entries are identified by a key as returned by
+     * decodedSpriteKey; the cache holds at most DECODED_SPRITE_CACHE_BYTES bytes of
+     * image data.
+     */
+    class decodedSpriteCache {
+        struct entry {
+            u64  m_key;
+            u32* m_data = nullptr;
+            u16  m_size; // in u32
+            u16  m_lastUse;
+            u16  m_palette[ 16 ];
+        };
+
+        entry _entries[ DECODED_SPRITE_CACHE_ENTRIES ];
+        u32   _usedBytes = 0;
+        u16   _clock     = 0;
+
+#ifdef DESQUID
+        u32 _hits      = 0;
+        u32 _misses    = 0;
+        u32 _evictions = 0;
+#endif
+
+        /*
+         * @brief: Frees the least recently used entry; returns false if the cache is
+         * empty.
+         */
+        bool _evict( );
+
+      public:
+        /*
+         * @brief: Copies the sprite with the given key (p_size u32 of image data) to
+         * TEMP and its palette to TEMP_PAL. Returns false if the sprite isn't cached.
+         */
+        bool load( u64 p_key, u16 p_size );
+
+        /*
+         * @brief: Caches the sprite currently in TEMP and TEMP_PAL under the given key,
+         * evicting the least recently used sprites if necessary.
+         */
+        void store( u64 p_key, u16 p_size );
+
+#ifdef DESQUID
+        /*
+         * @brief: Shows the number of cached sprites, the memory used, the hit rate and
+         * the number of evicted sprites in the message box.
+         */
+        void printStats( ) const;
+#endif
+    };
+
+    extern decodedSpriteCache DECODED_SPRITE_CACHE;
+} // namespace IO
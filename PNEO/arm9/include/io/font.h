@@ -28,47 +28,152 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 #include <nds.h>
 
+#include "defines.h"
+
 namespace IO {
     typedef u16 color;
 
+    constexpr u8 GLYPH_BPP = 3;
+
+    /*
+     * @brief: A glyph in a packed font; only the bounding box of the glyph's visible
+     * pixels is stored, row by row with GLYPH_BPP bits per pixel (see tools/fontpack.py).
+     */
+    struct packedGlyph {
+        u16 m_offset; // offset of the glyph's first pixel in the font data (in bytes)
+        u8  m_left;
+        u8  m_top;
+        u8  m_width;
+        u8  m_height;
+    };
+
     namespace REGULAR_FONT {
-        constexpr auto NUM_CHARS = 490;
-        void           shiftchar( u16 &val );
-        extern u8      fontWidths[ NUM_CHARS ];
-        extern u8      fontData[ NUM_CHARS * 256 ];
+        constexpr auto           NUM_CHARS = 490;
+        extern const u16 *const  charPages[ 256 ];
+        extern u8                fontWidths[ NUM_CHARS ];
+        extern const packedGlyph glyphs[ NUM_CHARS ];
+        extern const u8          fontData[ ];
     } // namespace REGULAR_FONT
     namespace BOLD_FONT {
-        constexpr auto NUM_CHARS = 490;
-        void           shiftchar( u16 &val );
-        extern u8      fontWidths[ NUM_CHARS ];
-        extern u8      fontData[ NUM_CHARS * 256 ];
+        constexpr auto           NUM_CHARS = 490;
+        extern const u16 *const  charPages[ 256 ];
+        extern u8                fontWidths[ NUM_CHARS ];
+        extern const packedGlyph glyphs[ NUM_CHARS ];
+        extern const u8          fontData[ ];
     } // namespace BOLD_FONT
     namespace SMALL_FONT {
-        constexpr auto NUM_CHARS = 150;
-        void           shiftchar( u16 &val );
-        extern u8      fontWidths[ NUM_CHARS ];
-        extern u8      fontData[ NUM_CHARS * 256 ];
+        constexpr auto           NUM_CHARS = 150;
+        extern const u16 *const  charPages[ 256 ];
+        extern u8                fontWidths[ NUM_CHARS ];
+        extern const packedGlyph glyphs[ NUM_CHARS ];
+        extern const u8          fontData[ ];
     } // namespace SMALL_FONT
     namespace BRAILLE_FONT {
-        constexpr auto NUM_CHARS = 30;
-        void           shiftchar( u16 &val );
-        extern u8      fontWidths[ NUM_CHARS ];
-        extern u8      fontData[ NUM_CHARS * 256 ];
+        constexpr auto           NUM_CHARS = 30;
+        extern const u16 *const  charPages[ 256 ];
+        extern u8                fontWidths[ NUM_CHARS ];
+        extern const packedGlyph glyphs[ NUM_CHARS ];
+        extern const u8          fontData[ ];
     } // namespace BRAILLE_FONT
 
+    constexpr u16 MAX_LAYOUT_CHARS = MAPSTRING_LEN; // longest string that can be printed
+    constexpr u8  MAX_LAYOUT_LINES = 32;            // lines whose width is recorded
+
+    /*
+     * @brief: A string that has been parsed and measured once by one of the layout
+     * methods of a font; holds the (already shifted) chars of the string together with
+     * their positions, so that it can be printed any number of times without measuring
+     * the string again. The glyphs are stored in a buffer provided by whoever created the
+     * layout. Chars beyond MAX_LAYOUT_CHARS are cut off (DESQUID builds halt instead).
+     */
+    struct textLayout {
+        struct glyph {
+            u16  m_ch;
+            s16  m_x; // relative to the position the layout is printed at
+            s16  m_y;
+            bool m_delay; // whether a delayed print waits after this char
+        };
+
+        /*
+         * @brief: Parameters a layout has been computed for.
+         */
+        struct params {
+            s16  m_maxWidth; // 0: only break lines at newlines
+            u16  m_boxWidth; // 0: align relative to the print position
+            u8   m_alignment;
+            u8   m_yDistance;
+            char m_breakChar;
+            s8   m_adjustX;
+            u8   m_charShift;
+
+            constexpr bool operator==( const params & ) const = default;
+        };
+
+        glyph *m_glyphs     = nullptr;
+        u16    m_capacity   = 0;
+        u16    m_glyphCount = 0;
+        u16    m_lines      = 0;
+        s16    m_lineWidths[ MAX_LAYOUT_LINES ]; // measured width of the first lines
+
+        constexpr textLayout( ) : m_lineWidths{ } {
+        }
+
+        constexpr textLayout( glyph *p_glyphs, u16 p_capacity )
+            : m_glyphs( p_glyphs ), m_capacity( p_capacity ), m_lineWidths{ } {
+        }
+
+        constexpr const glyph *begin( ) const {
+            return m_glyphs;
+        }
+
+        constexpr const glyph *end( ) const {
+            return m_glyphs + m_glyphCount;
+        }
+    };
+
     class font {
       private:
-        u8 *_data;
-        u8 *_widths;
-        void ( *_shiftchar )( u16 &val );
-        color _color[ 5 ];
+        const packedGlyph *_glyphs;
+        const u8          *_data;
+        u8                *_widths;
+        const u16 *const  *_charPages;
+        color              _color[ 5 ];
 
         void _charDelay( ) const;
 
+        /*
+         * @brief: Maps the given char to the index of its glyph (see tools/fontmap.py).
+         */
+        inline void _shiftchar( u16 &p_ch ) const {
+            if( auto page = _charPages[ p_ch >> 8 ] ) { p_ch = page[ p_ch & 0xFF ]; }
+        }
+
+        /*
+         * @brief: Unpacks the p_row-th pixel row of the specified (shifted) char into
+         * p_out, which needs to hold at least the char's width many entries.
+         */
+        void _unpackRow( u16 p_ch, u8 p_row, u8 *p_out ) const;
+
+        /*
+         * @brief: Parses and measures p_string according to p_params, storing the
+         * result in p_out.
+         */
+        void _layout( textLayout &p_out, const char *p_string,
+                      const textLayout::params &p_params ) const;
+
+        /*
+         * @brief: Draws the given layout to a 8bpp buffer (rows p_stride pixels apart),
+         * such that the layout's position is at (p_x, p_y). Only non-transparent pixels
+         * are written.
+         */
+        void _rasterize( const textLayout &p_layout, u8 *p_buffer, u16 p_stride, s16 p_x,
+                         s16 p_y ) const;
+
       public:
         enum alignment { LEFT, RIGHT, CENTER };
 
-        font( u8 *p_fontData, u8 *p_characterWidths, void ( *p_shiftchar )( u16 &val ) );
+        font( const packedGlyph *p_glyphs, const u8 *p_fontData, u8 *p_characterWidths,
+              const u16 *const *p_charPages );
 
         /*
          * @brief: Sets the p_num-th color.
@@ -108,6 +213,41 @@ namespace IO {
          */
         u32 stringMaxWidthC( const char *p_string, u16 p_maxWidth, char p_breakChar ) const;
 
+        // Methods to lay out strings
+
+        /*
+         * @brief: Parses and measures the given string once. If p_maxWidth is non-zero,
+         * lines are broken as in printBreakingString, otherwise only at newlines as in
+         * printString. The glyphs are stored in a buffer shared by all fonts, so the
+         * layout stays valid until the next call of layoutString or layoutStringB.
+         * Laying out strings is not reentrant: all layout methods (and hence all print
+         * methods for strings) use the same static scratch buffers.
+         */
+        textLayout layoutString( const char *p_string, s16 p_maxWidth = 0,
+                                 alignment p_alignment = LEFT, u8 p_yDistance = 15,
+                                 char p_breakChar = ' ', s8 p_adjustX = 0,
+                                 u8 p_charShift = 0 ) const;
+
+        /*
+         * @brief: Parses and measures the given string once for printing it to a buffer
+         * of the given width (see printStringB). Uses the same glyph buffer as
+         * layoutString.
+         */
+        textLayout layoutStringB( const char *p_string, u16 p_bufferWidth,
+                                  alignment p_alignment = LEFT, u8 p_yDistance = 15,
+                                  u8 p_charShift = 0, u16 p_rightPadding = 0 ) const;
+
+        /*
+         * @brief: Same as layoutString, but reuses the layout computed by an earlier
+         * call for the same p_id, parameters and string contents. The returned
+         * reference stays valid until the next call. Strings that are too long for a
+         * cache entry are laid out in the buffer of layoutString each time instead.
+         */
+        const textLayout &cachedLayout( const char *p_string, u16 p_id, s16 p_maxWidth = 0,
+                                        alignment p_alignment = LEFT, u8 p_yDistance = 15,
+                                        char p_breakChar = ' ', s8 p_adjustX = 0,
+                                        u8 p_charShift = 0 ) const;
+
         // Methods to print single characters
 
         /*
@@ -124,6 +264,21 @@ namespace IO {
         u16 printCharB( u16 p_ch, const u16 *p_palette, u16 *p_buffer, u16 p_bufferWidth,
                         s16 p_x = 0, s16 p_y = 0, bool p_shift = true ) const;
 
+#ifdef DESQUID
+        /*
+         * @brief: Per-pixel reference implementation of printChar.
+         */
+        u16 printCharReference( u16 p_ch, s16 p_x, s16 p_y, bool p_bottom, u8 p_layer = 1,
+                                bool p_shift = true ) const;
+
+        /*
+         * @brief: Renders the first p_numChars chars with both printChar and
+         * printCharReference at several positions, compares the results and prints the
+         * number of mismatches and the average cycles per glyph of both renderers.
+         */
+        void benchmarkBlitter( bool p_bottom, u8 p_layer, u16 p_numChars ) const;
+#endif
+
         /*
          * @brief: Draws the continue triangle for message boxes.
          */
@@ -145,6 +300,21 @@ namespace IO {
 
         // Methods to print strings
 
+        /*
+         * @brief: Prints a previously computed layout at the given position.
+         * @returns: number of lines written (i.e. 1 + number of newlines or other breaks)
+         */
+        u16 printLayout( const textLayout &p_layout, s16 p_x, s16 p_y, bool p_bottom,
+                         bool p_delay = false, u8 p_layer = 1 ) const;
+
+        /*
+         * @brief: Prints a layout computed by layoutStringB to the given buffer.
+         * @returns: number of lines written (i.e. 1 + number of newlines or other breaks)
+         */
+        u16 printLayoutB( const textLayout &p_layout, const u16 *p_palette, u16 *p_buffer,
+                          u16 p_bufferWidth, u8 p_chunkSize = 64,
+                          u16 p_bufferHeight = 32 ) const;
+
         /*
          * @brief: Prints the given string at the given position to the screen.
          * @returns: number of lines written (i.e. 1 + number of newlines or other breaks)
@@ -161,6 +331,25 @@ namespace IO {
                           alignment p_alignment = LEFT, u8 p_yDistance = 15, s8 p_adjustX = 0,
                           bool p_delay = false, u8 p_layer = 1 ) const;
 
+        /*
+         * @brief: Prints the UI string with the given id (see GET_STRING), which needs to
+         * be static, i.e. only depend on the language. The string is rendered only once
+         * (for every language and set of colors) into the string atlas and copied from
+         * there afterwards.
+         * @returns: number of lines written (i.e. 1 + number of newlines or other breaks)
+         */
+        u16 printStaticString( u16 p_stringId, s16 p_x, s16 p_y, bool p_bottom,
+                               alignment p_alignment = LEFT, u8 p_yDistance = 15,
+                               u8 p_charShift = 0, u8 p_layer = 1 ) const;
+
+        /*
+         * @brief: Same as printStaticString, with less horizontal space between characters.
+         * @returns: number of lines written (i.e. 1 + number of newlines or other breaks)
+         */
+        u16 printStaticStringC( u16 p_stringId, s16 p_x, s16 p_y, bool p_bottom,
+                                alignment p_alignment = LEFT, u8 p_yDistance = 15,
+                                u8 p_layer = 1 ) const;
+
         /*
          * @brief: Prints the given string with some delay after every character.
          * @returns: number of lines written (i.e. 1 + number of newlines or other breaks)
@@ -58,6 +58,31 @@ namespace IO {
         DSQ_WARP                = 3,
         DSQ_TIME                = 4,
         DSQ_BATTLE_TRAINER      = 5,
+        DSQ_PROFILE             = 6,
+    };
+
+    /*
+     * @brief: Entries of the profiling submenu of the DESQUID menu, in the order in
+     * which they are listed.
+     */
+    enum desquidProfileOption {
+        DSQ_PROF_SCRIPT_STATS,
+        DSQ_PROF_PHASE_STATS,
+        DSQ_PROF_DUMP_STATS,
+        DSQ_PROF_RESET_STATS,
+        DSQ_PROF_MAP_OBJECT_INDEX,
+        DSQ_PROF_OW_SPRITE_CACHE,
+        DSQ_PROF_GLYPH_BLITTER,
+        DSQ_PROF_RECTANGLES,
+        DSQ_PROF_BACK_BUFFER,
+        DSQ_PROF_STRING_ATLAS,
+        DSQ_PROF_SPRITE_VRAM,
+        DSQ_PROF_SPRITE_PALETTES,
+        DSQ_PROF_DECODED_SPRITES,
+        DSQ_PROF_FACILITY_POOL,
+        DSQ_PROF_BATTLE_BENCH,
+
+        DSQ_PROF_COUNT
     };
 #endif
 
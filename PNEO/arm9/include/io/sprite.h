@@ -31,6 +31,7 @@
 
 #include "battle/move.h"
 #include "battle/type.h"
+#include "io/spritePalettes.h"
 #include "save/saveOptions.h"
 
 namespace IO {
@@ -62,7 +63,8 @@ namespace IO {
 
     /*
      * @brief: Loads the given tiles and pal to the specified position in the OAM(Sub)
-     * (Assumes 1D tiled sprites w/ 16 colors per palette)
+     * (Assumes 1D tiled sprites w/ 16 colors per palette). If p_palIdx is SHARED_PALETTE,
+     * the screen's spritePalettes picks the palette slot.
      */
     u16 loadSprite( const u8 p_oamIdx, const u8 p_palIdx, const u16 p_tileIdx, const s16 p_posX,
                     const s16 p_posY, const u8 p_width, const u8 p_height,
@@ -0,0 +1,179 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : spriteAllocator.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <nds.h>
+#include <nds/ndstypes.h>
+
+#include "defines.h"
+
+namespace IO {
+    constexpr u16 SPRITE_ALLOCATOR_UNITS  = 1024; // gfxIndex values of a screen
+    constexpr u8  SPRITE_ALLOCATOR_ORDERS = 11;   // blocks of 1, 2, 4, ..., 1024 units
+    constexpr u8  SPRITE_ALLOCATOR_ASSETS = 64;
+
+    constexpr u16 NO_SPRITE_TILES = 0xFFFF;
+    constexpr u8  NO_SPRITE_ASSET = 0xFF;
+
+    /*
+     * @brief: Kinds of sprite images that can be shared via spriteAllocator::acquire.
+     */
+    enum spriteAssetType : u8 {
+        ASSET_ITEM_ICON = 1,
+        ASSET_PKMN_ICON = 2,
+    };
+
+    constexpr u64 itemIconKey( u16 p_itemId ) {
+        return ( u64( ASSET_ITEM_ICON ) << 56 ) | p_itemId;
+    }
+
+    constexpr u64 pkmnIconKey( const pkmnSpriteInfo& p_pkmn ) {
+        return ( u64( ASSET_PKMN_ICON ) << 56 ) | ( u64( p_pkmn.m_pkmnIdx & 0x7FF ) << 43 )
+               | ( u64( p_pkmn.m_forme ) << 35 ) | ( u64( !!p_pkmn.m_female ) << 34 )
+               | ( u64( !!p_pkmn.m_shiny ) << 33 ) | ( u64( !!p_pkmn.m_flipX ) << 32 )
+               | p_pkmn.m_pid;
+    }
+
+    /*
+     * @brief: Buddy allocator for the sprite vram of one screen, in units of the
+     * screen's gfxIndex. The first p_reserved units (see init) are left to the screen's
+     * hand-placed sprites.
+     *
+     * On top of that, sprite images ("assets", identified by a 64 bit key) can be
+     * shared: acquire returns the same tiles for the same key until the asset has been
+     * released by all users; unused assets stay in vram and are only evicted (least
+     * recently used first) once the space is needed, so that e.g. icons that reappear
+     * don't need to be loaded again. Along with its tiles, an asset can store a 16
+     * color palette and a u16 of user data.
+     *
+     * initOAMTable disables the allocator of the respective screen.
+     */
+    class spriteAllocator {
+        struct asset {
+            u64 m_key;
+            u16 m_tile = NO_SPRITE_TILES;
+            u16 m_lastUse;
+            u16 m_data;
+            u8  m_refs;
+            u16 m_palette[ 16 ];
+        };
+
+        static constexpr u8 FREE_BLOCK = 0x80;
+
+        // order of the block starting at the given unit (| FREE_BLOCK if unused)
+        u8    _blocks[ SPRITE_ALLOCATOR_UNITS ]
+            = { ( SPRITE_ALLOCATOR_ORDERS - 1 ) | FREE_BLOCK };
+        asset _assets[ SPRITE_ALLOCATOR_ASSETS ];
+        u16   _reserved = 0;
+        u16   _clock    = 0;
+        bool  _enabled  = false;
+
+#ifdef DESQUID
+        u32 _hits      = 0;
+        u32 _misses    = 0;
+        u32 _evictions = 0;
+#endif
+
+        /*
+         * @brief: Takes a free block of 2^p_order units; returns NO_SPRITE_TILES if
+         * there is none.
+         */
+        u16 _take( u8 p_order );
+
+        /*
+         * @brief: Drops the least recently used asset that is no longer in use; returns
+         * false if there is none.
+         */
+        bool _evict( );
+
+        void _dropAsset( u8 p_handle );
+
+      public:
+        /*
+         * @brief: Resets the allocator; units [0, p_reserved) remain hand-managed.
+         */
+        void init( u16 p_reserved );
+
+        /*
+         * @brief: Forgets all allocations; allocate and acquire fail until the next
+         * init.
+         */
+        void disable( );
+
+        constexpr bool isEnabled( ) const {
+            return _enabled;
+        }
+
+        /*
+         * @brief: Allocates p_units (rounded up to a power of 2) units; evicts unused
+         * assets if necessary. Returns the first unit or NO_SPRITE_TILES.
+         */
+        u16 allocate( u16 p_units );
+
+        /*
+         * @brief: Frees the block starting at p_tile (as returned by allocate).
+         */
+        void free( u16 p_tile );
+
+        /*
+         * @brief: Returns a handle to the asset with the given key, allocating
+         * p_units units for it if it isn't in vram. In that case p_fresh is set and the
+         * caller needs to upload the image to tile( handle ). Returns NO_SPRITE_ASSET if
+         * there is no space left.
+         */
+        u8 acquire( u64 p_key, u16 p_units, bool& p_fresh );
+
+        /*
+         * @brief: Gives up one use of the given asset; if p_keep is false (e.g. since
+         * uploading the image failed), the asset is dropped once unused.
+         */
+        void release( u8 p_handle, bool p_keep = true );
+
+        constexpr u16 tile( u8 p_handle ) const {
+            return _assets[ p_handle ].m_tile;
+        }
+
+        constexpr u16* palette( u8 p_handle ) {
+            return _assets[ p_handle ].m_palette;
+        }
+
+        constexpr u16& data( u8 p_handle ) {
+            return _assets[ p_handle ].m_data;
+        }
+
+#ifdef DESQUID
+        /*
+         * @brief: Shows the free space, the fragmentation, the asset hit rate and a map
+         * of the vram usage (one char per 32 units: '#' used, '+' partially used, '.'
+         * free, 'r' reserved) of the allocator's last screen in the message box.
+         */
+        void printStats( const char* p_screen ) const;
+#endif
+    };
+
+    extern spriteAllocator SPRITE_ALLOCATOR[ 2 ]; // top screen, bottom screen
+} // namespace IO
@@ -0,0 +1,117 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : spritePalettes.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <nds.h>
+#include <nds/ndstypes.h>
+
+namespace IO {
+    constexpr u8 SPRITE_PALETTE_SLOTS = 16;
+
+    // palette index that makes loadSprite use a slot of the screen's palette manager
+    constexpr u8 SHARED_PALETTE = 0xFF;
+
+    /*
+     * @brief: Manages the 16 color sprite palette slots [p_first, p_last) (see init) of
+     * one screen. Sprites that are loaded with palette index SHARED_PALETTE get a slot
+     * that holds their palette; sprites with identical palettes share a slot, which is
+     * uploaded only once. A sprite keeps its slot until its OAM entry is loaded again;
+     * slots nobody uses any more keep their palette until the slot is needed for a
+     * different palette.
+     *
+     * initOAMTable disables the manager of the respective screen.
+     */
+    class spritePalettes {
+        u16  _palettes[ SPRITE_PALETTE_SLOTS ][ 16 ]; // contents of the managed slots
+        u32  _hashes[ SPRITE_PALETTE_SLOTS ];
+        u8   _refs[ SPRITE_PALETTE_SLOTS ];
+        u16  _lastUse[ SPRITE_PALETTE_SLOTS ];
+        u8   _oamSlots[ SPRITE_COUNT ]; // slot used by each OAM entry
+        u16  _valid   = 0;              // bitmask of the slots whose contents are known
+        u16  _clock   = 0;
+        u8   _first   = 0;
+        u8   _last    = 0;
+        bool _enabled = false;
+        bool _bottom;
+
+#ifdef DESQUID
+        u32 _uploads  = 0;
+        u32 _shared   = 0;
+        u32 _failures = 0;
+        u8  _peak     = 0;
+#endif
+
+      public:
+        spritePalettes( bool p_bottom ) : _bottom( p_bottom ) {
+        }
+
+        /*
+         * @brief: Lets the manager use the palette slots [p_first, p_last), whose
+         * current contents are considered unknown.
+         */
+        void init( u8 p_first, u8 p_last = SPRITE_PALETTE_SLOTS );
+
+        /*
+         * @brief: Stops handing out slots; all slots are forgotten.
+         */
+        void disable( );
+
+        constexpr bool isEnabled( ) const {
+            return _enabled;
+        }
+
+        /*
+         * @brief: Returns the slot that holds the given palette for the sprite with the
+         * given OAM index, uploading the palette if no slot holds it yet. The slot the
+         * sprite used before is released. If all slots are in use by different palettes,
+         * the last managed slot is overwritten.
+         */
+        u8 acquire( u8 p_oamIdx, const unsigned short* p_palette );
+
+        /*
+         * @brief: Releases the slot used by the sprite with the given OAM index (if
+         * any).
+         */
+        void release( u8 p_oamIdx );
+
+        /*
+         * @brief: Returns the number of managed slots currently in use.
+         */
+        u8 usedSlots( ) const;
+
+#ifdef DESQUID
+        /*
+         * @brief: Shows the slot usage (current and peak), the number of uploads and
+         * of uploads that were saved by sharing slots, and how often all slots were
+         * taken in the message box.
+         */
+        void printStats( const char* p_screen ) const;
+#endif
+    };
+
+    extern spritePalettes SPRITE_PALETTES[ 2 ]; // top screen, bottom screen
+} // namespace IO
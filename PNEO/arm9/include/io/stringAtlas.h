@@ -0,0 +1,132 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : stringAtlas.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <nds.h>
+#include <nds/ndstypes.h>
+
+#include "io/font.h"
+
+namespace IO {
+    constexpr u16 STRING_ATLAS_WIDTH   = 256;
+    constexpr u16 STRING_ATLAS_HEIGHT  = 128;
+    constexpr u8  STRING_ATLAS_ENTRIES = 64;
+    constexpr u8  STRING_ATLAS_SHELVES = 32;
+
+    /*
+     * @brief: Main RAM 8bpp image holding static UI strings (see font::printStaticString)
+     * that have already been rendered, together with the position they need to be drawn
+     * at relative to the position the string is printed at. Strings are packed into
+     * shelves (rows of strings of similar height); once the atlas is full, or the
+     * language changes, all strings are dropped.
+     */
+    class stringAtlas {
+      public:
+        struct entry {
+            const font        *m_font;
+            u16                m_stringId;
+            textLayout::params m_params;
+            color              m_colors[ 5 ];
+            u8                 m_x; // position in the atlas
+            u8                 m_y;
+            u16                m_width;
+            u8                 m_height;
+            s16                m_offsetX; // relative to the print position
+            s16                m_offsetY;
+            u16                m_lines;
+        };
+
+      private:
+        struct shelf {
+            u8  m_y;
+            u8  m_height;
+            u16 m_used;
+        };
+
+        u8    _pixels[ STRING_ATLAS_WIDTH * STRING_ATLAS_HEIGHT ];
+        entry _entries[ STRING_ATLAS_ENTRIES ];
+        shelf _shelves[ STRING_ATLAS_SHELVES ];
+        u8    _entryCount = 0;
+        u8    _shelfCount = 0;
+        u8    _usedHeight = 0;
+        u8    _language   = 0xFF;
+
+#ifdef DESQUID
+        u32 _hits       = 0;
+        u32 _misses     = 0;
+        u32 _resets     = 0;
+        u32 _usedPixels = 0;
+#endif
+
+        /*
+         * @brief: Finds space for a p_width x p_height image; returns false if the atlas
+         * is full.
+         */
+        bool _allocate( u16 p_width, u8 p_height, u8 &p_outX, u8 &p_outY );
+
+      public:
+        /*
+         * @brief: Drops all strings.
+         */
+        void clear( );
+
+        /*
+         * @brief: Returns the entry for the given string rendered with the given font
+         * (using the font's current colors) and layout parameters in the given language
+         * or nullptr if the string hasn't been rendered yet.
+         */
+        const entry *find( const font *p_font, u16 p_stringId,
+                           const textLayout::params &p_params, u8 p_language );
+
+        /*
+         * @brief: Reserves (and clears) the space for a new string; the string's image
+         * needs to be drawn to pixels( ) afterwards. Returns nullptr if the string
+         * doesn't fit into the atlas at all.
+         */
+        const entry *insert( const font *p_font, u16 p_stringId,
+                             const textLayout::params &p_params, u16 p_width, u16 p_height,
+                             s16 p_offsetX, s16 p_offsetY, u16 p_lines );
+
+        /*
+         * @brief: Returns the top-left pixel of the given entry's image; rows are
+         * STRING_ATLAS_WIDTH pixels apart.
+         */
+        constexpr u8 *pixels( const entry &p_entry ) {
+            return _pixels + p_entry.m_y * STRING_ATLAS_WIDTH + p_entry.m_x;
+        }
+
+#ifdef DESQUID
+        /*
+         * @brief: Shows the number of strings, the atlas occupancy and the hit rate in
+         * the message box.
+         */
+        void printStats( ) const;
+#endif
+    };
+
+    extern stringAtlas STRING_ATLAS;
+} // namespace IO
@@ -240,9 +240,58 @@ namespace IO {
 
     void setPixel( u8 p_x, u8 p_y, bool p_bottom, u8 p_color, u8 p_layer = 1 );
 
+    /*
+     * @brief: An axis-parallel rectangle (with inclusive bounds) filled with a single
+     * color.
+     */
+    struct rectangle {
+        u8 m_x1;
+        u8 m_y1;
+        u8 m_x2;
+        u8 m_y2;
+        u8 m_color;
+    };
+
     void printRectangle( u8 p_x1, u8 p_y1, u8 p_x2, u8 p_y2, bool p_bottom, u8 p_color,
                          u8 p_layer = 1 );
 
+    /*
+     * @brief: Prints the given rectangles (in the given order, i.e. later rectangles
+     * overwrite earlier ones).
+     */
+    void printRectangles( const rectangle* p_rectangles, u8 p_count, bool p_bottom,
+                          u8 p_layer = 1 );
+
+    /*
+     * @brief: Copies a pre-rendered p_width x p_height 8bpp bitmap (stored row by row)
+     * to the given position; pixels right of the screen are clipped.
+     */
+    void blit8( const u8* p_src, u8 p_x, u8 p_y, u16 p_width, u16 p_height, bool p_bottom,
+                u8 p_layer = 1 );
+
+    /*
+     * @brief: Copies the non-zero pixels of a p_width x p_height 8bpp bitmap (whose rows
+     * are p_stride pixels apart) to the given position; pixels outside of the layer are
+     * clipped.
+     */
+    void blit8Masked( const u8* p_src, u16 p_stride, s16 p_x, s16 p_y, u16 p_width,
+                      u16 p_height, bool p_bottom, u8 p_layer = 1 );
+
+#ifdef DESQUID
+    /*
+     * @brief: Per-pixel reference implementation of printRectangle.
+     */
+    void printRectangleReference( u8 p_x1, u8 p_y1, u8 p_x2, u8 p_y2, bool p_bottom,
+                                  u8 p_color, u8 p_layer = 1 );
+
+    /*
+     * @brief: Prints the rectangles of some common UI elements with both printRectangles
+     * and printRectangleReference, compares the results and prints the number of
+     * mismatches and the cycles both implementations need per element.
+     */
+    void benchmarkRectangles( bool p_bottom, u8 p_layer );
+#endif
+
     void drawLine( u8 p_x1, u8 p_y1, u8 p_x2, u8 p_y5, bool p_bottom, u8 p_color, u8 p_layer = 1 );
 
     void displayHP( u16 p_HPstart, u16 p_HP, u8 p_x, u8 p_y, u8 p_freecolor1, u8 p_freecolor2,
@@ -61,6 +61,42 @@ namespace MAP {
     constexpr u8 TIER_FOR_STREAK[ TIER_MAX_STREAK ]
         = { TIER_BAD, TIER_BAD, TIER_AVERAGE, TIER_AVERAGE, TIER_GOOD };
 
+    constexpr u8  NUM_FACILITY_TIERS = TIER_GOOD + 1; // tiers opponents' pkmn are drawn from
+    constexpr u16 MAX_FACILITY_SETS  = 512;           // per tier
+
+    /*
+     * @brief: A pre-built set of a pkmn for the battle facilities. The sets of each tier
+     * are stored in a file of their own (written by tools/facilitysets.py): a
+     * facilitySetsHeader, followed by the sets, sorted by species.
+     */
+    struct facilitySet {
+        u16 m_speciesId;
+        u8  m_forme;
+        u8  m_nature;
+        u16 m_ability;
+        u16 m_heldItem;
+        u16 m_moves[ 4 ];
+        u8  m_ev[ 6 ];
+    };
+    static_assert( sizeof( facilitySet ) == 22 ); // the layout tools/facilitysets.py writes
+
+    constexpr u32 FACILITY_SETS_MAGIC   = 0x53544642; // "BFTS"
+    constexpr u16 FACILITY_SETS_VERSION = 1;
+
+    struct facilitySetsHeader {
+        u32 m_magic;
+        u16 m_version;
+        u16 m_count; // number of sets following the header
+    };
+    static_assert( sizeof( facilitySetsHeader ) == 8 );
+
+    /*
+     * @brief: Returns the tier of the sets the opponents at the given streak use.
+     */
+    constexpr u8 getFacilityTierForStreak( u16 p_streak ) {
+        return TIER_FOR_STREAK[ p_streak >= TIER_MAX_STREAK ? TIER_MAX_STREAK - 1 : p_streak ];
+    }
+
     /*
      * @brief: returns the general strength tier (as agrred upon by the competitive scene) of the
      * specified pkmn species.
@@ -333,7 +369,12 @@ namespace MAP {
     }
 
     constexpr u8 NO_VARIANT = 255;
-    constexpr u8 getSpeciesVariantForStreak( u16 p_species, u16 p_streak ) {
+    /*
+     * @brief: Returns which of the sets of the given species an opponent at the given
+     * streak uses (NO_VARIANT if the species doesn't fit the streak); p_random picks one
+     * if several fit.
+     */
+    constexpr u8 getSpeciesVariantForStreak( u16 p_species, u16 p_streak, u32 p_random ) {
         u8 baseTier = getTier( p_species );
         u8 streak   = p_streak >= TIER_MAX_STREAK ? TIER_MAX_STREAK - 1 : p_streak;
 
@@ -344,9 +385,9 @@ namespace MAP {
             if( p_streak >= TIER_MAX_STREAK - 1 && p_streak < TIER_MAX_STREAK + 2 ) {
                 return p_streak - ( TIER_MAX_STREAK - 1 );
             }
-            return rand( ) % 3;
+            return p_random % 3;
         }
-        return rand( ) % 2;
+        return p_random % 2;
     }
 
 } // namespace MAP
@@ -0,0 +1,159 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : mapBattleFacilityPool.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <nds.h>
+#include <nds/ndstypes.h>
+
+#include "battle/battleRandom.h"
+#include "battle/battleTrainer.h"
+#include "map/mapBattleFacilityDefines.h"
+#include "pokemon.h"
+
+namespace MAP {
+    constexpr u16 FACILITY_ID_BITS = 2048; // all species and item ids are smaller
+    constexpr u16 NO_FACILITY_SET  = 0xFFFF;
+
+    /*
+     * @brief: The pre-built sets of one tier and an index to draw teams from them.
+     *
+     * Teams are drawn with a partial Fisher-Yates shuffle of a permutation of the set
+     * indices: each draw takes O(1) and never yields the same set twice. Sets whose
+     * species or held item is already on the team (bit masks of the species and items on
+     * the team) are discarded. The permutation is restored after each team, so the same
+     * random numbers always yield the same team.
+     */
+    class facilityPool {
+        facilitySet _sets[ MAX_FACILITY_SETS ];  // sorted by species
+        u16         _order[ MAX_FACILITY_SETS ]; // permutation of [0, _count)
+        u16         _draws[ MAX_FACILITY_SETS ]; // positions drawn for the current team
+        u32         _usedSpecies[ FACILITY_ID_BITS / 32 ] = { 0 };
+        u32         _usedItems[ FACILITY_ID_BITS / 32 ]   = { 0 };
+
+        u16 _count = 0;
+        u8  _tier  = NUM_FACILITY_TIERS; // tier of the loaded sets
+
+#ifdef DESQUID
+        u32 _teams     = 0;
+        u32 _drawn     = 0;
+        u32 _discarded = 0;
+#endif
+
+        static constexpr bool test( const u32* p_mask, u16 p_id ) {
+            return p_id < FACILITY_ID_BITS && ( p_mask[ p_id >> 5 ] & ( 1 << ( p_id & 31 ) ) );
+        }
+
+        static constexpr void flip( u32* p_mask, u16 p_id ) {
+            if( p_id < FACILITY_ID_BITS ) { p_mask[ p_id >> 5 ] ^= 1 << ( p_id & 31 ); }
+        }
+
+      public:
+        /*
+         * @brief: Loads the sets of the given tier from the ROM (unless they are loaded
+         * already). Returns false if there are none.
+         */
+        bool load( u8 p_tier );
+
+        /*
+         * @brief: Removes all sets.
+         */
+        void clear( );
+
+        /*
+         * @brief: Appends a set; sets need to be added in the order of their species.
+         * Returns false if the pool is full.
+         */
+        bool add( const facilitySet& p_set );
+
+        constexpr u16 size( ) const {
+            return _count;
+        }
+
+        constexpr const facilitySet& operator[]( u16 p_idx ) const {
+            return _sets[ p_idx ];
+        }
+
+        /*
+         * @brief: Returns the index of the p_variant-th set (modulo the number of sets)
+         * of the given species, or NO_FACILITY_SET.
+         */
+        u16 find( u16 p_species, u8 p_variant ) const;
+
+        /*
+         * @brief: Draws up to p_count sets with pairwise distinct species and held items
+         * and writes their indices to p_out. Returns the number of sets drawn, which is
+         * less than p_count only if the pool runs out of suitable sets.
+         */
+        u8 drawSets( u8 p_count, u16* p_out, BATTLE::battleRandom& p_rng );
+
+        /*
+         * @brief: Creates the trainer pkmn for the given set; the IVs grow with the
+         * streak.
+         */
+        void createPkmn( u16 p_set, u8 p_level, u16 p_streak, trainerPokemon* p_out ) const;
+
+        /*
+         * @brief: Draws a team for an opponent at the given streak (from the sets of the
+         * tier for the streak) and stores it in p_out.
+         */
+        bool drawTeam( const ruleSet& p_rules, u16 p_streak, BATTLE::trainerData& p_out,
+                       BATTLE::battleRandom& p_rng );
+
+#ifdef DESQUID
+        /*
+         * @brief: Shows the number of teams drawn and how many sets were discarded due to
+         * duplicate species or items in the message box.
+         */
+        void printStats( ) const;
+#endif
+    };
+
+    extern facilityPool FACILITY_POOL;
+
+    /*
+     * @brief: Draws random species of the streak's tier until the team is complete (with
+     * pairwise distinct species and held items); used if there are no pre-built sets for
+     * the tier. The same random numbers always yield the same team.
+     */
+    void drawSpeciesTeam( const ruleSet& p_rules, u16 p_streak, BATTLE::trainerData& p_out,
+                          BATTLE::battleRandom& p_rng );
+
+    /*
+     * @brief: Draws a team for an opponent at the given streak from the pre-built sets of
+     * the streak's tier, or from random species of the tier if the ROM has no sets for it.
+     */
+    bool drawFacilityTeam( const ruleSet& p_rules, u16 p_streak, BATTLE::trainerData& p_out,
+                           BATTLE::battleRandom& p_rng );
+
+#ifdef DESQUID
+    /*
+     * @brief: Draws teams from a synthetic pool with many duplicate species and items,
+     * checks them, and shows the time needed per team. Clears FACILITY_POOL.
+     */
+    void benchmarkFacilityPool( );
+#endif
+} // namespace MAP
@@ -217,6 +217,15 @@ namespace MAP {
         std::map<position, tileAnimationInfo> _tileAnimations;
 
         u8 _fixedObjectCount = 0;
+
+        // spatial index over the currently active map objects
+        static constexpr u8 MAX_OBJECTS_PER_TILE = 8;
+        mapObjectIndex      _mapObjectIndex;
+#ifdef DESQUID
+        // checkMapObjectIndex verifies this many slots per call, starting at _indexCheckSlot
+        static constexpr u16 INDEX_CHECK_SLOTS = 16;
+        u16                  _indexCheckSlot   = 0;
+#endif
 #ifdef DESQUID
         static constexpr u8 TRACER_CHARGED = 1;
 #else
@@ -348,6 +357,12 @@ namespace MAP {
          */
         bool updateFollowPkmn( );
 
+        /*
+         * @brief: Makes sure the ow sprites of all pkmn in the player's party are cached,
+         * so that the following pkmn can be changed without file system accesses.
+         */
+        void prefetchFollowPkmnSprites( );
+
         /*
          * @brief: Player interacts with the pkmn following them.
          */
@@ -440,6 +455,32 @@ namespace MAP {
          */
         void unfixMapObject( );
 
+        /*
+         * @brief: Re-inserts all active map objects into the map object index.
+         */
+        void rebuildMapObjectIndex( );
+        /*
+         * @brief: Updates the position of the specified mo in the map object index (or
+         * removes it if the slot is unused); needs to be called whenever the mo's position
+         * changes or the mo is despawned.
+         */
+        void updateMapObjectIndex( u8 p_objectId );
+        /*
+         * @brief: Writes the ids of (at most MAX_OBJECTS_PER_TILE) active map objects at
+         * the specified position in increasing order to p_out.
+         * @returns: The number of ids written.
+         */
+        u8 mapObjectsAt( u16 p_globX, u16 p_globY, u8* p_out ) const;
+#ifdef DESQUID
+        /*
+         * @brief: Checks that the next INDEX_CHECK_SLOTS map object slots are stored
+         * under their current position in the map object index (or not at all if they
+         * are unused); halts with a message otherwise. Called once per step, so all
+         * slots are verified every MAX_MAPOBJECT / INDEX_CHECK_SLOTS steps.
+         */
+        void checkMapObjectIndex( );
+#endif
+
         void showExclamationAboveMapObject( u8 p_objectId );
         void moveMapObject( mapObject& p_mapObject, u8 p_spriteId, movement p_movement,
                             bool p_movePlayer = false, direction p_playerMovement = DOWN,
@@ -697,6 +738,12 @@ namespace MAP {
          */
         void destroyHMObject( u16 p_globX, u16 p_globY );
 
+        /*
+         * @brief: Checks whether an hmobject of the specified type (a
+         * mapSpriteManager::SPR_* value) is at the specified global position.
+         */
+        bool hasHMObject( u16 p_globX, u16 p_globY, u8 p_hmType ) const;
+
         void registerOnBankChangedHandler( std::function<void( u8 )> p_handler );
         void registerOnLocationChangedHandler( std::function<void( u16, bool )> p_handler );
         void registerOnMoveModeChangedHandler( std::function<void( moveMode )> p_handler );
@@ -113,4 +113,75 @@ namespace MAP {
               m_range( 0 ), m_direction( direction::DOWN ), m_event( mapData::event( ) ) {
         }
     };
+
+    /*
+     * @brief: Runtime spatial hash (tile -> map objects) over the map objects of the
+     * active save file. The index is not part of the save; it needs to be updated whenever
+     * a map object changes its position or is despawned and rebuilt whenever the map
+     * object array is replaced.
+     */
+    class mapObjectIndex {
+      public:
+        static constexpr u16 MAX_OBJECTS = 256;
+        static constexpr u8  NUM_BUCKETS = 64;
+        static constexpr u8  NO_OBJECT   = 255;
+
+      private:
+        static constexpr u8 NOT_INDEXED = 255;
+
+        u8  _head[ NUM_BUCKETS ];
+        u8  _next[ MAX_OBJECTS ];
+        u8  _bucket[ MAX_OBJECTS ]; // bucket the object is currently stored in
+        u16 _posX[ MAX_OBJECTS ];   // position the object is currently stored under
+        u16 _posY[ MAX_OBJECTS ];
+
+        static constexpr u8 bucket( u16 p_globX, u16 p_globY ) {
+            return ( p_globX & 7 ) | ( ( p_globY & 7 ) << 3 );
+        }
+
+      public:
+        mapObjectIndex( ) {
+            clear( );
+        }
+
+        /*
+         * @brief: Removes all objects from the index.
+         */
+        void clear( );
+
+        /*
+         * @brief: Adds the specified object at the given position; moves it if it is
+         * already part of the index.
+         */
+        void update( u8 p_objectId, u16 p_globX, u16 p_globY );
+
+        /*
+         * @brief: Removes the specified object from the index.
+         */
+        void remove( u8 p_objectId );
+
+        /*
+         * @brief: Checks whether the specified object is stored at the given position.
+         */
+        bool contains( u8 p_objectId, u16 p_globX, u16 p_globY ) const;
+
+        constexpr bool isIndexed( u8 p_objectId ) const {
+            return _bucket[ p_objectId ] != NOT_INDEXED;
+        }
+
+        /*
+         * @brief: Writes the ids of (at most p_maxCount) objects stored at the specified
+         * position in increasing order to p_out.
+         * @returns: The number of ids written.
+         */
+        u8 objectsAt( u16 p_globX, u16 p_globY, u8* p_out, u8 p_maxCount ) const;
+    };
+
+#ifdef DESQUID
+    /*
+     * @brief: Compares lookups in a mapObjectIndex over 200 synthetic map objects with
+     * linear scans over the same objects and prints the results.
+     */
+    void benchmarkMapObjectIndex( );
+#endif
 } // namespace MAP
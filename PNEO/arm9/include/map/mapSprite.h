@@ -26,6 +26,8 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #pragma once
+#include <vector>
+
 #include "io/sprite.h"
 #include "map/mapDefines.h"
 
@@ -120,6 +122,77 @@ namespace MAP {
         void updatePalette( u8 p_bgPalIdx );
     };
 
+    /*
+     * @brief: Keeps the ow sprites of (up to) the player's whole team in RLE compressed
+     * form, so that the following pkmn can be (re-)spawned without accessing the file
+     * system.
+     */
+    class owPkmnSpriteCache {
+      public:
+        static constexpr u8 CACHE_SIZE = 6;
+
+        struct key {
+            u16  m_species;
+            u8   m_forme;
+            bool m_shiny;
+
+            constexpr bool operator==( const key& ) const = default;
+        };
+
+      private:
+        struct entry {
+            key             m_key;
+            bool            m_exists; // false if there is no ow sprite for the pkmn
+            u8              m_width;
+            u8              m_height;
+            u8              m_frameCount;
+            u16             m_palData[ 16 ];
+            std::vector<u8> m_frameData; // RLE compressed
+        };
+
+        entry _entries[ CACHE_SIZE ];
+        u8    _entryCount = 0;
+
+        const entry* find( const key& p_key ) const;
+
+      public:
+        /*
+         * @brief: Makes the cache contain exactly the sprites for the specified pkmn;
+         * only sprites that are not already cached are read from the file system.
+         */
+        void prefetch( const key* p_keys, u8 p_count );
+
+        /*
+         * @brief: Decompresses the cached sprite for the specified pkmn into p_out.
+         * @returns: false if the sprite is not cached.
+         */
+        bool get( const key& p_key, mapSpriteData& p_out ) const;
+
+        /*
+         * @brief: Checks whether the specified pkmn has a cached ow sprite whose size
+         * does not exceed p_maxWidth x p_maxHeight.
+         * @returns: -1 if the sprite is not cached, 0 if it is too large or does not
+         * exist, 1 otherwise.
+         */
+        s8 fits( const key& p_key, u8 p_maxWidth, u8 p_maxHeight ) const;
+
+        /*
+         * @brief: Returns the number of bytes of sprite data currently held.
+         */
+        u32 memoryUsage( ) const;
+
+        constexpr u8 size( ) const {
+            return _entryCount;
+        }
+
+        /*
+         * @brief: Removes all sprites from the cache.
+         */
+        void clear( );
+    };
+
+    extern owPkmnSpriteCache OW_PKMN_SPRITE_CACHE;
+
     class mapSprite {
       private:
         mapSpriteInfo _info;
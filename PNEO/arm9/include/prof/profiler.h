@@ -0,0 +1,248 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : profiler.h
+author      : Philip Wellnitz
+description : Header file. Consult the corresponding source file for details.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#ifdef DESQUID
+#include <nds.h>
+#include <nds/ndstypes.h>
+
+#include "defines.h"
+
+/*
+ * @brief: Times the remainder of the enclosing scope and records it for the given
+ * phase. Compiles to nothing outside of DESQUID builds.
+ */
+#define PROFILE_PHASE( p_phase ) \
+    PROF::scopedTimer PROFILE_VAR_NAME( __LINE__ )( PROF::p_phase )
+/*
+ * @brief: Excludes the remainder of the enclosing scope from all phases that are
+ * currently being timed. Wrap blocking UI (messages, battles, scripts) with it, so that
+ * phase timings measure the cost of the engine and not the time the player needs.
+ */
+#define PROFILE_BLOCKING( ) PROF::pauseTimer PROFILE_VAR_NAME( __LINE__ )
+#define PROFILE_VAR_NAME( p_line )  PROFILE_VAR_NAME_( p_line )
+#define PROFILE_VAR_NAME_( p_line ) __profile##p_line
+
+namespace PROF {
+    // cascaded hardware timers (PROFILE_TIMER, PROFILE_TIMER + 1) used as a free running
+    // tick counter
+    constexpr u8  PROFILE_TIMER = 2;
+    constexpr u32 TICKS_PER_MS  = BUS_CLOCK / 1000;
+
+    constexpr u16 NUM_OPCODES          = 256;
+    constexpr u8  SLOWEST_SCRIPT_COUNT = 8;
+
+    // histogram bucket i counts samples of less than 250us * 2^i (last bucket: all
+    // remaining samples)
+    constexpr u8  HISTOGRAM_BUCKETS    = 8;
+    constexpr u32 HISTOGRAM_BASE_TICKS = TICKS_PER_MS / 4;
+
+    enum phase : u8 {
+        STEP_ON = 0,
+        STEP_LOCATION_CALLBACKS,
+        STEP_ANIMATE_FIELD,
+        STEP_BEHAVIOR,
+        STEP_TRAINER_EYE,
+        STEP_WILD_PKMN,
+        STEP_EVENTS,
+        STEP_INCREASE,
+        STEP_INCREASE_REPEL,
+        STEP_INCREASE_DAY_CARE,
+        STEP_INCREASE_EGGS,
+        MAP_WARP,
+        MAP_INIT_WEATHER,
+        UI_FLUSH,
+        BATTLE_TURN,
+        BATTLE_SORT_MOVES,
+        BATTLE_USE_MOVE,
+        BATTLE_END_OF_TURN,
+
+        NUM_PHASES
+    };
+
+    extern const char* const PHASE_NAMES[ NUM_PHASES ];
+
+    struct phaseStats {
+        u32 m_count;
+        u32 m_totalTicks;
+        u32 m_minTicks;
+        u32 m_maxTicks;
+        u32 m_histogram[ HISTOGRAM_BUCKETS ];
+        u32 m_allocations; // heap allocations (operator new) made during the phase
+    };
+
+    extern phaseStats PHASE_STATS[ NUM_PHASES ];
+
+    // number of calls to operator new so far (DESQUID builds count all heap allocations
+    // made via new)
+    extern u32 ALLOCATIONS;
+
+    // ticks and allocations spent in PROFILE_BLOCKING scopes so far
+    extern u32 PAUSED_TICKS;
+    extern u32 PAUSED_ALLOCATIONS;
+    extern u8  PAUSE_DEPTH;
+
+    struct opcodeStats {
+        u32 m_count;
+        u32 m_ticks;
+    };
+
+    struct scriptRun {
+        u16 m_scriptId;
+        u16 m_instructions;
+        u32 m_ticks;
+    };
+
+    extern opcodeStats SCRIPT_OPCODE_STATS[ NUM_OPCODES ];
+    extern scriptRun   SLOWEST_SCRIPTS[ SLOWEST_SCRIPT_COUNT ];
+
+    /*
+     * @brief: Starts the hardware timers used for profiling.
+     */
+    void init( );
+
+    /*
+     * @brief: Returns the current value of the profiling tick counter (BUS_CLOCK ticks).
+     */
+    inline u32 ticks( ) {
+        return cpuGetTiming( );
+    }
+
+    u32 ticksToUs( u32 p_ticks );
+
+    /*
+     * @brief: Adds a single sample of p_ticks (during which p_allocations heap
+     * allocations were made) to the stats of phase p_phase.
+     */
+    void recordPhase( phase p_phase, u32 p_ticks, u32 p_allocations = 0 );
+
+    /*
+     * @brief: Records the time between its construction and its destruction for a phase.
+     */
+    class scopedTimer {
+        phase _phase;
+        u32   _start;
+        u32   _allocations;
+        u32   _pausedTicks;
+        u32   _pausedAllocations;
+
+      public:
+        scopedTimer( phase p_phase )
+            : _phase( p_phase ), _start( ticks( ) ), _allocations( ALLOCATIONS ),
+              _pausedTicks( PAUSED_TICKS ), _pausedAllocations( PAUSED_ALLOCATIONS ) {
+        }
+        ~scopedTimer( ) {
+            recordPhase( _phase, ticks( ) - _start - ( PAUSED_TICKS - _pausedTicks ),
+                         ALLOCATIONS - _allocations - ( PAUSED_ALLOCATIONS - _pausedAllocations ) );
+        }
+    };
+
+    /*
+     * @brief: Adds the time between its construction and its destruction to PAUSED_TICKS,
+     * so that surrounding scopedTimers skip it. Only the outermost of nested pauses counts.
+     */
+    class pauseTimer {
+        u32 _start;
+        u32 _allocations;
+
+      public:
+        pauseTimer( ) : _start( ticks( ) ), _allocations( ALLOCATIONS ) {
+            PAUSE_DEPTH++;
+        }
+        ~pauseTimer( ) {
+            if( !--PAUSE_DEPTH ) {
+                PAUSED_TICKS += ticks( ) - _start;
+                PAUSED_ALLOCATIONS += ALLOCATIONS - _allocations;
+            }
+        }
+    };
+
+    /*
+     * @brief: Collects timing data of a single map script invocation. Construct at the
+     * start of the script and call beginOpcode before executing each instruction; the
+     * data is recorded once the object goes out of scope.
+     */
+    class scriptProfile {
+        u16 _scriptId;
+        u16 _instructions = 0;
+        u8  _curOpcode    = 0;
+        u32 _start;
+        u32 _opcodeStart;
+
+      public:
+        scriptProfile( u16 p_scriptId );
+        ~scriptProfile( );
+
+        void beginOpcode( u8 p_opcode );
+
+      private:
+        void endOpcode( u32 p_now );
+    };
+
+    /*
+     * @brief: Clears all collected map script data.
+     */
+    void resetScriptStats( );
+
+    /*
+     * @brief: Shows the most expensive opcodes and the slowest script invocations in the
+     * message box.
+     */
+    void printScriptStats( );
+
+    /*
+     * @brief: Writes all collected map script data as csv to a file next to the save
+     * file.
+     */
+    bool dumpScriptStats( const char* p_path );
+
+    /*
+     * @brief: Clears all collected phase data.
+     */
+    void resetPhaseStats( );
+
+    u32 averageTicks( const phaseStats& p_stats );
+
+    /*
+     * @brief: Shows min/avg/max of all recorded phases in the message box.
+     */
+    void printPhaseStats( );
+
+    /*
+     * @brief: Writes min/avg/max and the histogram of all phases as csv to a file next
+     * to the save file. The first line identifies the build, so that dumps of different
+     * builds can be diffed directly.
+     */
+    bool dumpPhaseStats( const char* p_path );
+} // namespace PROF
+#else
+#define PROFILE_PHASE( p_phase ) \
+    {}
+#define PROFILE_BLOCKING( ) \
+    {}
+#endif
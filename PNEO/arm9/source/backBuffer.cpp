@@ -0,0 +1,161 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : backBuffer.cpp
+author      : Philip Wellnitz
+description : Main RAM copy of a bitmap layer that is copied to vram in vblank.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "io/backBuffer.h"
+#include "io/message.h"
+#include "prof/profiler.h"
+
+namespace IO {
+    backBuffer BACK_BUFFER;
+
+    // spans of at least this many words are copied via dma
+    constexpr u16 DMA_COPY_MIN_WORDS = 8;
+
+    void backBuffer::_clearDirty( ) {
+        std::memset( _dirtyFrom, 0xFF, sizeof( _dirtyFrom ) );
+        std::memset( _dirtyTo, 0, sizeof( _dirtyTo ) );
+        _dirtyMinY = SCREEN_HEIGHT;
+        _dirtyMaxY = 0;
+    }
+
+    void backBuffer::_markDirty( u16 p_x1, u16 p_y1, u16 p_x2, u16 p_y2 ) {
+        // set first, so that a vblank interrupting the update doesn't flush
+        _drawnThisFrame = true;
+
+        p_x2 = std::min( p_x2, u16( SCREEN_WIDTH - 1 ) );
+        p_y2 = std::min( p_y2, u16( SCREEN_HEIGHT - 1 ) );
+        if( p_x1 > p_x2 || p_y1 > p_y2 ) { return; }
+
+        for( u16 y = p_y1; y <= p_y2; ++y ) {
+            if( p_x1 < _dirtyFrom[ y ] ) { _dirtyFrom[ y ] = p_x1; }
+            if( p_x2 > _dirtyTo[ y ] ) { _dirtyTo[ y ] = p_x2; }
+        }
+        if( p_y1 < _dirtyMinY ) { _dirtyMinY = p_y1; }
+        if( p_y2 > _dirtyMaxY ) { _dirtyMaxY = p_y2; }
+    }
+
+    void backBuffer::enable( bool p_bottom, u8 p_layer ) {
+        if( _active ) { disable( ); }
+
+        std::memcpy( _buffer, _vram( p_bottom, p_layer ), SCREEN_WIDTH * SCREEN_HEIGHT );
+        _clearDirty( );
+        _bottom = p_bottom;
+        _layer  = p_layer;
+        _active = true;
+    }
+
+    void backBuffer::disable( bool p_flush ) {
+        if( !_active ) { return; }
+        if( p_flush ) { flush( false ); }
+        _active = false;
+        _clearDirty( );
+    }
+
+    void backBuffer::_copy( ) {
+        if( _dirtyMinY > _dirtyMaxY ) { return; }
+        PROFILE_PHASE( UI_FLUSH );
+
+        u32* src   = reinterpret_cast<u32*>( _buffer );
+        u32* dst   = reinterpret_cast<u32*>( _vram( _bottom, _layer ) );
+        u32  bytes = 0;
+
+        // dma reads main RAM directly, bypassing the data cache
+        DC_FlushRange( src + _dirtyMinY * SCREEN_WIDTH / 4,
+                       ( _dirtyMaxY - _dirtyMinY + 1 ) * SCREEN_WIDTH );
+
+        auto copyWords = [ & ]( u32 p_from, u32 p_count ) {
+            if( p_count >= DMA_COPY_MIN_WORDS ) {
+                dmaCopyWords( BACK_BUFFER_DMA_CHANNEL, src + p_from, dst + p_from, 4 * p_count );
+            } else {
+                for( u32 i = p_from; i < p_from + p_count; ++i ) { dst[ i ] = src[ i ]; }
+            }
+            bytes += 4 * p_count;
+        };
+
+        u16 fullFrom = 0, fullCount = 0;
+        for( u16 y = _dirtyMinY; y <= _dirtyMaxY; ++y ) {
+            if( _dirtyFrom[ y ] > _dirtyTo[ y ] ) { continue; }
+            u16 first = _dirtyFrom[ y ] >> 2, last = _dirtyTo[ y ] >> 2;
+
+            if( !first && last == SCREEN_WIDTH / 4 - 1 ) {
+                // consecutive complete lines are contiguous
+                if( fullCount && fullFrom + fullCount == y ) {
+                    ++fullCount;
+                } else {
+                    if( fullCount ) {
+                        copyWords( fullFrom * SCREEN_WIDTH / 4, fullCount * SCREEN_WIDTH / 4 );
+                    }
+                    fullFrom  = y;
+                    fullCount = 1;
+                }
+                continue;
+            }
+            copyWords( y * SCREEN_WIDTH / 4 + first, last - first + 1 );
+        }
+        if( fullCount ) { copyWords( fullFrom * SCREEN_WIDTH / 4, fullCount * SCREEN_WIDTH / 4 ); }
+
+        _clearDirty( );
+
+#ifdef DESQUID
+        _flushes++;
+        _totalBytes += bytes;
+        _lastBytes = bytes;
+#endif
+    }
+
+    void backBuffer::flush( bool p_waitForVBlank ) {
+        if( !_active ) { return; }
+
+        // keep the vblank handler from copying at the same time
+        _drawnThisFrame = true;
+        if( p_waitForVBlank ) { swiWaitForVBlank( ); }
+        _copy( );
+    }
+
+    void backBuffer::vblank( ) {
+        if( !_active ) { return; }
+        if( _drawnThisFrame ) {
+            // the screen may still be drawn; wait for a frame without changes
+            _drawnThisFrame = false;
+            return;
+        }
+        _copy( );
+    }
+
+#ifdef DESQUID
+    void backBuffer::printStats( ) const {
+        char buffer[ 100 ];
+        snprintf( buffer, 99, "Flushes: %lu\nLast: %luB Avg: %luB", _flushes, _lastBytes,
+                  _flushes ? _totalBytes / _flushes : 0 );
+        IO::printMessage( buffer, MSG_INFO );
+    }
+#endif
+} // namespace IO
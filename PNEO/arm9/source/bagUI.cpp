@@ -27,6 +27,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <vector>
 
 #include "bag/bagUI.h"
@@ -34,8 +35,10 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "bag/item.h"
 #include "defines.h"
 #include "fs/data.h"
+#include "io/backBuffer.h"
 #include "io/choiceBox.h"
 #include "io/screenFade.h"
+#include "io/spriteAllocator.h"
 #include "io/strings.h"
 #include "io/yesNoBox.h"
 #include "save/saveGame.h"
@@ -76,6 +79,11 @@ namespace BAG {
     constexpr u8 SPR_BACK_PAL_SUB     = 12;
     constexpr u8 SPR_DOWN_PAL_SUB     = 13;
     constexpr u8 SPR_TRANSFER_PAL_SUB = 15;
+
+    // tiles of the tm, type and category icons on the top screen
+    constexpr u16 RESERVED_TILES_TOP = 64;
+    // vram asset of the currently shown item icon on the top screen
+    u8 ITEM_ICON_ASSET = IO::NO_SPRITE_ASSET;
     // constexpr u8 SPR_TYPE_PAL_SUB( u8 p_type ) {
     //     return 10 + ( p_type )
     // }
@@ -111,6 +119,8 @@ namespace BAG {
     void bagUI::init( ) {
         IO::fadeScreen( IO::CLEAR_DARK_IMMEDIATE, true, true );
         IO::initOAMTable( false );
+        IO::SPRITE_ALLOCATOR[ false ].init( RESERVED_TILES_TOP );
+        ITEM_ICON_ASSET = IO::NO_SPRITE_ASSET;
         // Don't init anything else for the top screen here
         IO::initOAMTable( true );
         IO::vramSetup( );
@@ -270,6 +280,9 @@ namespace BAG {
 
         initColors( );
         bgUpdate( );
+
+        // all further text and boxes on the bottom screen are composed off-screen
+        IO::BACK_BUFFER.enable( true, 1 );
     }
 
     u16 bagUI::drawPkmnIcons( ) {
@@ -290,11 +303,35 @@ namespace BAG {
         return tileCnt;
     }
 
+    /*
+     * @brief: Shows the icon of the given item on the top screen; the icons of recently
+     * shown items stay in vram, so that they don't need to be loaded again.
+     */
+    void drawItemIconTop( u16 p_itemId ) {
+        auto& tiles = IO::SPRITE_ALLOCATOR[ false ];
+        bool  fresh = false;
+
+        // 32x32 sprites with 16 colors take 16 tiles
+        ITEM_ICON_ASSET = tiles.acquire( IO::itemIconKey( p_itemId ), 16, fresh );
+        if( ITEM_ICON_ASSET == IO::NO_SPRITE_ASSET ) {
+            IO::loadItemIcon( p_itemId, 112, 44, 0, 0, 0, false );
+        } else if( fresh ) {
+            IO::loadItemIcon( p_itemId, 112, 44, 0, 0, tiles.tile( ITEM_ICON_ASSET ), false );
+            std::memcpy( tiles.palette( ITEM_ICON_ASSET ), SPRITE_PALETTE, 16 * sizeof( u16 ) );
+        } else {
+            IO::loadSprite( 0, 0, tiles.tile( ITEM_ICON_ASSET ), 112, 44, 32, 32,
+                            tiles.palette( ITEM_ICON_ASSET ), nullptr, 512, false, false, false,
+                            OBJPRIORITY_0, false );
+        }
+    }
+
     void drawItemTop( u16 p_itemId, const itemData* p_data, u16 p_count ) {
         IO::OamTop->oamBuffer[ 0 ].isHidden = true;
         IO::OamTop->oamBuffer[ 1 ].isHidden = true;
         IO::OamTop->oamBuffer[ 2 ].isHidden = true;
         IO::updateOAM( false );
+        IO::SPRITE_ALLOCATOR[ false ].release( ITEM_ICON_ASSET );
+        ITEM_ICON_ASSET = IO::NO_SPRITE_ASSET;
 
         if( !p_itemId || p_data == nullptr ) { return; }
 
@@ -302,7 +339,7 @@ namespace BAG {
         char        buffer[ 100 ];
 
         if( p_data->m_itemType != ITEMTYPE_TM ) {
-            IO::loadItemIcon( p_itemId, 112, 44, 0, 0, 0, false );
+            drawItemIconTop( p_itemId );
 
             if( p_data->m_itemType & ITEMTYPE_BERRY ) {
                 snprintf( buffer, 90, "%s%hu: %s", GET_STRING( IO::STR_UI_BAG_NUMBER ),
@@ -340,13 +377,13 @@ namespace BAG {
                       FS::getMoveName( p_data->m_param2 ).c_str( ) );
             IO::regularFont->printStringC( buffer, 128, 26, false, IO::font::CENTER );
 
-            IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_TYPE ), 56, 147, false,
-                                           IO::font::RIGHT );
+            IO::regularFont->printStaticStringC( IO::STR_UI_BAG_TYPE, 56, 147, false,
+                                                 IO::font::RIGHT );
             tileCnt
                 = IO::loadTypeIcon( move.m_type, 62, 146, 1, 1, tileCnt, false, CURRENT_LANGUAGE );
 
-            IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_CATEGORY ), 146, 147, false,
-                                           IO::font::RIGHT );
+            IO::regularFont->printStaticStringC( IO::STR_UI_BAG_CATEGORY, 146, 147, false,
+                                                 IO::font::RIGHT );
             IO::loadDamageCategoryIcon( move.m_category, 152, 146, 2, 2, tileCnt, false );
 
             snprintf( buffer, 99, "%s  %2d", GET_STRING( IO::STR_UI_BAG_PP ), move.m_pp );
@@ -374,8 +411,9 @@ namespace BAG {
             IO::regularFont->setColor( IO::BLACK_IDX, 1 );
         }
 
-        IO::regularFont->printBreakingStringC( descr.c_str( ), 33, 83, 196, false, IO::font::LEFT,
-                                               11 );
+        IO::regularFont->printLayout( IO::regularFont->cachedLayout( descr.c_str( ), p_itemId, 196,
+                                                                     IO::font::LEFT, 11, ' ', 0, 1 ),
+                                      33, 83, false );
         IO::updateOAM( false );
         IO::fadeScreen( IO::UNFADE_IMMEDIATE, true, true );
     }
@@ -430,8 +468,8 @@ namespace BAG {
             if( _playerTeam[ i ].isEgg( ) ) {
                 IO::regularFont->setColor( IO::WHITE_IDX, 1 );
                 IO::regularFont->setColor( IO::GRAY_IDX, 2 );
-                IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_PARTY_EGG ), 45,
-                                               SINGLE_LINE, true );
+                IO::regularFont->printStaticStringC( IO::STR_UI_BAG_PARTY_EGG, 45, SINGLE_LINE,
+                                                     true );
             } else {
                 if( p_data == nullptr ) {
                     IO::regularFont->printStringC( _playerTeam[ i ].m_boxdata.m_name, 45,
@@ -442,8 +480,8 @@ namespace BAG {
                         IO::regularFont->printStringC( _teamItemCache[ i ].second.c_str( ), 45,
                                                        SECOND_LINE, true );
                     } else
-                        IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_PARTY_NO_ITEM ),
-                                                       45, SECOND_LINE, true );
+                        IO::regularFont->printStaticStringC( IO::STR_UI_BAG_PARTY_NO_ITEM, 45,
+                                                             SECOND_LINE, true );
 
                     continue;
                 }
@@ -462,16 +500,16 @@ namespace BAG {
                         || currMv == _playerTeam[ i ].getMove( 3 ) ) {
                         IO::regularFont->setColor( IO::BLUE_IDX, 1 );
                         IO::regularFont->setColor( 0, 2 );
-                        IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_ALREADY_LEARNED ),
-                                                       45, SECOND_LINE, true, IO::font::LEFT, 11 );
+                        IO::regularFont->printStaticStringC( IO::STR_UI_BAG_ALREADY_LEARNED, 45,
+                                                             SECOND_LINE, true, IO::font::LEFT, 11 );
                     } else if( FS::canLearn( _playerTeam[ i ].getSpecies( ),
                                              _playerTeam[ i ].getForme( ), currMv,
                                              FS::LEARN_TM ) ) {
                         BG_PALETTE_SUB[ IO::COLOR_IDX ] = IO::GREEN;
                         IO::regularFont->setColor( IO::COLOR_IDX, 1 );
                         IO::regularFont->setColor( 0, 2 );
-                        IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_LEARN_POSSIBLE ),
-                                                       45, SECOND_LINE, true );
+                        IO::regularFont->printStaticStringC( IO::STR_UI_BAG_LEARN_POSSIBLE, 45,
+                                                             SECOND_LINE, true );
                     } else {
                         IO::regularFont->setColor( IO::RED_IDX, 1 );
                         IO::regularFont->setColor( 0, 2 );
@@ -497,13 +535,13 @@ namespace BAG {
                         BG_PALETTE_SUB[ IO::COLOR_IDX ] = IO::GREEN;
                         IO::regularFont->setColor( IO::COLOR_IDX, 1 );
                         IO::regularFont->setColor( 0, 2 );
-                        IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_POSSIBLE ), 45,
-                                                       SECOND_LINE, true );
+                        IO::regularFont->printStaticStringC( IO::STR_UI_BAG_POSSIBLE, 45,
+                                                             SECOND_LINE, true );
                     } else {
                         IO::regularFont->setColor( IO::RED_IDX, 1 );
                         IO::regularFont->setColor( 0, 2 );
-                        IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_NOT_POSSIBLE ),
-                                                       45, SECOND_LINE, true, IO::font::LEFT, 11 );
+                        IO::regularFont->printStaticStringC( IO::STR_UI_BAG_NOT_POSSIBLE, 45,
+                                                             SECOND_LINE, true, IO::font::LEFT, 11 );
                     }
                 } else {
                     IO::regularFont->setColor( 0, 2 );
@@ -512,8 +550,8 @@ namespace BAG {
                         IO::regularFont->printStringC( _teamItemCache[ i ].second.c_str( ), 45,
                                                        SECOND_LINE, true );
                     } else
-                        IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_PARTY_NO_ITEM ),
-                                                       45, SECOND_LINE, true );
+                        IO::regularFont->printStaticStringC( IO::STR_UI_BAG_PARTY_NO_ITEM, 45,
+                                                             SECOND_LINE, true );
                 }
             }
         }
@@ -601,8 +639,8 @@ namespace BAG {
         dmaFillWords( 0, bgGetGfxPtr( IO::bg2 ), 256 * 192 );
         IO::regularFont->setColor( IO::WHITE_IDX, 1 );
         IO::regularFont->setColor( IO::GRAY_IDX, 2 );
-        IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_PAGE_NAME_START + p_page ), 128,
-                                       4, false, IO::font::CENTER );
+        IO::regularFont->printStaticStringC( IO::STR_UI_BAG_PAGE_NAME_START + p_page, 128, 4, false,
+                                             IO::font::CENTER );
         IO::regularFont->setColor( IO::BLACK_IDX, 1 );
         IO::regularFont->setColor( IO::GRAY_IDX, 2 );
     }
@@ -617,8 +655,8 @@ namespace BAG {
         IO::updateOAM( true );
         IO::regularFont->setColor( IO::WHITE_IDX, 1 );
         IO::regularFont->setColor( IO::GRAY_IDX, 2 );
-        IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_CHOOSE_PKMN ), 67, 5, true,
-                                       IO::font::CENTER );
+        IO::regularFont->printStaticStringC( IO::STR_UI_BAG_CHOOSE_PKMN, 67, 5, true,
+                                             IO::font::CENTER );
         IO::regularFont->setColor( IO::BLACK_IDX, 1 );
         IO::regularFont->setColor( IO::GRAY_IDX, 2 );
     }
@@ -770,8 +808,8 @@ namespace BAG {
         IO::printRectangle( oam[ SPR_MSG_BOX_OAM_SUB ].x, oam[ SPR_MSG_BOX_OAM_SUB ].y,
                             256 - oam[ SPR_MSG_BOX_OAM_SUB ].x, oam[ SPR_MSG_BOX_OAM_SUB ].y + 31,
                             true, 0 );
-        IO::regularFont->printStringC( GET_STRING( p_message ), 128,
-                                       oam[ SPR_MSG_BOX_OAM_SUB ].y + 8, true, IO::font::CENTER );
+        IO::regularFont->printStaticStringC( p_message, 128, oam[ SPR_MSG_BOX_OAM_SUB ].y + 8, true,
+                                             IO::font::CENTER );
 
         // counter window
         for( u8 j = 0; j < SPRITES_PER_CB_WINDOW; j++ ) {
@@ -1026,8 +1064,9 @@ namespace BAG {
         IO::printRectangle( oam[ SPR_MSG_BOX_OAM_SUB ].x, oam[ SPR_MSG_BOX_OAM_SUB ].y,
                             256 - oam[ SPR_MSG_BOX_OAM_SUB ].x, oam[ SPR_MSG_BOX_OAM_SUB ].y + 31,
                             true, 0 );
-        IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_CHOOSE_MOVE ), 128,
-                                       oam[ SPR_MSG_BOX_OAM_SUB ].y + 8, true, IO::font::CENTER );
+        IO::regularFont->printStaticStringC( IO::STR_UI_BAG_CHOOSE_MOVE, 128,
+                                             oam[ SPR_MSG_BOX_OAM_SUB ].y + 8, true,
+                                             IO::font::CENTER );
 
         for( u8 i = 0; i < 4 + !!p_extraMove; ++i ) {
             if( i < 4 && !p_pokemon->getMove( i ) ) { break; }
@@ -1130,8 +1169,8 @@ namespace BAG {
             }
         } else {
             for( u8 i = 0; i < MAX_ITEMS_PER_PAGE; ++i ) { drawItemSub( 0, nullptr, i ); }
-            IO::regularFont->printStringC( GET_STRING( IO::STR_UI_BAG_EMPTY ), 182, 89, true,
-                                           IO::font::CENTER );
+            IO::regularFont->printStaticStringC( IO::STR_UI_BAG_EMPTY, 182, 89, true,
+                                                 IO::font::CENTER );
             IO::updateOAM( false );
         }
         IO::updateOAM( true );
@@ -33,6 +33,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "fs/data.h"
 #include "gen/itemNames.h"
 #include "io/animations.h"
+#include "io/backBuffer.h"
 #include "io/choiceBox.h"
 #include "io/counter.h"
 #include "io/strings.h"
@@ -882,6 +883,7 @@ namespace BAG {
     }
 
     u16 bagViewer::run( ) {
+        IO::backBufferScope bb;
         _currSelectedIdx = 0;
         initUI( );
 
@@ -906,6 +908,7 @@ namespace BAG {
     }
 
     u16 bagViewer::getItem( bool p_removeItem ) {
+        IO::backBufferScope bb;
         _currSelectedIdx = 0;
         initUI( );
 
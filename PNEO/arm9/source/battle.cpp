@@ -25,6 +25,8 @@ You should have received a copy of the GNU General Public License
 along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <bit>
 #include <string>
 
 #include "bag/bagViewer.h"
@@ -34,6 +36,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "battle/battleSlot.h"
 #include "battle/battleTrainer.h"
 #include "battle/battleUI.h"
+#include "battle/moveTable.h"
 #include "defines.h"
 #include "dex/dex.h"
 #include "fs/data.h"
@@ -44,19 +47,23 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "io/uio.h"
 #include "io/yesNoBox.h"
 #include "pokemon.h"
+#include "prof/profiler.h"
 #include "save/saveGame.h"
 #include "sound/sound.h"
 #include "sts/partyScreen.h"
 
 namespace BATTLE {
+    u32* MOVE_USAGE = nullptr;
+
     battle::battle( pokemon* p_playerTeam, u8 p_playerTeamSize, const battleTrainer& p_opponentId,
-                    battlePolicy p_policy ) {
+                    battlePolicy p_policy, bool p_headless ) {
         _playerTeam     = p_playerTeam;
         _playerTeamSize = p_playerTeamSize;
 
         _opponent = p_opponentId;
 
-        _policy = p_policy;
+        _policy    = p_policy;
+        _maxRounds = _policy.m_roundLimit;
 
         if( _policy.m_mode == BM_MOCK ) {
             _policy.m_mode = BM_SINGLE;
@@ -69,16 +76,16 @@ namespace BATTLE {
 
         _field    = field( _policy.m_mode, false, p_policy.m_weather );
         _battleUI = battleUI( _opponent.m_data.m_battlePlat1, _opponent.m_data.m_battlePlat2,
-                              _opponent.m_data.m_battleBG, _policy.m_mode, false );
+                              _opponent.m_data.m_battleBG, _policy.m_mode, false, p_headless );
 
         _opponentRuns = false;
 
         // adjust difficulty
         _opponentTeamSize = _opponent.m_data.m_numPokemon;
 
+        std::memset( _yieldEXP, 0, sizeof( _yieldEXP ) );
         for( u8 i = 0; i < _opponentTeamSize; ++i ) {
             _opponentTeam[ i ] = pokemon( _opponent.m_data.m_pokemon[ i ] );
-            _yieldEXP[ i ]     = std::set<u8>( );
         }
         switch( SAVE::SAV.getActiveFile( ).m_options.getDifficulty( ) ) {
         case 0:
@@ -117,10 +124,11 @@ namespace BATTLE {
 
         _opponent          = battleTrainer( );
         _opponentTeam[ 0 ] = p_opponent;
-        _yieldEXP[ 0 ]     = std::set<u8>( );
         _opponentTeamSize  = 1;
+        std::memset( _yieldEXP, 0, sizeof( _yieldEXP ) );
 
-        _policy = p_policy;
+        _policy    = p_policy;
+        _maxRounds = _policy.m_roundLimit;
         if( _policy.m_mode == BM_MOCK ) {
             _policy.m_mode = BM_SINGLE;
             _isMockBattle  = true;
@@ -139,32 +147,62 @@ namespace BATTLE {
     }
 
     battle::battleEndReason battle::start( ) {
+        return start( ( u32( rand( ) ) << 16 ) ^ u32( rand( ) ) );
+    }
+
+    battle::battleEndReason battle::replay( battleReplay& p_replay ) {
+        // a log with missing choices would play out differently
+        if( !p_replay.isComplete( ) ) { return battle::BATTLE_NONE; }
+        _replay    = &p_replay;
+        _replaying = true;
+        _replay->rewind( );
+        return start( _replay->getSeed( ) );
+    }
+
+    battle::battleEndReason battle::start( u32 p_seed ) {
         if( !_opponentTeamSize || !_playerTeamSize ) { return battle::BATTLE_NONE; }
 
+        _field.rng( ).seed( p_seed );
+        _playerAIRng.seed( ~p_seed );
+        if( !_replaying ) { _replay->reset( p_seed ); }
+
         constexpr u8 TMP_BUFFER_SIZE = 100;
         char         buffer[ TMP_BUFFER_SIZE + 10 ];
 
-        swiWaitForVBlank( );
-        scanKeys( );
+        bool headless = _battleUI.isHeadless( );
+        if( !headless ) {
+            swiWaitForVBlank( );
+            scanKeys( );
+        }
 
         battleEndReason battleEnd = BATTLE_NONE;
         initBattle( );
 
-        swiWaitForVBlank( );
-        scanKeys( );
+        if( !headless ) {
+            swiWaitForVBlank( );
+            scanKeys( );
+        }
 
         _round = 0;
+        if( !_isWildBattle ) { initMatchups( ); }
+
         // Main battle loop
         while( !_maxRounds || _round < _maxRounds ) {
+            PROFILE_PHASE( BATTLE_TURN );
             _round++;
 
+            // the ai plans its switches anew for every turn
+            std::memset( _plannedSwitches, 0, sizeof( _plannedSwitches ) );
+
             // register pkmn for exp
+            u8 battling = 0;
+            for( u8 j = 0; j < getBattlingPKMNCount( _policy.m_mode ); ++j ) {
+                auto pk = _field.getPkmn( field::PLAYER_SIDE, j );
+                if( pk == nullptr ) { continue; }
+                if( pk->canBattle( ) ) { battling |= 1 << _playerPkmnPerm[ j ]; }
+            }
             for( u8 i = 0; i < getBattlingPKMNCount( _policy.m_mode ); ++i ) {
-                for( u8 j = 0; j < getBattlingPKMNCount( _policy.m_mode ); ++j ) {
-                    auto pk = _field.getPkmn( field::PLAYER_SIDE, j );
-                    if( pk == nullptr ) { continue; }
-                    if( pk->canBattle( ) ) { _yieldEXP[ i ].insert( _playerPkmnPerm[ j ] ); }
-                }
+                _yieldEXP[ i ] |= battling;
             }
 
             battleMoveSelection moves[ field::NUM_SIDES ][ side::MAX_PKMN_PER_SIDE ]
@@ -173,8 +211,27 @@ namespace BATTLE {
             // Compute player's moves
             bool playerWillRun   = false;
             u16  playerWillCatch = 0;
-            loop( ) {
-                WAIT( HALF_SEC );
+            if( _replaying ) {
+                // the log replaces the player's input
+                for( u8 i = 0; i < getBattlingPKMNCount( _policy.m_mode ); ++i ) {
+                    if( !_replay->next( moves[ field::PLAYER_SIDE ][ i ] ) ) {
+                        moves[ field::PLAYER_SIDE ][ i ] = NO_OP_SELECTION;
+                    }
+                }
+                auto choice = NO_OP_SELECTION;
+                if( _replay->next( choice, MT_RUN ) ) {
+                    playerWillRun = true;
+                } else if( _replay->next( choice, MT_CAPTURE ) ) {
+                    playerWillCatch = choice.m_param;
+                }
+            } else if( headless ) {
+                // the ai plays for the player as well
+                for( u8 i = 0; i < getBattlingPKMNCount( _policy.m_mode ); ++i ) {
+                    moves[ field::PLAYER_SIDE ][ i ] = getAIMove( i, false );
+                }
+            }
+            while( !headless && !_replaying ) {
+                _battleUI.wait( HALF_SEC );
 
                 if( _field.getPkmn( field::PLAYER_SIDE, field::PKMN_0 ) == nullptr ) {
                     // There is no first pkmn, so it cannot move.
@@ -236,14 +293,30 @@ namespace BATTLE {
                 break;
             }
 
+            if( !_replaying ) {
+                for( u8 i = 0; i < getBattlingPKMNCount( _policy.m_mode ); ++i ) {
+                    _replay->record( moves[ field::PLAYER_SIDE ][ i ] );
+                }
+                // running and captures cancel the moves; they get a choice of their own
+                auto choice = NO_OP_SELECTION;
+                if( playerWillRun ) {
+                    choice.m_type = MT_RUN;
+                    _replay->record( choice );
+                } else if( playerWillCatch ) {
+                    choice.m_type  = MT_CAPTURE;
+                    choice.m_param = playerWillCatch;
+                    _replay->record( choice );
+                }
+            }
+
             // Check if opposing pkmn flees the battle
             if( _isWildBattle && _opponentRuns
                 && _field.canSwitchOut( field::OPPONENT_SIDE, field::PKMN_0 ) ) {
                 SOUND::playSoundEffect( SFX_BATTLE_ESCAPE );
                 snprintf( buffer, TMP_BUFFER_SIZE, GET_STRING( IO::STR_UI_BATTLE_WILD_PKMN_FLED ),
                           _opponentTeam[ field::PKMN_0 ].m_boxdata.m_name );
-                _battleUI.log( std::string( buffer ) );
-                WAIT( THREE_QUARTER_SEC );
+                _battleUI.log( buffer );
+                _battleUI.wait( THREE_QUARTER_SEC );
                 endBattle( battleEnd = BATTLE_RUN );
                 return battleEnd;
             }
@@ -263,7 +336,8 @@ namespace BATTLE {
                           || moves[ field::PLAYER_SIDE ][ field::PKMN_0 ].m_param == I_FLUFFY_TAIL
                           || moves[ field::PLAYER_SIDE ][ field::PKMN_0 ].m_param
                                  == I_POKE_TOY ) ) ) [[likely]] {
-                if( moves[ field::PLAYER_SIDE ][ field::PKMN_0 ].m_type == MT_USE_ITEM ) {
+                if( moves[ field::PLAYER_SIDE ][ field::PKMN_0 ].m_type == MT_USE_ITEM
+                    && !headless ) {
                     // player uses special item to escape the battle; remove said item
                     // from the player's bag
                     SAVE::SAV.getActiveFile( ).m_bag.erase(
@@ -271,14 +345,14 @@ namespace BATTLE {
                 }
 
                 SOUND::playSoundEffect( SFX_BATTLE_ESCAPE );
-                _battleUI.log( std::string( GET_STRING( IO::STR_UI_BATTLE_GOT_AWAY_SAFELY ) ) );
-                WAIT( THREE_QUARTER_SEC );
+                _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_GOT_AWAY_SAFELY ) );
+                _battleUI.wait( THREE_QUARTER_SEC );
                 endBattle( battleEnd = BATTLE_RUN );
                 return battleEnd;
             } else if( playerWillRun ) [[unlikely]] {
                 // escape failed
-                _battleUI.log( std::string( GET_STRING( IO::STR_UI_BATTLE_COULDNT_ESCAPE ) ) );
-                WAIT( THREE_QUARTER_SEC );
+                _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_COULDNT_ESCAPE ) );
+                _battleUI.wait( THREE_QUARTER_SEC );
             }
 
             // Check if player successfully catches
@@ -288,7 +362,7 @@ namespace BATTLE {
             }
 
             // Sort moves
-            std::vector<battleMoveSelection> selection = std::vector<battleMoveSelection>( );
+            battleMoveSelections selection;
             for( u8 side = 0; side < field::NUM_SIDES; ++side )
                 for( u8 i = 0; i < getBattlingPKMNCount( _policy.m_mode ); ++i ) {
                     // Check for pursuit
@@ -307,7 +381,11 @@ namespace BATTLE {
                     selection.push_back( moves[ side ][ i ] );
                 }
 
-            auto sortedMoves = _field.computeSortedBattleMoves( &_battleUI, selection );
+            battleMoves sortedMoves;
+            {
+                PROFILE_PHASE( BATTLE_SORT_MOVES );
+                sortedMoves = _field.computeSortedBattleMoves( &_battleUI, selection );
+            }
 
             // Mega evolve battlers
             for( size_t i = 0; i < sortedMoves.size( ); ++i ) {
@@ -320,42 +398,46 @@ namespace BATTLE {
 
             // Execute moves
             for( size_t i = 0; i < sortedMoves.size( ); ++i ) {
-                WAIT( HALF_SEC );
+                _battleUI.wait( HALF_SEC );
                 // show messages for special items
                 if( sortedMoves[ i ].m_type == MT_MESSAGE_ITEM ) [[unlikely]] {
-                    auto itmnm = FS::getItemName( sortedMoves[ i ].m_param );
-                    auto fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_USE_ITEM_TO_ACT_FIRST ) );
-                    snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ), itmnm.c_str( ),
-                              _battleUI
-                                  .getPkmnName(
-                                      _field.getPkmnOrDisguise( sortedMoves[ i ].m_user.first,
-                                                                sortedMoves[ i ].m_user.second ),
-                                      sortedMoves[ i ].m_user.first, false )
-                                  .c_str( ),
-                              itmnm.c_str( ) );
-                    _battleUI.log( std::string( buffer ) );
+                    if( !_battleUI.isHeadless( ) ) {
+                        auto itmnm = FS::getItemName( sortedMoves[ i ].m_param );
+                        auto fmt   = GET_STRING( IO::STR_UI_BATTLE_USE_ITEM_TO_ACT_FIRST );
+                        auto user  = _field.getPkmnOrDisguise( sortedMoves[ i ].m_user.first,
+                                                               sortedMoves[ i ].m_user.second );
+                        auto name  = _battleUI.getPkmnName( user, sortedMoves[ i ].m_user.first,
+                                                            false );
+                        snprintf( buffer, TMP_BUFFER_SIZE, fmt, itmnm.c_str( ), name.c_str( ),
+                                  itmnm.c_str( ) );
+                        _battleUI.log( buffer );
+                    }
                 }
 
                 // show special messages for special moves
                 if( sortedMoves[ i ].m_type == MT_MESSAGE_MOVE ) [[unlikely]] {
-                    auto pnm = std::string( _battleUI.getPkmnName(
+                    auto pnm = _battleUI.getPkmnName(
                         _field.getPkmnOrDisguise( sortedMoves[ i ].m_user.first,
                                                   sortedMoves[ i ].m_user.second ),
-                        sortedMoves[ i ].m_user.first, false ) );
+                        sortedMoves[ i ].m_user.first, false );
                     switch( sortedMoves[ i ].m_param ) {
                     case M_SHELL_TRAP:
-                        snprintf( buffer, TMP_BUFFER_SIZE,
-                                  GET_STRING( IO::STR_UI_BATTLE_PREPARE_SHELL_TRAP ),
-                                  pnm.c_str( ) );
-                        _battleUI.log( buffer );
+                        if( !_battleUI.isHeadless( ) ) {
+                            snprintf( buffer, TMP_BUFFER_SIZE,
+                                      GET_STRING( IO::STR_UI_BATTLE_PREPARE_SHELL_TRAP ),
+                                      pnm.c_str( ) );
+                            _battleUI.log( buffer );
+                        }
                         _field.addVolatileStatus( &_battleUI, sortedMoves[ i ].m_user.first,
                                                   sortedMoves[ i ].m_user.second, VS_SHELLTRAP, 1 );
                         break;
                     case M_FOCUS_PUNCH:
-                        snprintf( buffer, TMP_BUFFER_SIZE,
-                                  GET_STRING( IO::STR_UI_BATTLE_PREPARE_FOCUS_PUNCH ),
-                                  pnm.c_str( ) );
-                        _battleUI.log( buffer );
+                        if( !_battleUI.isHeadless( ) ) {
+                            snprintf( buffer, TMP_BUFFER_SIZE,
+                                      GET_STRING( IO::STR_UI_BATTLE_PREPARE_FOCUS_PUNCH ),
+                                      pnm.c_str( ) );
+                            _battleUI.log( buffer );
+                        }
                         _field.addVolatileStatus( &_battleUI, sortedMoves[ i ].m_user.first,
                                                   sortedMoves[ i ].m_user.second, VS_FOCUSPUNCH,
                                                   1 );
@@ -374,17 +456,13 @@ namespace BATTLE {
 
                 // pkmn attacks
                 if( sortedMoves[ i ].m_type == MT_ATTACK ) [[likely]] {
-                    std::vector<battleMove> targets    = std::vector<battleMove>( );
-                    std::vector<battleMove> targetedBy = std::vector<battleMove>( );
-
-                    for( auto m : sortedMoves ) {
-                        for( auto t : sortedMoves[ i ].m_target )
-                            if( t == m.m_user ) { targets.push_back( m ); }
-                        for( auto t : m.m_target )
-                            if( t == sortedMoves[ i ].m_user ) { targetedBy.push_back( m ); }
+                    if( MOVE_USAGE && sortedMoves[ i ].m_param < MAX_MOVE_USAGE_ID ) [[unlikely]] {
+                        MOVE_USAGE[ sortedMoves[ i ].m_param ]++;
+                    }
+                    {
+                        PROFILE_PHASE( BATTLE_USE_MOVE );
+                        _field.executeBattleMove( &_battleUI, sortedMoves[ i ] );
                     }
-
-                    _field.executeBattleMove( &_battleUI, sortedMoves[ i ], targets, targetedBy );
 
                     distributeEXP( );
                     checkAndRefillBattleSpots( slot::status::RECALLED );
@@ -408,7 +486,10 @@ namespace BATTLE {
             }
 
             // execute end-of-turn effects
-            _field.age( &_battleUI );
+            {
+                PROFILE_PHASE( BATTLE_END_OF_TURN );
+                _field.age( &_battleUI );
+            }
 
             distributeEXP( );
             if( endConditionHit( battleEnd ) ) {
@@ -417,13 +498,17 @@ namespace BATTLE {
             }
 
             checkAndRefillBattleSpots( slot::status::FAINTED );
+            if( !_isWildBattle ) { updateMatchups( ); }
         }
         endBattle( battleEnd );
         return battleEnd;
     }
 
     void battle::initBattle( ) {
-        SOUND::initBattleSound( );
+        // all move data the battle needs, so that turns don't need to access the file
+        MOVE_TABLE.load( _playerTeam, _playerTeamSize, _opponentTeam, _opponentTeamSize );
+
+        if( !_battleUI.isHeadless( ) ) { SOUND::initBattleSound( ); }
 
         _battleUI.init( _field.getWeather( ), _field.getTerrain( ) );
 
@@ -478,7 +563,7 @@ namespace BATTLE {
 
     battleMoveSelection battle::chooseTarget( const battleMoveSelection& p_move ) {
         auto res       = p_move;
-        res.m_moveData = FS::getMoveData( res.m_param );
+        res.m_moveData = MOVE_TABLE.get( res.m_param );
 
         if( _policy.m_mode == BM_SINGLE ) {
             switch( res.m_moveData.m_target ) {
@@ -606,10 +691,10 @@ namespace BATTLE {
             auto curSel = 0;
             _battleUI.showAttackSelection( _field.getPkmnOrDisguise( field::PLAYER_SIDE, p_slot ),
                                            canUse, mega, curSel, res.m_megaEvolve );
-            WAIT( HALF_SEC );
+            _battleUI.wait( HALF_SEC );
             _battleUI.showAttackSelection( _field.getPkmnOrDisguise( field::PLAYER_SIDE, p_slot ),
                                            canUse, mega, curSel = 2, res.m_megaEvolve );
-            WAIT( FULL_SEC );
+            _battleUI.wait( FULL_SEC );
             res.m_param     = _field.getPkmn( field::PLAYER_SIDE, p_slot )->getMove( curSel );
             _lastMoveChoice = curSel;
             return chooseTarget( res );
@@ -727,9 +812,10 @@ namespace BATTLE {
                     res.m_type  = MT_CAPTURE;
                     res.m_param = itm;
                 } else if( ( idata.m_itemType & 15 ) == 2 ) {
-                    // Already used
+                    // Already used; the log doesn't know on which pkmn
                     res.m_type  = MT_NO_OP_NO_CANCEL;
                     res.m_param = 0;
+                    _replay->invalidate( );
                 } else {
                     res.m_type  = MT_USE_ITEM;
                     res.m_param = itm;
@@ -778,17 +864,17 @@ namespace BATTLE {
             if( _field.getPkmn( field::PLAYER_SIDE, field::PKMN_0 )->m_stats.m_curHP * 2
                     > _field.getPkmn( field::PLAYER_SIDE, field::PKMN_0 )->m_stats.m_maxHP
                 && _round <= 2 ) { // Choose tackle
-                WAIT( FULL_SEC );
+                _battleUI.wait( FULL_SEC );
 
                 SOUND::playSoundEffect( SFX_CHOOSE );
                 return chooseAttack( p_slot, p_allowMegaEvolution );
             } else { // throw a poke ball
-                WAIT( FULL_SEC );
+                _battleUI.wait( FULL_SEC );
 
                 SOUND::playSoundEffect( SFX_CHOOSE );
                 _battleUI.showMoveSelection( _field.getPkmnOrDisguise( field::PLAYER_SIDE, p_slot ),
                                              p_slot, curSel = 3 );
-                WAIT( FULL_SEC );
+                _battleUI.wait( FULL_SEC );
 
                 BAG::bagViewer bv = BAG::bagViewer( _playerTeam, BAG::bagViewer::MOCK_BATTLE );
                 bv.getItem( );
@@ -957,6 +1043,14 @@ namespace BATTLE {
 
     u16  MOVE_BUFFER[ 20 ];
     void battle::endBattle( battle::battleEndReason p_battleEndReason ) {
+        MOVE_TABLE.clear( );
+        if( _battleUI.isHeadless( ) ) {
+            // simulated battle; no money, moves or evolutions
+            restoreInitialOrder( false );
+            resetBattleTransformations( false );
+            return;
+        }
+
         constexpr u8 TMP_BUFFER_SIZE = 100;
         char         buffer[ TMP_BUFFER_SIZE + 10 ];
         if( p_battleEndReason == BATTLE_OPPONENT_WON ) { SOUND::setVolume( 0 ); }
@@ -965,7 +1059,7 @@ namespace BATTLE {
             if( p_battleEndReason == BATTLE_CAPTURE ) {
                 handleCapture( );
             } else {
-                WAIT( THREEHALF_SEC );
+                _battleUI.wait( THREEHALF_SEC );
             }
         } else if( !_isWildBattle ) {
             if( p_battleEndReason == BATTLE_PLAYER_WON ) {
@@ -976,7 +1070,7 @@ namespace BATTLE {
                     snprintf( buffer, TMP_BUFFER_SIZE, GET_STRING( IO::STR_UI_BATTLE_WIN_MONEY ),
                               _opponent.m_data.m_moneyMultiplier );
                     _battleUI.log( buffer );
-                    WAIT( FULL_SEC );
+                    _battleUI.wait( FULL_SEC );
                     SAVE::SAV.getActiveFile( ).m_money += _opponent.m_data.m_moneyMultiplier;
                     if( SAVE::SAV.getActiveFile( ).m_money > 999'999'999 ) {
                         SAVE::SAV.getActiveFile( ).m_money = 999'999'999;
@@ -990,7 +1084,7 @@ namespace BATTLE {
                     snprintf( buffer, TMP_BUFFER_SIZE, GET_STRING( IO::STR_UI_BATTLE_LOSE_MONEY ),
                               _opponent.m_data.m_moneyMultiplier );
                     _battleUI.log( buffer );
-                    WAIT( FULL_SEC );
+                    _battleUI.wait( FULL_SEC );
 
                     if( SAVE::SAV.getActiveFile( ).m_money < _opponent.m_data.m_moneyMultiplier ) {
                         SAVE::SAV.getActiveFile( ).m_money = 0;
@@ -1028,7 +1122,7 @@ namespace BATTLE {
                                 MOVE_BUFFER[ j ],
                                 [ & ]( const char* p_message ) {
                                     _battleUI.printTopMessage( p_message, true );
-                                    WAIT( THREEHALF_SEC );
+                                    _battleUI.wait( THREEHALF_SEC );
                                 },
                                 [ & ]( boxPokemon* p_pkmn, u16 ) -> u8 {
                                     IO::choiceBox cb = IO::choiceBox(
@@ -1118,11 +1212,11 @@ namespace BATTLE {
         if( ownSpeed > oppSpeed || oppSpeed == 0 ) { return true; }
         if( !_field.canSwitchOut( field::PLAYER_SIDE, field::PKMN_0 ) ) { return false; }
 
-        return ( ownSpeed + ( rand( ) % oppSpeed ) >= oppSpeed );
+        return ( ownSpeed + ( _field.rng( ).next( ) % oppSpeed ) >= oppSpeed );
     }
 
     bool battle::playerCaptures( u16 p_pokeball ) {
-        if( !_isMockBattle ) {
+        if( !_isMockBattle && !_battleUI.isHeadless( ) ) {
             SAVE::SAV.getActiveFile( ).m_bag.erase( BAG::bag::ITEMS, p_pokeball, 1 );
         }
 
@@ -1215,7 +1309,7 @@ namespace BATTLE {
         u32 pr   = u32( ( 65535 << 4 ) / ( sqrt( sqrt( ( 255L << 18 ) / catchRate ) ) ) );
         u8  succ = 0;
         for( u8 i = 0; i < 4; ++i ) {
-            u16 rn = rand( );
+            u16 rn = _field.rng( ).next( );
             if( rn > pr ) break;
             succ++;
         }
@@ -1246,7 +1340,7 @@ namespace BATTLE {
             _battleUI.log( buffer );
             break;
         }
-        WAIT( FULL_SEC );
+        _battleUI.wait( FULL_SEC );
 
         if( succ == 4 ) {
             wild->m_boxdata.m_ball = BAG::itemToBall( p_pokeball );
@@ -1276,7 +1370,7 @@ namespace BATTLE {
                       FS::getDisplayName( spid ).c_str( ) );
             _battleUI.log( buffer );
 
-            WAIT( FULL_SEC );
+            _battleUI.wait( FULL_SEC );
 
             DEX::dex( ).run( spid, pkmn->getForme( ), pkmn->isShiny( ), pkmn->isFemale( ) );
         }
@@ -1309,13 +1403,14 @@ namespace BATTLE {
                           pkmn->m_boxdata.m_name );
                 _battleUI.log( buffer );
             }
-            WAIT( DOUBLE_SEC );
+            _battleUI.wait( DOUBLE_SEC );
         }
     }
 
     void battle::megaEvolve( fieldPosition p_position ) {
         _field.megaEvolve( &_battleUI, p_position.first, p_position.second );
         if( !p_position.first ) { _policy.m_allowMegaEvolution = false; }
+        if( !_isWildBattle ) { initMatchupPkmn( p_position.first, p_position.second ); }
     }
 
     void battle::checkAndRefillBattleSpots( slot::status p_checkType ) {
@@ -1324,7 +1419,7 @@ namespace BATTLE {
                 if( _field.getSlotStatus( i, j ) == p_checkType ) {
                     if( i && !_isWildBattle ) {
                         // AI chooses a next pkmn
-                        auto nxt = getNextAIPokemon( );
+                        auto nxt = getNextAIPokemon( i );
                         if( nxt != 255 ) { switchPokemon( { i, j }, nxt ); }
                     } else if( !i ) {
                         // Check if the player has something to send out
@@ -1334,6 +1429,28 @@ namespace BATTLE {
                         }
                         if( !good ) { continue; }
 
+                        // the replacement is part of the battle's log
+                        auto choice    = NO_OP_SELECTION;
+                        choice.m_type  = MT_SWITCH;
+                        choice.m_user  = { i, j };
+                        choice.m_param = 255;
+                        if( _replaying ) {
+                            _replay->next( choice, MT_SWITCH );
+                            if( choice.m_param != 255 ) {
+                                switchPokemon( { i, j }, choice.m_param );
+                            }
+                            continue;
+                        }
+                        if( _battleUI.isHeadless( ) ) {
+                            // AI chooses for the player
+                            choice.m_param = getNextAIPokemon( false );
+                            _replay->record( choice );
+                            if( choice.m_param != 255 ) {
+                                switchPokemon( { i, j }, choice.m_param );
+                            }
+                            continue;
+                        }
+
                         // Make the player choose a pokemon
 
                         STS::partyScreen pt = STS::partyScreen(
@@ -1356,6 +1473,8 @@ namespace BATTLE {
                                 _battleUI.updatePkmn( i2, j2, _field.getPkmnOrDisguise( i2, j2 ) );
                             }
 
+                        choice.m_param = res.getSelectedPkmn( );
+                        _replay->record( choice );
                         switchPokemon( { i, j }, res.getSelectedPkmn( ) );
                     }
                 }
@@ -1405,15 +1524,20 @@ namespace BATTLE {
                 return;
             }
 
-            snprintf( buffer, TMP_BUFFER_SIZE, GET_STRING( IO::STR_UI_BATTLE_TRAINER_USED_ITEM ),
-                      FS::getTrainerClassName( _opponent.getClass( ) ).c_str( ),
-                      _opponent.m_strings.m_name, FS::getItemName( p_item ).c_str( ) );
-            _battleUI.log( buffer );
+            if( !_battleUI.isHeadless( ) ) {
+                snprintf( buffer, TMP_BUFFER_SIZE,
+                          GET_STRING( IO::STR_UI_BATTLE_TRAINER_USED_ITEM ),
+                          FS::getTrainerClassName( _opponent.getClass( ) ).c_str( ),
+                          _opponent.m_strings.m_name, FS::getItemName( p_item ).c_str( ) );
+                _battleUI.log( buffer );
+            }
         } else {
             // player item
-            snprintf( buffer, TMP_BUFFER_SIZE, GET_STRING( IO::STR_UI_BATTLE_PLAYER_USED_ITEM ),
-                      FS::getItemName( p_item ) );
-            _battleUI.log( buffer );
+            if( !_battleUI.isHeadless( ) ) {
+                snprintf( buffer, TMP_BUFFER_SIZE, GET_STRING( IO::STR_UI_BATTLE_PLAYER_USED_ITEM ),
+                          FS::getItemName( p_item ) );
+                _battleUI.log( buffer );
+            }
         }
 
         auto   volst   = _field.getVolatileStatus( p_target.first, p_target.second );
@@ -1497,7 +1621,9 @@ namespace BATTLE {
                 bs    = bs.negative( ).invert( );
                 boost = true;
             } else {
-                _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                if( !_battleUI.isHeadless( ) ) {
+                    _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                }
             }
             break;
         }
@@ -1510,19 +1636,25 @@ namespace BATTLE {
                     p_target.first, p_target.second,
                     _field.getPkmnOrDisguise( p_target.first, p_target.second ) );
             } else {
-                _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                if( !_battleUI.isHeadless( ) ) {
+                    _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                }
             }
             break;
 
         case I_GUARD_SPEC:
             if( !_field.addSideCondition( &_battleUI, p_target.first, SC_MIST, 5 ) ) {
-                _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                if( !_battleUI.isHeadless( ) ) {
+                    _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                }
             }
             break;
         case I_DIRE_HIT:
             if( !_field.addVolatileStatus( &_battleUI, p_target.first, p_target.second,
                                            VS_FOCUSENERGY, 255 ) ) {
-                _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                if( !_battleUI.isHeadless( ) ) {
+                    _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                }
             }
             break;
         case I_YELLOW_FLUTE:
@@ -1533,16 +1665,21 @@ namespace BATTLE {
             if( volst & VS_CONFUSION ) {
                 _field.removeVolatileStatus( &_battleUI, p_target.first, p_target.second,
                                              VS_CONFUSION );
-                auto fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_CONFUSION_HEALED ) );
-                snprintf(
-                    buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                    _battleUI
-                        .getPkmnName( _field.getPkmnOrDisguise( p_target.first, p_target.second ),
-                                      p_target.first )
-                        .c_str( ) );
-                _battleUI.log( buffer );
+                if( !_battleUI.isHeadless( ) ) {
+                    auto fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_CONFUSION_HEALED ) );
+                    snprintf(
+                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
+                        _battleUI
+                            .getPkmnName( _field.getPkmnOrDisguise( p_target.first,
+                                                                    p_target.second ),
+                                          p_target.first )
+                            .c_str( ) );
+                    _battleUI.log( buffer );
+                }
             } else {
-                _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                if( !_battleUI.isHeadless( ) ) {
+                    _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                }
             }
             break;
 
@@ -1554,7 +1691,9 @@ namespace BATTLE {
                 _field.removeVolatileStatus( &_battleUI, p_target.first, p_target.second,
                                              VS_ATTRACT );
             } else {
-                _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                if( !_battleUI.isHeadless( ) ) {
+                    _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                }
             }
             break;
 
@@ -1567,10 +1706,12 @@ namespace BATTLE {
                 _battleUI.logBoosts( _field.getPkmnOrDisguise( p_target.first, p_target.second ),
                                      p_target.first, p_target.second, bs, res );
             } else {
-                _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                if( !_battleUI.isHeadless( ) ) {
+                    _battleUI.log( GET_STRING( IO::STR_UI_BATTLE_NOTHING_HAPPENED ) );
+                }
             }
         }
-        if( remitem && !p_target.first ) {
+        if( remitem && !p_target.first && !_battleUI.isHeadless( ) ) {
             SAVE::SAV.getActiveFile( ).m_bag.erase( BAG::toBagType( idata.m_itemType ), p_item, 1 );
         }
     }
@@ -1625,74 +1766,75 @@ namespace BATTLE {
         char         buffer[ TMP_BUFFER_SIZE + 10 ];
         for( u8 j = 0; j < getBattlingPKMNCount( _policy.m_mode ); ++j ) {
             if( _field.getSlotStatus( field::OPPONENT_SIDE, j ) == slot::status::FAINTED ) {
-                if( _yieldEXP[ j ].empty( ) ) { continue; } // already distributed
+                if( !_yieldEXP[ j ] ) { continue; } // already distributed
 
                 // distribute EXP
 #ifdef DESQUID_MORE
                 std::string lmsg = "Distributing EXP to ";
 #endif
-                std::vector<u8> reg = std::vector<u8>( ), share = std::vector<u8>( );
+                // bit masks of the current idx's of the pkmn that get regular exp and of
+                // those that get exp via exp share
+                u8 reg = 0, share = 0;
                 for( u8 q2 = 0; q2 < _playerTeamSize; ++q2 ) {
-                    if( _yieldEXP[ j ].count( _playerPkmnPerm[ q2 ] )
-                        && _playerTeam[ q2 ].canBattle( ) ) {
+                    if( !_playerTeam[ q2 ].canBattle( ) ) { continue; }
+                    if( _yieldEXP[ j ] & ( 1 << _playerPkmnPerm[ q2 ] ) ) {
 #ifdef DESQUID_MORE
                         lmsg += std::string( _playerTeam[ q2 ].m_boxdata.m_name ) + " ";
 #endif
-                        // pkmn that get regular exp
-                        reg.push_back( q2 );
-                    } else if( _playerTeam[ q2 ].canBattle( )
-                               && SAVE::SAV.getActiveFile( ).m_options.m_EXPShareEnabled ) {
-                        // pkmn that get exp via exp share
-                        share.push_back( q2 );
+                        reg |= 1 << q2;
+                    } else if( SAVE::SAV.getActiveFile( ).m_options.m_EXPShareEnabled ) {
+                        share |= 1 << q2;
                     }
                 }
 #ifdef DESQUID_MORE
                 _battleUI.log( lmsg );
 #endif
-                _yieldEXP[ j ].clear( );
+                _yieldEXP[ j ] = 0;
                 // base exp (before distribution to pkmn)
                 u32 baseexp = _field.getPkmnData( field::OPPONENT_SIDE, j ).m_baseForme.m_expYield
                                   * _opponentTeam[ j ].m_level
                               >> 3;
                 if( !_isWildBattle ) { baseexp = baseexp * 3 / 2; }
-                if( reg.size( ) && share.size( ) ) { baseexp /= 2; }
-
-                for( const std::vector<u8>& lst : { reg, share } ) {
-                    if( lst.size( ) ) {
-                        for( auto i : lst ) {
-                            // distribute ev
-                            for( u8 ev = 0; ev < 6; ++ev ) {
-                                u8 m1 = ( _playerTeam[ i ].getItem( ) == I_MACHO_BRACE );
-                                if( _playerTeam[ i ].m_boxdata.m_pokerus ) { m1++; }
-
-                                u8 m2 = 0;
-                                if( ev + I_POWER_BRACER - 1 == _playerTeam[ i ].getItem( ) ) {
-                                    m2 = 8;
-                                }
-                                if( !ev && _playerTeam[ i ].getItem( ) == I_POWER_WEIGHT ) {
-                                    m2 = 8;
-                                }
-
-                                _playerTeam[ i ].EVset(
-                                    ev, _playerTeam[ i ].EVget( ev )
-                                            + ( ( _field.getPkmnData( field::OPPONENT_SIDE, j )
-                                                      .m_baseForme.m_evYield[ ev ]
-                                                  + m2 )
-                                                << m1 ) );
+                if( reg && share ) { baseexp /= 2; }
+                u8 numReg = std::max( 1, std::popcount( reg ) );
+
+                for( u8 lst : { reg, share } ) {
+                    for( ; lst; lst &= lst - 1 ) {
+                        u8 i = std::countr_zero( lst );
+                        // distribute ev
+                        for( u8 ev = 0; ev < 6; ++ev ) {
+                            u8 m1 = ( _playerTeam[ i ].getItem( ) == I_MACHO_BRACE );
+                            if( _playerTeam[ i ].m_boxdata.m_pokerus ) { m1++; }
+
+                            u8 m2 = 0;
+                            if( ev + I_POWER_BRACER - 1 == _playerTeam[ i ].getItem( ) ) {
+                                m2 = 8;
                             }
+                            if( !ev && _playerTeam[ i ].getItem( ) == I_POWER_WEIGHT ) { m2 = 8; }
+
+                            _playerTeam[ i ].EVset(
+                                ev, _playerTeam[ i ].EVget( ev )
+                                        + ( ( _field.getPkmnData( field::OPPONENT_SIDE, j )
+                                                  .m_baseForme.m_evYield[ ev ]
+                                              + m2 )
+                                            << m1 ) );
+                        }
 
-                            u32 curexp = baseexp / reg.size( );
-                            if( _playerTeam[ i ].getItem( ) == I_LUCKY_EGG ) { curexp <<= 1; }
-                            if( _playerTeam[ i ].isForeign( ) ) { curexp <<= 1; }
+                        u32 curexp = baseexp / numReg;
+                        if( _playerTeam[ i ].getItem( ) == I_LUCKY_EGG ) { curexp <<= 1; }
+                        if( _playerTeam[ i ].isForeign( ) ) { curexp <<= 1; }
 
-                            u8 oldlv = _playerTeam[ i ].m_level;
-                            if( _playerTeam[ i ].m_level < 100 ) {
-                                _playerTeam[ i ].gainExperience( curexp );
+                        u8 oldlv = _playerTeam[ i ].m_level;
+                        if( _playerTeam[ i ].m_level < 100 ) {
+                            _playerTeam[ i ].gainExperience( curexp );
+                            if( !_battleUI.isHeadless( ) ) {
                                 snprintf( buffer, TMP_BUFFER_SIZE,
                                           GET_STRING( IO::STR_UI_BATTLE_EXP_GAINED ),
                                           _playerTeam[ i ].m_boxdata.m_name, curexp );
                                 _battleUI.log( buffer );
-                                if( _playerTeam[ i ].m_level != oldlv ) {
+                            }
+                            if( _playerTeam[ i ].m_level != oldlv ) {
+                                if( !_battleUI.isHeadless( ) ) {
                                     snprintf( buffer, TMP_BUFFER_SIZE,
                                               GET_STRING( IO::STR_UI_BATTLE_ADVANCE_LEVEL ),
                                               _playerTeam[ i ].m_boxdata.m_name,
@@ -1700,12 +1842,12 @@ namespace BATTLE {
                                     _battleUI.log( buffer );
                                 }
                             }
-                            if( i < getBattlingPKMNCount( _policy.m_mode ) ) {
-                                // update battleUI
-                                _battleUI.updatePkmnStats(
-                                    field::PLAYER_SIDE, i,
-                                    _field.getPkmnOrDisguise( field::PLAYER_SIDE, i ), true );
-                            }
+                        }
+                        if( i < getBattlingPKMNCount( _policy.m_mode ) ) {
+                            // update battleUI
+                            _battleUI.updatePkmnStats(
+                                field::PLAYER_SIDE, i,
+                                _field.getPkmnOrDisguise( field::PLAYER_SIDE, i ), true );
                         }
                     }
                 }
@@ -1713,6 +1855,47 @@ namespace BATTLE {
         }
     }
 
+    simulationResult simulateBattles( const pokemon* p_team, u8 p_teamSize,
+                                      const battleTrainer& p_opponent, battlePolicy p_policy,
+                                      u16 p_count, u32 p_seed, bool p_checkReplay ) {
+        p_policy.m_distributeEXP = false;
+        if( !p_policy.m_roundLimit ) { p_policy.m_roundLimit = SIMULATION_ROUND_LIMIT; }
+        if( p_teamSize > SAVE::NUM_PARTY_SLOTS ) { p_teamSize = SAVE::NUM_PARTY_SLOTS; }
+
+        simulationResult        res        = { };
+        pokemon                 team[ SAVE::NUM_PARTY_SLOTS ];
+        battle::battleEndReason last       = battle::BATTLE_NONE;
+        u16                     lastRounds = 0;
+        for( u16 i = 0; i < p_count; ++i ) {
+            std::copy( p_team, p_team + p_teamSize, team );
+            battle bt = battle( team, p_teamSize, p_opponent, p_policy, true );
+            switch( last = bt.start( p_seed + i ) ) {
+            case battle::BATTLE_PLAYER_WON: res.m_playerWins++; break;
+            case battle::BATTLE_OPPONENT_WON: res.m_opponentWins++; break;
+            default: res.m_draws++; break;
+            }
+            res.m_rounds += lastRounds = bt.getRound( );
+        }
+
+#ifdef DESQUID
+        // replaying the last battle from its log needs to yield the same outcome
+        res.m_replayMatches = true;
+        if( !p_count || !p_checkReplay ) { return res; }
+        u32* usage = MOVE_USAGE;
+        MOVE_USAGE = nullptr; // the replay doesn't count as a battle of its own
+        std::copy( p_team, p_team + p_teamSize, team );
+        battle bt           = battle( team, p_teamSize, p_opponent, p_policy, true );
+        res.m_replayMatches
+            = bt.replay( LAST_BATTLE_REPLAY ) == last && bt.getRound( ) == lastRounds;
+        MOVE_USAGE = usage;
+#else
+        (void) last;
+        (void) lastRounds;
+        (void) p_checkReplay;
+#endif
+        return res;
+    }
+
     const char* battle::getMessage( u8 p_stringId ) {
         if( _isWildBattle ) { return 0; }
 
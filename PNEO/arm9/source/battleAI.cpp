@@ -27,34 +27,241 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "battle/battle.h"
 #include "battle/battleField.h"
+#include "battle/battleSearch.h"
 #include "battle/battleSide.h"
 #include "battle/battleSlot.h"
 #include "battle/battleTrainer.h"
 #include "battle/battleUI.h"
+#include "battle/moveTable.h"
 #include "defines.h"
 #include "fs/data.h"
 #include "gen/bgmNames.h"
 #include "io/animations.h"
 #include "io/uio.h"
 #include "pokemon.h"
+#include "prof/profiler.h"
 #include "sound/sound.h"
 
 namespace BATTLE {
-    u8 battle::getNextAIPokemon( ) const {
-        for( u8 i = getBattlingPKMNCount( _policy.m_mode ); i < _opponentTeamSize; ++i ) {
-            if( _opponentTeam[ i ].canBattle( ) ) { return i; }
+#ifdef DESQUID
+    matchupStats MATCHUP_STATS;
+    bool         DISABLE_AI_SWITCHES = false;
+#endif
+
+    // ai levels from here on switch pkmn out of bad matchups
+    constexpr u16 SWITCH_MIN_AI_LEVEL = 5;
+
+    void battle::initMatchupPkmn( u8 p_side, u8 p_idx ) {
+        const pokemon& pkmn = ( p_side ? _opponentTeam : _playerTeam )[ p_idx ];
+        auto&          info = _matchupPkmn[ p_side ][ ( p_side ? _opponentPkmnPerm
+                                                               : _playerPkmnPerm )[ p_idx ] ];
+
+        auto types        = FS::getPkmnData( pkmn.getSpecies( ), pkmn.getForme( ) ).m_baseForme;
+        info.m_types[ 0 ] = types.m_types[ 0 ];
+        info.m_types[ 1 ] = types.m_types[ 1 ];
+        for( u8 i = 0; i < 4; ++i ) {
+            info.m_movePower[ i ] = 0;
+            if( !pkmn.getMove( i ) ) { continue; }
+            auto mdata               = MOVE_TABLE.get( pkmn.getMove( i ) );
+            info.m_moveTypes[ i ]    = mdata.m_type;
+            info.m_moveCategory[ i ] = mdata.m_category;
+            info.m_movePower[ i ]    = mdata.m_basePower;
+        }
+    }
+
+    void battle::initMatchups( ) {
+#ifdef DESQUID
+        u32 start = PROF::ticks( );
+#endif
+        for( u8 side = 0; side < field::NUM_SIDES; ++side ) {
+            u8 teamSize = side ? _opponentTeamSize : _playerTeamSize;
+            for( u8 i = 0; i < teamSize; ++i ) {
+                initMatchupPkmn( side, i );
+                auto& info          = _matchupPkmn[ side ][ ( side ? _opponentPkmnPerm
+                                                                   : _playerPkmnPerm )[ i ] ];
+                info.m_enteredRound = 0;
+                info.m_active       = false;
+            }
+        }
+        std::memset( _matchup, 0, sizeof( _matchup ) );
+        updateMatchups( true );
+#ifdef DESQUID
+        MATCHUP_STATS.m_initTicks = std::max( MATCHUP_STATS.m_initTicks, PROF::ticks( ) - start );
+#endif
+    }
+
+    void battle::updateMatchups( bool p_all ) {
+#ifdef DESQUID
+        u32 start = PROF::ticks( );
+#endif
+        for( u8 side = 0; side < field::NUM_SIDES; ++side ) {
+            const pokemon* team     = side ? _opponentTeam : _playerTeam;
+            const u8*      perm     = side ? _opponentPkmnPerm : _playerPkmnPerm;
+            const u8*      foePerm  = side ? _playerPkmnPerm : _opponentPkmnPerm;
+            u8             teamSize = side ? _opponentTeamSize : _playerTeamSize;
+            u8             foeSize  = side ? _playerTeamSize : _opponentTeamSize;
+            for( u8 i = 0; i < teamSize; ++i ) {
+                auto& info   = _matchupPkmn[ side ][ perm[ i ] ];
+                bool  active = i < getBattlingPKMNCount( _policy.m_mode )
+                              && _field.getSlotStatus( side, i ) == slot::status::NORMAL;
+                // boosts change only on the field, and pkmn lose them when recalled
+                if( !p_all && !active && !info.m_active
+                    && info.m_status == team[ i ].m_statusint ) {
+                    continue;
+                }
+                if( active && !info.m_active ) { info.m_enteredRound = _round; }
+                info.m_active = active;
+                info.m_status = team[ i ].m_statusint;
+
+                for( u8 j = 0; j < foeSize; ++j ) {
+                    _matchup[ side ][ perm[ i ] ][ foePerm[ j ] ] = estimateMatchup( side, i, j );
+                    _matchup[ !side ][ foePerm[ j ] ][ perm[ i ] ] = estimateMatchup( !side, j, i );
+                }
+            }
+        }
+#ifdef DESQUID
+        MATCHUP_STATS.m_updateTicks += PROF::ticks( ) - start;
+        MATCHUP_STATS.m_updates++;
+#endif
+    }
+
+    u8 battle::estimateMatchup( u8 p_side, u8 p_attacker, u8 p_defender ) {
+        const pokemon& atk     = ( p_side ? _opponentTeam : _playerTeam )[ p_attacker ];
+        const pokemon& def     = ( p_side ? _playerTeam : _opponentTeam )[ p_defender ];
+        const u8*      atkPerm = p_side ? _opponentPkmnPerm : _playerPkmnPerm;
+        const u8*      defPerm = p_side ? _playerPkmnPerm : _opponentPkmnPerm;
+        const auto&    ainf    = _matchupPkmn[ p_side ][ atkPerm[ p_attacker ] ];
+        const auto&    dinf    = _matchupPkmn[ !p_side ][ defPerm[ p_defender ] ];
+        if( !atk.canBattle( ) || !def.canBattle( ) ) { return 0; }
+
+        // pkmn on the field use their current stats (including boosts)
+        u8   cnt       = getBattlingPKMNCount( _policy.m_mode );
+        bool atkActive = p_attacker < cnt
+                         && _field.getSlotStatus( p_side, p_attacker ) == slot::status::NORMAL;
+        bool defActive = p_defender < cnt
+                         && _field.getSlotStatus( !p_side, p_defender ) == slot::status::NORMAL;
+
+        u32 best = 0;
+        for( u8 i = 0; i < 4; ++i ) {
+            if( !ainf.m_movePower[ i ] || ainf.m_moveCategory[ i ] == MH_STATUS ) { continue; }
+            bool phys = ainf.m_moveCategory[ i ] == MH_PHYSICAL;
+            u8   as = phys ? ATK : SATK, ds = phys ? DEF : SDEF;
+            u32  a  = atkActive ? _field.getStat( p_side, p_attacker, as ) : atk.getStat( as );
+            u32  d  = defActive ? _field.getStat( !p_side, p_defender, ds ) : def.getStat( ds );
+
+            u32 damage = ( ( 2 * atk.m_level / 5 + 2 ) * ainf.m_movePower[ i ] * a
+                           / std::max<u32>( 1, d ) )
+                             / 50
+                         + 2;
+            if( ainf.m_moveTypes[ i ] == ainf.m_types[ 0 ]
+                || ainf.m_moveTypes[ i ] == ainf.m_types[ 1 ] ) {
+                damage = damage * 3 / 2;
+            }
+            damage = damage * getTypeEffectiveness( ainf.m_moveTypes[ i ], dinf.m_types[ 0 ] )
+                     / 100;
+            if( dinf.m_types[ 1 ] != dinf.m_types[ 0 ] ) {
+                damage = damage * getTypeEffectiveness( ainf.m_moveTypes[ i ], dinf.m_types[ 1 ] )
+                         / 100;
+            }
+            if( phys && atk.m_status.m_isBurned ) { damage /= 2; }
+            best = std::max( best, damage );
+        }
+        return std::min<u32>( 255, best * 100 / std::max<u16>( 1, def.m_stats.m_maxHP ) );
+    }
+
+    s16 battle::rateMatchup( u8 p_side, u8 p_idx, bool p_switchIn ) {
+        const pokemon& pkmn = ( p_side ? _opponentTeam : _playerTeam )[ p_idx ];
+        const pokemon* foes = p_side ? _playerTeam : _opponentTeam;
+        u8             own  = ( p_side ? _opponentPkmnPerm : _playerPkmnPerm )[ p_idx ];
+        const u8*      perm = p_side ? _playerPkmnPerm : _opponentPkmnPerm;
+
+        // remaining HP in %
+        s16 hp = pkmn.m_stats.m_curHP * 100 / std::max<u16>( 1, pkmn.m_stats.m_maxHP );
+
+        s16 dealt = 0, taken = 0;
+        for( u8 i = 0; i < getBattlingPKMNCount( _policy.m_mode ); ++i ) {
+            if( _field.getSlotStatus( !p_side, i ) != slot::status::NORMAL ) { continue; }
+            const auto& stats = foes[ i ].m_stats;
+            s16 foeHP = std::max<s16>( 1, stats.m_curHP * 100 / std::max<u16>( 1, stats.m_maxHP ) );
+            dealt     = std::max<s16>(
+                dealt, std::min<s16>( 100, _matchup[ p_side ][ own ][ perm[ i ] ] * 100 / foeHP ) );
+            taken += _matchup[ !p_side ][ perm[ i ] ][ own ];
+        }
+        if( p_switchIn ) {
+            // the foes get a free hit
+            hp -= taken;
+        }
+        if( hp <= 0 ) { return -100; }
+        return dealt - std::min<s16>( 100, taken * 100 / hp );
+    }
+
+    u8 battle::getAISwitch( u8 p_slot, bool p_opponent, u16 p_aiLevel ) {
+#ifdef DESQUID
+        if( DISABLE_AI_SWITCHES ) { return 255; }
+#endif
+        u8 own = p_opponent ? field::OPPONENT_SIDE : field::PLAYER_SIDE;
+        if( _isWildBattle || !_field.canSwitchOut( own, p_slot ) ) { return 255; }
+
+        // give pkmn a turn on the field, so that the ai doesn't keep switching back and
+        // forth
+        const u8* perm = p_opponent ? _opponentPkmnPerm : _playerPkmnPerm;
+        if( _matchupPkmn[ own ][ perm[ p_slot ] ].m_enteredRound + 1 >= _round ) { return 255; }
+
+        s16 current = rateMatchup( own, p_slot, false );
+        if( current > -40 ) { return 255; }
+
+        const pokemon* team     = p_opponent ? _opponentTeam : _playerTeam;
+        u8             teamSize = p_opponent ? _opponentTeamSize : _playerTeamSize;
+        u8             res      = 255;
+        s16            best     = current + ( p_aiLevel >= 7 ? 40 : 60 );
+        for( u8 i = getBattlingPKMNCount( _policy.m_mode ); i < teamSize; ++i ) {
+            if( !team[ i ].canBattle( ) || ( _plannedSwitches[ own ] & ( 1 << i ) ) ) {
+                continue;
+            }
+            s16 rating = rateMatchup( own, i, true );
+            if( rating > 0 && rating > best ) {
+                best = rating;
+                res  = i;
+            }
+        }
+        if( res != 255 ) {
+            _plannedSwitches[ own ] |= 1 << res;
+#ifdef DESQUID
+            MATCHUP_STATS.m_switches++;
+#endif
+        }
+        return res;
+    }
+
+    u8 battle::getNextAIPokemon( bool p_opponent ) const {
+        const pokemon* team     = p_opponent ? _opponentTeam : _playerTeam;
+        u8             teamSize = p_opponent ? _opponentTeamSize : _playerTeamSize;
+        for( u8 i = getBattlingPKMNCount( _policy.m_mode ); i < teamSize; ++i ) {
+            if( team[ i ].canBattle( ) ) { return i; }
         }
         return 255;
     }
 
-    battleMoveSelection battle::getAIMove( u8 p_slot ) {
+    battleMoveSelection battle::getAIMove( u8 p_slot, bool p_opponent ) {
+        // own side and opposing side; canTarget arrays below list the opponent's slots
+        // first, then the player's slots
+        u8 own    = p_opponent ? field::OPPONENT_SIDE : field::PLAYER_SIDE;
+        u8 foe    = !own;
+        u8 ownIdx = p_opponent ? 0 : 2, foeIdx = 2 - ownIdx;
+
+        // the player's choices don't depend on the battle's generator, so that replays,
+        // which skip them, draw the same numbers
+        battleRandom& rng = p_opponent ? _field.rng( ) : _playerAIRng;
+        // the player's side plays at the level set by the policy
+        u16 aiLevel = p_opponent ? _AILevel : _policy.m_aiLevel;
+
         battleMoveSelection res = NO_OP_SELECTION;
-        res.m_user              = { field::OPPONENT_SIDE, p_slot };
-        auto pkmn               = _field.getPkmn( field::OPPONENT_SIDE, p_slot );
+        res.m_user              = { own, p_slot };
+        auto pkmn               = _field.getPkmn( own, p_slot );
         if( pkmn == nullptr ) { return res; }
 
-        // Use item if remotely sensible
-        for( u8 i = 0; i < trainerData::NUM_ITEMS; ++i ) {
+        // Use item if remotely sensible (the player's side has no items to use)
+        for( u8 i = 0; p_opponent && i < trainerData::NUM_ITEMS; ++i ) {
             switch( _opponent.m_data.m_items[ i ] ) {
             case I_POTION:
             case I_FRESH_WATER:
@@ -94,15 +301,26 @@ namespace BATTLE {
             }
         }
 
+        // Switch out of bad matchups starting with ai level 5; the pkmn planned to be sent
+        // out by the other slots this turn aren't available
+        if( aiLevel >= SWITCH_MIN_AI_LEVEL && aiLevel <= 9 ) {
+            u8 next = getAISwitch( p_slot, p_opponent, aiLevel );
+            if( next != 255 ) {
+                res.m_type  = MT_SWITCH;
+                res.m_param = next;
+                return res;
+            }
+        }
+
         // Mega evolve starting with ai level 6
-        if( _AILevel >= 6 ) {
+        if( aiLevel >= 6 && ( p_opponent || _policy.m_allowMegaEvolution ) ) {
             if( pkmn->canBattleTransform( ) ) { res.m_megaEvolve = true; }
         }
         res.m_type = MT_ATTACK;
         // check if pkmn has move left, ow struggle
         bool canUse[ 4 ], str = false;
         for( u8 i = 0; i < 4; ++i ) {
-            canUse[ i ] = _field.canSelectMove( field::OPPONENT_SIDE, p_slot, i );
+            canUse[ i ] = _field.canSelectMove( own, p_slot, i );
             str         = str || canUse[ i ];
         }
 
@@ -110,18 +328,19 @@ namespace BATTLE {
             res.m_param = M_STRUGGLE;
         }
 
-        switch( _AILevel ) {
+        // there is nothing to rate for a struggling pkmn, it only needs a target
+        switch( str ? aiLevel : 0 ) {
         default:
             [[likely]] case 0 : { // Wild pkmn
                 if( str ) {
                     // Pick a random move
-                    u8 mv = rand( ) % 4;
-                    while( !canUse[ mv ] ) { mv = rand( ) % 4; }
-                    res.m_param = _field.getPkmn( field::OPPONENT_SIDE, p_slot )->getMove( mv );
+                    u8 mv = rng.next( ) % 4;
+                    while( !canUse[ mv ] ) { mv = rng.next( ) % 4; }
+                    res.m_param = pkmn->getMove( mv );
                 }
                 // Choose a target
                 // Pick a random target
-                auto mdata     = FS::getMoveData( res.m_param );
+                auto mdata     = MOVE_TABLE.get( res.m_param );
                 res.m_moveData = mdata;
                 auto tg
                     = mdata.m_pressureTarget != TG_NONE ? mdata.m_pressureTarget : mdata.m_target;
@@ -130,19 +349,19 @@ namespace BATTLE {
                 for( u8 i = 0; i < 4; ++i ) {
                     canTarget[ i ] = _field.getPkmn( i < 2, i & 1 ) != nullptr;
                 }
-                u8 ctg = rand( ) % 2;
+                u8 ctg = rng.next( ) % 2;
 
                 switch( tg ) {
                 case TG_RANDOM:
                 case TG_ANY_FOE:
-                    [[likely]] case TG_ANY : while( !canTarget[ 2 + ctg ] ) {
-                        ctg = rand( ) & 1;
+                    [[likely]] case TG_ANY : while( !canTarget[ foeIdx + ctg ] ) {
+                        ctg = rng.next( ) & 1;
                     }
-                    res.m_target = fieldPosition( field::PLAYER_SIDE, ctg );
+                    res.m_target = fieldPosition( foe, ctg );
                     break;
                 case TG_ALLY_OR_SELF:
-                    while( !canTarget[ ctg ] ) { ctg = rand( ) & 1; }
-                    res.m_target = fieldPosition( field::OPPONENT_SIDE, ctg );
+                    while( !canTarget[ ownIdx + ctg ] ) { ctg = rng.next( ) & 1; }
+                    res.m_target = fieldPosition( own, ctg );
                     break;
                     [[unlikely]] default : break;
                 }
@@ -167,7 +386,8 @@ namespace BATTLE {
                     continue;
                 }
                 bmove[ i ].m_param    = pkmn->getMove( i );
-                bmove[ i ].m_moveData = FS::getMoveData( pkmn->getMove( i ) );
+                bmove[ i ].m_moveData = MOVE_TABLE.get( pkmn->getMove( i ) );
+                bmove[ i ].m_user     = fieldPosition( own, p_slot );
                 // TODO: do this properly for double battles
                 auto tg = bmove[ i ].m_moveData.m_pressureTarget != TG_NONE
                               ? bmove[ i ].m_moveData.m_pressureTarget
@@ -179,107 +399,118 @@ namespace BATTLE {
                         canTarget[ j ] = false;
                         continue;
                     }
-                    if( _AILevel > 3 ) {
-                        canTarget[ j ] = !!_field.getEffectiveness( bmove[ i ], { j / 2, j % 2 } );
+                    if( aiLevel > 3 ) {
+                        canTarget[ j ] = !!_field.getEffectiveness( bmove[ i ], { j < 2, j & 1 } );
                     } else {
                         canTarget[ j ] = true;
                     }
                 }
-                u8 ctg = rand( ) % 2;
+                u8 ctg = rng.next( ) % 2;
 
                 switch( tg ) {
                 case TG_RANDOM:
                 case TG_ANY_FOE:
-                    [[likely]] case TG_ANY : if( !canTarget[ 2 ] && !canTarget[ 3 ] ) {
+                    [[likely]] case TG_ANY : if( !canTarget[ foeIdx ]
+                                                 && !canTarget[ foeIdx + 1 ] ) {
                         ctg = 0;
                     }
                     else {
-                        while( !canTarget[ 2 + ctg ] ) { ctg = rand( ) & 1; }
+                        while( !canTarget[ foeIdx + ctg ] ) { ctg = rng.next( ) & 1; }
                     }
-                    bmove[ i ].m_target = { fieldPosition( field::PLAYER_SIDE, ctg ) };
+                    bmove[ i ].m_target = { fieldPosition( foe, ctg ) };
                     break;
                 case TG_ALLY_OR_SELF:
-                    while( !canTarget[ ctg ] ) { ctg = rand( ) & 1; }
-                    bmove[ i ].m_target = { fieldPosition( field::OPPONENT_SIDE, ctg ) };
-                    break;
-                case TG_SELF:
-                    bmove[ i ].m_target = { fieldPosition( field::OPPONENT_SIDE, p_slot ) };
+                    while( !canTarget[ ownIdx + ctg ] ) { ctg = rng.next( ) & 1; }
+                    bmove[ i ].m_target = { fieldPosition( own, ctg ) };
                     break;
+                case TG_SELF: bmove[ i ].m_target = { fieldPosition( own, p_slot ) }; break;
                     [[unlikely]] default : bmove[ i ].m_target
-                        = { fieldPosition( field::PLAYER_SIDE, field::PKMN_0 ) };
+                        = { fieldPosition( foe, field::PKMN_0 ) };
                     break;
                 }
 
                 auto target = _field.getPkmn( bmove[ i ].m_target[ 0 ].first,
                                               bmove[ i ].m_target[ 0 ].second );
 
-                if( _AILevel < 4 && bmove[ i ].m_moveData.m_category == MH_STATUS ) {
+                if( aiLevel < 4 && bmove[ i ].m_moveData.m_category == MH_STATUS ) {
                     // Bad trainers don't want to use status moves
                     score[ i ] -= 5;
                 } else if( bmove[ i ].m_moveData.m_category == MH_STATUS ) {
-                    if( _AILevel > 2 && bmove[ i ].m_moveData.m_weather != _field.getWeather( ) ) {
-                        if( _AILevel > 4 && _field.suppressesWeather( ) ) {
+                    if( aiLevel > 2 && bmove[ i ].m_moveData.m_weather != _field.getWeather( ) ) {
+                        if( aiLevel > 4 && _field.suppressesWeather( ) ) {
                             score[ i ] = 1;
                             continue;
                         } else {
                             score[ i ] = 200;
                         }
-                    } else if( _AILevel > 3 && bmove[ i ].m_moveData.m_status && target != nullptr
+                    } else if( aiLevel > 3 && bmove[ i ].m_moveData.m_status && target != nullptr
                                && !target->m_statusint ) {
                         score[ i ] += 20;
-                    } else if( pkmn->m_boxdata.m_curPP[ i ] + _AILevel / 2
+                    } else if( pkmn->m_boxdata.m_curPP[ i ] + aiLevel / 2
                                < bmove[ i ].m_moveData.m_pp ) {
                         score[ i ] = 1;
                         continue;
                     }
-                    score[ i ] = score[ i ] + 5 - ( rand( ) % ( 13 - _AILevel ) );
+                    score[ i ] = score[ i ] + 5 - ( rng.next( ) % ( 13 - aiLevel ) );
                 }
 
                 // Check for vol stat changes
-                if( _AILevel > 4 && bmove[ i ].m_moveData.m_volatileStatus ) {
+                if( aiLevel > 4 && bmove[ i ].m_moveData.m_volatileStatus ) {
                     if( target != nullptr
-                        && ( _field.getVolatileStatus( field::OPPONENT_SIDE, p_slot )
+                        && ( _field.getVolatileStatus( own, p_slot )
                              & bmove[ i ].m_moveData.m_volatileStatus ) ) {
                         score[ i ] = 1;
                         continue;
-                    } else if( _AILevel > 5 ) {
+                    } else if( aiLevel > 5 ) {
                         score[ i ] += 5;
                     }
                 }
 
-                if( _AILevel > 4
-                    && _field.hasType( field::OPPONENT_SIDE, p_slot,
+                if( aiLevel > 4
+                    && _field.hasType( own, p_slot,
                                        bmove[ i ].m_moveData.m_type ) ) {
-                    score[ i ] += _AILevel / 2;
+                    score[ i ] += aiLevel / 2;
                 }
                 if( bmove[ i ].m_moveData.m_category == MH_PHYSICAL ) {
-                    if( _AILevel > 3
-                        && _field.getStat( field::OPPONENT_SIDE, p_slot, ATK )
-                               > _field.getStat( field::OPPONENT_SIDE, p_slot, SATK ) ) {
-                        score[ i ] += _AILevel / 2;
+                    if( aiLevel > 3
+                        && _field.getStat( own, p_slot, ATK )
+                               > _field.getStat( own, p_slot, SATK ) ) {
+                        score[ i ] += aiLevel / 2;
                     }
                 }
                 if( bmove[ i ].m_moveData.m_category == MH_SPECIAL ) {
-                    if( _AILevel > 3
-                        && _field.getStat( field::OPPONENT_SIDE, p_slot, SATK )
-                               > _field.getStat( field::OPPONENT_SIDE, p_slot, ATK ) ) {
-                        score[ i ] += _AILevel / 2;
+                    if( aiLevel > 3
+                        && _field.getStat( own, p_slot, SATK )
+                               > _field.getStat( own, p_slot, ATK ) ) {
+                        score[ i ] += aiLevel / 2;
                     }
                 }
 
-                if( _AILevel > 5 ) {
+                if( aiLevel > 5 ) {
                     u16 eff = _field.getEffectiveness( bmove[ i ], bmove[ i ].m_target[ 0 ] );
                     score[ i ] += ( eff - 100 ) / 3;
                 }
-                if( _AILevel > 2 ) {
-                    if( bmove[ i ].m_moveData.m_basePower > _AILevel * 9 ) {
+                if( aiLevel > 2 ) {
+                    if( bmove[ i ].m_moveData.m_basePower > aiLevel * 9 ) {
                         score[ i ] += ( bmove[ i ].m_moveData.m_basePower - 50 ) / 10;
                     }
                 }
-                if( _AILevel > 6 ) {
+                if( aiLevel > 6 ) {
                     score[ i ] -= ( 100 - bmove[ i ].m_moveData.m_accuracy ) / 10;
                 }
-                score[ i ] += ( rand( ) % 5 );
+                if( aiLevel > 6 && target != nullptr
+                    && bmove[ i ].m_moveData.m_category != MH_STATUS ) {
+                    // prefer moves that knock out the target for sure (or with some luck)
+                    u16 rolls[ NUM_DAMAGE_ROLLS ];
+                    if( _field.computeDamageRolls( bmove[ i ], bmove[ i ].m_target[ 0 ], rolls ) ) {
+                        if( rolls[ 0 ] >= target->m_stats.m_curHP ) {
+                            score[ i ] += 12;
+                        } else if( rolls[ NUM_DAMAGE_ROLLS - 1 ] >= target->m_stats.m_curHP ) {
+                            score[ i ] += 6;
+                        }
+                    }
+                }
+                score[ i ] += ( rng.next( ) % 5 );
             }
 
             // pick the move with the highest score
@@ -291,13 +522,16 @@ namespace BATTLE {
                 }
             }
 
-            // TODO: switch pkmn if mx score is too low
-
             res.m_type     = MT_ATTACK;
             res.m_target   = bmove[ idx ].m_target[ 0 ];
             res.m_param    = bmove[ idx ].m_param;
             res.m_moveData = bmove[ idx ].m_moveData;
 
+            // the best trainers look ahead (and may switch pkmn instead)
+            if( aiLevel >= SEARCH_MIN_AI_LEVEL ) {
+                res = searchAIMove( p_slot, p_opponent, res, rng, aiLevel );
+            }
+
             break;
         }
         }
@@ -0,0 +1,276 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleBenchmark.cpp
+author      : Philip Wellnitz
+description : Timings of the phases of battle turns in scripted scenarios.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef DESQUID
+#include <cstdio>
+#include <cstring>
+
+#include "battle/battle.h"
+#include "battle/battleBenchmark.h"
+#include "battle/battleTrainer.h"
+#include "fs/fs.h"
+#include "gen/abilityNames.h"
+#include "gen/itemNames.h"
+#include "gen/moveNames.h"
+#include "gen/pokemonNames.h"
+
+namespace BATTLE {
+    constexpr u8 NUM_TURN_PHASES = LAST_BATTLE_PHASE - FIRST_BATTLE_PHASE + 1;
+
+    constexpr trainerPokemon benchmarkPkmn( u16 p_species, u16 p_ability, u16 p_item,
+                                            u16 p_move1, u16 p_move2, u16 p_move3,
+                                            u16 p_move4 ) {
+        return { p_species,
+                 0,
+                 50,
+                 p_ability,
+                 p_item,
+                 { p_move1, p_move2, p_move3, p_move4 },
+                 { 0, 0, 0, 0, 0, 0 },
+                 { 31, 31, 31, 31, 31, 31 },
+                 0,
+                 0 };
+    }
+
+    const benchmarkScenario BENCHMARK_SCENARIOS[ NUM_BENCHMARK_SCENARIOS ] = {
+        { "singles",
+          BM_SINGLE,
+          WE_NONE,
+          3,
+          { benchmarkPkmn( PKMN_GARCHOMP, A_ROUGH_SKIN, I_LIFE_ORB, M_EARTHQUAKE, M_DRAGON_CLAW,
+                           M_STONE_EDGE, M_SWORDS_DANCE ),
+            benchmarkPkmn( PKMN_METAGROSS, A_CLEAR_BODY, I_SITRUS_BERRY, M_METEOR_MASH,
+                           M_ZEN_HEADBUTT, M_BULLET_PUNCH, M_EARTHQUAKE ),
+            benchmarkPkmn( PKMN_GYARADOS, A_INTIMIDATE, I_LEFTOVERS, M_WATERFALL, M_CRUNCH,
+                           M_THUNDER_WAVE, M_TAUNT ) },
+          { benchmarkPkmn( PKMN_CHARIZARD, A_BLAZE, I_CHOICE_SCARF, M_FLAMETHROWER,
+                           M_SOLAR_BEAM, M_HURRICANE, M_DRAGON_CLAW ),
+            benchmarkPkmn( PKMN_ROTOM, A_LEVITATE, I_LEFTOVERS, M_THUNDERBOLT, M_HEX,
+                           M_WILL_O_WISP, M_PROTECT ),
+            benchmarkPkmn( PKMN_VENUSAUR, A_OVERGROW, I_BLACK_SLUDGE, M_GIGA_DRAIN,
+                           M_SLUDGE_BOMB, M_LEECH_SEED, M_SLEEP_POWDER ) } },
+        { "doubles",
+          BM_DOUBLE,
+          WE_NONE,
+          4,
+          { benchmarkPkmn( PKMN_GARCHOMP, A_ROUGH_SKIN, I_FOCUS_SASH, M_EARTHQUAKE,
+                           M_ROCK_SLIDE, M_DRAGON_CLAW, M_PROTECT ),
+            benchmarkPkmn( PKMN_CHARIZARD, A_BLAZE, I_LIFE_ORB, M_HEAT_WAVE, M_HURRICANE,
+                           M_SOLAR_BEAM, M_PROTECT ),
+            benchmarkPkmn( PKMN_METAGROSS, A_CLEAR_BODY, I_SITRUS_BERRY, M_METEOR_MASH,
+                           M_ZEN_HEADBUTT, M_BULLET_PUNCH, M_PROTECT ),
+            benchmarkPkmn( PKMN_GYARADOS, A_INTIMIDATE, I_LUM_BERRY, M_WATERFALL,
+                           M_ICE_BEAM, M_THUNDER_WAVE, M_PROTECT ) },
+          { benchmarkPkmn( PKMN_TYRANITAR, A_UNNERVE, I_CHOICE_SCARF, M_ROCK_SLIDE,
+                           M_CRUNCH, M_EARTHQUAKE, M_STONE_EDGE ),
+            benchmarkPkmn( PKMN_AMOONGUSS, A_REGENERATOR, I_ROCKY_HELMET, M_RAGE_POWDER,
+                           M_SPORE, M_GIGA_DRAIN, M_PROTECT ),
+            benchmarkPkmn( PKMN_GENGAR, A_CURSED_BODY, I_LIFE_ORB, M_SHADOW_BALL,
+                           M_SLUDGE_BOMB, M_DAZZLING_GLEAM, M_PROTECT ),
+            benchmarkPkmn( PKMN_FERROTHORN, A_IRON_BARBS, I_LEFTOVERS, M_GYRO_BALL,
+                           M_LEECH_SEED, M_KNOCK_OFF, M_PROTECT ) } },
+        { "weather war",
+          BM_DOUBLE,
+          WE_NONE,
+          4,
+          { benchmarkPkmn( PKMN_PELIPPER, A_DRIZZLE, I_DAMP_ROCK, M_HURRICANE, M_SURF,
+                           M_WEATHER_BALL, M_RAIN_DANCE ),
+            benchmarkPkmn( PKMN_TAPU_KOKO, A_ELECTRIC_SURGE, I_TERRAIN_EXTENDER, M_THUNDER,
+                           M_DAZZLING_GLEAM, M_ELECTRIC_TERRAIN, M_PROTECT ),
+            benchmarkPkmn( PKMN_TYRANITAR, A_SAND_STREAM, I_SMOOTH_ROCK, M_ROCK_SLIDE,
+                           M_CRUNCH, M_SANDSTORM, M_PROTECT ),
+            benchmarkPkmn( PKMN_GYARADOS, A_INTIMIDATE, I_SITRUS_BERRY, M_WATERFALL,
+                           M_RAIN_DANCE, M_THUNDER_WAVE, M_PROTECT ) },
+          { benchmarkPkmn( PKMN_NINETALES, A_DROUGHT, I_HEAT_ROCK, M_HEAT_WAVE,
+                           M_SOLAR_BEAM, M_WEATHER_BALL, M_SUNNY_DAY ),
+            benchmarkPkmn( PKMN_TAPU_LELE, A_PSYCHIC_SURGE, I_TERRAIN_EXTENDER, M_PSYCHIC,
+                           M_MOONBLAST, M_PSYCHIC_TERRAIN, M_PROTECT ),
+            benchmarkPkmn( PKMN_ABOMASNOW, A_SNOW_WARNING, I_ICY_ROCK, M_BLIZZARD,
+                           M_GIGA_DRAIN, M_HAIL, M_PROTECT ),
+            benchmarkPkmn( PKMN_VENUSAUR, A_CHLOROPHYLL, I_LIFE_ORB, M_SOLAR_BEAM,
+                           M_SLUDGE_BOMB, M_SUNNY_DAY, M_PROTECT ) } },
+        { "multi-hit",
+          BM_SINGLE,
+          WE_NONE,
+          3,
+          { benchmarkPkmn( PKMN_CLOYSTER, A_SKILL_LINK, I_FOCUS_SASH, M_ICICLE_SPEAR,
+                           M_ROCK_BLAST, M_SHELL_SMASH, M_SPIKES ),
+            benchmarkPkmn( PKMN_CINCCINO, A_SKILL_LINK, I_CHOICE_SCARF, M_TAIL_SLAP,
+                           M_BULLET_SEED, M_ROCK_BLAST, M_KNOCK_OFF ),
+            benchmarkPkmn( PKMN_BRELOOM, A_TECHNICIAN, I_LIFE_ORB, M_BULLET_SEED,
+                           M_MACH_PUNCH, M_ARM_THRUST, M_SPORE ) },
+          { benchmarkPkmn( PKMN_FERROTHORN, A_IRON_BARBS, I_ROCKY_HELMET, M_PIN_MISSILE,
+                           M_GYRO_BALL, M_STEALTH_ROCK, M_LEECH_SEED ),
+            benchmarkPkmn( PKMN_GARCHOMP, A_ROUGH_SKIN, I_ROCKY_HELMET, M_SCALE_SHOT,
+                           M_DRAGON_DARTS, M_EARTHQUAKE, M_STONE_EDGE ),
+            benchmarkPkmn( PKMN_METAGROSS, A_CLEAR_BODY, I_SITRUS_BERRY, M_DOUBLE_HIT,
+                           M_METEOR_MASH, M_BULLET_PUNCH, M_ZEN_HEADBUTT ) } },
+        { "status",
+          BM_DOUBLE,
+          WE_HAIL,
+          4,
+          { benchmarkPkmn( PKMN_SABLEYE, A_PRANKSTER, I_LEFTOVERS, M_WILL_O_WISP,
+                           M_CONFUSE_RAY, M_TAUNT, M_ENCORE ),
+            benchmarkPkmn( PKMN_TOXAPEX, A_REGENERATOR, I_BLACK_SLUDGE, M_TOXIC,
+                           M_BANEFUL_BUNKER, M_SCALD, M_HAZE ),
+            benchmarkPkmn( PKMN_AMOONGUSS, A_REGENERATOR, I_ROCKY_HELMET, M_SPORE,
+                           M_RAGE_POWDER, M_STUN_SPORE, M_STRENGTH_SAP ),
+            benchmarkPkmn( PKMN_GENGAR, A_CURSED_BODY, I_FOCUS_SASH, M_HEX, M_PERISH_SONG,
+                           M_SUBSTITUTE, M_DISABLE ) },
+          { benchmarkPkmn( PKMN_VENUSAUR, A_OVERGROW, I_BLACK_SLUDGE, M_LEECH_SEED,
+                           M_POISON_POWDER, M_SLEEP_POWDER, M_SUBSTITUTE ),
+            benchmarkPkmn( PKMN_ROTOM, A_LEVITATE, I_LEFTOVERS, M_THUNDER_WAVE, M_HEX,
+                           M_WILL_O_WISP, M_PROTECT ),
+            benchmarkPkmn( PKMN_GYARADOS, A_INTIMIDATE, I_LUM_BERRY, M_SWAGGER, M_YAWN,
+                           M_TAUNT, M_WATERFALL ),
+            benchmarkPkmn( PKMN_FERROTHORN, A_IRON_BARBS, I_LEFTOVERS, M_TOXIC_SPIKES,
+                           M_LEECH_SEED, M_GYRO_BALL, M_PROTECT ) } },
+    };
+
+    struct turnPhaseResult {
+        u32 m_count;
+        u32 m_minUs;
+        u32 m_avgUs;
+        u32 m_maxUs;
+        u32 m_allocations;
+    };
+
+    /*
+     * @brief: Plays the battles of the given scenario and stores the stats of the
+     * phases of a turn in p_out.
+     */
+    void runBenchmarkScenario( const benchmarkScenario& p_scenario, u32 p_seed,
+                               turnPhaseResult* p_out ) {
+        pokemon       team[ MAX_BENCHMARK_PKMN ];
+        battleTrainer opponent;
+        std::memset( &opponent, 0, sizeof( battleTrainer ) );
+        std::strncpy( opponent.m_strings.m_name, p_scenario.m_name,
+                      trainerStrings::NAME_LENGTH - 1 );
+        opponent.m_data.m_AILevel           = DEFAULT_TRAINER_POLICY.m_aiLevel;
+        opponent.m_data.m_numPokemon        = p_scenario.m_numPkmn;
+        opponent.m_data.m_forceDoubleBattle = p_scenario.m_mode == BM_DOUBLE;
+        for( u8 i = 0; i < p_scenario.m_numPkmn; ++i ) {
+            auto pkmn                      = p_scenario.m_player[ i ];
+            team[ i ]                      = pokemon( pkmn );
+            opponent.m_data.m_pokemon[ i ] = p_scenario.m_opponent[ i ];
+            team[ i ].heal( );
+        }
+
+        auto policy      = DEFAULT_TRAINER_POLICY;
+        policy.m_mode    = p_scenario.m_mode;
+        policy.m_weather = p_scenario.m_weather;
+
+        PROF::resetPhaseStats( );
+        simulateBattles( team, p_scenario.m_numPkmn, opponent, policy, BENCHMARK_BATTLES,
+                         p_seed );
+
+        for( u8 i = 0; i < NUM_TURN_PHASES; ++i ) {
+            const auto& st = PROF::PHASE_STATS[ FIRST_BATTLE_PHASE + i ];
+
+            p_out[ i ].m_count = st.m_count;
+            p_out[ i ].m_minUs = PROF::ticksToUs( st.m_minTicks );
+            p_out[ i ].m_avgUs = PROF::ticksToUs( PROF::averageTicks( st ) );
+            p_out[ i ].m_maxUs = PROF::ticksToUs( st.m_maxTicks );
+
+            p_out[ i ].m_allocations = st.m_allocations;
+        }
+    }
+
+    void writeBenchmarkResults( FILE* p_out,
+                                const turnPhaseResult p_res[][ NUM_TURN_PHASES ] ) {
+        fprintf( p_out, "# %s %s v%d (%s %s)\n", GAME_TITLE, VERSION_NAME, VERSION, __DATE__,
+                 __TIME__ );
+        fprintf( p_out, "scenario,phase,count,min us,avg us,max us,allocs\n" );
+        for( u8 s = 0; s < NUM_BENCHMARK_SCENARIOS; ++s ) {
+            for( u8 i = 0; i < NUM_TURN_PHASES; ++i ) {
+                fprintf( p_out, "%s,%s,%lu,%lu,%lu,%lu,%lu\n", BENCHMARK_SCENARIOS[ s ].m_name,
+                         PROF::PHASE_NAMES[ FIRST_BATTLE_PHASE + i ], p_res[ s ][ i ].m_count,
+                         p_res[ s ][ i ].m_minUs, p_res[ s ][ i ].m_avgUs,
+                         p_res[ s ][ i ].m_maxUs, p_res[ s ][ i ].m_allocations );
+            }
+        }
+    }
+
+    benchmarkResult benchmarkBattleTurns( const char* p_path ) {
+        benchmarkResult res = { NUM_BENCHMARK_SCENARIOS, 0, 0, 0, false };
+        turnPhaseResult results[ NUM_BENCHMARK_SCENARIOS ][ NUM_TURN_PHASES ];
+
+        u32 turns = 0, allocations = 0;
+        for( u8 s = 0; s < NUM_BENCHMARK_SCENARIOS; ++s ) {
+            runBenchmarkScenario( BENCHMARK_SCENARIOS[ s ], u32( s ) << 16, results[ s ] );
+            turns += results[ s ][ PROF::BATTLE_TURN - FIRST_BATTLE_PHASE ].m_count;
+            allocations += results[ s ][ PROF::BATTLE_TURN - FIRST_BATTLE_PHASE ].m_allocations;
+        }
+        PROF::resetPhaseStats( );
+        if( turns ) { res.m_turnAllocations = u32( u64( allocations ) * 10 / turns ); }
+
+        FILE* f = FS::open( p_path, "BATTLEBENCH", ".prof.csv", "w" );
+        if( f ) {
+            writeBenchmarkResults( f, results );
+            FS::close( f );
+        }
+
+        // compare with the baseline, or make these results the baseline
+        f = FS::open( p_path, "BATTLEBENCH", ".base.csv", "r" );
+        if( !f ) {
+            f = FS::open( p_path, "BATTLEBENCH", ".base.csv", "w" );
+            if( f ) {
+                writeBenchmarkResults( f, results );
+                FS::close( f );
+            }
+            return res;
+        }
+
+        res.m_hasBaseline = true;
+        char line[ 100 ];
+        while( fgets( line, sizeof( line ), f ) ) {
+            char scenario[ 20 ], phase[ 20 ];
+            u32  count, minUs, avgUs, maxUs;
+            if( sscanf( line, "%19[^,],%19[^,],%lu,%lu,%lu,%lu", scenario, phase, &count, &minUs,
+                        &avgUs, &maxUs )
+                != 6 ) {
+                continue; // build info or column names; the allocation count isn't compared
+            }
+            for( u8 s = 0; s < NUM_BENCHMARK_SCENARIOS; ++s ) {
+                if( std::strcmp( scenario, BENCHMARK_SCENARIOS[ s ].m_name ) ) { continue; }
+                for( u8 i = 0; i < NUM_TURN_PHASES; ++i ) {
+                    if( std::strcmp( phase, PROF::PHASE_NAMES[ FIRST_BATTLE_PHASE + i ] ) ) {
+                        continue;
+                    }
+                    const auto& cur = results[ s ][ i ];
+                    if( cur.m_count != count ) { res.m_changed++; }
+                    if( cur.m_avgUs * 10 >= avgUs * 11 && cur.m_avgUs > avgUs ) {
+                        res.m_regressions++;
+                    }
+                }
+            }
+        }
+        FS::close( f );
+        return res;
+    }
+} // namespace BATTLE
+#endif
@@ -35,6 +35,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "battle/battleSlot.h"
 #include "battle/battleUI.h"
 #include "battle/move.h"
+#include "battle/moveTable.h"
 #include "battle/type.h"
 #include "defines.h"
 #include "gen/abilityNames.h"
@@ -119,12 +120,15 @@ namespace BATTLE {
         case I_BERRY_JUICE:
             if( lowhptrigger ) {
                 p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                auto fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_DRINK_ITEM ) );
-                snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                          p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                              .c_str( ),
-                          FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( IO::STR_UI_BATTLE_DRINK_ITEM );
+                    snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                              p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ),
+                                                 p_opponent )
+                                  .c_str( ),
+                              FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                    p_ui->log( buffer );
+                }
                 healPokemon( p_ui, p_opponent, p_pos, pkmn->m_stats.m_maxHP / 4 );
                 removeItem( p_ui, p_opponent, p_pos );
                 checkOnEatBerry( p_ui, p_opponent, p_pos, pkmn->getItem( ) );
@@ -137,13 +141,15 @@ namespace BATTLE {
                 auto res = addBoosts( p_opponent, p_pos, bs );
                 if( res != boosts( ) ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    auto fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_ACTIVATE_ITEM ) );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        auto fmt = GET_STRING( IO::STR_UI_BATTLE_ACTIVATE_ITEM );
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     p_ui->logBoosts( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent, p_pos, bs,
                                      res );
                     removeItem( p_ui, p_opponent, p_pos );
@@ -154,12 +160,15 @@ namespace BATTLE {
         case I_MENTAL_HERB:
             if( userVolStat & VS_ATTRACT ) {
                 p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                auto fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_ACTIVATE_ITEM ) );
-                snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                          p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                              .c_str( ),
-                          FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( IO::STR_UI_BATTLE_ACTIVATE_ITEM );
+                    snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                              p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ),
+                                                 p_opponent )
+                                  .c_str( ),
+                              FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                    p_ui->log( buffer );
+                }
 
                 removeVolatileStatus( p_ui, p_opponent, p_pos, VS_ATTRACT );
                 removeItem( p_ui, p_opponent, p_pos );
@@ -177,7 +186,7 @@ namespace BATTLE {
             }
 
             bool ripen = !supprAbs && pkmn->getAbility( ) == A_RIPEN;
-            auto fmt   = std::string( GET_STRING( IO::STR_UI_BATTLE_EAT_ITEM ) );
+            auto fmt   = p_ui->isHeadless( ) ? "" : GET_STRING( IO::STR_UI_BATTLE_EAT_ITEM );
 
             switch( pkmn->getItem( ) ) {
             case I_NION_BERRY: {
@@ -189,12 +198,15 @@ namespace BATTLE {
                     auto res = addBoosts( p_opponent, p_pos, bs );
                     if( res != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                                .c_str( ),
-                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ),
+                                                   p_opponent )
+                                    .c_str( ),
+                                FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
                         p_ui->logBoosts( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent, p_pos,
                                          bs, res );
                         removeItem( p_ui, p_opponent, p_pos );
@@ -206,12 +218,14 @@ namespace BATTLE {
             case I_CHERI_BERRY:
                 if( hasStatusCondition( p_opponent, p_pos, PARALYSIS ) ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     removeStatusCondition( p_opponent, p_pos );
                     p_ui->updatePkmnStats( p_opponent, p_pos,
                                            getPkmnOrDisguise( p_opponent, p_pos ) );
@@ -222,12 +236,14 @@ namespace BATTLE {
             case I_CHESTO_BERRY:
                 if( hasStatusCondition( p_opponent, p_pos, SLEEP ) ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     removeStatusCondition( p_opponent, p_pos );
                     p_ui->updatePkmnStats( p_opponent, p_pos,
                                            getPkmnOrDisguise( p_opponent, p_pos ) );
@@ -239,12 +255,14 @@ namespace BATTLE {
             case I_PECHA_BERRY:
                 if( hasStatusCondition( p_opponent, p_pos, POISON ) ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     removeStatusCondition( p_opponent, p_pos );
                     p_ui->updatePkmnStats( p_opponent, p_pos,
                                            getPkmnOrDisguise( p_opponent, p_pos ) );
@@ -256,12 +274,14 @@ namespace BATTLE {
             case I_RAWST_BERRY:
                 if( hasStatusCondition( p_opponent, p_pos, BURN ) ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     removeStatusCondition( p_opponent, p_pos );
                     p_ui->updatePkmnStats( p_opponent, p_pos,
                                            getPkmnOrDisguise( p_opponent, p_pos ) );
@@ -273,12 +293,14 @@ namespace BATTLE {
             case I_ASPEAR_BERRY:
                 if( hasStatusCondition( p_opponent, p_pos, FROZEN ) ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     removeStatusCondition( p_opponent, p_pos );
                     p_ui->updatePkmnStats( p_opponent, p_pos,
                                            getPkmnOrDisguise( p_opponent, p_pos ) );
@@ -289,12 +311,14 @@ namespace BATTLE {
             case I_ORAN_BERRY:
                 if( lowhptrigger ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     healPokemon( p_ui, p_opponent, p_pos, 10 * ( 1 + ripen ) );
                     removeItem( p_ui, p_opponent, p_pos );
                     checkOnEatBerry( p_ui, p_opponent, p_pos, pkmn->getItem( ) );
@@ -304,13 +328,15 @@ namespace BATTLE {
             case I_PERSIM_BERRY:
                 if( userVolStat & VS_CONFUSION ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_EAT_ITEM_HEAL_CONFUSION ) );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        fmt = GET_STRING( IO::STR_UI_BATTLE_EAT_ITEM_HEAL_CONFUSION );
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
 
                     removeVolatileStatus( p_ui, p_opponent, p_pos, VS_CONFUSION );
                     removeItem( p_ui, p_opponent, p_pos );
@@ -320,13 +346,15 @@ namespace BATTLE {
             case I_GARC_BERRY:
                 if( userVolStat & VS_ATTRACT ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_EAT_ITEM ) );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        fmt = GET_STRING( IO::STR_UI_BATTLE_EAT_ITEM );
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
 
                     removeVolatileStatus( p_ui, p_opponent, p_pos, VS_ATTRACT );
                     removeItem( p_ui, p_opponent, p_pos );
@@ -336,12 +364,14 @@ namespace BATTLE {
             case I_LUM_BERRY:
                 if( pkmn->m_statusint || ( userVolStat & VS_CONFUSION ) ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     removeStatusCondition( p_opponent, p_pos );
                     removeVolatileStatus( p_ui, p_opponent, p_pos, VS_CONFUSION );
                     p_ui->updatePkmnStats( p_opponent, p_pos,
@@ -353,12 +383,14 @@ namespace BATTLE {
             case I_SITRUS_BERRY:
                 if( lowhptrigger ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     healPokemon( p_ui, p_opponent, p_pos,
                                  pkmn->m_stats.m_maxHP * ( 1 + ripen ) / 4 );
                     removeItem( p_ui, p_opponent, p_pos );
@@ -368,12 +400,14 @@ namespace BATTLE {
             case I_FIGY_BERRY:
                 if( lowhptrigger ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     healPokemon( p_ui, p_opponent, p_pos,
                                  pkmn->m_stats.m_maxHP * ( 1 + ripen ) / 4 );
                     removeItem( p_ui, p_opponent, p_pos );
@@ -383,12 +417,14 @@ namespace BATTLE {
             case I_WIKI_BERRY:
                 if( lowhptrigger ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     healPokemon( p_ui, p_opponent, p_pos,
                                  pkmn->m_stats.m_maxHP * ( 1 + ripen ) / 4 );
                     removeItem( p_ui, p_opponent, p_pos );
@@ -398,12 +434,14 @@ namespace BATTLE {
             case I_MAGO_BERRY:
                 if( lowhptrigger ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     healPokemon( p_ui, p_opponent, p_pos,
                                  pkmn->m_stats.m_maxHP * ( 1 + ripen ) / 4 );
                     removeItem( p_ui, p_opponent, p_pos );
@@ -413,12 +451,14 @@ namespace BATTLE {
             case I_AGUAV_BERRY:
                 if( lowhptrigger ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     healPokemon( p_ui, p_opponent, p_pos,
                                  pkmn->m_stats.m_maxHP * ( 1 + ripen ) / 4 );
                     removeItem( p_ui, p_opponent, p_pos );
@@ -428,12 +468,14 @@ namespace BATTLE {
             case I_IAPAPA_BERRY:
                 if( lowhptrigger ) {
                     p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                            .c_str( ),
-                        FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
+                                .c_str( ),
+                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     healPokemon( p_ui, p_opponent, p_pos,
                                  pkmn->m_stats.m_maxHP * ( 1 + ripen ) / 4 );
                     removeItem( p_ui, p_opponent, p_pos );
@@ -448,12 +490,15 @@ namespace BATTLE {
                     auto res = addBoosts( p_opponent, p_pos, bs );
                     if( res != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                                .c_str( ),
-                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ),
+                                                   p_opponent )
+                                    .c_str( ),
+                                FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
                         p_ui->logBoosts( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent, p_pos,
                                          bs, res );
                         removeItem( p_ui, p_opponent, p_pos );
@@ -470,12 +515,15 @@ namespace BATTLE {
                     auto res = addBoosts( p_opponent, p_pos, bs );
                     if( res != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                                .c_str( ),
-                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ),
+                                                   p_opponent )
+                                    .c_str( ),
+                                FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
                         p_ui->logBoosts( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent, p_pos,
                                          bs, res );
                         removeItem( p_ui, p_opponent, p_pos );
@@ -492,12 +540,15 @@ namespace BATTLE {
                     auto res = addBoosts( p_opponent, p_pos, bs );
                     if( res != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                                .c_str( ),
-                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ),
+                                                   p_opponent )
+                                    .c_str( ),
+                                FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
                         p_ui->logBoosts( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent, p_pos,
                                          bs, res );
                         removeItem( p_ui, p_opponent, p_pos );
@@ -514,12 +565,15 @@ namespace BATTLE {
                     auto res = addBoosts( p_opponent, p_pos, bs );
                     if( res != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                                .c_str( ),
-                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ),
+                                                   p_opponent )
+                                    .c_str( ),
+                                FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
                         p_ui->logBoosts( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent, p_pos,
                                          bs, res );
                         removeItem( p_ui, p_opponent, p_pos );
@@ -536,12 +590,15 @@ namespace BATTLE {
                     auto res = addBoosts( p_opponent, p_pos, bs );
                     if( res != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                                .c_str( ),
-                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ),
+                                                   p_opponent )
+                                    .c_str( ),
+                                FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
                         p_ui->logBoosts( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent, p_pos,
                                          bs, res );
                         removeItem( p_ui, p_opponent, p_pos );
@@ -554,24 +611,27 @@ namespace BATTLE {
                 if( lowhptrigger ) {
                     boosts bs  = getBoosts( p_opponent, p_pos );
                     boosts res = boosts( );
-                    u8     rs  = 1 + rand( ) % 5;
+                    u8     rs  = 1 + _rng.next( ) % 5;
 
                     bool gd = false;
                     for( u8 i2 = 1; i2 < 6; ++i2 ) {
                         if( bs.getBoost( i2 ) < 6 ) { gd = true; }
                     }
-                    while( gd && bs.getBoost( rs ) >= 6 ) { rs = 1 + rand( ) % 5; }
+                    while( gd && bs.getBoost( rs ) >= 6 ) { rs = 1 + _rng.next( ) % 5; }
                     res.setBoost( rs, 3 * ( 1 + ripen ) );
 
                     auto res2 = addBoosts( p_opponent, p_pos, res );
                     if( res2 != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent )
-                                .c_str( ),
-                            FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_pos ),
+                                                   p_opponent )
+                                    .c_str( ),
+                                FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
 
                         p_ui->logBoosts( getPkmnOrDisguise( p_opponent, p_pos ), p_opponent, p_pos,
                                          res, res2 );
@@ -621,7 +681,7 @@ namespace BATTLE {
         }
 
         if( canUseItem( p_target.first, p_target.second ) ) {
-            auto fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_ACTIVATE_ITEM ) );
+            auto fmt = p_ui->isHeadless( ) ? "" : GET_STRING( IO::STR_UI_BATTLE_ACTIVATE_ITEM );
             switch( target->getItem( ) ) {
             case I_WEAKNESS_POLICY:
                 if( p_effectiveness > 100 && target->canBattle( )
@@ -634,13 +694,16 @@ namespace BATTLE {
                     if( res != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                        p_target.first );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                               p_target.first )
-                                .c_str( ),
-                            FS::getItemName( target->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                      p_target.second ),
+                                                   p_target.first )
+                                    .c_str( ),
+                                FS::getItemName( target->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
 
                         p_ui->logBoosts( getPkmnOrDisguise( p_target.first, p_target.second ),
                                          p_target.first, p_target.second, bs, res );
@@ -659,13 +722,16 @@ namespace BATTLE {
                     if( res != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                        p_target.first );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                               p_target.first )
-                                .c_str( ),
-                            FS::getItemName( target->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                      p_target.second ),
+                                                   p_target.first )
+                                    .c_str( ),
+                                FS::getItemName( target->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
 
                         p_ui->logBoosts( getPkmnOrDisguise( p_target.first, p_target.second ),
                                          p_target.first, p_target.second, bs, res );
@@ -684,13 +750,16 @@ namespace BATTLE {
                     if( res != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                        p_target.first );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                               p_target.first )
-                                .c_str( ),
-                            FS::getItemName( target->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                      p_target.second ),
+                                                   p_target.first )
+                                    .c_str( ),
+                                FS::getItemName( target->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
 
                         p_ui->logBoosts( getPkmnOrDisguise( p_target.first, p_target.second ),
                                          p_target.first, p_target.second, bs, res );
@@ -710,13 +779,16 @@ namespace BATTLE {
                     if( res != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                        p_target.first );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                               p_target.first )
-                                .c_str( ),
-                            FS::getItemName( target->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                      p_target.second ),
+                                                   p_target.first )
+                                    .c_str( ),
+                                FS::getItemName( target->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
 
                         p_ui->logBoosts( getPkmnOrDisguise( p_target.first, p_target.second ),
                                          p_target.first, p_target.second, bs, res );
@@ -735,13 +807,16 @@ namespace BATTLE {
                     if( res != boosts( ) ) {
                         p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                        p_target.first );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                               p_target.first )
-                                .c_str( ),
-                            FS::getItemName( target->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                      p_target.second ),
+                                                   p_target.first )
+                                    .c_str( ),
+                                FS::getItemName( target->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
 
                         p_ui->logBoosts( getPkmnOrDisguise( p_target.first, p_target.second ),
                                          p_target.first, p_target.second, bs, res );
@@ -752,24 +827,30 @@ namespace BATTLE {
                 break;
 
             case I_AIR_BALLOON: {
-                fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_ACTIVATE_AIR_BALLON ) );
-                snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                          p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                             p_target.first )
-                              .c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    fmt = GET_STRING( IO::STR_UI_BATTLE_ACTIVATE_AIR_BALLON );
+                    snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                              p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                    p_target.second ),
+                                                 p_target.first )
+                                  .c_str( ) );
+                    p_ui->log( buffer );
+                }
                 removeItem( p_ui, p_target.first, p_target.second );
                 break;
             }
             case I_EJECT_BUTTON:
                 p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                p_target.first );
-                snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                          p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                             p_target.first )
-                              .c_str( ),
-                          FS::getItemName( target->getItem( ) ).c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                              p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                    p_target.second ),
+                                                 p_target.first )
+                                  .c_str( ),
+                              FS::getItemName( target->getItem( ) ).c_str( ) );
+                    p_ui->log( buffer );
+                }
                 removeItem( p_ui, p_target.first, p_target.second );
                 // TODO: should only work if opponent has > 1 pkmn that can battle
                 recallPokemon( p_ui, p_target.first, p_target.second );
@@ -783,20 +864,23 @@ namespace BATTLE {
             || !_sides[ !p_move.m_user.first ? PLAYER_SIDE : OPPONENT_SIDE ].anyHasAbility(
                 A_UNNERVE ) ) {
             if( canUseItem( p_target.first, p_target.second ) ) {
-                auto fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_EAT_ITEM ) );
+                auto fmt = p_ui->isHeadless( ) ? "" : GET_STRING( IO::STR_UI_BATTLE_EAT_ITEM );
                 switch( target->getItem( ) ) {
                 case I_ENIGMA_BERRY:
                     if( p_effectiveness > 100 && target->canBattle( )
                         && target->m_stats.m_curHP < target->m_stats.m_maxHP ) {
                         p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                        p_target.first );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                               p_target.first )
-                                .c_str( ),
-                            FS::getItemName( target->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                      p_target.second ),
+                                                   p_target.first )
+                                    .c_str( ),
+                                FS::getItemName( target->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
 
                         if( supprAbs || target->getAbility( ) != A_RIPEN ) {
                             healPokemon( p_ui, p_target.first, p_target.second,
@@ -815,13 +899,16 @@ namespace BATTLE {
                     if( user->canBattle( ) && p_move.m_moveData.m_category == MH_PHYSICAL ) {
                         p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                        p_target.first );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                               p_target.first )
-                                .c_str( ),
-                            FS::getItemName( target->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                      p_target.second ),
+                                                   p_target.first )
+                                    .c_str( ),
+                                FS::getItemName( target->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
 
                         if( supprAbs || target->getAbility( ) != A_RIPEN ) {
                             damagePokemon( p_ui, p_move.m_user.first, p_move.m_user.second,
@@ -849,13 +936,16 @@ namespace BATTLE {
                         if( res != boosts( ) ) {
                             p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                            p_target.first );
-                            snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                                      p_ui->getPkmnName(
-                                              getPkmnOrDisguise( p_target.first, p_target.second ),
-                                              p_target.first )
-                                          .c_str( ),
-                                      FS::getItemName( target->getItem( ) ).c_str( ) );
-                            p_ui->log( buffer );
+                            if( !p_ui->isHeadless( ) ) {
+                                snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                                          p_ui->getPkmnName(
+                                                  getPkmnOrDisguise( p_target.first,
+                                                                     p_target.second ),
+                                                  p_target.first )
+                                              .c_str( ),
+                                          FS::getItemName( target->getItem( ) ).c_str( ) );
+                                p_ui->log( buffer );
+                            }
 
                             p_ui->logBoosts( getPkmnOrDisguise( p_target.first, p_target.second ),
                                              p_target.first, p_target.second, bs, res );
@@ -879,13 +969,16 @@ namespace BATTLE {
                         if( res != boosts( ) ) {
                             p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                            p_target.first );
-                            snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                                      p_ui->getPkmnName(
-                                              getPkmnOrDisguise( p_target.first, p_target.second ),
-                                              p_target.first )
-                                          .c_str( ),
-                                      FS::getItemName( target->getItem( ) ).c_str( ) );
-                            p_ui->log( buffer );
+                            if( !p_ui->isHeadless( ) ) {
+                                snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                                          p_ui->getPkmnName(
+                                                  getPkmnOrDisguise( p_target.first,
+                                                                     p_target.second ),
+                                                  p_target.first )
+                                              .c_str( ),
+                                          FS::getItemName( target->getItem( ) ).c_str( ) );
+                                p_ui->log( buffer );
+                            }
 
                             p_ui->logBoosts( getPkmnOrDisguise( p_target.first, p_target.second ),
                                              p_target.first, p_target.second, bs, res );
@@ -901,13 +994,16 @@ namespace BATTLE {
                     if( user->canBattle( ) && p_move.m_moveData.m_category == MH_SPECIAL ) {
                         p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                        p_target.first );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                               p_target.first )
-                                .c_str( ),
-                            FS::getItemName( target->getItem( ) ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                      p_target.second ),
+                                                   p_target.first )
+                                    .c_str( ),
+                                FS::getItemName( target->getItem( ) ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
 
                         if( supprAbs || target->getAbility( ) != A_RIPEN ) {
                             damagePokemon( p_ui, p_move.m_user.first, p_move.m_user.second,
@@ -1114,16 +1210,14 @@ namespace BATTLE {
                         if( tmp == nullptr ) { continue; }
                         for( u8 j = 0; j < 4; ++j ) {
                             if( tmp->getMove( j ) ) [[likely]] {
-                                auto mdata = FS::getMoveData( tmp->getMove( j ) );
+                                auto mdata = MOVE_TABLE.get( tmp->getMove( j ) );
                                 if( ( mdata.m_flags & MF_OHKO ) ) [[unlikely]] {
                                     warn = true;
                                     break;
                                 }
-                                u16 eff = 1;
-                                for( auto tp : getTypes( p_opponent, p_slot ) ) {
-                                    eff *= getTypeEffectiveness( mdata.m_type, tp );
-                                }
-                                if( eff > 1 ) {
+                                u16 eff = getEffectivenessOnTypes(
+                                    mdata.m_type, getTypeMask( p_opponent, p_slot ) );
+                                if( eff > 100 ) {
                                     warn = true;
                                     break;
                                 }
@@ -1146,7 +1240,7 @@ namespace BATTLE {
                         for( u8 j = 0; j < 4; ++j ) {
                             if( tmp->getMove( j ) ) {
                                 moves.push_back( std::pair<u8, u16>(
-                                    255 - FS::getMoveData( tmp->getMove( j ) ).m_basePower,
+                                    255 - MOVE_TABLE.get( tmp->getMove( j ) ).m_basePower,
                                     tmp->getMove( j ) ) );
                             }
                         }
@@ -1266,7 +1360,7 @@ namespace BATTLE {
                     auto adj = getPkmn( i, !j );
 
                     if( adj != nullptr && adj->getAbility( ) == A_HEALER ) {
-                        if( pkmn->m_statusint && !( rand( ) % 3 ) ) {
+                        if( pkmn->m_statusint && !( _rng.next( ) % 3 ) ) {
                             if( removeStatusCondition( i, j ) ) {
                                 p_ui->logAbility( getPkmnOrDisguise( i, !j ), i );
                                 p_ui->updatePkmnStats( i, j, getPkmnOrDisguise( i, j ), true );
@@ -1276,7 +1370,7 @@ namespace BATTLE {
 
                     switch( pkmn->getAbility( ) ) {
                     case A_SHED_SKIN:
-                        if( pkmn->m_statusint && !( rand( ) % 3 ) ) {
+                        if( pkmn->m_statusint && !( _rng.next( ) % 3 ) ) {
                             if( removeStatusCondition( i, j ) ) {
                                 p_ui->logAbility( getPkmnOrDisguise( i, j ), i );
                                 p_ui->updatePkmnStats( i, j, getPkmnOrDisguise( i, j ), true );
@@ -1297,20 +1391,20 @@ namespace BATTLE {
                     case A_MOODY: {
                         boosts bs  = getBoosts( i, j );
                         boosts res = boosts( );
-                        u8     rs = 1 + rand( ) % 5, lw = 1 + rand( ) % 5;
+                        u8     rs = 1 + _rng.next( ) % 5, lw = 1 + _rng.next( ) % 5;
 
                         bool gd = false;
                         for( u8 i2 = 1; i2 < 6; ++i2 ) {
                             if( bs.getBoost( i2 ) < 6 ) { gd = true; }
                         }
-                        while( gd && bs.getBoost( rs ) >= 6 ) { rs = 1 + rand( ) % 5; }
+                        while( gd && bs.getBoost( rs ) >= 6 ) { rs = 1 + _rng.next( ) % 5; }
                         res.setBoost( rs, 2 );
                         gd = false;
                         for( u8 i2 = 1; i2 < 6; ++i2 ) {
                             if( bs.getBoost( i2 ) > -6 ) { gd = true; }
                         }
                         while( gd && ( bs.getBoost( lw ) <= -6 || rs == lw ) ) {
-                            lw = 1 + rand( ) % 5;
+                            lw = 1 + _rng.next( ) % 5;
                         }
                         res.setBoost( lw, -1 );
 
@@ -1382,11 +1476,13 @@ namespace BATTLE {
 
                 auto volst = getVolatileStatus( i, j );
                 if( volst & VS_NIGHTMARE ) {
-                    auto fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_HARMED_BY_NIGHTMARE ) );
                     if( hasStatusCondition( i, j, SLEEP ) ) {
-                        snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                                  p_ui->getPkmnName( getPkmnOrDisguise( i, j ), i ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            auto fmt = GET_STRING( IO::STR_UI_BATTLE_HARMED_BY_NIGHTMARE );
+                            snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                                      p_ui->getPkmnName( getPkmnOrDisguise( i, j ), i ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
                         u16 amount = pkmn->m_stats.m_maxHP / 4;
                         if( !amount ) { amount = 1; }
                         damagePokemon( p_ui, i, j, amount );
@@ -1397,7 +1493,7 @@ namespace BATTLE {
 
                 if( volst & VS_YAWN ) {
                     if( getVolatileStatusCounter( i, j, VS_YAWN ) == 1 ) {
-                        if( setStatusCondition( i, j, SLEEP, 4 + ( rand( ) & 3 ) ) ) {
+                        if( setStatusCondition( i, j, SLEEP, 4 + ( _rng.next( ) & 3 ) ) ) {
                             p_ui->animateGetStatusCondition( getPkmnOrDisguise( i, j ), i, j,
                                                              SLEEP );
                             p_ui->updatePkmnStats( i, j, getPkmnOrDisguise( i, j ), true );
@@ -1408,11 +1504,12 @@ namespace BATTLE {
                 }
                 if( volst & VS_AQUARING ) {
                     if( !( volst & VS_HEALBLOCK ) ) {
-                        auto fmt
-                            = std::string( GET_STRING( IO::STR_UI_BATTLE_HEALED_BY_AQUA_RING ) );
-                        snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                                  p_ui->getPkmnName( getPkmnOrDisguise( i, j ), i ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            auto fmt = GET_STRING( IO::STR_UI_BATTLE_HEALED_BY_AQUA_RING );
+                            snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                                      p_ui->getPkmnName( getPkmnOrDisguise( i, j ), i ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
                         u16 amount = pkmn->m_stats.m_maxHP / 16;
                         if( !amount ) { amount = 1; }
                         if( canUseItem( i, j ) && pkmn->getItem( ) == I_BIG_ROOT ) {
@@ -1423,10 +1520,12 @@ namespace BATTLE {
                 }
                 if( volst & VS_INGRAIN ) {
                     if( !( volst & VS_HEALBLOCK ) ) {
-                        auto fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_HEALED_BY_INGRAIN ) );
-                        snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                                  p_ui->getPkmnName( getPkmnOrDisguise( i, j ), i ).c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            auto fmt = GET_STRING( IO::STR_UI_BATTLE_HEALED_BY_INGRAIN );
+                            snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                                      p_ui->getPkmnName( getPkmnOrDisguise( i, j ), i ).c_str( ) );
+                            p_ui->log( buffer );
+                        }
                         u16 amount = pkmn->m_stats.m_maxHP / 16;
                         if( !amount ) { amount = 1; }
                         if( canUseItem( i, j ) && pkmn->getItem( ) == I_BIG_ROOT ) {
@@ -1439,10 +1538,12 @@ namespace BATTLE {
 #ifdef DESQUID_MORE
                     p_ui->log( std::to_string( volst ) );
 #endif
-                    auto fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_HARMED_BY_CURSE ) );
-                    snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                              p_ui->getPkmnName( getPkmnOrDisguise( i, j ), i ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        auto fmt = GET_STRING( IO::STR_UI_BATTLE_HARMED_BY_CURSE );
+                        snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                                  p_ui->getPkmnName( getPkmnOrDisguise( i, j ), i ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     u16 amount = pkmn->m_stats.m_maxHP / 4;
                     if( !amount ) { amount = 1; }
                     damagePokemon( p_ui, i, j, amount );
@@ -1560,7 +1661,7 @@ namespace BATTLE {
 
     bool field::setWeather( battleUI* p_ui, weather p_newWeather, bool p_extended ) {
         if( p_newWeather == _weather ) {
-            p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+            if( !p_ui->isHeadless( ) ) { p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) ); }
             return false;
         }
 
@@ -1569,7 +1670,9 @@ namespace BATTLE {
             // weather can be replaced only with a similar weather
             if( p_newWeather != WE_HEAVY_RAIN && p_newWeather != WE_HEAVY_SUNSHINE
                 && p_newWeather != WE_HEAVY_WINDS ) {
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
                 return false;
             }
         }
@@ -1761,7 +1864,9 @@ namespace BATTLE {
 
     bool field::setTerrain( battleUI* p_ui, terrain p_newTerrain, bool p_extended ) {
         if( _terrain == p_newTerrain ) {
-            p_ui->log( GET_STRING( IO::STR_UI_BATTLE_TERRAIN_NO_CHANGE ) );
+            if( !p_ui->isHeadless( ) ) {
+                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_TERRAIN_NO_CHANGE ) );
+            }
             return false;
         }
         p_ui->setNewTerrain( p_newTerrain );
@@ -1783,34 +1888,40 @@ namespace BATTLE {
 
         constexpr u8 TMP_BUFFER_SIZE = 100;
         char         buffer[ TMP_BUFFER_SIZE + 10 ];
-        auto         fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_MEGA_EVOLVE_WISH ) );
-        snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                  p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_slot ), p_opponent ).c_str( ),
-                  FS::getItemName( pkmn->getItem( ) ).c_str( ) );
-        p_ui->log( std::string( buffer ) );
+        const char*  fmt;
+        if( !p_ui->isHeadless( ) ) {
+            fmt = GET_STRING( IO::STR_UI_BATTLE_MEGA_EVOLVE_WISH );
+            snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                      p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_slot ), p_opponent )
+                          .c_str( ),
+                      FS::getItemName( pkmn->getItem( ) ).c_str( ) );
+            p_ui->log( buffer );
+        }
 
         pkmn->battleTransform( );
         pkmn = getPkmn( p_opponent, p_slot );
         if( pkmn == nullptr ) [[unlikely]] { return; }
         p_ui->updatePkmn( p_opponent, p_slot, getPkmnOrDisguise( p_opponent, p_slot ) );
 
-        fmt = std::string( GET_STRING( IO::STR_UI_BATTLE_MEGA_EVOLVE_WISH_GRANTED ) );
-        snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                  p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_slot ), p_opponent ).c_str( ),
-                  pkmn->getItem( ) );
-        p_ui->log( std::string( buffer ) );
+        if( !p_ui->isHeadless( ) ) {
+            fmt = GET_STRING( IO::STR_UI_BATTLE_MEGA_EVOLVE_WISH_GRANTED );
+            snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                      p_ui->getPkmnName( getPkmnOrDisguise( p_opponent, p_slot ), p_opponent )
+                          .c_str( ),
+                      pkmn->getItem( ) );
+            p_ui->log( buffer );
+        }
 
         checkOnSendOut( p_ui, p_opponent, p_slot );
     }
 
-    std::vector<battleMove>
-    field::computeSortedBattleMoves( battleUI*                               p_ui,
-                                     const std::vector<battleMoveSelection>& p_selectedMoves ) {
-        std::vector<battleMove> res = std::vector<battleMove>( );
+    battleMoves field::computeSortedBattleMoves( battleUI*                   p_ui,
+                                                 const battleMoveSelections& p_selectedMoves ) {
+        battleMoves res;
 
         // randomly pertube scores slightly to break ties.
         u8 pertub[ 4 ] = { 0, 1, 2, 3 };
-        for( u8 i = 0; i < 4; ++i ) { std::swap( pertub[ i ], pertub[ rand( ) % 4 ] ); }
+        for( u8 i = 0; i < 4; ++i ) { std::swap( pertub[ i ], pertub[ _rng.next( ) % 4 ] ); }
 
         for( u8 j = 0; j < p_selectedMoves.size( ); ++j ) {
             battleMove bm;
@@ -1818,7 +1929,7 @@ namespace BATTLE {
 
             bm.m_param       = m.m_param;
             bm.m_user        = m.m_user;
-            bm.m_target      = std::vector<fieldPosition>( );
+            bm.m_target      = { };
             bm.m_pertubation = pertub[ j ];
             bm.m_moveData    = m.m_moveData;
             bm.m_megaEvolve  = m.m_megaEvolve;
@@ -1884,7 +1995,7 @@ namespace BATTLE {
 
                         if( getPkmn( m.m_user.first, m.m_user.second )->getItem( ) == I_QUICK_CLAW )
                             [[unlikely]] {
-                            if( rand( ) % 100 < 20 ) {
+                            if( _rng.next( ) % 100 < 20 ) {
                                 bm.m_priority++;
                                 res.push_back( { MT_MESSAGE_ITEM,
                                                  I_QUICK_CLAW,
@@ -2089,14 +2200,18 @@ namespace BATTLE {
                     checkOnSendOut( p_ui, p_move.m_user.first, p_move.m_user.second );
                 }
             } else {
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
             }
             return;
         }
 
         if( p_move.m_param == M_REST ) {
             if( getVolatileStatus( p_target.first, p_target.second ) & VS_HEALBLOCK ) {
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
             } else {
                 user->m_status.m_isAsleep = 3;
                 p_ui->animateGetStatusCondition(
@@ -2120,7 +2235,9 @@ namespace BATTLE {
         // Heal
         if( p_move.m_moveData.m_heal ) {
             if( getVolatileStatus( p_target.first, p_target.second ) & VS_HEALBLOCK ) {
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
             } else {
                 u16 amount = target->m_stats.m_maxHP * p_move.m_moveData.m_heal / 240;
                 if( !amount ) { amount = 1; }
@@ -2130,7 +2247,9 @@ namespace BATTLE {
         if( p_move.m_param == M_SYNTHESIS || p_move.m_param == M_MOONLIGHT
             || p_move.m_param == M_MORNING_SUN ) {
             if( getVolatileStatus( p_target.first, p_target.second ) & VS_HEALBLOCK ) {
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
             } else {
                 u16 amount = 1;
                 switch( getWeather( ) ) {
@@ -2146,7 +2265,9 @@ namespace BATTLE {
         }
         if( p_move.m_param == M_SHORE_UP ) {
             if( getVolatileStatus( p_target.first, p_target.second ) & VS_HEALBLOCK ) {
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
             } else {
                 u16 amount = 1;
                 switch( getWeather( ) ) {
@@ -2167,7 +2288,9 @@ namespace BATTLE {
                     healPokemon( p_ui, p_move.m_user.first, p_move.m_user.second, amount );
                 }
             } else {
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
             }
         }
         if( p_move.m_param == M_STRENGTH_SAP ) {
@@ -2194,16 +2317,19 @@ namespace BATTLE {
                 corr = ( p_move.m_moveData.m_secondaryStatus == POISON );
             }
 
-            if( setStatusCondition( p_target.first, p_target.second, p_move.m_moveData.m_status,
-                                    p_move.m_moveData.m_status == SLEEP ? ( 4 + ( rand( ) & 3 ) )
-                                                                        : ( corr ? 254 : 255 ) ) ) {
+            if( setStatusCondition(
+                    p_target.first, p_target.second, p_move.m_moveData.m_status,
+                    p_move.m_moveData.m_status == SLEEP ? ( 4 + ( _rng.next( ) & 3 ) )
+                                                        : ( corr ? 254 : 255 ) ) ) {
                 p_ui->animateGetStatusCondition(
                     getPkmnOrDisguise( p_target.first, p_target.second ), p_target.first,
                     p_target.second, p_move.m_moveData.m_status );
                 p_ui->updatePkmnStats( p_target.first, p_target.second,
                                        getPkmnOrDisguise( p_target.first, p_target.second ), true );
             } else {
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
             }
         }
 
@@ -2264,7 +2390,7 @@ namespace BATTLE {
 
                 auto lstmv = getLastUsedMove( p_target.first, p_target.second );
                 if( lstmv.m_moveData.m_volatileStatus & ( VS_PROTECT | VS_ENDURE ) ) {
-                    fail = ( rand( ) & 31 ) > 10;
+                    fail = ( _rng.next( ) & 31 ) > 10;
                 }
             }
 
@@ -2275,7 +2401,9 @@ namespace BATTLE {
                     getPkmnOrDisguise( p_target.first, p_target.second ), p_target.first,
                     p_target.second, p_move.m_moveData.m_volatileStatus );
             } else {
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
             }
         }
     }
@@ -2297,7 +2425,7 @@ namespace BATTLE {
             }
             if( setStatusCondition(
                     p_target.first, p_target.second, p_move.m_moveData.m_secondaryStatus,
-                    p_move.m_moveData.m_secondaryStatus == SLEEP ? ( 4 + ( rand( ) & 3 ) )
+                    p_move.m_moveData.m_secondaryStatus == SLEEP ? ( 4 + ( _rng.next( ) & 3 ) )
                                                                  : ( corr ? 254 : 255 ) ) ) {
                 p_ui->animateGetStatusCondition(
                     getPkmnOrDisguise( p_target.first, p_target.second ), p_target.first,
@@ -2305,7 +2433,9 @@ namespace BATTLE {
                 p_ui->updatePkmnStats( p_target.first, p_target.second,
                                        getPkmnOrDisguise( p_target.first, p_target.second ), true );
             } else {
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
             }
         }
 
@@ -2316,7 +2446,7 @@ namespace BATTLE {
                 duration   = 1;
                 auto lstmv = getLastUsedMove( p_target.first, p_target.second );
                 if( lstmv.m_moveData.m_volatileStatus & ( VS_PROTECT | VS_ENDURE ) ) {
-                    fail = ( rand( ) & 31 ) > 10;
+                    fail = ( _rng.next( ) & 31 ) > 10;
                 }
             }
 
@@ -2327,7 +2457,9 @@ namespace BATTLE {
                     getPkmnOrDisguise( p_target.first, p_target.second ), p_target.first,
                     p_target.second, p_move.m_moveData.m_secondaryVolatileStatus );
             } else {
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
             }
         }
     }
@@ -2505,7 +2637,7 @@ namespace BATTLE {
                 break;
             }
             case A_CUTE_CHARM: {
-                if( !( rand( ) % 3 ) ) {
+                if( !( _rng.next( ) % 3 ) ) {
                     p_ui->logAbility( getPkmnOrDisguise( p_target.first, p_target.second ),
                                       p_target.first );
                     addVolatileStatus( p_ui, p_move.m_user.first, p_move.m_user.second, VS_ATTRACT,
@@ -2517,7 +2649,7 @@ namespace BATTLE {
                 break;
             }
             case A_FLAME_BODY: {
-                if( !( rand( ) % 3 ) ) {
+                if( !( _rng.next( ) % 3 ) ) {
                     if( setStatusCondition( p_move.m_user.first, p_move.m_user.second, BURN ) ) {
                         p_ui->logAbility( getPkmnOrDisguise( p_target.first, p_target.second ),
                                           p_target.first );
@@ -2532,7 +2664,7 @@ namespace BATTLE {
                 break;
             }
             case A_POISON_POINT: {
-                if( !( rand( ) % 3 ) ) {
+                if( !( _rng.next( ) % 3 ) ) {
                     if( setStatusCondition( p_move.m_user.first, p_move.m_user.second, POISON ) ) {
                         p_ui->logAbility( getPkmnOrDisguise( p_target.first, p_target.second ),
                                           p_target.first );
@@ -2547,7 +2679,7 @@ namespace BATTLE {
                 break;
             }
             case A_STATIC: {
-                if( !( rand( ) % 3 ) ) {
+                if( !( _rng.next( ) % 3 ) ) {
                     if( setStatusCondition( p_move.m_user.first, p_move.m_user.second,
                                             PARALYSIS ) ) {
                         p_ui->logAbility( getPkmnOrDisguise( p_target.first, p_target.second ),
@@ -2564,9 +2696,9 @@ namespace BATTLE {
             }
 
             case A_EFFECT_SPORE: {
-                if( !( rand( ) % 3 ) ) {
+                if( !( _rng.next( ) % 3 ) ) {
                     // TODO message
-                    switch( rand( ) % 3 ) {
+                    switch( _rng.next( ) % 3 ) {
                     case 0:
                         if( setStatusCondition( p_move.m_user.first, p_move.m_user.second,
                                                 BURN ) ) {
@@ -2613,7 +2745,7 @@ namespace BATTLE {
             }
 
             case A_POISON_TOUCH: {
-                if( !( rand( ) % 3 ) ) {
+                if( !( _rng.next( ) % 3 ) ) {
                     if( setStatusCondition( p_target.first, p_target.second, POISON ) ) {
                         p_ui->logAbility(
                             getPkmnOrDisguise( p_move.m_user.first, p_move.m_user.second ),
@@ -2642,25 +2774,34 @@ namespace BATTLE {
         auto volst = getVolatileStatus( opponent, slot );
 
         if( p_move.m_param == M_FOCUS_PUNCH && !( volst & VS_FOCUSPUNCH ) ) [[unlikely]] {
-            auto fmt = std::string( GET_STRING( 548 ) );
-            snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                      p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ) );
-            p_ui->log( buffer );
+            if( !p_ui->isHeadless( ) ) {
+                auto fmt = GET_STRING( 548 );
+                snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                          p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                              .c_str( ) );
+                p_ui->log( buffer );
+            }
             return MOVE_FAIL;
         }
         if( p_move.m_param == M_SHELL_TRAP && ( volst & VS_SHELLTRAP ) ) [[unlikely]] {
-            auto fmt = std::string( GET_STRING( 536 ) );
-            snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                      p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ) );
-            p_ui->log( buffer );
+            if( !p_ui->isHeadless( ) ) {
+                auto fmt = GET_STRING( 536 );
+                snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                          p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                              .c_str( ) );
+                p_ui->log( buffer );
+            }
             return MOVE_FAIL;
         }
 
         if( volst & VS_RECHARGE ) [[unlikely]] {
-            auto fmt = std::string( GET_STRING( 276 ) );
-            snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                      p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ) );
-            p_ui->log( buffer );
+            if( !p_ui->isHeadless( ) ) {
+                auto fmt = GET_STRING( 276 );
+                snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                          p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                              .c_str( ) );
+                p_ui->log( buffer );
+            }
 
             removeVolatileStatus( p_ui, opponent, slot, VS_RECHARGE );
             removeLockedMove( opponent, slot );
@@ -2668,22 +2809,28 @@ namespace BATTLE {
         }
 
         if( volst & VS_FLINCH ) [[unlikely]] {
-            auto fmt = std::string( GET_STRING( 296 ) );
-            snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                      p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ) );
-            p_ui->log( buffer );
+            if( !p_ui->isHeadless( ) ) {
+                auto fmt = GET_STRING( 296 );
+                snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                          p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                              .c_str( ) );
+                p_ui->log( buffer );
+            }
             return MOVE_FAIL_NO_PP;
         }
 
         if( hasStatusCondition( opponent, slot, FROZEN ) ) [[unlikely]] {
             if( p_move.m_moveData.m_type == TYPE_FIRE || ( p_move.m_moveData.m_flags & MF_DEFROST )
-                || ( rand( ) % 100 < 20 ) ) {
+                || ( _rng.next( ) % 100 < 20 ) ) {
                 // user thaws
-                auto fmt = std::string( GET_STRING( 298 ) );
-                snprintf(
-                    buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                    p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( 298 );
+                    snprintf(
+                        buffer, TMP_BUFFER_SIZE, fmt,
+                        p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                            .c_str( ) );
+                    p_ui->log( buffer );
+                }
                 removeStatusCondition( opponent, slot );
                 p_ui->updatePkmnStats( opponent, slot, getPkmn( opponent, slot ) );
             } else {
@@ -2701,28 +2848,35 @@ namespace BATTLE {
                 if( !( p_move.m_moveData.m_flags & MF_SLEEPUSABLE ) ) { return MOVE_FAIL_NO_PP; }
             } else {
                 removeStatusCondition( opponent, slot );
-                auto fmt = std::string( GET_STRING( 300 ) );
-                snprintf(
-                    buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                    p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( 300 );
+                    snprintf(
+                        buffer, TMP_BUFFER_SIZE, fmt,
+                        p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                            .c_str( ) );
+                    p_ui->log( buffer );
+                }
                 p_ui->updatePkmnStats( opponent, slot, getPkmn( opponent, slot ) );
             }
         } else if( p_move.m_moveData.m_flags & MF_SLEEPUSABLE ) {
             if( getPkmn( opponent, slot )->getAbility( ) != A_COMATOSE ) {
-                auto fmt = std::string( GET_STRING( 10 ) );
-                snprintf(
-                    buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                    p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ),
-                    FS::getMoveName( p_move.m_param ).c_str( ) );
-                p_ui->log( buffer );
-                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( 10 );
+                    snprintf(
+                        buffer, TMP_BUFFER_SIZE, fmt,
+                        p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ),
+                        FS::getMoveName( p_move.m_param ).c_str( ) );
+                    p_ui->log( buffer );
+                }
+                if( !p_ui->isHeadless( ) ) {
+                    p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) );
+                }
                 return MOVE_FAIL;
             }
         }
 
         if( hasStatusCondition( opponent, slot, PARALYSIS ) ) {
-            if( rand( ) % 100 < 25 ) {
+            if( _rng.next( ) % 100 < 25 ) {
                 p_ui->animateStatusCondition( getPkmn( opponent, slot ), opponent, slot,
                                               PARALYSIS );
                 return MOVE_FAIL_NO_PP;
@@ -2735,24 +2889,30 @@ namespace BATTLE {
                 --curVal;
                 p_ui->animateVolatileStatusCondition( getPkmn( opponent, slot ), opponent, slot,
                                                       VS_CONFUSION );
-                auto fmt = std::string( GET_STRING( 293 ) );
-                snprintf(
-                    buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                    p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( 293 );
+                    snprintf(
+                        buffer, TMP_BUFFER_SIZE, fmt,
+                        p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                            .c_str( ) );
+                    p_ui->log( buffer );
+                }
                 addVolatileStatus( p_ui, opponent, slot, VS_CONFUSION, curVal );
 
-                if( rand( ) % 300 < 100 ) {
+                if( _rng.next( ) % 300 < 100 ) {
                     confusionSelfDamage( p_ui, opponent, slot );
-                    p_ui->log( GET_STRING( 295 ) );
+                    if( !p_ui->isHeadless( ) ) { p_ui->log( GET_STRING( 295 ) ); }
                     return MOVE_FAIL_NO_PP;
                 }
             } else {
-                auto fmt = std::string( GET_STRING( 294 ) );
-                snprintf(
-                    buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                    p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( 294 );
+                    snprintf(
+                        buffer, TMP_BUFFER_SIZE, fmt,
+                        p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                            .c_str( ) );
+                    p_ui->log( buffer );
+                }
                 removeVolatileStatus( p_ui, opponent, slot, VS_CONFUSION );
             }
         }
@@ -2767,12 +2927,15 @@ namespace BATTLE {
         }
 
         if( volst & VS_ATTRACT ) [[unlikely]] {
-            if( rand( ) % 100 < 50 ) {
-                auto fmt = std::string( GET_STRING( 302 ) );
-                snprintf(
-                    buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                    p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ) );
-                p_ui->log( buffer );
+            if( _rng.next( ) % 100 < 50 ) {
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( 302 );
+                    snprintf(
+                        buffer, TMP_BUFFER_SIZE, fmt,
+                        p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                            .c_str( ) );
+                    p_ui->log( buffer );
+                }
                 return MOVE_FAIL_NO_PP;
             }
         }
@@ -2818,7 +2981,7 @@ namespace BATTLE {
         }
         if( p_move.m_moveData.m_flags & MF_OHKO ) {
             if( target->m_level > user->m_level ) { return true; }
-            return ( rand( ) % 100 ) > ( 20 + user->m_level - target->m_level );
+            return ( _rng.next( ) % 100 ) > u32( 20 + user->m_level - target->m_level );
         }
 
         if( usvol & VS_FORESIGHT ) { return false; }
@@ -2898,7 +3061,7 @@ namespace BATTLE {
         (void) p_ui;
 #endif
 
-        return rand( ) % 100 >= acc;
+        return _rng.next( ) % 100 >= acc;
     }
 
     bool field::executeCriticalCheck( battleUI* p_ui, battleMove p_move, fieldPosition p_target ) {
@@ -2959,12 +3122,15 @@ namespace BATTLE {
                     || !_sides[ opponent ? PLAYER_SIDE : OPPONENT_SIDE ].anyHasAbility(
                         A_UNNERVE ) ) [[likely]] {
                     p_ui->logItem( getPkmnOrDisguise( opponent, slot ), opponent );
-                    auto fmt = std::string( GET_STRING( 279 ) );
-                    snprintf(
-                        buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                        p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ),
-                        FS::getItemName( I_LANSAT_BERRY ).c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        auto fmt = GET_STRING( 279 );
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                                .c_str( ),
+                            FS::getItemName( I_LANSAT_BERRY ).c_str( ) );
+                        p_ui->log( buffer );
+                    }
 
                     critLevel += 3;
 
@@ -2979,11 +3145,11 @@ namespace BATTLE {
         if( critLevel >= 3 ) [[unlikely]] {
             critical = true;
         } else if( critLevel == 2 ) [[unlikely]] {
-            critical = !( rand( ) % 2 );
+            critical = !( _rng.next( ) % 2 );
         } else if( critLevel == 1 ) {
-            critical = !( rand( ) % 8 );
+            critical = !( _rng.next( ) % 8 );
         } else [[likely]] {
-            critical = !( rand( ) % 24 );
+            critical = !( _rng.next( ) % 24 );
         }
 
         return critical;
@@ -3135,9 +3301,9 @@ namespace BATTLE {
         }
 
         if( p_move.m_param == M_REVELATION_DANCE ) {
-            auto types = getTypes( p_move.m_user.first, p_move.m_user.second );
-            if( types.size( ) >= 1 ) {
-                moveType = types[ 0 ];
+            u32 types = getTypeMask( p_move.m_user.first, p_move.m_user.second );
+            if( types ) {
+                moveType = type( __builtin_ctz( types ) );
             } else {
                 moveType = TYPE_NORMAL;
             }
@@ -3217,13 +3383,35 @@ namespace BATTLE {
             }
         }
 
-        bool targetIsGrounded
-            = isGrounded( p_target.first, p_target.second, p_move.m_param != M_SUNSTEEL_STRIKE );
         auto user = getPkmn( p_move.m_user.first, p_move.m_user.second );
         if( user == nullptr ) [[unlikely]] { return 0; }
 
-        for( type t : getTypes( p_target.first, p_target.second ) ) {
-            u16 curval = getTypeEffectiveness( moveType, t );
+        u32 types = getTypeMask( p_target.first, p_target.second );
+
+        // Most moves are affected by none of the special cases below and only need a
+        // look-up in the precomputed table.
+        bool special
+            = moveType == TYPE_GROUND || p_move.m_param == M_FLYING_PRESS
+              || p_move.m_param == M_FREEZE_DRY || ( p_move.m_moveData.m_flags & MF_IGNOREIMMUNITY )
+              || ( ( types & ( 1 << TYPE_GHOST ) )
+                   && ( moveType == TYPE_NORMAL || moveType == TYPE_FIGHTING ) )
+              || ( ( types & ( 1 << TYPE_DARKNESS ) ) && moveType == TYPE_PSYCHIC )
+              || ( ( types & ( 1 << TYPE_FLYING ) ) && _weather == WE_HEAVY_WINDS )
+              || ( items && target->getItem( ) == I_RING_TARGET );
+
+        if( !special ) [[likely]] {
+            res = getEffectivenessOnTypes( moveType, types );
+            if( wonderguard && res <= 100 ) { return 0; }
+            return res;
+        }
+
+        bool targetIsGrounded
+            = moveType == TYPE_GROUND
+              && isGrounded( p_target.first, p_target.second, p_move.m_param != M_SUNSTEEL_STRIKE );
+
+        for( ; types; types &= types - 1 ) {
+            type t      = type( __builtin_ctz( types ) );
+            u16  curval = getTypeEffectiveness( moveType, t );
 
             if( !targetIsGrounded && moveType == TYPE_GROUND ) [[unlikely]] {
                 curval = 0;
@@ -3268,565 +3456,627 @@ namespace BATTLE {
         return res;
     }
 
-    bool field::executeDamagingMove( battleUI* p_ui, battleMove p_move, fieldPosition p_target,
-                                     bool p_critical, u8 p_damageModifier ) {
-        constexpr u8 TMP_BUFFER_SIZE = 100;
-        char         buffer[ TMP_BUFFER_SIZE + 10 ];
-
+    u32 field::computeBaseDamage( battleMove p_move, fieldPosition p_target, bool p_critical ) {
         auto user   = getPkmn( p_move.m_user.first, p_move.m_user.second );
         auto target = getPkmn( p_target.first, p_target.second );
-        if( user == nullptr || target == nullptr ) [[unlikely]] { return false; }
-
-        bool supprAbs    = suppressesAbilities( );
-        auto userVolStat = getVolatileStatus( p_move.m_user.first, p_move.m_user.second );
+        if( user == nullptr || target == nullptr ) [[unlikely]] { return 0; }
 
-        u16 effectiveness = getEffectiveness( p_move, p_target );
+        bool supprAbs = suppressesAbilities( );
 
-        if( effectiveness == 0 ) {
-            auto fmt = std::string( GET_STRING( 284 ) );
-            snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                      p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                         p_target.first, false )
-                          .c_str( ) );
-            p_ui->log( buffer );
-            return false;
+        u16 atk = getStat( p_move.m_user.first, p_move.m_user.second,
+                           p_move.m_moveData.m_category == MH_SPECIAL ? SATK : ATK,
+                           !supprAbs && p_move.m_param != M_SUNSTEEL_STRIKE, p_critical );
+        u16 def
+            = getStat( p_target.first, p_target.second,
+                       p_move.m_moveData.m_defensiveCategory == MH_SPECIAL ? SDEF : DEF,
+                       !supprAbs && p_move.m_param != M_SUNSTEEL_STRIKE, false, p_critical );
+        if( p_move.m_moveData.m_flags & MF_DEFASOFF ) {
+            atk = getStat( p_move.m_user.first, p_move.m_user.second,
+                           p_move.m_moveData.m_category == MH_SPECIAL ? SDEF : DEF,
+                           !supprAbs && p_move.m_param != M_SUNSTEEL_STRIKE, p_critical );
         }
 
-        // Calculate damage
-        u32 damage = 0;
-
-        if( p_move.m_moveData.m_fixedDamage ) {
-            damage = p_move.m_moveData.m_fixedDamage;
-        } else {
-            u16 atk = getStat( p_move.m_user.first, p_move.m_user.second,
-                               p_move.m_moveData.m_category == MH_SPECIAL ? SATK : ATK,
-                               !supprAbs && p_move.m_param != M_SUNSTEEL_STRIKE, p_critical );
-            u16 def
-                = getStat( p_target.first, p_target.second,
-                           p_move.m_moveData.m_defensiveCategory == MH_SPECIAL ? SDEF : DEF,
-                           !supprAbs && p_move.m_param != M_SUNSTEEL_STRIKE, false, p_critical );
-            if( p_move.m_moveData.m_flags & MF_DEFASOFF ) {
-                atk = getStat( p_move.m_user.first, p_move.m_user.second,
-                               p_move.m_moveData.m_category == MH_SPECIAL ? SDEF : DEF,
-                               !supprAbs && p_move.m_param != M_SUNSTEEL_STRIKE, p_critical );
-            }
-
-            damage = ( user->m_level * 2 ) / 5 + 2;
+        u32 damage = ( user->m_level * 2 ) / 5 + 2;
 
-            // base power modifying stuff
-            u16 movePower = getMovePower( p_move );
+        // base power modifying stuff
+        u16 movePower = getMovePower( p_move );
 
-            // speed-based
-            if( p_move.m_param == M_GYRO_BALL ) [[unlikely]] {
-                auto atkspd = getStat( p_move.m_user.first, p_move.m_user.second, SPEED );
-                auto defspd = getStat( p_target.first, p_move.m_user.second, SPEED );
+        // speed-based
+        if( p_move.m_param == M_GYRO_BALL ) [[unlikely]] {
+            auto atkspd = getStat( p_move.m_user.first, p_move.m_user.second, SPEED );
+            auto defspd = getStat( p_target.first, p_move.m_user.second, SPEED );
 
-                movePower = atkspd ? 25 * defspd / atkspd : 150;
-                if( movePower > 150 ) { movePower = 150; }
-                if( movePower == 0 ) { movePower = 1; }
-            }
+            movePower = atkspd ? 25 * defspd / atkspd : 150;
+            if( movePower > 150 ) { movePower = 150; }
+            if( movePower == 0 ) { movePower = 1; }
+        }
 
-            if( p_move.m_param == M_ELECTRO_BALL ) [[unlikely]] {
-                auto atkspd = getStat( p_move.m_user.first, p_move.m_user.second, SPEED );
-                auto defspd = getStat( p_target.first, p_move.m_user.second, SPEED );
+        if( p_move.m_param == M_ELECTRO_BALL ) [[unlikely]] {
+            auto atkspd = getStat( p_move.m_user.first, p_move.m_user.second, SPEED );
+            auto defspd = getStat( p_target.first, p_move.m_user.second, SPEED );
 
-                if( !defspd ) {
-                    movePower = 150;
-                } else {
-                    switch( atkspd / defspd ) {
-                    case 0: movePower = 40; break;
-                    case 1: movePower = 60; break;
-                    case 2: movePower = 80; break;
-                    case 3: movePower = 120; break;
-                    default: movePower = 150; break;
-                    }
+            if( !defspd ) {
+                movePower = 150;
+            } else {
+                switch( atkspd / defspd ) {
+                case 0: movePower = 40; break;
+                case 1: movePower = 60; break;
+                case 2: movePower = 80; break;
+                case 3: movePower = 120; break;
+                default: movePower = 150; break;
                 }
             }
+        }
 
-            // weight-based
-            auto tgweight   = getWeight( p_target.first, p_target.second, !supprAbs );
-            auto userweight = getWeight( p_move.m_user.first, p_move.m_user.second, !supprAbs );
-
-            if( p_move.m_param == M_LOW_KICK || p_move.m_param == M_GRASS_KNOT ) {
-                if( tgweight < TMP_BUFFER_SIZE ) {
-                    movePower = 20;
-                } else if( tgweight < 249 ) {
-                    movePower = 40;
-                } else if( tgweight < 499 ) {
-                    movePower = 60;
-                } else if( tgweight < 999 ) {
-                    movePower = 80;
-                } else if( tgweight < 1999 ) {
-                    movePower = 100;
-                } else {
-                    movePower = 120;
-                }
+        // weight-based
+        auto tgweight   = getWeight( p_target.first, p_target.second, !supprAbs );
+        auto userweight = getWeight( p_move.m_user.first, p_move.m_user.second, !supprAbs );
+
+        if( p_move.m_param == M_LOW_KICK || p_move.m_param == M_GRASS_KNOT ) {
+            if( tgweight < 100 ) {
+                movePower = 20;
+            } else if( tgweight < 249 ) {
+                movePower = 40;
+            } else if( tgweight < 499 ) {
+                movePower = 60;
+            } else if( tgweight < 999 ) {
+                movePower = 80;
+            } else if( tgweight < 1999 ) {
+                movePower = 100;
+            } else {
+                movePower = 120;
             }
+        }
 
-            if( p_move.m_param == M_HEAVY_SLAM || p_move.m_param == M_HEAT_CRASH ) {
-                if( tgweight * 2 > userweight ) {
-                    movePower = 40;
-                } else if( tgweight * 3 > userweight ) {
-                    movePower = 60;
-                } else if( tgweight * 4 > userweight ) {
-                    movePower = 80;
-                } else if( tgweight * 5 > userweight ) {
-                    movePower = 100;
-                } else {
-                    movePower = 120;
-                }
-            }
-
-            // HP-based
-            if( p_move.m_param == M_ERUPTION || p_move.m_param == M_WATER_SPOUT
-                || p_move.m_param == M_DRAGON_ENERGY ) {
-                movePower = 150 * user->m_stats.m_curHP / user->m_stats.m_maxHP;
-            }
-            if( p_move.m_param == M_FLAIL || p_move.m_param == M_REVERSAL ) {
-                auto relhp = 48 * user->m_stats.m_curHP / user->m_stats.m_maxHP;
-                if( relhp > 32 ) {
-                    movePower = 20;
-                } else if( relhp > 16 ) {
-                    movePower = 40;
-                } else if( relhp > 9 ) {
-                    movePower = 60;
-                } else if( relhp > 4 ) {
-                    movePower = 100;
-                } else if( relhp > 1 ) {
-                    movePower = 150;
-                } else {
-                    movePower = 200;
-                }
+        if( p_move.m_param == M_HEAVY_SLAM || p_move.m_param == M_HEAT_CRASH ) {
+            if( tgweight * 2 > userweight ) {
+                movePower = 40;
+            } else if( tgweight * 3 > userweight ) {
+                movePower = 60;
+            } else if( tgweight * 4 > userweight ) {
+                movePower = 80;
+            } else if( tgweight * 5 > userweight ) {
+                movePower = 100;
+            } else {
+                movePower = 120;
             }
-            if( p_move.m_param == M_CRUSH_GRIP || p_move.m_param == M_WRING_OUT ) {
-                movePower = 120 * target->m_stats.m_curHP / target->m_stats.m_maxHP;
+        }
+
+        // HP-based
+        if( p_move.m_param == M_ERUPTION || p_move.m_param == M_WATER_SPOUT
+            || p_move.m_param == M_DRAGON_ENERGY ) {
+            movePower = 150 * user->m_stats.m_curHP / user->m_stats.m_maxHP;
+        }
+        if( p_move.m_param == M_FLAIL || p_move.m_param == M_REVERSAL ) {
+            auto relhp = 48 * user->m_stats.m_curHP / user->m_stats.m_maxHP;
+            if( relhp > 32 ) {
+                movePower = 20;
+            } else if( relhp > 16 ) {
+                movePower = 40;
+            } else if( relhp > 9 ) {
+                movePower = 60;
+            } else if( relhp > 4 ) {
+                movePower = 100;
+            } else if( relhp > 1 ) {
+                movePower = 150;
+            } else {
+                movePower = 200;
             }
+        }
+        if( p_move.m_param == M_CRUSH_GRIP || p_move.m_param == M_WRING_OUT ) {
+            movePower = 120 * target->m_stats.m_curHP / target->m_stats.m_maxHP;
+        }
 
-            // happiness-based
+        // happiness-based
 
-            if( p_move.m_param == M_RETURN ) { movePower = 1 + user->m_boxdata.m_steps * 10 / 25; }
-            if( p_move.m_param == M_FRUSTRATION ) {
-                movePower = 1 + ( 255 - user->m_boxdata.m_steps ) * 10 / 25;
-            }
+        if( p_move.m_param == M_RETURN ) { movePower = 1 + user->m_boxdata.m_steps * 10 / 25; }
+        if( p_move.m_param == M_FRUSTRATION ) {
+            movePower = 1 + ( 255 - user->m_boxdata.m_steps ) * 10 / 25;
+        }
 
-            // repetition-based
+        // repetition-based
 
-            if( p_move.m_param == M_FURY_CUTTER ) {
-                u8 cnt = getConsecutiveMoveCount( p_move.m_user.first, p_move.m_user.second );
+        if( p_move.m_param == M_FURY_CUTTER ) {
+            u8 cnt = getConsecutiveMoveCount( p_move.m_user.first, p_move.m_user.second );
 
-                if( cnt == 0
-                    || getLastUsedMove( p_move.m_user.first, p_move.m_user.second ).m_param
-                           != M_FURY_CUTTER ) {
-                    movePower = 40;
-                } else if( cnt == 1 ) {
-                    movePower = 80;
-                } else {
-                    movePower = 160;
-                }
+            if( cnt == 0
+                || getLastUsedMove( p_move.m_user.first, p_move.m_user.second ).m_param
+                       != M_FURY_CUTTER ) {
+                movePower = 40;
+            } else if( cnt == 1 ) {
+                movePower = 80;
+            } else {
+                movePower = 160;
+            }
+        }
+        if( p_move.m_param == M_ROLLOUT || p_move.m_param == M_ICE_BALL ) {
+            u8 cnt = getConsecutiveMoveCount( p_move.m_user.first, p_move.m_user.second );
+
+            if( cnt == 0
+                || getLastUsedMove( p_move.m_user.first, p_move.m_user.second ).m_param
+                       != p_move.m_param ) {
+                movePower = 30;
+            } else if( cnt == 1 ) {
+                movePower = 60;
+            } else if( cnt == 2 ) {
+                movePower = 120;
+            } else if( cnt == 3 ) {
+                movePower = 240;
+            } else {
+                movePower = 480;
             }
-            if( p_move.m_param == M_ROLLOUT || p_move.m_param == M_ICE_BALL ) {
-                u8 cnt = getConsecutiveMoveCount( p_move.m_user.first, p_move.m_user.second );
-
-                if( cnt == 0
-                    || getLastUsedMove( p_move.m_user.first, p_move.m_user.second ).m_param
-                           != p_move.m_param ) {
-                    movePower = 30;
-                } else if( cnt == 1 ) {
-                    movePower = 60;
-                } else if( cnt == 2 ) {
-                    movePower = 120;
-                } else if( cnt == 3 ) {
-                    movePower = 240;
-                } else {
-                    movePower = 480;
-                }
 
-                if( getVolatileStatus( p_move.m_user.first, p_move.m_user.second )
-                    & VS_DEFENSECURL ) {
-                    movePower <<= 1;
-                }
+            if( getVolatileStatus( p_move.m_user.first, p_move.m_user.second )
+                & VS_DEFENSECURL ) {
+                movePower <<= 1;
             }
-            if( p_move.m_param == M_SPIT_UP ) {
-                u8 stkpile = getVolatileStatusCounter( p_move.m_user.first, p_move.m_user.second,
-                                                       VS_STOCKPILE );
-                if( stkpile > 3 ) { stkpile = 3; }
+        }
+        if( p_move.m_param == M_SPIT_UP ) {
+            u8 stkpile = getVolatileStatusCounter( p_move.m_user.first, p_move.m_user.second,
+                                                   VS_STOCKPILE );
+            if( stkpile > 3 ) { stkpile = 3; }
 
-                movePower = 100 * stkpile;
+            movePower = 100 * stkpile;
+        }
 
-                removeVolatileStatus( p_ui, p_move.m_user.first, p_move.m_user.second,
-                                      VS_STOCKPILE );
-                boosts bt = boosts( );
-                bt.setBoost( DEF, -stkpile );
-                bt.setBoost( SDEF, -stkpile );
-                auto res = addBoosts( p_move.m_user.first, p_move.m_user.second, bt );
-                p_ui->logBoosts( getPkmnOrDisguise( p_move.m_user.first, p_move.m_user.second ),
-                                 p_move.m_user.first, p_move.m_user.second, bt, res );
+        // TODO
+        // Stored power, power trip: 20 + 20 * atk stat boost
+        // punishment: 60 + 20 * def stat boost
+
+        // acrobatics
+        // assurance
+        // avalanche / revenge
+        // grass / fire / water pledge
+        // hex
+        // payback
+        // round
+        // smelling salts
+        // stomping tantrum
+        // wake-up slap
+        //
+        // fling, natural gift
+        //
+        // beat up
+        // echoed voice
+        // magnitude
+        // present
+        // triple kick
+        // trump card
+
+        damage *= movePower;
+
+        damage = ( damage * atk ) / def;
+        damage = ( damage / 50 ) + 2;
+
+        if( p_move.m_target.size( ) > 1 ) { damage = ( damage * 75 ) / 100; }
+
+        if( !suppressesWeather( ) ) [[likely]] {
+            if( p_move.m_moveData.m_type == TYPE_WATER
+                && ( _weather == WE_RAIN || _weather == WE_HEAVY_RAIN ) ) [[unlikely]] {
+                damage = ( damage * 3 ) >> 1;
+            }
+            if( p_move.m_moveData.m_type == TYPE_FIRE
+                && ( _weather == WE_RAIN || _weather == WE_HEAVY_RAIN ) ) [[unlikely]] {
+                damage = ( damage >> 1 );
+            }
+            if( p_move.m_moveData.m_type == TYPE_FIRE
+                && ( _weather == WE_SUN || _weather == WE_HEAVY_SUNSHINE ) ) [[unlikely]] {
+                damage = ( damage * 3 ) >> 1;
+            }
+            if( p_move.m_moveData.m_type == TYPE_WATER
+                && ( _weather == WE_SUN || _weather == WE_HEAVY_SUNSHINE ) ) [[unlikely]] {
+                damage = ( damage >> 1 );
             }
+        }
 
-            // TODO
-            // Stored power, power trip: 20 + 20 * atk stat boost
-            // punishment: 60 + 20 * def stat boost
-
-            // acrobatics
-            // assurance
-            // avalanche / revenge
-            // grass / fire / water pledge
-            // hex
-            // payback
-            // round
-            // smelling salts
-            // stomping tantrum
-            // wake-up slap
-            //
-            // fling, natural gift
-            //
-            // beat up
-            // echoed voice
-            // magnitude
-            // present
-            // triple kick
-            // trump card
-
-            damage *= movePower;
-
-            damage = ( damage * atk ) / def;
-            damage = ( damage / 50 ) + 2;
-
-            if( p_move.m_target.size( ) > 1 ) { damage = ( damage * 75 ) / 100; }
-
-            if( !suppressesWeather( ) ) [[likely]] {
-                if( p_move.m_moveData.m_type == TYPE_WATER
-                    && ( _weather == WE_RAIN || _weather == WE_HEAVY_RAIN ) ) [[unlikely]] {
-                    damage = ( damage * 3 ) >> 1;
-                }
-                if( p_move.m_moveData.m_type == TYPE_FIRE
-                    && ( _weather == WE_RAIN || _weather == WE_HEAVY_RAIN ) ) [[unlikely]] {
-                    damage = ( damage >> 1 );
-                }
-                if( p_move.m_moveData.m_type == TYPE_FIRE
-                    && ( _weather == WE_SUN || _weather == WE_HEAVY_SUNSHINE ) ) [[unlikely]] {
-                    damage = ( damage * 3 ) >> 1;
-                }
-                if( p_move.m_moveData.m_type == TYPE_WATER
-                    && ( _weather == WE_SUN || _weather == WE_HEAVY_SUNSHINE ) ) [[unlikely]] {
-                    damage = ( damage >> 1 );
-                }
-            }
+        if( p_critical ) { damage = ( damage * 3 ) >> 1; }
+
+        return damage;
+    }
 
-            if( p_critical ) { damage = ( damage * 3 ) >> 1; }
+    u16 field::computeDamageModifiers( battleMove p_move, fieldPosition p_target, bool p_critical,
+                                       u8 p_damageModifier, u16 p_effectiveness,
+                                       damageModifiers& p_out ) {
+        auto user   = getPkmn( p_move.m_user.first, p_move.m_user.second );
+        auto target = getPkmn( p_target.first, p_target.second );
+        if( user == nullptr || target == nullptr ) [[unlikely]] { return 0; }
 
-            u8 rnd = rand( ) & 15;
-            damage = ( damage * ( 85 + rnd ) / 100 );
+        bool supprAbs = suppressesAbilities( );
 
-            // stab
-            type moveType = getMoveType( p_move );
+        type moveType = getMoveType( p_move );
 
-            if( !supprAbs
-                && ( user->getAbility( ) == A_PROTEAN || user->getAbility( ) == A_LIBERO ) ) {
-                p_ui->logAbility( getPkmnOrDisguise( p_move.m_user.first, p_move.m_user.second ),
-                                  p_move.m_user.first );
-                setType( p_ui, p_move.m_user.first, p_move.m_user.second, moveType );
-                // TODO log
+        // pkmn with protean get the type of the move before using it
+        if( hasType( p_move.m_user.first, p_move.m_user.second, moveType )
+            || ( !supprAbs
+                 && ( user->getAbility( ) == A_PROTEAN || user->getAbility( ) == A_LIBERO ) ) ) {
+            if( !supprAbs && user->getAbility( ) == A_ADAPTABILITY ) {
+                p_out.add( 2, 1 );
+            } else {
+                p_out.add( 3, 2 );
             }
+        }
 
-            if( hasType( p_move.m_user.first, p_move.m_user.second, moveType ) ) {
-                if( !supprAbs && user->getAbility( ) == A_ADAPTABILITY ) {
-                    damage <<= 1;
-                } else {
-                    damage = ( damage * 3 ) >> 1;
-                }
+        // effectiveness
+        p_out.add( p_effectiveness, 100 );
+
+        // burn
+
+        if( user->m_status.m_isBurned && p_move.m_moveData.m_category == MH_PHYSICAL
+            && ( supprAbs || user->getAbility( ) != A_GUTS ) && p_move.m_param != M_FACADE ) {
+            p_out.add( 1, 2 );
+        }
+
+        p_out.add( p_damageModifier, 100 );
+
+        auto sidec = getSideCondition( !p_move.m_user.first );
+
+        if( supprAbs || !anyHasAbility( A_SCREEN_CLEANER ) ) {
+            if( ( sidec & SC_AURORAVEIL )
+                || ( ( sidec & SC_REFLECT )
+                     && p_move.m_moveData.m_defensiveCategory == MH_PHYSICAL )
+                || ( ( sidec & SC_LIGHTSCREEN )
+                     && p_move.m_moveData.m_defensiveCategory == MH_SPECIAL ) ) {
+                // nerf intentional!
+                p_out.add( 66, 100 );
             }
+        }
 
-            // effectiveness
-            damage = ( damage * effectiveness ) / 100;
+        if( p_move.m_param == M_BODY_SLAM || p_move.m_param == M_DRAGON_RUSH
+            || p_move.m_param == M_FLYING_PRESS || p_move.m_param == M_HEAT_CRASH
+            || p_move.m_param == M_HEAVY_SLAM || p_move.m_param == M_PHANTOM_FORCE
+            || p_move.m_param == M_SHADOW_FORCE || p_move.m_param == M_STOMP ) {
+            if( getVolatileStatus( p_target.first, p_target.second ) & VS_MINIMIZE )
+                [[unlikely]] {
+                p_out.add( 2, 1 );
+            }
+        }
 
-            // burn
+        if( p_move.m_param == M_SURF || p_move.m_param == M_WHIRLPOOL ) {
+            if( getVolatileStatus( p_target.first, p_target.second ) & VS_DIVING ) {
+                p_out.add( 2, 1 );
+            }
+        }
 
-            if( user->m_status.m_isBurned && p_move.m_moveData.m_category == MH_PHYSICAL
-                && ( supprAbs || user->getAbility( ) != A_GUTS ) && p_move.m_param != M_FACADE ) {
-                damage >>= 1;
+        if( p_move.m_param == M_EARTHQUAKE || p_move.m_param == M_MAGNITUDE ) {
+            if( getVolatileStatus( p_target.first, p_target.second ) & VS_DIGGING ) {
+                p_out.add( 2, 1 );
             }
+        }
 
-            damage = damage * p_damageModifier / 100;
+        if( p_move.m_param == M_GUST || p_move.m_param == M_TWISTER ) {
+            if( getVolatileStatus( p_target.first, p_target.second ) & VS_INAIR ) {
+                p_out.add( 2, 1 );
+            }
+        }
 
-            auto sidec = getSideCondition( !p_move.m_user.first );
+        // abilities
 
-            if( supprAbs || !anyHasAbility( A_SCREEN_CLEANER ) ) {
-                if( ( sidec & SC_AURORAVEIL )
-                    || ( ( sidec & SC_REFLECT )
-                         && p_move.m_moveData.m_defensiveCategory == MH_PHYSICAL )
-                    || ( ( sidec & SC_LIGHTSCREEN )
-                         && p_move.m_moveData.m_defensiveCategory == MH_SPECIAL ) ) {
-                    // nerf intentional!
-                    damage = ( damage * 66 ) / 100;
+        // TODO
+        // aura break
+        // iron fist, reckless
+        // battery
+        // sheer force, sand force, analytic, tough claws
+        // fairy aura, dark aura
+        // technician
+        // flare boost
+        // toxic boost
+        // strong jaw
+        // mega launcher
+        // heatproof
+        // dry skin
+        //
+        // Muscle band
+        // wise glasses
+        //
+        // plates, gems, incenses
+        // adamant orb, lustrous orb, griseous orb, soul dew
+        // normal gem
+        // solar beam/blade for non-sunny
+        // me first
+        // knock off
+        // helping hand
+        // charge
+        // brine
+        // venoshock
+        // retaliate
+        // fusion bolt/flare
+        // terrains
+        // mud sport / water sport
+
+        // foul play
+        //
+        // water bubble/stakeout
+        // thick fat/water bubble (def)
+        //
+        // chip away/ sacred sword
+        // wonder room
+        //
+        //  . . .
+
+        if( !supprAbs ) {
+            switch( target->getAbility( ) ) {
+            case A_FLUFFY:
+                if( p_move.m_moveData.m_flags & MF_CONTACT ) {
+                    if( moveType == TYPE_FIRE ) {
+                        p_out.add( 2, 1 );
+                    } else {
+                        p_out.add( 1, 2 );
+                    }
                 }
+                break;
+            case A_FILTER:
+            case A_PRISM_ARMOR:
+            case A_SOLID_ROCK:
+                if( p_effectiveness > 100 ) { p_out.add( 75, 100 ); }
+                break;
+            case A_SHADOW_SHIELD:
+            case A_MULTISCALE:
+                if( target->m_stats.m_curHP == target->m_stats.m_maxHP ) { p_out.add( 1, 2 ); }
+                break;
+            case A_ICE_SCALES:
+                if( p_move.m_moveData.m_defensiveCategory == MH_SPECIAL ) { p_out.add( 1, 2 ); }
+                break;
+            case A_PUNK_ROCK:
+                if( p_move.m_moveData.m_flags & MF_SOUND ) { p_out.add( 1, 2 ); }
+                break;
+            [[likely]] default:
+                break;
             }
 
-            if( p_move.m_param == M_BODY_SLAM || p_move.m_param == M_DRAGON_RUSH
-                || p_move.m_param == M_FLYING_PRESS || p_move.m_param == M_HEAT_CRASH
-                || p_move.m_param == M_HEAVY_SLAM || p_move.m_param == M_PHANTOM_FORCE
-                || p_move.m_param == M_SHADOW_FORCE || p_move.m_param == M_STOMP ) {
-                if( getVolatileStatus( p_target.first, p_target.second ) & VS_MINIMIZE )
-                    [[unlikely]] {
-                    damage <<= 1;
-                }
+            if( getPkmn( p_target.first, !p_target.second ) != nullptr
+                && getPkmn( p_target.first, !p_target.second )->getAbility( )
+                       == A_FRIEND_GUARD ) [[unlikely]] {
+                p_out.add( 75, 100 );
             }
 
-            if( p_move.m_param == M_SURF || p_move.m_param == M_WHIRLPOOL ) {
-                if( getVolatileStatus( p_target.first, p_target.second ) & VS_DIVING ) {
-                    damage <<= 1;
+            switch( user->getAbility( ) ) {
+            case A_TORRENT:
+                if( moveType == TYPE_WATER
+                    && user->m_stats.m_curHP * 3 < user->m_stats.m_maxHP ) {
+                    p_out.add( 3, 2 );
                 }
-            }
+                break;
+            case A_OVERGROW:
+                if( moveType == TYPE_GRASS
+                    && user->m_stats.m_curHP * 3 < user->m_stats.m_maxHP ) {
+                    p_out.add( 3, 2 );
+                }
+                break;
+            case A_BLAZE:
+                if( moveType == TYPE_FIRE
+                    && user->m_stats.m_curHP * 3 < user->m_stats.m_maxHP ) {
+                    p_out.add( 3, 2 );
+                }
+                break;
+            case A_SWARM:
+                if( moveType == TYPE_BUG
+                    && user->m_stats.m_curHP * 3 < user->m_stats.m_maxHP ) {
+                    p_out.add( 3, 2 );
+                }
+                break;
+            case A_STEELWORKER:
+                if( moveType == TYPE_STEEL ) { p_out.add( 3, 2 ); }
+                break;
 
-            if( p_move.m_param == M_EARTHQUAKE || p_move.m_param == M_MAGNITUDE ) {
-                if( getVolatileStatus( p_target.first, p_target.second ) & VS_DIGGING ) {
-                    damage <<= 1;
+            case A_RIVALRY:
+                if( user->gender( ) * target->gender( ) < 0 ) {
+                    p_out.add( 75, 100 );
+                } else if( user->gender( ) * target->gender( ) > 0 ) {
+                    p_out.add( 125, 100 );
                 }
+                break;
+            case A_NEUROFORCE:
+                if( p_effectiveness > 100 ) { p_out.add( 125, 100 ); }
+                break;
+            case A_TINTED_LENS:
+                if( p_effectiveness < 100 ) { p_out.add( 2, 1 ); }
+                break;
+            case A_SNIPER:
+                if( p_critical ) { p_out.add( 3, 2 ); }
+                break;
+
+            [[likely]] default:
+                break;
+            }
+        }
+
+        if( canUseItem( p_move.m_user.first, p_move.m_user.second, !supprAbs ) ) {
+            switch( user->getItem( ) ) {
+            case I_EXPERT_BELT:
+                if( p_effectiveness > 100 ) { p_out.add( 120, 100 ); }
+                break;
+            case I_LIFE_ORB:
+                if( p_effectiveness > 100 ) { p_out.add( 130, 100 ); }
+                break;
+            case I_METRONOME: {
+                u8 cnt = getConsecutiveMoveCount( p_move.m_user.first, p_move.m_user.second );
+                p_out.add( 100 + 20 * std::min( u8( 5 ), cnt ), 100 );
+                break;
+            }
+            default: break;
             }
+        }
 
-            if( p_move.m_param == M_GUST || p_move.m_param == M_TWISTER ) {
-                if( getVolatileStatus( p_target.first, p_target.second ) & VS_INAIR ) {
-                    damage <<= 1;
+        if( canUseItem( p_target.first, p_target.second, !supprAbs )
+            && ( !supprAbs
+                 || !_sides[ p_target.first ? PLAYER_SIDE : OPPONENT_SIDE ].anyHasAbility(
+                     A_UNNERVE ) ) ) {
+            bool eatitem = false;
+            switch( target->getItem( ) ) {
+            case I_CHILAN_BERRY:
+                if( moveType == TYPE_NORMAL ) { eatitem = true; }
+                break;
+            case I_BABIRI_BERRY:
+                if( moveType == TYPE_STEEL && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_CHARTI_BERRY:
+                if( moveType == TYPE_ROCK && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_CHOPLE_BERRY:
+                if( moveType == TYPE_FIGHTING && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_COBA_BERRY:
+                if( moveType == TYPE_FLYING && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_COLBUR_BERRY:
+                if( moveType == TYPE_DARKNESS && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_HABAN_BERRY:
+                if( moveType == TYPE_DRAGON && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_KASIB_BERRY:
+                if( moveType == TYPE_GHOST && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_KEBIA_BERRY:
+                if( moveType == TYPE_POISON && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_OCCA_BERRY:
+                if( moveType == TYPE_FIRE && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_PASSHO_BERRY:
+                if( moveType == TYPE_WATER && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_PAYAPA_BERRY:
+                if( moveType == TYPE_PSYCHIC && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_RINDO_BERRY:
+                if( moveType == TYPE_GRASS && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_ROSELI_BERRY:
+                if( moveType == TYPE_FAIRY && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_SHUCA_BERRY:
+                if( moveType == TYPE_GROUND && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_TANGA_BERRY:
+                if( moveType == TYPE_BUG && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_WACAN_BERRY:
+                if( moveType == TYPE_LIGHTNING && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            case I_YACHE_BERRY:
+                if( moveType == TYPE_ICE && p_effectiveness > 100 ) { eatitem = true; }
+                break;
+            default: break;
+            }
+            if( eatitem ) {
+                if( target->getAbility( ) != A_RIPEN || supprAbs ) {
+                    p_out.add( 1, 2 );
+                } else {
+                    p_out.add( 1, 4 );
                 }
+                return target->getItem( );
             }
+        }
 
-            // abilities
+        return 0;
+    }
 
-            // TODO
-            // aura break
-            // iron fist, reckless
-            // battery
-            // sheer force, sand force, analytic, tough claws
-            // fairy aura, dark aura
-            // technician
-            // flare boost
-            // toxic boost
-            // strong jaw
-            // mega launcher
-            // heatproof
-            // dry skin
-            //
-            // Muscle band
-            // wise glasses
-            //
-            // plates, gems, incenses
-            // adamant orb, lustrous orb, griseous orb, soul dew
-            // normal gem
-            // solar beam/blade for non-sunny
-            // me first
-            // knock off
-            // helping hand
-            // charge
-            // brine
-            // venoshock
-            // retaliate
-            // fusion bolt/flare
-            // terrains
-            // mud sport / water sport
-
-            // foul play
-            //
-            // water bubble/stakeout
-            // thick fat/water bubble (def)
-            //
-            // chip away/ sacred sword
-            // wonder room
-            //
-            //  . . .
-
-            if( !supprAbs ) {
-                switch( target->getAbility( ) ) {
-                case A_FLUFFY:
-                    if( p_move.m_moveData.m_flags & MF_CONTACT ) {
-                        if( moveType == TYPE_FIRE ) {
-                            damage <<= 1;
-                        } else {
-                            damage >>= 1;
-                        }
-                    }
-                    break;
-                case A_FILTER:
-                case A_PRISM_ARMOR:
-                case A_SOLID_ROCK:
-                    if( effectiveness > 100 ) { damage = ( damage * 75 ) / 100; }
-                    break;
-                case A_SHADOW_SHIELD:
-                case A_MULTISCALE:
-                    if( target->m_stats.m_curHP == target->m_stats.m_maxHP ) { damage >>= 1; }
-                    break;
-                case A_ICE_SCALES:
-                    if( p_move.m_moveData.m_defensiveCategory == MH_SPECIAL ) { damage >>= 1; }
-                    break;
-                case A_PUNK_ROCK:
-                    if( p_move.m_moveData.m_flags & MF_SOUND ) { damage >>= 1; }
-                    break;
-                [[likely]] default:
-                    break;
-                }
+    u16 field::computeDamageRolls( battleMove p_move, fieldPosition p_target,
+                                   u16 p_out[ NUM_DAMAGE_ROLLS ], bool p_critical ) {
+        u16 effectiveness = getEffectiveness( p_move, p_target );
+        if( !effectiveness ) {
+            std::memset( p_out, 0, NUM_DAMAGE_ROLLS * sizeof( u16 ) );
+            return 0;
+        }
 
-                if( getPkmn( p_target.first, !p_target.second ) != nullptr
-                    && getPkmn( p_target.first, !p_target.second )->getAbility( )
-                           == A_FRIEND_GUARD ) [[unlikely]] {
-                    damage = ( damage * 75 ) / 100;
-                }
+        if( p_move.m_moveData.m_fixedDamage ) {
+            for( u8 i = 0; i < NUM_DAMAGE_ROLLS; ++i ) {
+                p_out[ i ] = p_move.m_moveData.m_fixedDamage;
+            }
+            return effectiveness;
+        }
 
-                switch( user->getAbility( ) ) {
-                case A_TORRENT:
-                    if( moveType == TYPE_WATER
-                        && user->m_stats.m_curHP * 3 < user->m_stats.m_maxHP ) {
-                        damage = ( 3 * damage ) >> 1;
-                    }
-                    break;
-                case A_OVERGROW:
-                    if( moveType == TYPE_GRASS
-                        && user->m_stats.m_curHP * 3 < user->m_stats.m_maxHP ) {
-                        damage = ( 3 * damage ) >> 1;
-                    }
-                    break;
-                case A_BLAZE:
-                    if( moveType == TYPE_FIRE
-                        && user->m_stats.m_curHP * 3 < user->m_stats.m_maxHP ) {
-                        damage = ( 3 * damage ) >> 1;
-                    }
-                    break;
-                case A_SWARM:
-                    if( moveType == TYPE_BUG
-                        && user->m_stats.m_curHP * 3 < user->m_stats.m_maxHP ) {
-                        damage = ( 3 * damage ) >> 1;
-                    }
-                    break;
-                case A_STEELWORKER:
-                    if( moveType == TYPE_STEEL ) { damage = ( 3 * damage ) >> 1; }
-                    break;
+        u32             base = computeBaseDamage( p_move, p_target, p_critical );
+        damageModifiers mods;
+        computeDamageModifiers( p_move, p_target, p_critical, 100, effectiveness, mods );
+        for( u8 i = 0; i < NUM_DAMAGE_ROLLS; ++i ) {
+            p_out[ i ] = computeRolledDamage( base, i, mods );
+        }
+        return effectiveness;
+    }
 
-                case A_RIVALRY:
-                    if( user->gender( ) * target->gender( ) < 0 ) {
-                        damage = ( damage * 75 ) / 100;
-                    } else if( user->gender( ) * target->gender( ) > 0 ) {
-                        damage = ( damage * 125 ) / 100;
-                    }
-                    break;
-                case A_NEUROFORCE:
-                    if( effectiveness > 100 ) { damage = ( damage * 125 ) / 100; }
-                    break;
-                case A_TINTED_LENS:
-                    if( effectiveness < 100 ) { damage <<= 1; }
-                    break;
-                case A_SNIPER:
-                    if( p_critical ) { damage = ( 3 * damage ) >> 1; }
-                    break;
+    bool field::executeDamagingMove( battleUI* p_ui, battleMove p_move, fieldPosition p_target,
+                                     bool p_critical, u8 p_damageModifier ) {
+        constexpr u8 TMP_BUFFER_SIZE = 100;
+        char         buffer[ TMP_BUFFER_SIZE + 10 ];
 
-                [[likely]] default:
-                    break;
-                }
+        auto user   = getPkmn( p_move.m_user.first, p_move.m_user.second );
+        auto target = getPkmn( p_target.first, p_target.second );
+        if( user == nullptr || target == nullptr ) [[unlikely]] { return false; }
+
+        bool supprAbs    = suppressesAbilities( );
+        auto userVolStat = getVolatileStatus( p_move.m_user.first, p_move.m_user.second );
+
+        u16 effectiveness = getEffectiveness( p_move, p_target );
+
+        if( effectiveness == 0 ) {
+            if( !p_ui->isHeadless( ) ) {
+                auto fmt = GET_STRING( 284 );
+                snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                          p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
+                                             p_target.first, false )
+                              .c_str( ) );
+                p_ui->log( buffer );
             }
+            return false;
+        }
 
-            if( canUseItem( p_move.m_user.first, p_move.m_user.second, !supprAbs ) ) {
-                switch( user->getItem( ) ) {
-                case I_EXPERT_BELT:
-                    if( effectiveness > 100 ) { damage = ( damage * 120 ) / 100; }
-                    break;
-                case I_LIFE_ORB:
-                    if( effectiveness > 100 ) { damage = ( damage * 130 ) / 100; }
-                    break;
-                case I_METRONOME: {
-                    auto cons = 100
-                                + 20
-                                      * std::min( u8( 5 ),
-                                                  getConsecutiveMoveCount( p_move.m_user.first,
-                                                                           p_move.m_user.second ) );
-                    damage = ( damage * cons / 100 );
-                    break;
-                }
-                default: break;
-                }
+        // Calculate damage
+        u32 damage = 0;
+
+        if( p_move.m_moveData.m_fixedDamage ) {
+            damage = p_move.m_moveData.m_fixedDamage;
+        } else {
+            damage = computeBaseDamage( p_move, p_target, p_critical );
+
+            if( p_move.m_param == M_SPIT_UP ) {
+                u8 stkpile = getVolatileStatusCounter( p_move.m_user.first, p_move.m_user.second,
+                                                       VS_STOCKPILE );
+                if( stkpile > 3 ) { stkpile = 3; }
+
+                removeVolatileStatus( p_ui, p_move.m_user.first, p_move.m_user.second,
+                                      VS_STOCKPILE );
+                boosts bt = boosts( );
+                bt.setBoost( DEF, -stkpile );
+                bt.setBoost( SDEF, -stkpile );
+                auto res = addBoosts( p_move.m_user.first, p_move.m_user.second, bt );
+                p_ui->logBoosts( getPkmnOrDisguise( p_move.m_user.first, p_move.m_user.second ),
+                                 p_move.m_user.first, p_move.m_user.second, bt, res );
             }
 
-            if( canUseItem( p_target.first, p_target.second, !supprAbs )
-                && ( !supprAbs
-                     || !_sides[ p_target.first ? PLAYER_SIDE : OPPONENT_SIDE ].anyHasAbility(
-                         A_UNNERVE ) ) ) {
-                bool eatitem = false;
-                switch( target->getItem( ) ) {
-                case I_CHILAN_BERRY:
-                    if( moveType == TYPE_NORMAL ) { eatitem = true; }
-                    break;
-                case I_BABIRI_BERRY:
-                    if( moveType == TYPE_STEEL && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_CHARTI_BERRY:
-                    if( moveType == TYPE_ROCK && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_CHOPLE_BERRY:
-                    if( moveType == TYPE_FIGHTING && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_COBA_BERRY:
-                    if( moveType == TYPE_FLYING && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_COLBUR_BERRY:
-                    if( moveType == TYPE_DARKNESS && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_HABAN_BERRY:
-                    if( moveType == TYPE_DRAGON && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_KASIB_BERRY:
-                    if( moveType == TYPE_GHOST && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_KEBIA_BERRY:
-                    if( moveType == TYPE_POISON && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_OCCA_BERRY:
-                    if( moveType == TYPE_FIRE && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_PASSHO_BERRY:
-                    if( moveType == TYPE_WATER && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_PAYAPA_BERRY:
-                    if( moveType == TYPE_PSYCHIC && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_RINDO_BERRY:
-                    if( moveType == TYPE_GRASS && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_ROSELI_BERRY:
-                    if( moveType == TYPE_FAIRY && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_SHUCA_BERRY:
-                    if( moveType == TYPE_GROUND && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_TANGA_BERRY:
-                    if( moveType == TYPE_BUG && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_WACAN_BERRY:
-                    if( moveType == TYPE_LIGHTNING && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                case I_YACHE_BERRY:
-                    if( moveType == TYPE_ICE && effectiveness > 100 ) { eatitem = true; }
-                    break;
-                default: break;
-                }
-                if( eatitem ) {
-                    p_ui->logItem( target, p_target.first );
-                    if( target->getAbility( ) != A_RIPEN || supprAbs ) {
-                        damage >>= 1;
-                    } else {
-                        damage >>= 2;
-                    }
-                    auto fmt = std::string( GET_STRING( 279 ) );
-                    snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
+            u8 rnd = _rng.next( ) & 15;
+
+            if( !supprAbs
+                && ( user->getAbility( ) == A_PROTEAN || user->getAbility( ) == A_LIBERO ) ) {
+                p_ui->logAbility( getPkmnOrDisguise( p_move.m_user.first, p_move.m_user.second ),
+                                  p_move.m_user.first );
+                setType( p_ui, p_move.m_user.first, p_move.m_user.second, getMoveType( p_move ) );
+                // TODO log
+            }
+
+            damageModifiers mods;
+            u16             berry = computeDamageModifiers( p_move, p_target, p_critical,
+                                                            p_damageModifier, effectiveness, mods );
+
+            damage = computeRolledDamage( damage, rnd, mods );
+
+            if( berry ) {
+                p_ui->logItem( target, p_target.first );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( 279 );
+                    snprintf( buffer, TMP_BUFFER_SIZE, fmt,
                               p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_user.first,
                                                                     p_move.m_user.second ),
                                                  p_move.m_user.first )
                                   .c_str( ),
                               FS::getItemName( target->getItem( ) ).c_str( ) );
                     p_ui->log( buffer );
-
-                    removeItem( p_ui, p_target.first, p_target.second );
-                    checkOnEatBerry( p_ui, p_target.first, p_target.second, target->getItem( ) );
                 }
-            }
 
-            if( !damage ) { damage = 1; }
-            if( damage > 9000 ) { damage = 9000; }
+                removeItem( p_ui, p_target.first, p_target.second );
+                checkOnEatBerry( p_ui, p_target.first, p_target.second, target->getItem( ) );
+            }
         }
 
         p_ui->animateHitPkmn( p_target.first, p_target.second, effectiveness );
@@ -3851,7 +4101,7 @@ namespace BATTLE {
                     removeItem( p_ui, p_target.first, p_target.second );
                 }
                 if( canUseItem( p_target.first, p_target.second, !supprAbs )
-                    && target->getItem( ) == I_FOCUS_BAND && rand( ) % 100 < 10 ) {
+                    && target->getItem( ) == I_FOCUS_BAND && _rng.next( ) % 100 < 10 ) {
                     damage = target->m_stats.m_curHP - 1;
                     p_ui->logItem( getPkmnOrDisguise( p_target.first, p_target.second ),
                                    p_target.first );
@@ -3876,19 +4126,25 @@ namespace BATTLE {
             damagePokemon( p_ui, p_target.first, p_target.second, damage );
 
             if( effectiveness > 100 ) {
-                auto fmt = std::string( GET_STRING( 285 ) );
-                snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                          p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                             p_target.first, false )
-                              .c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( 285 );
+                    snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                              p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                    p_target.second ),
+                                                 p_target.first, false )
+                                  .c_str( ) );
+                    p_ui->log( buffer );
+                }
             } else if( effectiveness < 100 ) {
-                auto fmt = std::string( GET_STRING( 286 ) );
-                snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                          p_ui->getPkmnName( getPkmnOrDisguise( p_target.first, p_target.second ),
-                                             p_target.first, false )
-                              .c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( 286 );
+                    snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                              p_ui->getPkmnName( getPkmnOrDisguise( p_target.first,
+                                                                    p_target.second ),
+                                                 p_target.first, false )
+                                  .c_str( ) );
+                    p_ui->log( buffer );
+                }
             }
 
             if( p_critical ) { p_ui->log( GET_STRING( 291 ) ); }
@@ -3911,13 +4167,15 @@ namespace BATTLE {
                     if( user->m_stats.m_curHP < user->m_stats.m_maxHP ) {
                         healPokemon( p_ui, p_move.m_user.first, p_move.m_user.second, amount );
 
-                        auto fmt = std::string( GET_STRING( 288 ) );
-                        snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                                  p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_user.first,
-                                                                        p_move.m_user.second ),
-                                                     p_move.m_user.first )
-                                      .c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            auto fmt = GET_STRING( 288 );
+                            snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                                      p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_user.first,
+                                                                            p_move.m_user.second ),
+                                                         p_move.m_user.first )
+                                          .c_str( ) );
+                            p_ui->log( buffer );
+                        }
                     }
                 }
             }
@@ -3928,13 +4186,16 @@ namespace BATTLE {
 
                 damagePokemon( p_ui, p_move.m_user.first, p_move.m_user.second, amount );
 
-                auto fmt = std::string( GET_STRING( 287 ) );
-                snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                          p_ui->getPkmnName(
-                                  getPkmnOrDisguise( p_move.m_user.first, p_move.m_user.second ),
-                                  p_move.m_user.first )
-                              .c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( 287 );
+                    snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                              p_ui->getPkmnName(
+                                      getPkmnOrDisguise( p_move.m_user.first,
+                                                         p_move.m_user.second ),
+                                      p_move.m_user.first )
+                                  .c_str( ) );
+                    p_ui->log( buffer );
+                }
             }
 
             // Shell bell
@@ -3946,13 +4207,15 @@ namespace BATTLE {
 
                     healPokemon( p_ui, p_move.m_user.first, p_move.m_user.second, amount );
 
-                    auto fmt = std::string( GET_STRING( 533 ) );
-                    snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                              p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_user.first,
-                                                                    p_move.m_user.second ),
-                                                 p_move.m_user.first )
-                                  .c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        auto fmt = GET_STRING( 533 );
+                        snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                                  p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_user.first,
+                                                                        p_move.m_user.second ),
+                                                     p_move.m_user.first )
+                                      .c_str( ) );
+                        p_ui->log( buffer );
+                    }
                 }
             }
 
@@ -3963,13 +4226,16 @@ namespace BATTLE {
                 damagePokemon( p_ui, p_move.m_user.first, p_move.m_user.second,
                                user->m_stats.m_maxHP / 16 );
 
-                auto fmt = std::string( GET_STRING( 306 ) );
-                snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                          p_ui->getPkmnName(
-                                  getPkmnOrDisguise( p_move.m_user.first, p_move.m_user.second ),
-                                  p_move.m_user.first )
-                              .c_str( ) );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    auto fmt = GET_STRING( 306 );
+                    snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                              p_ui->getPkmnName(
+                                      getPkmnOrDisguise( p_move.m_user.first,
+                                                         p_move.m_user.second ),
+                                      p_move.m_user.first )
+                                  .c_str( ) );
+                    p_ui->log( buffer );
+                }
             }
 
             // check for things that trigger when causing damage
@@ -3989,13 +4255,7 @@ namespace BATTLE {
         return true;
     }
 
-    void field::executeBattleMove( battleUI* p_ui, battleMove p_move,
-                                   const std::vector<battleMove>& p_targetsMoves,
-                                   const std::vector<battleMove>& p_tergetedMoves ) {
-
-        (void) p_targetsMoves;
-        (void) p_tergetedMoves;
-
+    void field::executeBattleMove( battleUI* p_ui, battleMove p_move ) {
         constexpr u8 TMP_BUFFER_SIZE = 100;
         char         buffer[ TMP_BUFFER_SIZE + 10 ];
         bool         opponent = p_move.m_user.first;
@@ -4022,7 +4282,7 @@ namespace BATTLE {
             }
 
             setLastUsedMove( opponent, slot, battleMove( ) );
-            WAIT( HALF_SEC );
+            p_ui->wait( HALF_SEC );
             return;
         }
 
@@ -4038,7 +4298,7 @@ namespace BATTLE {
                 if( tg == nullptr ) [[unlikely]] { return; }
 
                 p_ui->prepareMove( getPkmnOrDisguise( opponent, slot ), opponent, slot, p_move );
-                WAIT( HALF_SEC );
+                p_ui->wait( HALF_SEC );
 
                 if( ( p_move.m_param == M_SOLAR_BLADE || p_move.m_param == M_SOLAR_BEAM )
                     && !suppressesWeather( )
@@ -4047,11 +4307,13 @@ namespace BATTLE {
                 } else if( canUseItem( opponent, slot ) && tg->getItem( ) == I_POWER_HERB )
                     [[unlikely]] {
                     p_ui->logItem( getPkmnOrDisguise( opponent, slot ), opponent );
-                    auto fmt = std::string( GET_STRING( 305 ) );
-                    snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                              p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
-                                  .c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        auto fmt = GET_STRING( 305 );
+                        snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                                  p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                                      .c_str( ) );
+                        p_ui->log( buffer );
+                    }
 
                     removeItem( p_ui, opponent, slot );
                 } else {
@@ -4086,21 +4348,27 @@ namespace BATTLE {
                     bms.m_user = p_move.m_user;
 
                     addLockedMove( opponent, slot, bms );
-                    WAIT( HALF_SEC );
+                    p_ui->wait( HALF_SEC );
                     return;
                 }
             }
         }
 
         if( !getLockedMoveCount( opponent, slot ) ) { deducePP( opponent, slot, p_move.m_param ); }
-        auto fmt = std::string( GET_STRING( 10 ) );
-        snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                  p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ),
-                  FS::getMoveName( p_move.m_param ).c_str( ) );
-        p_ui->log( buffer );
+        auto fmt = p_ui->isHeadless( ) ? "" : GET_STRING( 10 );
+        if( !p_ui->isHeadless( ) ) {
+            snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                      p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent ).c_str( ),
+                      FS::getMoveName( p_move.m_param ).c_str( ) );
+            p_ui->log( buffer );
+        }
 
         bool moveHadTarget = _mode == BM_SINGLE;
         for( u8 i = 0; i < p_move.m_target.size( ); ++i ) {
+            // The user may have fainted while hitting an earlier target (e.g. from life
+            // orb recoil)
+            if( getPkmn( opponent, slot ) == nullptr ) [[unlikely]] { break; }
+
             // Check if the move needs to be redirected
 
             auto curTg = getPkmn( p_move.m_target[ i ].first, p_move.m_target[ i ].second );
@@ -4126,9 +4394,10 @@ namespace BATTLE {
             u8 numHits = 1, strengthMod = 100;
             if( p_move.m_moveData.getMultiHitMax( ) > 1 ) [[unlikely]] {
                 numHits = p_move.m_moveData.getMultiHitMin( );
-                numHits += rand( )
-                           % ( p_move.m_moveData.getMultiHitMax( )
-                               - p_move.m_moveData.getMultiHitMin( ) );
+                u8  spread = p_move.m_moveData.getMultiHitMax( ) - numHits;
+                u32 roll   = _rng.next( );
+                // moves that always hit the same number of times (e.g. double hit)
+                if( spread ) { numHits += roll % spread; }
 
                 if( !suppressesAbilities( )
                     && getPkmn( opponent, slot )->getAbility( ) == A_SKILL_LINK ) [[unlikely]] {
@@ -4154,14 +4423,16 @@ namespace BATTLE {
                     [[unlikely]] {
                     protect = true;
                     if( ( p_move.m_moveData.m_flags & MF_PROTECT ) ) {
-                        fmt = std::string( GET_STRING( 674 ) );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_target[ i ].first,
-                                                                  p_move.m_target[ i ].second ),
-                                               p_move.m_target[ i ].first )
-                                .c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            fmt = GET_STRING( 674 );
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_target[ i ].first,
+                                                                      p_move.m_target[ i ].second ),
+                                                   p_move.m_target[ i ].first )
+                                    .c_str( ) );
+                            p_ui->log( buffer );
+                        }
                     }
                 }
 
@@ -4171,13 +4442,16 @@ namespace BATTLE {
                                           p_move.m_target[ i ].second, VS_PROTECT );
                     tgsc = getVolatileStatus( p_move.m_target[ i ].first,
                                               p_move.m_target[ i ].second );
-                    fmt  = std::string( GET_STRING( 675 ) );
-                    snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                              p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_target[ i ].first,
-                                                                    p_move.m_target[ i ].second ),
-                                                 p_move.m_target[ i ].first )
-                                  .c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        fmt = GET_STRING( 675 );
+                        snprintf(
+                            buffer, TMP_BUFFER_SIZE, fmt,
+                            p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_target[ i ].first,
+                                                                  p_move.m_target[ i ].second ),
+                                               p_move.m_target[ i ].first )
+                                .c_str( ) );
+                        p_ui->log( buffer );
+                    }
                     protect = false;
                 }
 
@@ -4186,25 +4460,30 @@ namespace BATTLE {
 
                     // Check if the move misses
                     if( moveMisses( p_ui, p_move, p_move.m_target[ i ], critical ) ) {
-                        fmt = std::string( GET_STRING( 280 ) );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_target[ i ].first,
-                                                                  p_move.m_target[ i ].second ),
-                                               p_move.m_target[ i ].first )
-                                .c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            fmt = GET_STRING( 280 );
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_target[ i ].first,
+                                                                      p_move.m_target[ i ].second ),
+                                                   p_move.m_target[ i ].first )
+                                    .c_str( ) );
+                            p_ui->log( buffer );
+                        }
                         // check for crash damage
 
                         if( p_move.m_moveData.m_flags & MF_CRASHDAMAGE ) {
                             u16 maxHP = getPkmn( opponent, slot )->m_stats.m_maxHP;
                             damagePokemon( p_ui, opponent, slot, maxHP / 2 );
-                            fmt = std::string( GET_STRING( 546 ) );
-                            snprintf(
-                                buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                                p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
-                                    .c_str( ) );
-                            p_ui->log( buffer );
+                            if( !p_ui->isHeadless( ) ) {
+                                fmt = GET_STRING( 546 );
+                                snprintf(
+                                    buffer, TMP_BUFFER_SIZE, fmt,
+                                    p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ),
+                                                       opponent )
+                                        .c_str( ) );
+                                p_ui->log( buffer );
+                            }
 
                             if( !getPkmn( opponent, slot )->canBattle( ) ) {
                                 faintPokemon( p_ui, opponent, slot );
@@ -4215,7 +4494,7 @@ namespace BATTLE {
                     } else if( p_move.m_moveData.m_flags & MF_OHKO ) [[unlikely]] {
                         faintPokemon( p_ui, p_move.m_target[ i ].first,
                                       p_move.m_target[ i ].second );
-                        p_ui->log( GET_STRING( 547 ) );
+                        if( !p_ui->isHeadless( ) ) { p_ui->log( GET_STRING( 547 ) ); }
                     } else if( p_move.m_moveData.m_category != MH_STATUS
                                && !executeDamagingMove(
                                    p_ui, p_move, p_move.m_target[ i ], critical,
@@ -4241,11 +4520,11 @@ namespace BATTLE {
 
                     // Check for secondary status effects
                     if( p_move.m_moveData.m_secondaryStatus
-                        && ( rand( ) % 100 < p_move.m_moveData.m_secondaryChance ) ) {
+                        && ( _rng.next( ) % 100 < p_move.m_moveData.m_secondaryChance ) ) {
                         executeSecondaryStatus( p_ui, p_move, p_move.m_target[ i ] );
                     }
                     // Other secondary effects
-                    if( rand( ) % 100 < p_move.m_moveData.m_secondaryChance ) {
+                    if( _rng.next( ) % 100 < p_move.m_moveData.m_secondaryChance ) {
                         executeSecondaryEffects( p_ui, p_move, p_move.m_target[ i ] );
                     }
                 }
@@ -4287,21 +4566,23 @@ namespace BATTLE {
                 if( p_move.m_moveData.m_flags & MF_DEFROSTTARGET ) {
                     if( hasStatusCondition( p_move.m_target[ i ].first, p_move.m_target[ i ].second,
                                             FROZEN ) ) {
-                        fmt = std::string( GET_STRING( 298 ) );
-                        snprintf(
-                            buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                            p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_target[ i ].first,
-                                                                  p_move.m_target[ i ].second ),
-                                               p_move.m_target[ i ].first )
-                                .c_str( ) );
-                        p_ui->log( buffer );
+                        if( !p_ui->isHeadless( ) ) {
+                            fmt = GET_STRING( 298 );
+                            snprintf(
+                                buffer, TMP_BUFFER_SIZE, fmt,
+                                p_ui->getPkmnName( getPkmnOrDisguise( p_move.m_target[ i ].first,
+                                                                      p_move.m_target[ i ].second ),
+                                                   p_move.m_target[ i ].first )
+                                    .c_str( ) );
+                            p_ui->log( buffer );
+                        }
                         removeStatusCondition( p_move.m_target[ i ].first,
                                                p_move.m_target[ i ].second );
                         p_ui->updatePkmnStats( p_move.m_target[ i ].first,
                                                p_move.m_target[ i ].second,
                                                getPkmnOrDisguise( p_move.m_target[ i ].first,
                                                                   p_move.m_target[ i ].second ) );
-                        WAIT( HALF_SEC );
+                        p_ui->wait( HALF_SEC );
                     }
                 }
 
@@ -4312,16 +4593,20 @@ namespace BATTLE {
             }
 
             if( multihit && hits >= 1 ) {
-                snprintf( buffer, TMP_BUFFER_SIZE, GET_STRING( 400 ), hits );
-                p_ui->log( buffer );
+                if( !p_ui->isHeadless( ) ) {
+                    snprintf( buffer, TMP_BUFFER_SIZE, GET_STRING( 400 ), hits );
+                    p_ui->log( buffer );
+                }
             }
 
             if( getSlotStatus( opponent, slot ) == slot::status::FAINTED ) { continue; }
         }
 
         if( !moveHadTarget ) {
-            p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) ); // "It failed."
-            return;
+            if( !p_ui->isHeadless( ) ) {
+                p_ui->log( GET_STRING( IO::STR_UI_BATTLE_IT_FAILED ) ); // "It failed."
+                return;
+            }
         }
 
         // Check for flags and stuff
@@ -4358,7 +4643,7 @@ namespace BATTLE {
             bms.m_target              = { 255, 255 };
             bms.m_user                = p_move.m_user;
             if( !lmcnt ) {
-                addLockedMove( opponent, slot, bms, 1 + rand( ) % 2 );
+                addLockedMove( opponent, slot, bms, 1 + _rng.next( ) % 2 );
             } else if( --lmcnt ) {
                 addLockedMove( opponent, slot, bms, lmcnt );
             } else {
@@ -4367,17 +4652,19 @@ namespace BATTLE {
                     || getPkmn( opponent, slot )->getAbility( ) != A_OWN_TEMPO
                     || ( getTerrain( ) == TR_MISTYTERRAIN && isGrounded( opponent, slot ) )
                     || ( getVolatileStatus( opponent, slot ) & VS_SUBSTITUTE ) ) {
-                    fmt = std::string( GET_STRING( 277 ) );
-                    snprintf( buffer, TMP_BUFFER_SIZE, fmt.c_str( ),
-                              p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
-                                  .c_str( ) );
-                    p_ui->log( buffer );
+                    if( !p_ui->isHeadless( ) ) {
+                        fmt = GET_STRING( 277 );
+                        snprintf( buffer, TMP_BUFFER_SIZE, fmt,
+                                  p_ui->getPkmnName( getPkmnOrDisguise( opponent, slot ), opponent )
+                                      .c_str( ) );
+                        p_ui->log( buffer );
+                    }
 
                     if( getVolatileStatus( opponent, slot ) & VS_CONFUSION ) {
                         // empty!
                     } else {
                         addVolatileStatus( p_ui, opponent, slot, VS_CONFUSION,
-                                           250 + 2 + ( rand( ) % 4 ) );
+                                           250 + 2 + ( _rng.next( ) % 4 ) );
                     }
                 }
             }
@@ -0,0 +1,94 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleReplay.cpp
+author      : Philip Wellnitz
+description : Recording and replaying the player's choices of a battle.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "battle/battleReplay.h"
+#include "battle/moveTable.h"
+
+namespace BATTLE {
+    battleReplay LAST_BATTLE_REPLAY;
+
+    // positions are stored as 3 bits: side * 2 + slot, or 4 for no position
+    constexpr u8 POSITION_BITS = 3;
+    constexpr u8 POSITION_MASK = ( 1 << POSITION_BITS ) - 1;
+    constexpr u8 NO_POSITION   = 4;
+    constexpr u8 MEGA_BIT      = 2 * POSITION_BITS;
+
+    constexpr u8 packPosition( const fieldPosition& p_pos ) {
+        if( p_pos.first > 1 || p_pos.second > 1 ) { return NO_POSITION; }
+        return p_pos.first * 2 + p_pos.second;
+    }
+
+    constexpr fieldPosition unpackPosition( u8 p_pos ) {
+        if( p_pos == NO_POSITION ) { return { 255, 255 }; }
+        return { p_pos / 2, p_pos % 2 };
+    }
+
+    constexpr bool roundTrips( const fieldPosition& p_pos ) {
+        return unpackPosition( packPosition( p_pos ) ) == p_pos;
+    }
+
+    static_assert( roundTrips( { 0, 0 } ) && roundTrips( { 0, 1 } ) && roundTrips( { 1, 0 } )
+                   && roundTrips( { 1, 1 } ) && roundTrips( { 255, 255 } ) );
+    static_assert( MEGA_BIT < 8 );
+
+    void battleReplay::reset( u32 p_seed ) {
+        _seed       = p_seed;
+        _count      = 0;
+        _next       = 0;
+        _incomplete = false;
+    }
+
+    void battleReplay::record( const battleMoveSelection& p_choice ) {
+        if( _count >= MAX_REPLAY_CHOICES ) {
+            _incomplete = true;
+            return;
+        }
+        _choices[ _count++ ]
+            = { p_choice.m_param, u8( p_choice.m_type ),
+                u8( packPosition( p_choice.m_user )
+                    | ( packPosition( p_choice.m_target ) << POSITION_BITS )
+                    | ( p_choice.m_megaEvolve << MEGA_BIT ) ) };
+    }
+
+    bool battleReplay::next( battleMoveSelection& p_out ) {
+        if( _next >= _count ) { return false; }
+        const auto& c = _choices[ _next++ ];
+
+        p_out.m_type       = battleMoveType( c.m_type );
+        p_out.m_param      = c.m_param;
+        p_out.m_user       = unpackPosition( c.m_positions & POSITION_MASK );
+        p_out.m_target     = unpackPosition( ( c.m_positions >> POSITION_BITS ) & POSITION_MASK );
+        p_out.m_megaEvolve = !!( c.m_positions & ( 1 << MEGA_BIT ) );
+        p_out.m_moveData   = p_out.m_type == MT_ATTACK ? MOVE_TABLE.get( c.m_param ) : moveData( );
+        return true;
+    }
+
+    bool battleReplay::next( battleMoveSelection& p_out, battleMoveType p_type ) {
+        if( _next >= _count || _choices[ _next ].m_type != p_type ) { return false; }
+        return next( p_out );
+    }
+} // namespace BATTLE
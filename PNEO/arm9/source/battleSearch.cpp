@@ -0,0 +1,361 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleSearch.cpp
+author      : Philip Wellnitz
+description : Search-based move selection for the battle AI of the highest levels.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "battle/battle.h"
+#include "battle/battleSearch.h"
+#include "battle/moveTable.h"
+#include "prof/profiler.h"
+
+namespace BATTLE {
+#ifdef DESQUID
+    searchStats SEARCH_STATS;
+#endif
+
+    // root of the current search and the state a rollout plays on; both are too large
+    // for the stack
+    battleSnapshot SEARCH_ROOT;
+    battleSnapshot SEARCH_STATE;
+
+    void battleSnapshot::copy( const battleSnapshot& p_other ) {
+        _field = p_other._field;
+        _mode  = p_other._mode;
+        std::memcpy( _teams, p_other._teams, sizeof( _teams ) );
+        std::memcpy( _teamSizes, p_other._teamSizes, sizeof( _teamSizes ) );
+        for( u8 i = 0; i < field::NUM_SIDES; ++i ) {
+            _field.relocate( i, p_other._teams[ i ], _teams[ i ], SAVE::NUM_PARTY_SLOTS );
+        }
+    }
+
+    void battleSnapshot::set( const field& p_field, battleMode p_mode,
+                              const pokemon* p_playerTeam, u8 p_playerTeamSize,
+                              const pokemon* p_opponentTeam, u8 p_opponentTeamSize ) {
+        _field = p_field;
+        _mode  = p_mode;
+
+        _teamSizes[ field::PLAYER_SIDE ]   = p_playerTeamSize;
+        _teamSizes[ field::OPPONENT_SIDE ] = p_opponentTeamSize;
+        std::memset( _teams, 0, sizeof( _teams ) );
+        std::memcpy( _teams[ field::PLAYER_SIDE ], p_playerTeam,
+                     p_playerTeamSize * sizeof( pokemon ) );
+        std::memcpy( _teams[ field::OPPONENT_SIDE ], p_opponentTeam,
+                     p_opponentTeamSize * sizeof( pokemon ) );
+
+        _field.relocate( false, p_playerTeam, _teams[ field::PLAYER_SIDE ], p_playerTeamSize );
+        _field.relocate( true, p_opponentTeam, _teams[ field::OPPONENT_SIDE ],
+                         p_opponentTeamSize );
+    }
+
+    bool battleSnapshot::canBattle( u8 p_side ) const {
+        for( u8 i = 0; i < _teamSizes[ p_side ]; ++i ) {
+            if( _teams[ p_side ][ i ].canBattle( ) ) { return true; }
+        }
+        return false;
+    }
+
+    s32 battleSnapshot::evaluate( u8 p_side ) const {
+        s32 res = 0;
+        for( u8 side = 0; side < field::NUM_SIDES; ++side ) {
+            s32 value = 0;
+            for( u8 i = 0; i < _teamSizes[ side ]; ++i ) {
+                const auto& pkmn = _teams[ side ][ i ];
+                if( !pkmn.canBattle( ) ) { continue; }
+                value += 300
+                         + 700 * pkmn.m_stats.m_curHP / std::max<u16>( 1, pkmn.m_stats.m_maxHP );
+            }
+            res += side == p_side ? value : -value;
+        }
+        return res;
+    }
+
+    battleMoveSelection battleSnapshot::randomChoice( u8 p_side, u8 p_slot, battleRandom& p_rng ) {
+        battleMoveSelection res = NO_OP_SELECTION;
+        res.m_user              = { p_side, p_slot };
+        auto pkmn               = _field.getPkmn( p_side, p_slot );
+        if( pkmn == nullptr ) { return res; }
+        if( !_field.canSelectMove( p_side, p_slot ) ) {
+            return _field.getStoredMove( p_side, p_slot );
+        }
+
+        u8 usable[ 4 ], cnt = 0;
+        for( u8 i = 0; i < 4; ++i ) {
+            if( _field.canSelectMove( p_side, p_slot, i ) ) { usable[ cnt++ ] = i; }
+        }
+        res.m_type     = MT_ATTACK;
+        res.m_param    = cnt ? pkmn->getMove( usable[ p_rng.next( ) % cnt ] ) : M_STRUGGLE;
+        res.m_moveData = MOVE_TABLE.get( res.m_param );
+
+        // same targets as the heuristic ai picks
+        u8   foe = !p_side;
+        auto tg  = res.m_moveData.m_pressureTarget != TG_NONE ? res.m_moveData.m_pressureTarget
+                                                              : res.m_moveData.m_target;
+        u8   ctg = p_rng.next( ) % getBattlingPKMNCount( _mode );
+        switch( tg ) {
+        case TG_RANDOM:
+        case TG_ANY_FOE:
+        case TG_ANY:
+            if( _field.getPkmn( foe, ctg ) == nullptr ) { ctg = !ctg; }
+            if( _field.getPkmn( foe, ctg ) == nullptr ) { ctg = 0; }
+            res.m_target = fieldPosition( foe, ctg );
+            break;
+        case TG_ALLY_OR_SELF:
+            if( _field.getPkmn( p_side, ctg ) == nullptr ) { ctg = p_slot; }
+            res.m_target = fieldPosition( p_side, ctg );
+            break;
+        case TG_SELF: res.m_target = fieldPosition( p_side, p_slot ); break;
+        default: res.m_target = fieldPosition( foe, field::PKMN_0 ); break;
+        }
+        return res;
+    }
+
+    void battleSnapshot::switchPokemon( battleUI* p_ui, fieldPosition p_toSwitch,
+                                        u8 p_newIndex ) {
+        auto oldst = _field.getSlotStatus( p_toSwitch.first, p_toSwitch.second );
+        if( oldst != slot::status::FAINTED && oldst != slot::status::RECALLED ) {
+            _field.recallPokemon( p_ui, p_toSwitch.first, p_toSwitch.second, false, true );
+        }
+
+        auto team = _teams[ p_toSwitch.first ];
+        std::swap( team[ p_toSwitch.second ], team[ p_newIndex ] );
+        _field.sendPokemon( p_ui, p_toSwitch.first, p_toSwitch.second,
+                            &team[ p_toSwitch.second ], team );
+    }
+
+    void battleSnapshot::refill( battleUI* p_ui, slot::status p_checkType ) {
+        for( u8 i = 0; i < field::NUM_SIDES; ++i ) {
+            for( u8 j = 0; j < getBattlingPKMNCount( _mode ); ++j ) {
+                if( _field.getSlotStatus( i, j ) != p_checkType ) { continue; }
+                for( u8 k = getBattlingPKMNCount( _mode ); k < _teamSizes[ i ]; ++k ) {
+                    if( _teams[ i ][ k ].canBattle( ) ) {
+                        switchPokemon( p_ui, { i, j }, k );
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    bool battleSnapshot::playTurn(
+        battleUI*           p_ui,
+        battleMoveSelection p_moves[ field::NUM_SIDES ][ side::MAX_PKMN_PER_SIDE ] ) {
+        // same order of events as in battle::start, minus items, mega evolutions and exp
+        battleMoveSelections selection;
+        for( u8 side = 0; side < field::NUM_SIDES; ++side ) {
+            for( u8 i = 0; i < getBattlingPKMNCount( _mode ); ++i ) {
+                auto& mv = p_moves[ side ][ i ];
+                if( mv.m_type == MT_ATTACK && mv.m_param == M_PURSUIT
+                    && mv.m_target.first < field::NUM_SIDES
+                    && mv.m_target.second < side::MAX_PKMN_PER_SIDE
+                    && p_moves[ mv.m_target.first ][ mv.m_target.second ].m_type
+                           == MT_SWITCH ) {
+                    mv.m_type = MT_SWITCH_PURSUIT;
+                }
+                if( mv.m_type == MT_NO_OP_NO_CANCEL ) { mv.m_type = MT_NO_OP; }
+                selection.push_back( mv );
+            }
+        }
+
+        auto sortedMoves = _field.computeSortedBattleMoves( p_ui, selection );
+        for( size_t i = 0; i < sortedMoves.size( ); ++i ) {
+            if( sortedMoves[ i ].m_type == MT_ATTACK ) {
+                _field.executeBattleMove( p_ui, sortedMoves[ i ] );
+                refill( p_ui, slot::status::RECALLED );
+            }
+            if( sortedMoves[ i ].m_type == MT_SWITCH ) {
+                switchPokemon( p_ui, sortedMoves[ i ].m_user, sortedMoves[ i ].m_param );
+            }
+            if( !canBattle( field::PLAYER_SIDE ) || !canBattle( field::OPPONENT_SIDE ) ) {
+                return false;
+            }
+        }
+
+        _field.age( p_ui );
+        if( !canBattle( field::PLAYER_SIDE ) || !canBattle( field::OPPONENT_SIDE ) ) {
+            return false;
+        }
+        refill( p_ui, slot::status::FAINTED );
+        return true;
+    }
+
+    battleMoveSelection battle::searchAIMove( u8 p_slot, bool p_opponent,
+                                              const battleMoveSelection& p_fallback,
+                                              battleRandom& p_rng, u16 p_aiLevel ) {
+        u8 own = p_opponent ? field::OPPONENT_SIDE : field::PLAYER_SIDE;
+        u8 foe = !own;
+
+        auto pkmn = _field.getPkmn( own, p_slot );
+        if( pkmn == nullptr || !_field.canSelectMove( own, p_slot ) ) { return p_fallback; }
+
+#ifdef DESQUID
+        u32 start = PROF::ticks( );
+        SEARCH_STATS.m_decisions++;
+#endif
+
+        // candidates: every usable move (against every foe, if the move has a single
+        // target of choice), every possible switch
+        battleMoveSelection cand[ MAX_SEARCH_CANDIDATES ];
+        u8                  cnt     = 0;
+        bool                canMove = false;
+        for( u8 i = 0; i < 4; ++i ) {
+            if( !_field.canSelectMove( own, p_slot, i ) ) { continue; }
+            canMove = true;
+
+            battleMoveSelection mv = NO_OP_SELECTION;
+            mv.m_type              = MT_ATTACK;
+            mv.m_user              = { own, p_slot };
+            mv.m_param             = pkmn->getMove( i );
+            mv.m_megaEvolve        = p_fallback.m_megaEvolve;
+            mv.m_moveData          = MOVE_TABLE.get( mv.m_param );
+
+            auto tg = mv.m_moveData.m_pressureTarget != TG_NONE ? mv.m_moveData.m_pressureTarget
+                                                                : mv.m_moveData.m_target;
+            switch( tg ) {
+            case TG_ANY_FOE:
+            case TG_ANY:
+                for( u8 j = 0; j < getBattlingPKMNCount( _policy.m_mode ); ++j ) {
+                    if( _field.getPkmn( foe, j ) == nullptr && j ) { continue; }
+                    mv.m_target   = fieldPosition( foe, j );
+                    cand[ cnt++ ] = mv;
+                }
+                continue;
+            case TG_RANDOM: mv.m_target = fieldPosition( foe, field::PKMN_0 ); break;
+            case TG_ALLY_OR_SELF:
+            case TG_SELF: mv.m_target = fieldPosition( own, p_slot ); break;
+            default: mv.m_target = fieldPosition( foe, field::PKMN_0 ); break;
+            }
+            cand[ cnt++ ] = mv;
+        }
+        if( !canMove ) { cand[ cnt++ ] = p_fallback; }
+
+        // bench pkmn that the other slots plan to send out this turn aren't available,
+        // the one the heuristic planned for this slot is
+        u8 planned = _plannedSwitches[ own ];
+        if( p_fallback.m_type == MT_SWITCH ) { planned &= ~( 1 << p_fallback.m_param ); }
+        if( _field.canSwitchOut( own, p_slot ) ) {
+            const pokemon* team     = p_opponent ? _opponentTeam : _playerTeam;
+            u8             teamSize = p_opponent ? _opponentTeamSize : _playerTeamSize;
+            for( u8 i = getBattlingPKMNCount( _policy.m_mode );
+                 i < teamSize && cnt < MAX_SEARCH_CANDIDATES; ++i ) {
+                if( !team[ i ].canBattle( ) || ( planned & ( 1 << i ) ) ) { continue; }
+                battleMoveSelection sw = NO_OP_SELECTION;
+                sw.m_type              = MT_SWITCH;
+                sw.m_user              = { own, p_slot };
+                sw.m_param             = i;
+                cand[ cnt++ ]          = sw;
+            }
+        }
+
+        if( cnt < 2 ) {
+#ifdef DESQUID
+            SEARCH_STATS.m_ticks += PROF::ticks( ) - start;
+#endif
+            return p_fallback;
+        }
+
+        // the heuristic's choice, if it is a candidate
+        u8 fallback = 0;
+        for( u8 i = 0; i < cnt; ++i ) {
+            if( cand[ i ].m_type == p_fallback.m_type && cand[ i ].m_param == p_fallback.m_param
+                && cand[ i ].m_target == p_fallback.m_target ) {
+                fallback = i;
+                break;
+            }
+        }
+
+        // every candidate gets at least SEARCH_MIN_ROLLOUTS rollouts: look only 1 turn
+        // ahead if 2 turns leave too few of them; if that doesn't suffice either, drop
+        // the last candidates (switches first), but keep the heuristic's choice
+        constexpr u8 MAX_SEARCHED = SEARCH_NODE_BUDGET / SEARCH_MIN_ROLLOUTS;
+        static_assert( MAX_SEARCHED >= 2 );
+
+        u8 depth = p_aiLevel >= SEARCH_DEEP_AI_LEVEL ? 2 : 1;
+        if( SEARCH_NODE_BUDGET / depth < cnt * SEARCH_MIN_ROLLOUTS ) { depth = 1; }
+        if( cnt > MAX_SEARCHED ) {
+            if( fallback >= MAX_SEARCHED ) {
+                std::swap( cand[ fallback ], cand[ MAX_SEARCHED - 1 ] );
+                fallback = MAX_SEARCHED - 1;
+            }
+            cnt = MAX_SEARCHED;
+#ifdef DESQUID
+            SEARCH_STATS.m_cuts++;
+#endif
+        }
+        u16 rollouts = SEARCH_NODE_BUDGET / depth;
+
+        // play each candidate a few times against random choices of all other pkmn
+        SEARCH_ROOT.set( _field, _policy.m_mode, _playerTeam, _playerTeamSize, _opponentTeam,
+                         _opponentTeamSize );
+        battleUI     ui  = battleUI( 0, 0, 0, _policy.m_mode, _isWildBattle, true );
+        battleRandom rng = battleRandom( p_rng.next( ) );
+
+        s32 score[ MAX_SEARCH_CANDIDATES ]  = { 0 };
+        u8  visits[ MAX_SEARCH_CANDIDATES ] = { 0 };
+        for( u16 r = 0; r < rollouts; ++r ) {
+            u8 c         = r % cnt;
+            SEARCH_STATE = SEARCH_ROOT;
+            SEARCH_STATE.getField( ).rng( ).seed( rng.next( ) );
+
+            for( u8 d = 0; d < depth; ++d ) {
+                battleMoveSelection moves[ field::NUM_SIDES ][ side::MAX_PKMN_PER_SIDE ];
+                for( u8 s = 0; s < field::NUM_SIDES; ++s ) {
+                    for( u8 i = 0; i < side::MAX_PKMN_PER_SIDE; ++i ) {
+                        if( !d && s == own && i == p_slot ) {
+                            moves[ s ][ i ] = cand[ c ];
+                        } else {
+                            moves[ s ][ i ] = SEARCH_STATE.randomChoice( s, i, rng );
+                        }
+                    }
+                }
+#ifdef DESQUID
+                SEARCH_STATS.m_nodes++;
+#endif
+                if( !SEARCH_STATE.playTurn( &ui, moves ) ) { break; }
+            }
+            score[ c ] += SEARCH_STATE.evaluate( own );
+            visits[ c ]++;
+        }
+
+        // pick the best candidate on average; on ties, trust the heuristic
+        u8 best = fallback;
+        for( u8 i = 0; i < cnt; ++i ) {
+            if( score[ i ] * visits[ best ] > score[ best ] * visits[ i ] ) { best = i; }
+        }
+
+        // the other slots can't send out the pkmn this slot switches to
+        _plannedSwitches[ own ] = planned;
+        if( cand[ best ].m_type == MT_SWITCH ) {
+            _plannedSwitches[ own ] |= 1 << cand[ best ].m_param;
+        }
+
+#ifdef DESQUID
+        SEARCH_STATS.m_ticks += PROF::ticks( ) - start;
+#endif
+        return cand[ best ];
+    }
+} // namespace BATTLE
@@ -0,0 +1,172 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleTournament.cpp
+author      : Philip Wellnitz
+description : Balance sweeps of simulated battles against all trainers and facilities.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "battle/battle.h"
+#include "battle/battleRandom.h"
+#include "battle/battleTournament.h"
+#include "fs/data.h"
+#include "map/mapBattleFacilityDefines.h"
+#include "map/mapBattleFacilityPool.h"
+#include "save/saveGame.h"
+
+namespace BATTLE {
+    constexpr u8 TOURNAMENT_TRAINER  = 0;
+    constexpr u8 TOURNAMENT_FACILITY = 1;
+
+    u32 TOURNAMENT_MOVE_USES[ MAX_MOVE_USAGE_ID ];
+
+    u32 tournamentSeed( u8 p_kind, u16 p_id, u8 p_variant ) {
+        return battleRandom( ( u32( p_kind ) << 24 ) | ( u32( p_variant ) << 16 ) | p_id )
+            .next( );
+    }
+
+    /*
+     * @brief: Adds the results of a matchup to the totals and writes its CSV row.
+     */
+    void logMatchup( FILE* p_out, const char* p_kind, u16 p_id, u8 p_difficulty, u16 p_streak,
+                     const simulationResult& p_res, tournamentResult& p_total ) {
+        u16 battles = p_res.m_playerWins + p_res.m_opponentWins + p_res.m_draws;
+
+        p_total.m_matchups++;
+        p_total.m_battles += battles;
+        p_total.m_playerWins += p_res.m_playerWins;
+        p_total.m_rounds += p_res.m_rounds;
+#ifdef DESQUID
+        if( !p_res.m_replayMatches ) { p_total.m_replayMismatches++; }
+#endif
+        if( !p_out ) { return; }
+        fprintf( p_out, "%s,%hu,%hhu,%hu,%hu,%hu,%hu,%hu,%lu\n", p_kind, p_id, p_difficulty,
+                 p_streak, battles, p_res.m_playerWins, p_res.m_opponentWins, p_res.m_draws,
+                 p_res.m_rounds );
+    }
+
+    tournamentResult runTournament( const pokemon* p_team, u8 p_teamSize, u16 p_lastTrainer,
+                                    u16 p_battles, FILE* p_out, u16 p_shard,
+                                    u16 p_numShards ) {
+        tournamentResult res = { };
+        if( !p_numShards ) { p_numShards = 1; }
+        if( p_teamSize > SAVE::NUM_PARTY_SLOTS ) { p_teamSize = SAVE::NUM_PARTY_SLOTS; }
+
+        std::memset( TOURNAMENT_MOVE_USES, 0, sizeof( TOURNAMENT_MOVE_USES ) );
+        MOVE_USAGE = TOURNAMENT_MOVE_USES;
+        if( p_out ) {
+            fprintf( p_out, "kind,id,difficulty,streak,battles,wins,losses,draws,rounds\n" );
+        }
+
+        // matchups are numbered whether they exist or not, so that the shards stay the same
+        u32 matchup = 0;
+
+        // regular trainers; the difficulty selects the directory their teams are read from
+        for( u8 d = 0; d < TOURNAMENT_DIFFICULTIES; ++d ) {
+            for( u16 t = 1; t <= p_lastTrainer; ++t ) {
+                if( matchup++ % p_numShards != p_shard ) { continue; }
+
+                // trainers without a team of their own for the difficulty fall back to the
+                // normal one; that matchup is played at the normal difficulty already
+                battleTrainer opponent;
+                u8            dir;
+                if( !FS::getBattleTrainer( t, CURRENT_LANGUAGE, &opponent, 3 * d, &dir )
+                    || dir != d ) {
+                    continue;
+                }
+                auto policy = opponent.m_data.m_forceDoubleBattle ? DEFAULT_DOUBLE_TRAINER_POLICY
+                                                                  : DEFAULT_TRAINER_POLICY;
+                auto sim    = simulateBattles( p_team, p_teamSize, opponent, policy, p_battles,
+                                               tournamentSeed( TOURNAMENT_TRAINER, t, d ) );
+                logMatchup( p_out, "trainer", t, d, 0, sim, res );
+            }
+        }
+
+        // battle facility; each battle is against a team of its own, drawn as in the game
+        pokemon team[ SAVE::NUM_PARTY_SLOTS ];
+        for( u8 r = 0; r < TOURNAMENT_FACILITY_RULES; ++r ) {
+            const auto& rules = MAP::FACILITY_RULE_SETS[ r ];
+            u8          size  = std::min( p_teamSize, rules.m_numPkmn );
+            std::memcpy( team, p_team, size * sizeof( pokemon ) );
+            for( u8 i = 0; i < size; ++i ) {
+                team[ i ].setLevel( rules.m_level );
+                team[ i ].heal( );
+            }
+
+            for( u8 s = 0; s < TOURNAMENT_STREAKS; ++s ) {
+                if( matchup++ % p_numShards != p_shard ) { continue; }
+
+                u16 round = TOURNAMENT_STREAK[ s ] / 7; // as passed by runBattleFactory
+                u32 seed  = tournamentSeed( TOURNAMENT_FACILITY, rules.m_level, s );
+
+                battleTrainer    opponent;
+                simulationResult sim = { };
+                std::memset( &opponent, 0, sizeof( battleTrainer ) );
+
+                // check that all teams can be drawn before any battle counts (drawing a
+                // team again with the same seed yields the same team); without sets for
+                // the tier, teams are drawn from random species as in the game
+                bool drawn = true;
+                for( u16 i = 0; drawn && i < p_battles; ++i ) {
+                    battleRandom rng( seed + i );
+                    drawn = MAP::drawFacilityTeam( rules, round, opponent.m_data, rng );
+                }
+                if( !drawn ) {
+                    res.m_failed++;
+                    continue;
+                }
+
+                // the batch's replay check is done on its last battle only
+                for( u16 i = 0; i < p_battles; ++i ) {
+                    battleRandom rng( seed + i );
+                    MAP::drawFacilityTeam( rules, round, opponent.m_data, rng );
+                    opponent.m_data.m_AILevel = std::min( 9, 4 + round );
+
+                    auto one = simulateBattles( team, size, opponent, FACILITY_TRAINER_POLICY, 1,
+                                                rng.next( ), i + 1 == p_battles );
+                    sim.m_playerWins += one.m_playerWins;
+                    sim.m_opponentWins += one.m_opponentWins;
+                    sim.m_draws += one.m_draws;
+                    sim.m_rounds += one.m_rounds;
+#ifdef DESQUID
+                    sim.m_replayMatches = one.m_replayMatches;
+#endif
+                }
+                logMatchup( p_out, "facility", rules.m_level, 0, TOURNAMENT_STREAK[ s ], sim,
+                            res );
+            }
+        }
+
+        MOVE_USAGE = nullptr;
+        if( p_out ) {
+            fprintf( p_out, "\nmove,uses\n" );
+            for( u16 i = 1; i < MAX_MOVE_USAGE_ID; ++i ) {
+                if( !TOURNAMENT_MOVE_USES[ i ] ) { continue; }
+                fprintf( p_out, "%hu,%lu\n", i, TOURNAMENT_MOVE_USES[ i ] );
+            }
+        }
+        return res;
+    }
+} // namespace BATTLE
@@ -34,6 +34,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "battle/battleTrainer.h"
 #include "battle/battleUI.h"
 #include "battle/move.h"
+#include "battle/moveTable.h"
 #include "defines.h"
 #include "fs/fs.h"
 #include "gen/moveNames.h"
@@ -920,6 +921,7 @@ namespace BATTLE {
     }
 
     void battleUI::animateHitPkmn( bool p_opponent, u8 p_pos, u8 p_effectiveness ) {
+        if( _headless ) { return; }
         if( p_effectiveness > 100 ) {
             SOUND::playSoundEffect( SFX_BATTLE_DAMAGE_SUPER );
         } else if( p_effectiveness < 100 ) {
@@ -969,6 +971,7 @@ namespace BATTLE {
     }
 
     void battleUI::init( weather p_initialWeather, terrain p_initialTerrain ) {
+        if( _headless ) { return; }
         for( u8 i = 0; i < 2; ++i ) {
             u16* pal = IO::BG_PAL( i );
             pal[ 0 ] = 0;
@@ -997,6 +1000,7 @@ namespace BATTLE {
     }
 
     void battleUI::deinit( ) {
+        if( _headless ) { return; }
         IO::fadeScreen( IO::CLEAR_DARK_IMMEDIATE, false );
         IO::initOAMTable( true );
         IO::initOAMTable( false );
@@ -1011,6 +1015,7 @@ namespace BATTLE {
     }
 
     void battleUI::resetLog( ) {
+        if( _headless ) { return; }
         SpriteEntry* oam = IO::Oam->oamBuffer;
         for( u8 i = 0; i < 128; ++i ) { oam[ i ].isHidden = true; }
         for( u8 i = 0; i < 12; ++i ) { oam[ SPR_LARGE_MESSAGE_OAM_SUB + i ].isHidden = false; }
@@ -1019,7 +1024,8 @@ namespace BATTLE {
         _currentLogLine = 1;
     }
 
-    void battleUI::log( std::string p_message ) {
+    void battleUI::log( const char* p_message ) {
+        if( _headless ) { return; }
         SpriteEntry* oam = IO::Oam->oamBuffer;
 
         if( oam[ SPR_LARGE_MESSAGE_OAM_SUB ].isHidden ) { resetLog( ); }
@@ -1028,42 +1034,43 @@ namespace BATTLE {
         IO::regularFont->setColor( 251, 2 );
 
         u8 height = IO::regularFont->printBreakingStringC(
-            p_message.c_str( ), 16, 24, 256 - 32, true, IO::font::LEFT, 14, ' ', 0, false, -1 );
+            p_message, 16, 24, 256 - 32, true, IO::font::LEFT, 14, ' ', 0, false, -1 );
 
         if( _currentLogLine + height > 12 ) { _currentLogLine = 1; }
 
         dmaFillWords( 0, bgGetGfxPtr( IO::bg2sub ) + ( 10 + 14 * _currentLogLine ) * 128,
                       ( 14 * ( height + 2 ) ) * 256 );
         _currentLogLine += IO::regularFont->printBreakingStringC(
-            p_message.c_str( ), 16, 10 + 14 * _currentLogLine, 256 - 32, true, IO::font::LEFT, 14,
-            ' ', 0, true );
+            p_message, 16, 10 + 14 * _currentLogLine, 256 - 32, true, IO::font::LEFT, 14, ' ', 0,
+            true );
 
         for( u8 i = 0; i < 30; ++i ) { swiWaitForVBlank( ); }
     }
 
-    std::string battleUI::getPkmnName( pokemon* p_pokemon, bool p_opponent,
-                                       bool p_sentenceStart ) const {
-        char        buffer[ 50 ];
-        std::string fmt = "%s";
+    pkmnName battleUI::getPkmnName( pokemon* p_pokemon, bool p_opponent,
+                                    bool p_sentenceStart ) const {
+        pkmnName    res;
+        const char* fmt = "%s";
         if( p_opponent && _isWildBattle ) {
             if( p_sentenceStart ) {
-                fmt = std::string( GET_STRING( 311 ) );
+                fmt = GET_STRING( 311 );
             } else {
-                fmt = std::string( GET_STRING( 309 ) );
+                fmt = GET_STRING( 309 );
             }
         } else if( p_opponent ) {
             if( p_sentenceStart ) {
-                fmt = std::string( GET_STRING( 312 ) );
+                fmt = GET_STRING( 312 );
             } else {
-                fmt = std::string( GET_STRING( 310 ) );
+                fmt = GET_STRING( 310 );
             }
         }
-        snprintf( buffer, 49, fmt.c_str( ), p_pokemon->m_boxdata.m_name );
-        return std::string( buffer );
+        snprintf( res.m_name, pkmnName::MAX_LENGTH - 1, fmt, p_pokemon->m_boxdata.m_name );
+        return res;
     }
 
     void battleUI::logBoosts( pokemon* p_pokemon, bool p_opponent, u8 p_slot, boosts p_intended,
                               boosts p_actual ) {
+        if( _headless ) { return; }
         char buffer[ 100 ];
         auto pkmnstr = getPkmnName( p_pokemon, p_opponent );
         bool up      = false;
@@ -1102,7 +1109,7 @@ namespace BATTLE {
                     snprintf( buffer, 99, fmt.c_str( ), pkmnstr.c_str( ), GET_STRING( 248 + i ),
                               pkmnstr.c_str( ) );
                 }
-                log( std::string( buffer ) );
+                log( buffer );
             }
         }
 
@@ -1142,13 +1149,14 @@ namespace BATTLE {
                     snprintf( buffer, 99, fmt.c_str( ), pkmnstr.c_str( ), GET_STRING( 248 + i ),
                               pkmnstr.c_str( ) );
                 }
-                log( std::string( buffer ) );
+                log( buffer );
             }
         }
         for( u8 i = 0; i < 30; ++i ) { swiWaitForVBlank( ); }
     }
 
     void battleUI::logItem( pokemon* p_pokemon, bool p_opponent ) {
+        if( _headless ) { return; }
         if( !p_pokemon->getItem( ) ) { return; }
 
         for( u8 i = 0; i < 5; ++i ) { swiWaitForVBlank( ); }
@@ -1179,6 +1187,7 @@ namespace BATTLE {
     }
 
     void battleUI::logAbility( pokemon* p_pokemon, bool p_opponent ) {
+        if( _headless ) { return; }
         for( u8 i = 0; i < 5; ++i ) { swiWaitForVBlank( ); }
         SOUND::playSoundEffect( SFX_BATTLE_ABILITY );
 
@@ -1208,21 +1217,24 @@ namespace BATTLE {
     }
 
     void battleUI::logForewarn( pokemon* p_pokemon, bool p_opponent, u16 p_move ) {
+        if( _headless ) { return; }
         char buffer[ 50 ];
         auto fmt = std::string( GET_STRING( 396 ) );
         snprintf( buffer, 49, fmt.c_str( ), getPkmnName( p_pokemon, p_opponent ).c_str( ),
                   FS::getMoveName( p_move ).c_str( ) );
-        log( std::string( buffer ) );
+        log( buffer );
     }
 
     void battleUI::logAnticipation( pokemon* p_pokemon, bool p_opponent ) {
+        if( _headless ) { return; }
         char buffer[ 50 ];
         auto fmt = std::string( GET_STRING( 397 ) );
         snprintf( buffer, 49, fmt.c_str( ), getPkmnName( p_pokemon, p_opponent ).c_str( ) );
-        log( std::string( buffer ) );
+        log( buffer );
     }
 
     void battleUI::logFrisk( pokemon* p_pokemon, bool p_opponent, std::vector<u16> p_itms ) {
+        if( _headless ) { return; }
         char buffer[ 100 ];
         if( p_itms.size( ) == 1 ) {
             auto fmt = std::string( GET_STRING( 398 ) );
@@ -1236,10 +1248,11 @@ namespace BATTLE {
         } else {
             return;
         }
-        log( std::string( buffer ) );
+        log( buffer );
     }
 
     void battleUI::updatePkmnStats( bool p_opponent, u8 p_pos, pokemon* p_pokemon, bool p_redraw ) {
+        if( _headless ) { return; }
         SpriteEntry* oam = IO::OamTop->oamBuffer;
         u16          anchorx
             = oam[ SPR_HPBAR_OAM + 2 * ( !p_opponent ) + p_pos ].x + ( p_opponent ? -88 : 34 );
@@ -1479,6 +1492,7 @@ namespace BATTLE {
     }
 
     void battleUI::hidePkmnStats( bool p_opponent, u8 p_pos ) {
+        if( _headless ) { return; }
         SpriteEntry* oam = IO::OamTop->oamBuffer;
 
         oam[ SPR_HPBAR_OAM + 2 * ( !p_opponent ) + p_pos ].isHidden    = true;
@@ -1500,6 +1514,7 @@ namespace BATTLE {
     }
 
     void battleUI::updatePkmn( bool p_opponent, u8 p_pos, pokemon* p_pokemon ) {
+        if( _headless ) { return; }
         if( p_pokemon == nullptr ) {
             hidePkmn( p_opponent, p_pos );
         } else {
@@ -1510,6 +1525,7 @@ namespace BATTLE {
     }
 
     void battleUI::showPkmn( bool p_opponent, u8 p_pos ) {
+        if( _headless ) { return; }
         SpriteEntry* oam = IO::OamTop->oamBuffer;
         for( u8 i = 0; i < 4; ++i ) {
             if( !p_opponent ) {
@@ -1530,6 +1546,7 @@ namespace BATTLE {
     }
 
     void battleUI::hidePkmn( bool p_opponent, u8 p_pos ) {
+        if( _headless ) { return; }
         SpriteEntry* oam = IO::OamTop->oamBuffer;
         for( u8 i = 0; i < 4; ++i ) {
             oam[ SPR_PKMN_START_OAM( 2 * ( !p_opponent ) + p_pos ) + i ].isRotateScale = false;
@@ -1545,6 +1562,7 @@ namespace BATTLE {
     }
 
     void battleUI::faintPkmn( bool p_opponent, u8 p_pos, pokemon* p_pokemon ) {
+        if( _headless ) { return; }
         SpriteEntry* oam = IO::OamTop->oamBuffer;
         char         buffer[ 100 ];
         SOUND::playSoundEffect( SFX_BATTLE_FAINT );
@@ -1574,7 +1592,7 @@ namespace BATTLE {
             snprintf( buffer, 99, fmt.c_str( ), "[it's a nullptr]" );
 #endif
         }
-        log( std::string( buffer ) );
+        log( buffer );
     }
 
     void battleUI::loadPkmnSprite( bool p_opponent, u8 p_pos, pokemon* p_pokemon ) {
@@ -1672,6 +1690,7 @@ namespace BATTLE {
     }
 
     void battleUI::startWildBattle( pokemon* p_pokemon ) {
+        if( _headless ) { return; }
         SpriteEntry* oam = IO::OamTop->oamBuffer;
 
         IO::fadeScreen( IO::UNFADE, true, true );
@@ -1737,10 +1756,11 @@ namespace BATTLE {
 
         char buffer[ 50 ];
         snprintf( buffer, 49, GET_STRING( 394 ), p_pokemon->m_boxdata.m_name );
-        log( std::string( buffer ) );
+        log( buffer );
     }
 
     void battleUI::startTrainerBattle( battleTrainer* p_trainer ) {
+        if( _headless ) { return; }
         _battleTrainer = p_trainer;
 
         SpriteEntry* oam = IO::OamTop->oamBuffer;
@@ -1769,7 +1789,7 @@ namespace BATTLE {
         snprintf( buffer, 49, fmt.c_str( ),
                   FS::getTrainerClassName( _battleTrainer->getClass( ) ).c_str( ),
                   _battleTrainer->m_strings.m_name );
-        log( std::string( buffer ) );
+        log( buffer );
 
         // Slide trainer out
 
@@ -1785,6 +1805,7 @@ namespace BATTLE {
     }
 
     void battleUI::sendOutPkmn( bool p_opponent, u8 p_pos, pokemon* p_pokemon ) {
+        if( _headless ) { return; }
         if( p_pokemon != nullptr ) {
             SAVE::SAV.getActiveFile( ).registerSeenPkmn( p_pokemon->getSpecies( ) );
         }
@@ -1801,10 +1822,10 @@ namespace BATTLE {
             snprintf( buffer, 99, fmt.c_str( ),
                       FS::getTrainerClassName( _battleTrainer->getClass( ) ).c_str( ),
                       _battleTrainer->m_strings.m_name, p_pokemon->m_boxdata.m_name );
-            log( std::string( buffer ) );
+            log( buffer );
         } else {
             snprintf( buffer, 99, GET_STRING( 395 ), p_pokemon->m_boxdata.m_name );
-            log( std::string( buffer ) );
+            log( buffer );
         }
 
         // play pokeball animation
@@ -1825,16 +1846,17 @@ namespace BATTLE {
     }
 
     void battleUI::recallPkmn( bool p_opponent, u8 p_pos, pokemon* p_pokemon, bool p_forced ) {
+        if( _headless ) { return; }
         char buffer[ 100 ];
         if( p_opponent && _battleTrainer != nullptr ) {
             // TODO
             //            snprintf( buffer, 99, GET_STRING( 274 + p_forced ),
             //                    FS::getTrainerClassName( _battleTrainer->getClass( ) ).c_str( ),
             //                    _battleTrainer->m_strings.m_name, p_pokemon->m_boxdata.m_name );
-            //            log( std::string( buffer ) );
+            //            log( buffer );
         } else {
             snprintf( buffer, 99, GET_STRING( 272 + p_forced ), p_pokemon->m_boxdata.m_name );
-            log( std::string( buffer ) );
+            log( buffer );
         }
 
         // Hide pkmn and status
@@ -1846,6 +1868,7 @@ namespace BATTLE {
     }
 
     void battleUI::prepareMove( pokemon* p_pokemon, bool p_opponent, u8 p_pos, battleMove p_move ) {
+        if( _headless ) { return; }
         auto pkmnstr  = getPkmnName( p_pokemon, p_opponent );
         bool hidepkmn = true;
         char buffer[ 100 ];
@@ -2070,6 +2093,7 @@ namespace BATTLE {
     }
 
     void battleUI::animateCapturePkmn( u16 p_pokeball, u8 p_ticks ) {
+        if( _headless ) { return; }
         animateBallThrow( 0, BAG::itemToBall( p_pokeball ) );
         char buffer[ 50 ];
         snprintf( buffer, 49, "PB/%hhu/%hhu_", BAG::itemToBall( p_pokeball ),
@@ -2182,6 +2206,7 @@ namespace BATTLE {
 
     void battleUI::animateGetVolatileStatusCondition( pokemon* p_pokemon, bool p_opponent,
                                                       u8 p_slot, volatileStatus p_status ) {
+        if( _headless ) { return; }
         // TODO
         (void) p_slot;
 
@@ -2206,6 +2231,7 @@ namespace BATTLE {
 
     void battleUI::animateVolatileStatusCondition( pokemon* p_pokemon, bool p_opponent, u8 p_slot,
                                                    volatileStatus p_status ) {
+        if( _headless ) { return; }
         // TODO
         (void) p_pokemon;
         (void) p_opponent;
@@ -2215,6 +2241,7 @@ namespace BATTLE {
 
     void battleUI::animateGetStatusCondition( pokemon* p_pokemon, bool p_opponent, u8 p_slot,
                                               u8 p_status ) {
+        if( _headless ) { return; }
         (void) p_slot;
 
         auto pkmnstr = getPkmnName( p_pokemon, p_opponent );
@@ -2248,6 +2275,7 @@ namespace BATTLE {
 
     void battleUI::animateStatusCondition( pokemon* p_pokemon, bool p_opponent, u8 p_slot,
                                            u8 p_status ) {
+        if( _headless ) { return; }
         (void) p_slot;
 
         auto pkmnstr = getPkmnName( p_pokemon, p_opponent );
@@ -2355,7 +2383,7 @@ namespace BATTLE {
                     oam[ SPR_TYPE_OAM_SUB( i ) ].isHidden = true;
                     continue;
                 }
-                auto mdata = FS::getMoveData( p_pokemon->getMove( i ) );
+                auto mdata = MOVE_TABLE.get( p_pokemon->getMove( i ) );
                 mdatas.push_back( mdata );
 
                 type t;
@@ -2660,6 +2688,7 @@ namespace BATTLE {
     }
 
     void battleUI::printTopMessage( const char* p_message, bool p_init ) {
+        if( _headless ) { return; }
         if( p_init ) {
             IO::loadSprite( "UI/mbox1", SPR_MBOX_START_OAM, SPR_BALL_PAL, SPR_PKMN_GFX( 1 ), 0,
                             192 - 46, 32, 64, false, false, false, OBJPRIORITY_3, false );
@@ -2686,6 +2715,7 @@ namespace BATTLE {
     }
 
     void battleUI::hideTopMessage( ) {
+        if( _headless ) { return; }
         IO::printRectangle( 0, 192 - 46, 255, 192, false, 0 );
         for( u8 i = 0; i < 14; ++i ) {
             IO::OamTop->oamBuffer[ SPR_MBOX_START_OAM + i ].isHidden = true;
@@ -2698,6 +2728,7 @@ namespace BATTLE {
     }
 
     void battleUI::showTopMessagePkmn( pokemon* p_pokemon ) {
+        if( _headless ) { return; }
         init( _currentWeather, _currentTerrain );
         IO::initOAMTable( false );
 
@@ -2709,6 +2740,7 @@ namespace BATTLE {
     }
 
     void battleUI::handleCapture( pokemon* p_pokemon ) {
+        if( _headless ) { return; }
         char buffer[ 100 ];
 
         showTopMessagePkmn( p_pokemon );
@@ -2749,6 +2781,7 @@ namespace BATTLE {
     }
 
     void battleUI::handleBattleEnd( bool p_playerWon ) {
+        if( _headless ) { return; }
         SpriteEntry* oam = IO::OamTop->oamBuffer;
         for( u8 i = 0; i < 2; ++i ) {
             for( u8 j = 0; j < 2; ++j ) {
@@ -2802,25 +2835,30 @@ namespace BATTLE {
     }
 
     void battleUI::setNewWeather( weather p_newWeather ) {
+        if( _headless ) { return; }
         log( GET_STRING( 491 + u8( p_newWeather ) ) );
         _currentWeather = p_newWeather;
     }
 
     void battleUI::continueWeather( ) {
+        if( _headless ) { return; }
         if( _currentWeather == WE_NONE ) { return; }
 
         log( GET_STRING( 500 + u8( _currentWeather ) - 1 ) );
     }
 
     void battleUI::addPseudoWeather( u8 p_pwIdx ) {
+        if( _headless ) { return; }
         log( GET_STRING( 513 + u8( p_pwIdx ) ) );
     }
 
     void battleUI::removePseudoWeather( u8 p_pwIdx ) {
+        if( _headless ) { return; }
         log( GET_STRING( 521 + u8( p_pwIdx ) ) );
     }
 
     void battleUI::setNewTerrain( terrain p_newTerrain ) {
+        if( _headless ) { return; }
         _currentTerrain = p_newTerrain;
         redrawBattleBG( );
         log( GET_STRING( 508 + u8( p_newTerrain ) ) );
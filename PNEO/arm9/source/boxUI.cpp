@@ -185,29 +185,93 @@ namespace BOX {
         tileCnt
             = IO::loadSpriteB( SPR_PKMN_SEL_OAM_SUB, tileCnt, 0, 0, 32, 32, NoPkmnPal, NoPkmnTiles,
                                NoPkmnTilesLen, false, false, true, OBJPRIORITY_1, true );
-        // pkmn
+
+        // pkmn; all slots share the placeholder, icons get their tiles from the allocator
+        _placeholderTile = tileCnt;
+        tileCnt = IO::loadSpriteB( SPR_PKMN_START_OAM_SUB, tileCnt, 26, 32, 32, 32, NoPkmnPal,
+                                   NoPkmnTiles, NoPkmnTilesLen, false, false, false, OBJPRIORITY_3,
+                                   true );
         for( u8 i = 0; i < 5; ++i ) {
             for( u8 j = 0; j < 6; ++j ) {
-                tileCnt
-                    = IO::loadSpriteB( SPR_PKMN_START_OAM_SUB + 6 * i + j, tileCnt, 26 + 26 * j,
-                                       32 + 26 * i, 32, 32, NoPkmnPal, NoPkmnTiles, NoPkmnTilesLen,
-                                       false, false, false, OBJPRIORITY_3, true );
+                IO::loadSpriteB( SPR_PKMN_START_OAM_SUB + 6 * i + j, _placeholderTile, 26 + 26 * j,
+                                 32 + 26 * i, 32, 32, (const unsigned short*) nullptr, 0, false,
+                                 false, false, OBJPRIORITY_3, true );
             }
         }
 
         // team pkmn
         for( u8 i = 0; i < 3; ++i ) {
-            u8 pos  = 2 * i;
-            tileCnt = IO::loadSpriteB( SPR_PKMN_START_OAM_SUB + 30 + pos, tileCnt, 36, 46 + 36 * i,
-                                       32, 32, NoPkmnPal, NoPkmnTiles, NoPkmnTilesLen, false, false,
-                                       true, OBJPRIORITY_1, true );
+            u8 pos = 2 * i;
+            IO::loadSpriteB( SPR_PKMN_START_OAM_SUB + 30 + pos, _placeholderTile, 36, 46 + 36 * i,
+                             32, 32, (const unsigned short*) nullptr, 0, false, false, true,
+                             OBJPRIORITY_1, true );
         }
         for( u8 i = 0; i < 3; ++i ) {
-            u8 pos  = 2 * i + 1;
-            tileCnt = IO::loadSpriteB( SPR_PKMN_START_OAM_SUB + 30 + pos, tileCnt, 72, 51 + 36 * i,
-                                       32, 32, NoPkmnPal, NoPkmnTiles, NoPkmnTilesLen, false, false,
-                                       true, OBJPRIORITY_1, true );
+            u8 pos = 2 * i + 1;
+            IO::loadSpriteB( SPR_PKMN_START_OAM_SUB + 30 + pos, _placeholderTile, 72, 51 + 36 * i,
+                             32, 32, (const unsigned short*) nullptr, 0, false, false, true,
+                             OBJPRIORITY_1, true );
+        }
+
+        IO::SPRITE_ALLOCATOR[ true ].init( tileCnt );
+        std::memset( _iconAssets, IO::NO_SPRITE_ASSET, sizeof( _iconAssets ) );
+    }
+
+    void boxUI::drawPlaceholderIcon( u8 p_index, ObjPriority p_priority ) {
+        SpriteEntry* oam = IO::Oam->oamBuffer;
+        u8           spr = SPR_PKMN_START_OAM_SUB + p_index;
+
+        IO::SPRITE_ALLOCATOR[ true ].release( _iconAssets[ p_index ] );
+        _iconAssets[ p_index ] = IO::NO_SPRITE_ASSET;
+        IO::loadSpriteB( spr, _placeholderTile, oam[ spr ].x, oam[ spr ].y, 32, 32,
+                         (const unsigned short*) nullptr, 0, false, false, false, p_priority,
+                         true );
+    }
+
+    void boxUI::drawPkmnIcon( boxPokemon* p_pokemon, u8 p_index, ObjPriority p_priority ) {
+        SpriteEntry* oam   = IO::Oam->oamBuffer;
+        auto&        tiles = IO::SPRITE_ALLOCATOR[ true ];
+        u8           spr   = SPR_PKMN_START_OAM_SUB + p_index;
+
+        tiles.release( _iconAssets[ p_index ] );
+        _iconAssets[ p_index ] = IO::NO_SPRITE_ASSET;
+
+        if( p_pokemon == nullptr || !p_pokemon->getSpecies( ) ) {
+            oam[ spr ].isHidden = true;
+            oam[ spr ].priority = p_priority;
+            return;
+        }
+
+        pkmnSpriteInfo pinfo = p_pokemon->getSpriteInfo( );
+        if( p_pokemon->isEgg( ) ) {
+            // same as IO::loadEggIconB
+            pinfo = { 0, u8( 1 + ( p_pokemon->getSpecies( ) == PKMN_MANAPHY ) ), false, false,
+                      false, DEFAULT_SPRITE_PID };
+        }
+
+        bool fresh = false;
+        // 32x32 bitmap sprites take 16 units
+        u8 asset = tiles.acquire( IO::pkmnIconKey( pinfo ), 16, fresh );
+        if( asset == IO::NO_SPRITE_ASSET ) {
+            drawPlaceholderIcon( p_index, p_priority );
+            return;
+        }
+        if( fresh ) {
+            if( !IO::loadPKMNIconB( pinfo, oam[ spr ].x, oam[ spr ].y, spr, tiles.tile( asset ),
+                                    true ) ) {
+                tiles.release( asset, false );
+                drawPlaceholderIcon( p_index, p_priority );
+                return;
+            }
+            // remember whether the icon needs to be flipped
+            tiles.data( asset ) = oam[ spr ].vFlip;
+        } else {
+            IO::loadSpriteB( spr, tiles.tile( asset ), oam[ spr ].x, oam[ spr ].y, 32, 32,
+                             (const unsigned short*) nullptr, 0, tiles.data( asset ), false,
+                             false, p_priority, true );
         }
+        _iconAssets[ p_index ] = asset;
+        oam[ spr ].priority    = p_priority;
     }
 
     std::vector<boxUI::interact> boxUI::getInteractions( ) {
@@ -296,7 +360,6 @@ namespace BOX {
         if( !_heldPkmn.getSpecies( ) ) { drawPkmnInfoTop( 0 ); }
         IO::regularFont->setColor( IO::WHITE_IDX, 1 );
         IO::regularFont->setColor( IO::GRAY_IDX, 2 );
-        SpriteEntry* oam = IO::Oam->oamBuffer;
 
         FS::readPictureData( bgGetGfxPtr( IO::bg3sub ), "nitro:/PICS/BOX/",
                              std::to_string( p_box->m_wallpaper % MAX_WALLPAPERS ).c_str( ), 128,
@@ -309,13 +372,9 @@ namespace BOX {
         // Load some placeholder
         for( u8 i = 0; i < MAX_PKMN_PER_BOX; ++i ) {
             if( p_box->m_pokemon[ i ].getSpecies( ) ) {
-                IO::loadSpriteB(
-                    SPR_PKMN_START_OAM_SUB + i, oam[ SPR_PKMN_START_OAM_SUB + i ].gfxIndex,
-                    oam[ SPR_PKMN_START_OAM_SUB + i ].x, oam[ SPR_PKMN_START_OAM_SUB + i ].y, 32,
-                    32, NoPkmnPal, NoPkmnTiles, NoPkmnTilesLen, false, false, false, OBJPRIORITY_3,
-                    true );
+                drawPlaceholderIcon( i, OBJPRIORITY_3 );
             } else {
-                oam[ SPR_PKMN_START_OAM_SUB + i ].isHidden = true;
+                drawPkmnIcon( nullptr, i, OBJPRIORITY_3 );
             }
         }
         IO::updateOAM( true );
@@ -324,22 +383,7 @@ namespace BOX {
         IO::regularFont->printStringC( p_box->m_name, 94, 6, true, IO::font::CENTER );
 
         for( u8 i = 0; i < MAX_PKMN_PER_BOX; ++i ) {
-            if( p_box->m_pokemon[ i ].getSpecies( ) ) {
-                if( !p_box->m_pokemon[ i ].isEgg( ) ) {
-                    IO::loadPKMNIconB(
-                        ( *p_box )[ i ].getSpriteInfo( ), oam[ SPR_PKMN_START_OAM_SUB + i ].x,
-                        oam[ SPR_PKMN_START_OAM_SUB + i ].y, SPR_PKMN_START_OAM_SUB + i,
-                        oam[ SPR_PKMN_START_OAM_SUB + i ].gfxIndex, true );
-                } else {
-                    IO::loadEggIconB(
-                        oam[ SPR_PKMN_START_OAM_SUB + i ].x, oam[ SPR_PKMN_START_OAM_SUB + i ].y,
-                        SPR_PKMN_START_OAM_SUB + i, oam[ SPR_PKMN_START_OAM_SUB + i ].gfxIndex,
-                        true, p_box->m_pokemon[ i ].getSpecies( ) == PKMN_MANAPHY );
-                }
-            } else {
-                oam[ SPR_PKMN_START_OAM_SUB + i ].isHidden = true;
-            }
-            oam[ SPR_PKMN_START_OAM_SUB + i ].priority = OBJPRIORITY_3;
+            drawPkmnIcon( &p_box->m_pokemon[ i ], i, OBJPRIORITY_3 );
         }
 
         IO::updateOAM( true );
@@ -813,28 +857,8 @@ namespace BOX {
     }
 
     void boxUI::updatePkmn( boxPokemon* p_pokemon, u8 p_index ) {
-        SpriteEntry* oam = IO::Oam->oamBuffer;
-        if( p_pokemon != nullptr && p_pokemon->getSpecies( ) ) {
-            if( !p_pokemon->isEgg( ) ) {
-                IO::loadPKMNIconB(
-                    p_pokemon->getSpriteInfo( ), oam[ SPR_PKMN_START_OAM_SUB + p_index ].x,
-                    oam[ SPR_PKMN_START_OAM_SUB + p_index ].y, SPR_PKMN_START_OAM_SUB + p_index,
-                    oam[ SPR_PKMN_START_OAM_SUB + p_index ].gfxIndex, true );
-            } else {
-                IO::loadEggIconB( oam[ SPR_PKMN_START_OAM_SUB + p_index ].x,
-                                  oam[ SPR_PKMN_START_OAM_SUB + p_index ].y,
-                                  SPR_PKMN_START_OAM_SUB + p_index,
-                                  oam[ SPR_PKMN_START_OAM_SUB + p_index ].gfxIndex, true,
-                                  p_pokemon->getSpecies( ) == PKMN_MANAPHY );
-            }
-        } else {
-            oam[ SPR_PKMN_START_OAM_SUB + p_index ].isHidden = true;
-        }
-        if( p_index >= MAX_PKMN_PER_BOX ) {
-            oam[ SPR_PKMN_START_OAM_SUB + p_index ].priority = OBJPRIORITY_1;
-        } else {
-            oam[ SPR_PKMN_START_OAM_SUB + p_index ].priority = OBJPRIORITY_3;
-        }
+        drawPkmnIcon( p_pokemon, p_index,
+                      p_index >= MAX_PKMN_PER_BOX ? OBJPRIORITY_1 : OBJPRIORITY_3 );
         if( p_index == _currentSelection ) { selectPkmn( p_pokemon, p_index ); }
         IO::updateOAM( true );
     }
@@ -904,13 +928,9 @@ namespace BOX {
         // Load some placeholder
         for( u8 i = MAX_PKMN_PER_BOX; i < MAX_PKMN_PER_BOX + p_partyLen; ++i ) {
             if( p_party[ i - MAX_PKMN_PER_BOX ].getSpecies( ) ) {
-                IO::loadSpriteB(
-                    SPR_PKMN_START_OAM_SUB + i, oam[ SPR_PKMN_START_OAM_SUB + i ].gfxIndex,
-                    oam[ SPR_PKMN_START_OAM_SUB + i ].x, oam[ SPR_PKMN_START_OAM_SUB + i ].y, 32,
-                    32, NoPkmnPal, NoPkmnTiles, NoPkmnTilesLen, false, false, false, OBJPRIORITY_1,
-                    true );
+                drawPlaceholderIcon( i, OBJPRIORITY_1 );
             } else {
-                oam[ SPR_PKMN_START_OAM_SUB + i ].isHidden = true;
+                drawPkmnIcon( nullptr, i, OBJPRIORITY_1 );
             }
         }
         oam[ SPR_PARTY_TEXT_OAM_SUB ].isHidden     = true;
@@ -918,23 +938,7 @@ namespace BOX {
         IO::updateOAM( true );
 
         for( u8 i = MAX_PKMN_PER_BOX; i < MAX_PKMN_PER_BOX + p_partyLen; ++i ) {
-            if( p_party[ i - MAX_PKMN_PER_BOX ].getSpecies( ) ) {
-                if( !p_party[ i - MAX_PKMN_PER_BOX ].isEgg( ) ) {
-                    IO::loadPKMNIconB( p_party[ i - MAX_PKMN_PER_BOX ].getSpriteInfo( ),
-                                       oam[ SPR_PKMN_START_OAM_SUB + i ].x,
-                                       oam[ SPR_PKMN_START_OAM_SUB + i ].y,
-                                       SPR_PKMN_START_OAM_SUB + i,
-                                       oam[ SPR_PKMN_START_OAM_SUB + i ].gfxIndex, true );
-                } else {
-                    IO::loadEggIconB(
-                        oam[ SPR_PKMN_START_OAM_SUB + i ].x, oam[ SPR_PKMN_START_OAM_SUB + i ].y,
-                        SPR_PKMN_START_OAM_SUB + i, oam[ SPR_PKMN_START_OAM_SUB + i ].gfxIndex,
-                        true, p_party[ i - MAX_PKMN_PER_BOX ].getSpecies( ) == PKMN_MANAPHY );
-                }
-            } else {
-                oam[ SPR_PKMN_START_OAM_SUB + i ].isHidden = true;
-            }
-            oam[ SPR_PKMN_START_OAM_SUB + i ].priority = OBJPRIORITY_1;
+            drawPkmnIcon( &p_party[ i - MAX_PKMN_PER_BOX ].m_boxdata, i, OBJPRIORITY_1 );
         }
         IO::updateOAM( true );
     }
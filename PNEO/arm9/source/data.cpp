@@ -45,6 +45,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "gen/bgmNames.h"
 #include "gen/pokemonFormes.h"
 #include "io/uio.h"
+#include "map/mapBattleFacilityPool.h"
 #include "map/mapDrawer.h"
 #include "pokemon.h"
 
@@ -577,13 +578,15 @@ namespace FS {
     }
 
     BATTLE::battleTrainer getBattleTrainer( u16 p_battleTrainerId, u8 p_language ) {
-        BATTLE::battleTrainer res = BATTLE::battleTrainer( );
-        if( getBattleTrainer( p_battleTrainerId, p_language, &res ) ) { return res; }
-        getBattleTrainer( 0, p_language, &res );
+        BATTLE::battleTrainer res        = BATTLE::battleTrainer( );
+        u8                    difficulty = SAVE::SAV.getActiveFile( ).m_options.getDifficulty( );
+        if( getBattleTrainer( p_battleTrainerId, p_language, &res, difficulty ) ) { return res; }
+        getBattleTrainer( 0, p_language, &res, difficulty );
         return res;
     }
 
-    bool getBattleTrainer( u16 p_battleTrainerId, u8 p_language, BATTLE::battleTrainer* p_out ) {
+    bool getBattleTrainer( u16 p_battleTrainerId, u8 p_language, BATTLE::battleTrainer* p_out,
+                           u8 p_difficulty, u8* p_directory ) {
         static u8    lastLang = -1;
         static FILE* namefile = nullptr;
         static FILE* msg1file = nullptr;
@@ -609,13 +612,14 @@ namespace FS {
             return false;
         }
 
-        FILE* f = openSplit(
-            BATTLE_TRAINER_PATHS[ SAVE::SAV.getActiveFile( ).m_options.getDifficulty( ) / 3 ],
-            p_battleTrainerId, ".trnr.data" );
-        if( !f && SAVE::SAV.getActiveFile( ).m_options.getDifficulty( ) != 3 ) {
-            f = openSplit( BATTLE_TRAINER_PATHS[ 1 ], p_battleTrainerId, ".trnr.data" );
+        u8    dir = p_difficulty / 3;
+        FILE* f   = openSplit( BATTLE_TRAINER_PATHS[ dir ], p_battleTrainerId, ".trnr.data" );
+        if( !f && p_difficulty != 3 ) {
+            dir = 1;
+            f   = openSplit( BATTLE_TRAINER_PATHS[ dir ], p_battleTrainerId, ".trnr.data" );
         }
         if( !f ) { return false; }
+        if( p_directory ) { *p_directory = dir; }
         fread( &p_out->m_data, sizeof( BATTLE::trainerData ), 1, f );
         fclose( f );
         return true;
@@ -632,46 +636,54 @@ namespace FS {
         return true;
     }
 
+    u16 loadBattleFacilitySets( u8 p_tier, MAP::facilitySet* p_out, u16 p_maxCount ) {
+        FILE* f = open( BATTLE_FACILITY_PKMN_PATH, p_tier, ".sets.data" );
+        if( !f ) { return 0; }
+
+        // files of a different version or with a wrong size would yield garbage sets
+        MAP::facilitySetsHeader header;
+        u16                     count = 0;
+        if( fread( &header, sizeof( header ), 1, f ) == 1
+            && header.m_magic == MAP::FACILITY_SETS_MAGIC
+            && header.m_version == MAP::FACILITY_SETS_VERSION && header.m_count <= p_maxCount
+            && !std::fseek( f, 0, SEEK_END )
+            && std::ftell( f )
+                   == long( sizeof( header ) + header.m_count * sizeof( MAP::facilitySet ) )
+            && !std::fseek( f, sizeof( header ), SEEK_SET ) ) {
+            count = fread( p_out, sizeof( MAP::facilitySet ), header.m_count, f );
+            if( count != header.m_count ) { count = 0; }
+        }
+        fclose( f );
+        return count;
+    }
+
     bool loadBattleFacilityPkmn( u16 p_species, u8 p_variant, u8 p_level, u16 p_streak,
                                  trainerPokemon* p_out ) {
-        u16 streak = p_streak >= MAP::IV_MAX_STREAK ? MAP::IV_MAX_STREAK - 1 : p_streak;
-        u8  iv     = MAP::IV_FOR_STREAK[ streak ];
-
-        // TODO: actually load these pkmn from ROM
-        p_out->m_speciesId  = p_species;
-        p_out->m_forme      = 0;
-        p_out->m_ability    = 0;
-        p_out->m_heldItem   = 0;
-        p_out->m_moves[ 0 ] = 1;
-        p_out->m_moves[ 1 ] = 0;
-        p_out->m_moves[ 2 ] = 0;
-        p_out->m_moves[ 3 ] = 0;
-        p_out->m_ev[ 0 ]    = 0;
-        p_out->m_ev[ 1 ]    = 0;
-        p_out->m_ev[ 2 ]    = 0;
-        p_out->m_ev[ 3 ]    = 0;
-        p_out->m_ev[ 4 ]    = 0;
-        p_out->m_ev[ 5 ]    = 0;
-        p_out->m_shiny      = 0;
-        p_out->m_nature     = 0;
-
-        // adjust pkmn to given parameters
-        p_out->m_level   = p_level;
-        p_out->m_iv[ 0 ] = p_out->m_iv[ 1 ] = p_out->m_iv[ 2 ] = iv;
-        p_out->m_iv[ 3 ] = p_out->m_iv[ 4 ] = p_out->m_iv[ 5 ] = iv;
+        auto& pool = MAP::FACILITY_POOL;
+        if( !pool.load( MAP::getFacilityTierForStreak( p_streak ) ) ) {
+            // no sets for this tier in the ROM, use a placeholder set
+            u16 streak = p_streak >= MAP::IV_MAX_STREAK ? MAP::IV_MAX_STREAK - 1 : p_streak;
+            std::memset( p_out, 0, sizeof( trainerPokemon ) );
+            p_out->m_speciesId  = p_species;
+            p_out->m_moves[ 0 ] = 1;
+            p_out->m_level      = p_level;
+            std::memset( p_out->m_iv, MAP::IV_FOR_STREAK[ streak ], sizeof( p_out->m_iv ) );
+            return true;
+        }
 
+        u16 set = pool.find( p_species, p_variant );
+        if( set == MAP::NO_FACILITY_SET ) { return false; }
+        pool.createPkmn( set, p_level, p_streak, p_out );
         return true;
     }
 
     bool loadBattleFacilityTrainerTeam( const MAP::ruleSet& p_rules, u8 p_trainerClass, u8 p_team,
                                         u16 p_streak, BATTLE::battleTrainer* p_out ) {
-        (void) p_rules;
-        (void) p_trainerClass;
-        (void) p_team;
-        (void) p_streak;
-        (void) p_out;
-        // TODO
-        return false;
+        // the teams of the trainer classes are fixed: they are drawn from the pool of the
+        // streak's tier with a seed that depends only on the team
+        BATTLE::battleRandom rng( ( u32( p_trainerClass ) << 16 ) | ( u32( p_team ) << 8 )
+                                  | MAP::getFacilityTierForStreak( p_streak ) );
+        return MAP::FACILITY_POOL.drawTeam( p_rules, p_streak, p_out->m_data, rng );
     }
 
 #ifndef NO_SOUND
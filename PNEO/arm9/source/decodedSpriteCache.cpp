@@ -0,0 +1,124 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : decodedSpriteCache.cpp
+author      : Philip Wellnitz
+description : Cache of decoded pkmn sprites in main RAM.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "io/decodedSpriteCache.h"
+#include "io/message.h"
+
+namespace IO {
+    decodedSpriteCache DECODED_SPRITE_CACHE;
+
+    bool decodedSpriteCache::_evict( ) {
+        u8 victim = DECODED_SPRITE_CACHE_ENTRIES;
+        for( u8 i = 0; i < DECODED_SPRITE_CACHE_ENTRIES; ++i ) {
+            const auto& e = _entries[ i ];
+            if( !e.m_data ) { continue; }
+            if( victim == DECODED_SPRITE_CACHE_ENTRIES
+                || u16( _clock - e.m_lastUse ) > u16( _clock - _entries[ victim ].m_lastUse ) ) {
+                victim = i;
+            }
+        }
+        if( victim == DECODED_SPRITE_CACHE_ENTRIES ) { return false; }
+#ifdef DESQUID
+        _evictions++;
+#endif
+        auto& e = _entries[ victim ];
+        _usedBytes -= e.m_size * sizeof( u32 );
+        std::free( e.m_data );
+        e.m_data = nullptr;
+        return true;
+    }
+
+    bool decodedSpriteCache::load( u64 p_key, u16 p_size ) {
+        ++_clock;
+        for( u8 i = 0; i < DECODED_SPRITE_CACHE_ENTRIES; ++i ) {
+            auto& e = _entries[ i ];
+            if( !e.m_data || e.m_key != p_key || e.m_size != p_size ) { continue; }
+#ifdef DESQUID
+            _hits++;
+#endif
+            e.m_lastUse = _clock;
+            std::memcpy( TEMP, e.m_data, p_size * sizeof( u32 ) );
+            std::memcpy( TEMP_PAL, e.m_palette, sizeof( e.m_palette ) );
+            return true;
+        }
+#ifdef DESQUID
+        _misses++;
+#endif
+        return false;
+    }
+
+    void decodedSpriteCache::store( u64 p_key, u16 p_size ) {
+        u32 bytes = p_size * sizeof( u32 );
+        if( !p_size || bytes > DECODED_SPRITE_CACHE_BYTES ) { return; }
+
+        u8 slot = DECODED_SPRITE_CACHE_ENTRIES;
+        while( true ) {
+            if( _usedBytes + bytes <= DECODED_SPRITE_CACHE_BYTES ) {
+                for( u8 i = 0; i < DECODED_SPRITE_CACHE_ENTRIES; ++i ) {
+                    if( !_entries[ i ].m_data ) {
+                        slot = i;
+                        break;
+                    }
+                }
+                if( slot != DECODED_SPRITE_CACHE_ENTRIES ) { break; }
+            }
+            if( !_evict( ) ) { return; }
+        }
+
+        auto& e  = _entries[ slot ];
+        e.m_data = static_cast<u32*>( std::malloc( bytes ) );
+        if( !e.m_data ) { return; }
+        e.m_key     = p_key;
+        e.m_size    = p_size;
+        e.m_lastUse = _clock;
+        std::memcpy( e.m_data, TEMP, bytes );
+        std::memcpy( e.m_palette, TEMP_PAL, sizeof( e.m_palette ) );
+        _usedBytes += bytes;
+    }
+
+#ifdef DESQUID
+    void decodedSpriteCache::printStats( ) const {
+        u8 count = 0;
+        for( u8 i = 0; i < DECODED_SPRITE_CACHE_ENTRIES; ++i ) {
+            if( _entries[ i ].m_data ) { count++; }
+        }
+        u32 lookups = _hits + _misses;
+
+        char buffer[ 150 ];
+        snprintf( buffer, 149,
+                  "%hhu sprites, %lu of %lu bytes\nHits: %lu Misses: %lu (%lu%% hits)\nEvicted: "
+                  "%lu",
+                  count, _usedBytes, DECODED_SPRITE_CACHE_BYTES, _hits, _misses,
+                  lookups ? _hits * 100 / lookups : 0, _evictions );
+        IO::printMessage( buffer, MSG_INFO );
+    }
+#endif
+} // namespace IO
@@ -25,22 +25,36 @@ You should have received a copy of the GNU General Public License
 along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <cstring>
+
 #include <nds.h>
 #include <nds/ndstypes.h>
 
 #include "defines.h"
+#include "fs/data.h"
+#include "io/backBuffer.h"
 #include "io/font.h"
+#include "io/message.h"
+#include "io/stringAtlas.h"
 #include "io/uio.h"
+#include "prof/profiler.h"
 #include "save/saveGame.h"
 
 namespace IO {
     u16 TMPBUF[ 256 * 64 ] = { 0 };
 
-    font::font( u8 *p_data, u8 *p_widths, void ( *p_shiftchar )( u16 &val ) ) {
+    // scratch buffers of the layout methods; no layout allocates
+    u16               LAYOUT_CHARS[ MAX_LAYOUT_CHARS ];
+    textLayout::glyph LAYOUT_GLYPHS[ MAX_LAYOUT_CHARS ];
+
+    font::font( const packedGlyph *p_glyphs, const u8 *p_data, u8 *p_widths,
+                const u16 *const *p_charPages ) {
+        _glyphs     = p_glyphs;
         _data       = p_data;
         _widths     = p_widths;
         _color[ 0 ] = _color[ 1 ] = _color[ 2 ] = _color[ 3 ] = _color[ 4 ] = WHITE;
-        _shiftchar                                                          = p_shiftchar;
+        _charPages                                                          = p_charPages;
     }
 
     void font::_charDelay( ) const {
@@ -50,6 +64,18 @@ namespace IO {
             swiWaitForVBlank( );
     }
 
+    void font::_unpackRow( u16 p_ch, u8 p_row, u8 *p_out ) const {
+        const auto &g = _glyphs[ p_ch ];
+        std::memset( p_out, 0, _widths[ p_ch ] );
+        if( p_row < g.m_top || p_row >= g.m_top + g.m_height ) { return; }
+
+        u32 bit = 8 * g.m_offset + ( p_row - g.m_top ) * g.m_width * GLYPH_BPP;
+        for( u8 x = 0; x < g.m_width; ++x, bit += GLYPH_BPP ) {
+            u16 word = _data[ bit >> 3 ] | ( _data[ ( bit >> 3 ) + 1 ] << 8 );
+            p_out[ g.m_left + x ] = ( word >> ( bit & 7 ) ) & ( ( 1 << GLYPH_BPP ) - 1 );
+        }
+    }
+
     u32 font::stringWidth( const char *p_string, u8 p_charShift ) const {
         u32 current_char = 0;
         u32 width        = 0;
@@ -127,19 +153,255 @@ namespace IO {
         return stringMaxWidth( p_string, p_maxWidth, p_breakChar, 1 );
     }
 
+    void font::_layout( textLayout &p_out, const char *p_string,
+                        const textLayout::params &p_params ) const {
+        p_out.m_glyphCount = 0;
+        p_out.m_lines      = 0;
+
+        // shift every char exactly once, measuring a line only looks up widths
+        u32 len = std::strlen( p_string );
+        DESQUID_ASSERT( len <= MAX_LAYOUT_CHARS, "String too long to lay out" );
+        len        = std::min( len, u32( MAX_LAYOUT_CHARS ) );
+        u16 *chars = LAYOUT_CHARS;
+        for( u32 i = 0; i < len; ++i ) {
+            chars[ i ] = (u16) p_string[ i ];
+            _shiftchar( chars[ i ] );
+        }
+
+        // same rules as stringWidth (no max width) and stringMaxWidth
+        auto measure = [ & ]( u32 p_start ) -> s16 {
+            u32  width = 0, lastBreak = 0;
+            bool sp = false;
+            for( u32 i = p_start; i < len; ++i ) {
+                if( p_string[ i ] == '\n' ) { break; }
+                if( p_string[ i ] == '[' ) {
+                    sp = true;
+                    continue;
+                }
+                if( p_string[ i ] == ']' ) {
+                    sp = false;
+                    width += 16 - p_params.m_charShift;
+                    continue;
+                }
+                if( sp ) { continue; }
+                if( !p_params.m_maxWidth ) {
+                    width += _widths[ chars[ i ] ] - p_params.m_charShift;
+                    continue;
+                }
+                if( p_string[ i ] == p_params.m_breakChar ) { lastBreak = width; }
+                width += _widths[ chars[ i ] ] - p_params.m_charShift;
+                if( width >= u16( p_params.m_maxWidth ) ) { return lastBreak; }
+            }
+            return width;
+        };
+
+        s16  lineX = 0, putY = 0;
+        s16  lineWd    = measure( 0 );
+        auto lineStart = [ & ]( ) -> s16 {
+            if( p_params.m_boxWidth ) {
+                if( p_params.m_alignment == RIGHT ) { return p_params.m_boxWidth - lineWd; }
+                if( p_params.m_alignment == CENTER ) {
+                    return ( p_params.m_boxWidth - lineWd ) / 2;
+                }
+                return 0;
+            }
+            if( p_params.m_alignment == RIGHT ) { return lineX - lineWd; }
+            if( p_params.m_alignment == CENTER ) { return lineX - lineWd / 2; }
+            return lineX;
+        };
+        auto addLine = [ & ]( ) {
+            if( p_out.m_lines < MAX_LAYOUT_LINES ) {
+                p_out.m_lineWidths[ p_out.m_lines ] = lineWd;
+            }
+            p_out.m_lines++;
+        };
+        s16 putX = lineStart( );
+        addLine( );
+
+        auto addGlyph = [ & ]( u16 p_ch, bool p_delay ) {
+            if( p_out.m_glyphCount < p_out.m_capacity ) {
+                p_out.m_glyphs[ p_out.m_glyphCount++ ] = { p_ch, putX, putY, p_delay };
+            }
+            putX += _widths[ p_ch ] - p_params.m_charShift;
+            lineWd -= _widths[ p_ch ] - p_params.m_charShift;
+        };
+
+        bool sp   = false; // special character
+        u16  spch = 0;
+        for( u32 i = 0; i < len && ( !p_params.m_boxWidth || putX < p_params.m_boxWidth ); ++i ) {
+            if( ( p_params.m_maxWidth && lineWd <= 0 ) || p_string[ i ] == '\n' ) {
+                putY += p_params.m_yDistance;
+                lineX -= p_params.m_adjustX;
+                lineWd = measure( i + 1 );
+                putX   = lineStart( );
+                addLine( );
+                continue;
+            }
+            if( p_string[ i ] == '[' ) {
+                sp   = true;
+                spch = 0;
+                continue;
+            }
+            if( p_string[ i ] == ']' ) {
+                sp = false;
+                addGlyph( spch, false );
+                continue;
+            }
+            if( sp ) {
+                spch *= 10;
+                spch += ( p_string[ i ] - '0' );
+                continue;
+            }
+            addGlyph( chars[ i ], true );
+        }
+    }
+
+    textLayout font::layoutString( const char *p_string, s16 p_maxWidth, alignment p_alignment,
+                                   u8 p_yDistance, char p_breakChar, s8 p_adjustX,
+                                   u8 p_charShift ) const {
+        textLayout res( LAYOUT_GLYPHS, MAX_LAYOUT_CHARS );
+        _layout( res, p_string,
+                 { p_maxWidth, 0, u8( p_alignment ), p_yDistance, p_breakChar, p_adjustX,
+                   p_charShift } );
+        return res;
+    }
+
+    textLayout font::layoutStringB( const char *p_string, u16 p_bufferWidth,
+                                    alignment p_alignment, u8 p_yDistance, u8 p_charShift,
+                                    u16 p_rightPadding ) const {
+        textLayout res( LAYOUT_GLYPHS, MAX_LAYOUT_CHARS );
+        u16        lineSpace = p_bufferWidth - p_rightPadding;
+        _layout( res, p_string,
+                 { s16( lineSpace ), lineSpace, u8( p_alignment ), p_yDistance, ' ', 0,
+                   p_charShift } );
+        return res;
+    }
+
+    constexpr u8  LAYOUT_CACHE_SIZE   = 8;
+    constexpr u16 LAYOUT_CACHE_GLYPHS = 256; // longer strings aren't cached
+
+    struct layoutCacheEntry {
+        const font        *m_font;
+        u16                m_id;
+        u32                m_length;
+        u32                m_checksum;
+        u32                m_lastUse;
+        textLayout::params m_params;
+        textLayout         m_layout;
+        textLayout::glyph  m_glyphs[ LAYOUT_CACHE_GLYPHS ];
+    };
+    layoutCacheEntry LAYOUT_CACHE[ LAYOUT_CACHE_SIZE ];
+    u32              LAYOUT_CACHE_TIME = 0;
+    textLayout       UNCACHED_LAYOUT;
+
+    const textLayout &font::cachedLayout( const char *p_string, u16 p_id, s16 p_maxWidth,
+                                          alignment p_alignment, u8 p_yDistance,
+                                          char p_breakChar, s8 p_adjustX,
+                                          u8 p_charShift ) const {
+        textLayout::params params
+            = { p_maxWidth, 0, u8( p_alignment ), p_yDistance, p_breakChar, p_adjustX,
+                p_charShift };
+
+        // Strings are mostly obtained via GET_STRING and friends, which reuse the same
+        // buffer for all strings, so the contents need to be compared, too (FNV-1a).
+        u32 length = 0, checksum = 2166136261;
+        for( ; p_string[ length ]; ++length ) {
+            checksum = ( checksum ^ u8( p_string[ length ] ) ) * 16777619;
+        }
+        if( length > LAYOUT_CACHE_GLYPHS ) {
+            UNCACHED_LAYOUT = textLayout( LAYOUT_GLYPHS, MAX_LAYOUT_CHARS );
+            _layout( UNCACHED_LAYOUT, p_string, params );
+            return UNCACHED_LAYOUT;
+        }
+
+        layoutCacheEntry *victim = &LAYOUT_CACHE[ 0 ];
+        for( u8 i = 0; i < LAYOUT_CACHE_SIZE; ++i ) {
+            auto &e = LAYOUT_CACHE[ i ];
+            if( e.m_font == this && e.m_id == p_id && e.m_length == length
+                && e.m_checksum == checksum && e.m_params == params ) {
+                e.m_lastUse = ++LAYOUT_CACHE_TIME;
+                return e.m_layout;
+            }
+            if( e.m_lastUse < victim->m_lastUse ) { victim = &e; }
+        }
+
+        victim->m_font     = this;
+        victim->m_id       = p_id;
+        victim->m_length   = length;
+        victim->m_checksum = checksum;
+        victim->m_params   = params;
+        victim->m_lastUse  = ++LAYOUT_CACHE_TIME;
+        victim->m_layout   = textLayout( victim->m_glyphs, LAYOUT_CACHE_GLYPHS );
+        _layout( victim->m_layout, p_string, params );
+        return victim->m_layout;
+    }
+
     u16 font::printChar( u16 p_ch, s16 p_x, s16 p_y, bool p_bottom, u8 p_layer,
                          bool p_shift ) const {
         if( p_shift ) { _shiftchar( p_ch ); }
+        if( p_layer == u8( -1 ) ) { return _widths[ p_ch ]; }
+
+        s16 fromX = std::max( p_x, s16( 0 ) );
+        s16 toX   = std::min( s16( p_x + _widths[ p_ch ] ), s16( SCREEN_WIDTH ) );
+        if( fromX >= toX ) { return _widths[ p_ch ]; }
+
+        // The 8bpp bitmap layers only allow 16 and 32 bit writes, so each glyph row is
+        // composed into a copy of the affected words of the target line, which is then
+        // written back as a whole.
+        u16  firstWord = fromX >> 2, wordCnt = ( ( toX + 3 ) >> 2 ) - firstWord;
+        u32  span[ FONT_WIDTH / 4 + 1 ];
+        u8  *spanPx = reinterpret_cast<u8 *>( span ) - 4 * firstWord;
+        u8   row[ FONT_WIDTH ];
+
+        // with a transparent background, only the glyph's bounding box needs to be drawn
+        s16 fromY = _color[ 0 ] ? 0 : _glyphs[ p_ch ].m_top;
+        s16 toY   = _color[ 0 ] ? FONT_HEIGHT : fromY + _glyphs[ p_ch ].m_height;
+        if( p_y + fromY < 0 ) { fromY = -p_y; }
+        if( p_y + toY > 256 ) { toY = 256 - p_y; }
+        if( fromY >= toY ) { return _widths[ p_ch ]; }
+
+        u32 *bmp = reinterpret_cast<u32 *>(
+            BACK_BUFFER.bitmap( p_bottom, p_layer, fromX, p_y + fromY, toX - 1, p_y + toY - 1 ) );
+
+        for( s16 getY = fromY; getY < toY; ++getY ) {
+            _unpackRow( p_ch, getY, row );
+
+            u32 *line = bmp + ( p_y + getY ) * ( SCREEN_WIDTH / 4 ) + firstWord;
+            for( u8 i = 0; i < wordCnt; ++i ) { span[ i ] = line[ i ]; }
+
+            bool changed = false;
+            for( s16 putX = fromX; putX < toX; ++putX ) {
+                u8 clr = _color[ row[ putX - p_x ] ];
+                if( clr ) {
+                    spanPx[ putX ] = clr;
+                    changed        = true;
+                }
+            }
+            if( changed ) {
+                for( u8 i = 0; i < wordCnt; ++i ) { line[ i ] = span[ i ]; }
+            }
+        }
+        return _widths[ p_ch ];
+    }
+
+#ifdef DESQUID
+    u16 font::printCharReference( u16 p_ch, s16 p_x, s16 p_y, bool p_bottom, u8 p_layer,
+                                  bool p_shift ) const {
+        if( p_shift ) { _shiftchar( p_ch ); }
 
         s16 putX, putY;
         u8  getX, getY;
-        u32 offset = p_ch * FONT_WIDTH * FONT_HEIGHT;
+        u8  row[ FONT_WIDTH ];
+
+        u8 fromY = _color[ 0 ] ? 0 : _glyphs[ p_ch ].m_top;
+        u8 toY   = _color[ 0 ] ? FONT_HEIGHT : fromY + _glyphs[ p_ch ].m_height;
 
         if( p_layer != u8( -1 ) ) {
-            for( putY = p_y, getY = 0; putY < p_y + FONT_HEIGHT; ++putY, ++getY ) {
+            for( putY = p_y + fromY, getY = fromY; getY < toY; ++putY, ++getY ) {
+                _unpackRow( p_ch, getY, row );
                 for( putX = p_x, getX = 0; putX < p_x + _widths[ p_ch ]; putX++, getX++ ) {
                     if( putX >= 0 && putX < SCREEN_WIDTH && putY >= 0 && putY < 256 ) {
-                        u8 clr = _color[ _data[ offset + ( getX + getY * FONT_WIDTH ) ] ];
+                        u8 clr = _color[ row[ getX ] ];
                         if( clr ) setPixel( putX, putY, p_bottom, clr, p_layer );
                     }
                 }
@@ -148,18 +410,72 @@ namespace IO {
         return _widths[ p_ch ];
     }
 
+    void font::benchmarkBlitter( bool p_bottom, u8 p_layer, u16 p_numChars ) const {
+        constexpr s16 POSITIONS[] = { 0, 1, 2, 3, -5, SCREEN_WIDTH - 7 };
+        constexpr u8  REF_Y = 8, SPAN_Y = 40;
+
+        u8 *bmp = reinterpret_cast<u8 *>( p_bottom ? BG_BMP_RAM_SUB( p_layer )
+                                                   : BG_BMP_RAM( p_layer ) );
+
+        // compare both renderers on a non-uniform background
+        u16 mismatches = 0;
+        for( u16 ch = 0; ch < p_numChars; ++ch ) {
+            for( auto x : POSITIONS ) {
+                for( u16 i = 0; i < 64 * SCREEN_WIDTH / 2; ++i ) {
+                    reinterpret_cast<u16 *>( bmp )[ i ] = 0x0201 + ( i & 0x0f0f );
+                }
+                printCharReference( ch, x, REF_Y, p_bottom, p_layer, false );
+                printChar( ch, x, SPAN_Y, p_bottom, p_layer, false );
+                // the background pattern repeats every 32 rows
+                if( std::memcmp( bmp + ( REF_Y - 4 ) * SCREEN_WIDTH,
+                                 bmp + ( SPAN_Y - 4 ) * SCREEN_WIDTH,
+                                 ( FONT_HEIGHT + 8 ) * SCREEN_WIDTH ) ) {
+                    ++mismatches;
+                }
+            }
+        }
+
+        // time both renderers
+        u32 start = PROF::ticks( );
+        for( u16 ch = 0; ch < p_numChars; ++ch ) {
+            printCharReference( ch, ch & 15, REF_Y, p_bottom, p_layer, false );
+        }
+        u32 refTicks = PROF::ticks( ) - start;
+
+        start = PROF::ticks( );
+        for( u16 ch = 0; ch < p_numChars; ++ch ) {
+            printChar( ch, ch & 15, SPAN_Y, p_bottom, p_layer, false );
+        }
+        u32 spanTicks = PROF::ticks( ) - start;
+
+        for( u16 i = 0; i < 64 * SCREEN_WIDTH / 2; ++i ) {
+            reinterpret_cast<u16 *>( bmp )[ i ] = 0;
+        }
+
+        // one tick of the profiling timer corresponds to 2 cpu cycles
+        char buffer[ 100 ];
+        snprintf( buffer, 99, "%hu glyphs, %hu mismatches\nsetPixel %lu, span %lu cyc/glyph",
+                  p_numChars, mismatches, 2 * refTicks / p_numChars, 2 * spanTicks / p_numChars );
+        printMessage( buffer, MSG_INFO );
+    }
+#endif
+
     u16 font::printCharB( u16 p_ch, const u16 *p_palette, u16 *p_buffer, u16 p_bufferWidth, s16 p_x,
                           s16 p_y, bool p_shift ) const {
         if( p_shift ) { _shiftchar( p_ch ); }
 
         s16 putX, putY;
         u16 getX, getY;
-        u32 offset = p_ch * FONT_WIDTH * FONT_HEIGHT;
+        u8  row[ FONT_WIDTH ];
 
-        for( putY = p_y, getY = 0; putY < p_y + FONT_HEIGHT; ++putY, ++getY ) {
+        u8 fromY = _color[ 0 ] ? 0 : _glyphs[ p_ch ].m_top;
+        u8 toY   = _color[ 0 ] ? FONT_HEIGHT : fromY + _glyphs[ p_ch ].m_height;
+
+        for( putY = p_y + fromY, getY = fromY; getY < toY; ++putY, ++getY ) {
+            _unpackRow( p_ch, getY, row );
             for( putX = p_x, getX = 0; putX < p_x + _widths[ p_ch ]; putX++, getX++ ) {
                 if( putX >= 0 && putX < p_bufferWidth ) {
-                    u8 clr = _color[ _data[ offset + ( getX + getY * FONT_WIDTH ) ] ];
+                    u8 clr = _color[ row[ getX ] ];
                     if( clr ) {
                         p_buffer[ p_bufferWidth * putY + putX ] = ( 1 << 15 ) | p_palette[ clr ];
                     }
@@ -197,67 +513,88 @@ namespace IO {
         }
     }
 
+    u16 font::printLayout( const textLayout &p_layout, s16 p_x, s16 p_y, bool p_bottom,
+                           bool p_delay, u8 p_layer ) const {
+        for( const auto &g : p_layout ) {
+            printChar( g.m_ch, p_x + g.m_x, p_y + g.m_y, p_bottom, p_layer, false );
+            if( p_delay && g.m_delay ) { _charDelay( ); }
+        }
+        return p_layout.m_lines;
+    }
+
     u16 font::printString( const char *p_string, s16 p_x, s16 p_y, bool p_bottom,
                            alignment p_alignment, u8 p_yDistance, s8 p_adjustX, u8 p_charShift,
                            bool p_delay, u8 p_layer ) const {
-        u32 current_char = 0;
-        s16 putX = p_x, putY = p_y;
-        u16 lines = 1;
-        if( p_alignment == RIGHT ) { putX = p_x - stringWidth( p_string, p_charShift ); }
-        if( p_alignment == CENTER ) { putX = p_x - stringWidth( p_string, p_charShift ) / 2; }
+        return printLayout(
+            layoutString( p_string, 0, p_alignment, p_yDistance, ' ', p_adjustX, p_charShift ),
+            p_x, p_y, p_bottom, p_delay, p_layer );
+    }
 
-        bool sp   = false; // special character
-        u16  spch = 0;
+    u16 font::printStringC( const char *p_string, s16 p_x, s16 p_y, bool p_bottom,
+                            alignment p_alignment, u8 p_yDistance, s8 p_adjustX, bool p_delay,
+                            u8 p_layer ) const {
+        return printString( p_string, p_x, p_y, p_bottom, p_alignment, p_yDistance, p_adjustX, 1,
+                            p_delay, p_layer );
+    }
 
-        while( p_string[ current_char ] ) {
-            if( p_string[ current_char ] == '\n' ) {
-                putY += p_yDistance;
-                putX = ( p_x -= p_adjustX );
-                if( p_alignment == RIGHT ) {
-                    putX = p_x - stringWidth( p_string + current_char + 1, p_charShift );
-                }
-                if( p_alignment == CENTER ) {
-                    putX = p_x - stringWidth( p_string + current_char + 1, p_charShift ) / 2;
+    void font::_rasterize( const textLayout &p_layout, u8 *p_buffer, u16 p_stride, s16 p_x,
+                           s16 p_y ) const {
+        u8 row[ FONT_WIDTH ];
+        for( const auto &g : p_layout ) {
+            u8 fromY = _color[ 0 ] ? 0 : _glyphs[ g.m_ch ].m_top;
+            u8 toY   = _color[ 0 ] ? FONT_HEIGHT : fromY + _glyphs[ g.m_ch ].m_height;
+            for( u8 getY = fromY; getY < toY; ++getY ) {
+                _unpackRow( g.m_ch, getY, row );
+                u8 *out = p_buffer + ( p_y + g.m_y + getY ) * p_stride + p_x + g.m_x;
+                for( u8 getX = 0; getX < _widths[ g.m_ch ]; ++getX ) {
+                    if( u8 clr = _color[ row[ getX ] ] ) { out[ getX ] = clr; }
                 }
-
-                current_char++;
-                lines++;
-                continue;
             }
-            if( p_string[ current_char ] == '[' ) {
-                sp   = true;
-                spch = 0;
-                current_char++;
-                continue;
-            }
-            if( p_string[ current_char ] == ']' ) {
-                sp = false;
-                putX += printChar( spch, putX, putY, p_bottom, p_layer, false ) - p_charShift;
-                current_char++;
-                continue;
-            }
-            if( sp ) {
-                spch *= 10;
-                spch += ( p_string[ current_char ] - '0' );
-                current_char++;
-                continue;
-            }
-
-            putX += printChar( p_string[ current_char ], putX, putY, p_bottom, p_layer )
-                    - p_charShift;
+        }
+    }
 
-            if( p_delay ) { _charDelay( ); }
+    u16 font::printStaticString( u16 p_stringId, s16 p_x, s16 p_y, bool p_bottom,
+                                 alignment p_alignment, u8 p_yDistance, u8 p_charShift,
+                                 u8 p_layer ) const {
+        textLayout::params params
+            = { 0, 0, u8( p_alignment ), p_yDistance, ' ', 0, p_charShift };
+
+        auto e = STRING_ATLAS.find( this, p_stringId, params, CURRENT_LANGUAGE );
+        if( e == nullptr ) {
+            textLayout layout( LAYOUT_GLYPHS, MAX_LAYOUT_CHARS );
+            _layout( layout, GET_STRING( p_stringId ), params );
+
+            // bounding box of everything printChar would draw
+            s16 x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+            for( const auto &g : layout ) {
+                s16 top = g.m_y + ( _color[ 0 ] ? 0 : _glyphs[ g.m_ch ].m_top );
+                s16 bot = _color[ 0 ] ? g.m_y + FONT_HEIGHT : top + _glyphs[ g.m_ch ].m_height;
+                if( !_widths[ g.m_ch ] || top >= bot ) { continue; }
+                if( x1 >= x2 ) {
+                    x1 = g.m_x, y1 = top, x2 = g.m_x + _widths[ g.m_ch ], y2 = bot;
+                    continue;
+                }
+                x1 = std::min( x1, g.m_x );
+                y1 = std::min( y1, top );
+                x2 = std::max( x2, s16( g.m_x + _widths[ g.m_ch ] ) );
+                y2 = std::max( y2, bot );
+            }
 
-            current_char++;
+            e = STRING_ATLAS.insert( this, p_stringId, params, x2 - x1, y2 - y1, x1, y1,
+                                     layout.m_lines );
+            if( e == nullptr ) { return printLayout( layout, p_x, p_y, p_bottom, false, p_layer ); }
+            _rasterize( layout, STRING_ATLAS.pixels( *e ), STRING_ATLAS_WIDTH, -x1, -y1 );
         }
-        return lines;
+
+        blit8Masked( STRING_ATLAS.pixels( *e ), STRING_ATLAS_WIDTH, p_x + e->m_offsetX,
+                     p_y + e->m_offsetY, e->m_width, e->m_height, p_bottom, p_layer );
+        return e->m_lines;
     }
 
-    u16 font::printStringC( const char *p_string, s16 p_x, s16 p_y, bool p_bottom,
-                            alignment p_alignment, u8 p_yDistance, s8 p_adjustX, bool p_delay,
-                            u8 p_layer ) const {
-        return printString( p_string, p_x, p_y, p_bottom, p_alignment, p_yDistance, p_adjustX, 1,
-                            p_delay, p_layer );
+    u16 font::printStaticStringC( u16 p_stringId, s16 p_x, s16 p_y, bool p_bottom,
+                                  alignment p_alignment, u8 p_yDistance, u8 p_layer ) const {
+        return printStaticString( p_stringId, p_x, p_y, p_bottom, p_alignment, p_yDistance, 1,
+                                  p_layer );
     }
 
     u16 font::printStringD( const char *p_string, s16 p_x, s16 p_y, bool p_bottom,
@@ -267,60 +604,12 @@ namespace IO {
                             p_charShift, true, p_layer );
     }
 
-    u16 font::printStringB( const char *p_string, const u16 *p_palette, u16 *p_buffer,
-                            u16 p_bufferWidth, alignment p_alignment, u8 p_yDistance,
-                            u8 p_charShift, u8 p_chunkSize, u16 p_bufferHeight,
-                            u16 p_rightPadding ) const {
-        u32 current_char = 0;
-        s16 putX = 0, putY = 0;
-        u16 lines     = 1;
-        u16 lineSpace = p_bufferWidth - p_rightPadding;
-        s16 lineWd    = stringMaxWidth( p_string, lineSpace, ' ', p_charShift );
-        if( p_alignment == RIGHT ) putX = lineSpace - lineWd;
-        if( p_alignment == CENTER ) putX = ( lineSpace - lineWd ) / 2;
-
+    u16 font::printLayoutB( const textLayout &p_layout, const u16 *p_palette, u16 *p_buffer,
+                            u16 p_bufferWidth, u8 p_chunkSize, u16 p_bufferHeight ) const {
         std::memset( TMPBUF, 0, sizeof( TMPBUF ) );
 
-        u16  spch = 0;
-        bool sp   = false;
-        while( p_string[ current_char ] && putX < lineSpace ) {
-            if( lineWd <= 0 || p_string[ current_char ] == '\n' ) {
-                putY += p_yDistance;
-                lineWd = stringMaxWidth( p_string + current_char + 1, lineSpace, ' ', p_charShift );
-                if( p_alignment == LEFT ) { putX = 0; }
-                if( p_alignment == RIGHT ) putX = lineSpace - lineWd;
-                if( p_alignment == CENTER ) putX = ( lineSpace - lineWd ) / 2;
-
-                current_char++;
-                lines++;
-                continue;
-            }
-            if( p_string[ current_char ] == '[' ) {
-                sp   = true;
-                spch = 0;
-                current_char++;
-                continue;
-            }
-            if( p_string[ current_char ] == ']' ) {
-                sp     = false;
-                u16 wd = printCharB( spch, p_palette, TMPBUF, p_bufferWidth, putX, putY, false );
-                putX += wd - p_charShift;
-                lineWd -= wd - p_charShift;
-                current_char++;
-                continue;
-            }
-            if( sp ) {
-                spch *= 10;
-                spch += ( p_string[ current_char ] - '0' );
-                current_char++;
-                continue;
-            }
-
-            u16 wd = printCharB( p_string[ current_char ], p_palette, TMPBUF, p_bufferWidth, putX,
-                                 putY );
-            putX += wd - p_charShift;
-            lineWd -= wd - p_charShift;
-            current_char++;
+        for( const auto &g : p_layout ) {
+            printCharB( g.m_ch, p_palette, TMPBUF, p_bufferWidth, g.m_x, g.m_y, false );
         }
 
         //      if( p_chunkSize < p_bufferWidth ) {
@@ -336,7 +625,16 @@ namespace IO {
             }
         }
 
-        return lines;
+        return p_layout.m_lines;
+    }
+
+    u16 font::printStringB( const char *p_string, const u16 *p_palette, u16 *p_buffer,
+                            u16 p_bufferWidth, alignment p_alignment, u8 p_yDistance,
+                            u8 p_charShift, u8 p_chunkSize, u16 p_bufferHeight,
+                            u16 p_rightPadding ) const {
+        return printLayoutB( layoutStringB( p_string, p_bufferWidth, p_alignment, p_yDistance,
+                                            p_charShift, p_rightPadding ),
+                             p_palette, p_buffer, p_bufferWidth, p_chunkSize, p_bufferHeight );
     }
 
     u16 font::printStringBC( const char *p_string, const u16 *p_palette, u16 *p_buffer,
@@ -350,60 +648,9 @@ namespace IO {
                                    bool p_bottom, alignment p_alignment, u8 p_yDistance,
                                    char p_breakChar, s8 p_adjustX, u8 p_charShift, bool p_delay,
                                    u8 p_layer ) const {
-        u32 current_char = 0;
-        s16 putX = p_x, putY = p_y;
-        u16 lines = 1;
-
-        s16 lineWd = stringMaxWidth( p_string, p_maxWidth, p_breakChar, p_charShift );
-        if( p_alignment == RIGHT ) putX = p_x - lineWd;
-        if( p_alignment == CENTER ) putX = p_x - lineWd / 2;
-
-        bool sp   = false;
-        u16  spch = 0;
-
-        while( p_string[ current_char ] ) {
-            if( lineWd <= 0 || p_string[ current_char ] == '\n' ) {
-                putY += p_yDistance;
-                putX   = ( p_x -= p_adjustX );
-                lineWd = stringMaxWidth( p_string + current_char + 1, p_maxWidth, p_breakChar,
-                                         p_charShift );
-                if( p_alignment == RIGHT ) putX = p_x - lineWd;
-                if( p_alignment == CENTER ) putX = p_x - lineWd / 2;
-
-                current_char++;
-                lines++;
-                continue;
-            }
-            if( p_string[ current_char ] == '[' ) {
-                sp   = true;
-                spch = 0;
-                current_char++;
-                continue;
-            }
-            if( p_string[ current_char ] == ']' ) {
-                sp     = false;
-                u16 wd = printChar( spch, putX, putY, p_bottom, p_layer, false );
-                putX += wd - p_charShift;
-                lineWd -= wd - p_charShift;
-                current_char++;
-                continue;
-            }
-            if( sp ) {
-                spch *= 10;
-                spch += ( p_string[ current_char ] - '0' );
-                current_char++;
-                continue;
-            }
-
-            u16 wd = printChar( p_string[ current_char ], putX, putY, p_bottom, p_layer );
-            putX += wd - p_charShift;
-            lineWd -= wd - p_charShift;
-
-            if( p_delay ) { _charDelay( ); }
-
-            current_char++;
-        }
-        return lines;
+        return printLayout( layoutString( p_string, p_maxWidth, p_alignment, p_yDistance,
+                                          p_breakChar, p_adjustX, p_charShift ),
+                            p_x, p_y, p_bottom, p_delay, p_layer );
     }
 
     u16 font::printBreakingStringC( const char *p_string, s16 p_x, s16 p_y, s16 p_maxWidth,
@@ -35,423 +35,112 @@ namespace IO {
         // FONT_WIDTH = 16
         // FONT_HEIGHT = 16
 
-        void shiftchar( u16& p_val ) {
-            if( '0' <= p_val && p_val <= '9' ) {
-                p_val = ( p_val - '0' );
-                return;
-            }
-            if( 'A' <= p_val && p_val <= 'Z' ) {
-                p_val = ( p_val - 'A' ) + 10;
-                return;
-            }
-            if( 'a' <= p_val && p_val <= 'z' ) {
-                p_val = ( p_val - 'a' ) + 36;
-                return;
-            }
-
-            if( 5000 <= p_val && p_val <= 5300 ) { // 平仮名
-                p_val = ( p_val - 5000 ) + 195;
-                return;
-            }
-
-            if( p_val == '\xc0' ) { // À
-                p_val = 62;
-                return;
-            }
-            if( p_val == '\xc1' ) { // Á
-                p_val = 63;
-                return;
-            }
-            if( p_val == '\xc5' ) { // Â
-                p_val = 64;
-                return;
-            }
-            if( p_val == '\xc4' ) { // Ä
-                p_val = 65;
-                return;
-            }
-            if( p_val == '\xc7' ) { // Ç
-                p_val = 66;
-                return;
-            }
-            if( p_val == '\xc8' ) { // È
-                p_val = 67;
-                return;
-            }
-            if( p_val == '\xc9' ) { // É
-                p_val = 68;
-                return;
-            }
-            if( p_val == '\xca' ) { // Ê
-                p_val = 69;
-                return;
-            }
-            if( p_val == '\xcb' ) { // Ë
-                p_val = 70;
-                return;
-            }
-            if( p_val == '\xcc' ) { // Ì
-                p_val = 71;
-                return;
-            }
-            if( p_val == '\xcd' ) { // Í
-                p_val = 72;
-                return;
-            }
-            if( p_val == '\xce' ) { // Î
-                p_val = 73;
-                return;
-            }
-            if( p_val == '\xcf' ) { // Ï
-                p_val = 74;
-                return;
-            }
-            if( p_val == '\xd1' ) { // Ñ
-                p_val = 75;
-                return;
-            }
-            if( p_val == '\xd2' ) { // Ò
-                p_val = 76;
-                return;
-            }
-            if( p_val == '\xd3' ) { // Ó
-                p_val = 77;
-                return;
-            }
-            if( p_val == '\xd4' ) { // Ô
-                p_val = 78;
-                return;
-            }
-            if( p_val == '\xd6' ) { // Ö
-                p_val = 79;
-                return;
-            }
-            if( p_val == '\xd7' ) { // ×
-                p_val = 80;
-                return;
-            }
-            if( p_val == '\xd9' ) { // Ù
-                p_val = 81;
-                return;
-            }
-            if( p_val == '\xda' ) { // Ú
-                p_val = 82;
-                return;
-            }
-            if( p_val == '\xdb' ) { // Û
-                p_val = 83;
-                return;
-            }
-            if( p_val == '\xdc' ) { // Ü
-                p_val = 84;
-                return;
-            }
-
-            if( p_val == '\xdf' ) { // ß
-                p_val = 85;
-                return;
-            }
-            if( p_val == '\xe0' ) { // à
-                p_val = 86;
-                return;
-            }
-            if( p_val == '\xe1' ) { // á
-                p_val = 87;
-                return;
-            }
-            if( p_val == '\xe2' ) { // â
-                p_val = 88;
-                return;
-            }
-
-            if( p_val == '\xe4' ) { // ä
-                p_val = 89;
-                return;
-            }
-            if( p_val == '\xe5' ) { // å
-                p_val = 90;
-                return;
-            }
-            if( p_val == '\xe7' ) { // ç
-                p_val = 91;
-                return;
-            }
-            if( p_val == '\xe8' ) { // è
-                p_val = 92;
-                return;
-            }
-            if( p_val == '\xe9' ) { // é
-                p_val = 93;
-                return;
-            }
-            if( p_val == '\xea' ) { // ê
-                p_val = 94;
-                return;
-            }
-            if( p_val == '\xeb' ) { // ë
-                p_val = 95;
-                return;
-            }
-            if( p_val == '\xec' ) { // ì
-                p_val = 96;
-                return;
-            }
-            if( p_val == '\xed' ) { // í
-                p_val = 97;
-                return;
-            }
-            if( p_val == '\xee' ) { // î
-                p_val = 98;
-                return;
-            }
-            if( p_val == '\xef' ) { // ï
-                p_val = 99;
-                return;
-            }
-            if( p_val == '\xf1' ) { // ñ
-                p_val = 100;
-                return;
-            }
-            if( p_val == '\xf2' ) { // ò
-                p_val = 101;
-                return;
-            }
-            if( p_val == '\xf3' ) { // ó
-                p_val = 102;
-                return;
-            }
-            if( p_val == '\xf4' ) { // ô
-                p_val = 103;
-                return;
-            }
-            if( p_val == '\xf6' ) { // ö
-                p_val = 104;
-                return;
-            }
-            if( p_val == '\xf7' ) { // ÷
-                p_val = 105;
-                return;
-            }
-            if( p_val == '\xf9' ) { // ù
-                p_val = 106;
-                return;
-            }
-            if( p_val == '\xfa' ) { // ú
-                p_val = 107;
-                return;
-            }
-            if( p_val == '\xfb' ) { // û
-                p_val = 108;
-                return;
-            }
-            if( p_val == '\xfc' ) { // ü
-                p_val = 109;
-                return;
-            }
-
-            if( p_val == '' ) {
-                p_val = 110;
-                return;
-            }
-            if( p_val == '' ) {
-                p_val = 111;
-                return;
-            }
-
-            if( p_val == '$' ) {
-                p_val = 117;
-                return;
-            }
-            if( p_val == '¡' ) {
-                p_val = 118;
-                return;
-            }
-            if( p_val == '¿' ) {
-                p_val = 119;
-                return;
-            }
-            if( p_val == '!' ) {
-                p_val = 120;
-                return;
-            }
-            if( p_val == '?' ) {
-                p_val = 121;
-                return;
-            }
-            if( p_val == ',' ) {
-                p_val = 122;
-                return;
-            }
-            if( p_val == '.' ) {
-                p_val = 123;
-                return;
-            }
-            if( p_val == '' ) {
-                p_val = 124;
-                return;
-            }
-            if( p_val == '·' ) {
-                p_val = 125;
-                return;
-            }
-            if( p_val == '/' ) {
-                p_val = 126;
-                return;
-            }
-            if( p_val == '' ) {
-                p_val = 127;
-                return;
-            }
-            if( p_val == '' ) {
-                p_val = 128;
-                return;
-            }
-            if( p_val == '\'' ) {
-                p_val = 128;
-                return;
-            }
-            if( p_val == '' ) {
-                p_val = 129;
-                return;
-            }
-            if( p_val == '' ) {
-                p_val = 130;
-                return;
-            }
-            if( p_val == '\"' ) {
-                p_val = 130;
-                return;
-            }
-            if( p_val == '' ) {
-                p_val = 131;
-                return;
-            }
-            if( p_val == '«' ) {
-                p_val = 132;
-                return;
-            }
-            if( p_val == '»' ) {
-                p_val = 133;
-                return;
-            }
-            if( p_val == '<' ) {
-                p_val = 132;
-                return;
-            }
-            if( p_val == '>' ) {
-                p_val = 133;
-                return;
-            }
-
-            if( p_val == '(' ) {
-                p_val = 134;
-                return;
-            }
-            if( p_val == ')' ) {
-                p_val = 135;
-                return;
-            }
-
-            if( p_val == '{' ) {
-                p_val = 136;
-                return;
-            } // male
-            if( p_val == '}' ) {
-                p_val = 137;
-                return;
-            } // female
-
-            if( p_val == '+' ) {
-                p_val = 138;
-                return;
-            }
-            if( p_val == '-' ) {
-                p_val = 139;
-                return;
-            }
-            if( p_val == '*' ) {
-                p_val = 140;
-                return;
-            }
-            if( p_val == '#' ) {
-                p_val = 141;
-                return;
-            }
-            if( p_val == '=' ) {
-                p_val = 132;
-                return;
-            }
-            if( p_val == '&' ) {
-                p_val = 143;
-                return;
-            }
-            if( p_val == '~' ) {
-                p_val = 144;
-                return;
-            }
-            if( p_val == ':' ) {
-                p_val = 145;
-                return;
-            }
-            if( p_val == ';' ) {
-                p_val = 146;
-                return;
-            }
-            // pik
-            // krz
-            // hrt
-            // karo
-            // star
-            // crcld pnt
-            // circle
-            // sqare
-            // triangle
-            // raute
-            if( p_val == '@' ) {
-                p_val = 157;
-                return;
-            }
-            // music
-            if( p_val == '%' ) {
-                p_val = 159;
-                return;
-            }
-            // sun
-            // wind
-            // rain
-            // snow
-            //:)
-            //^^
-            //><
-            //|(
-            //-^
-            //-v
-            // sleep
-            //^e
-            if( p_val == 173 ) { // continue (messageBox)
-                p_val = 173;
-                return;
-            }
-            if( p_val == '_' ) {
-                p_val = 173;
-                return;
-            }
-            if( p_val == 175 ) {
-                p_val = 175;
-                return;
-            }
-
-            if( p_val == ' ' ) {
-                p_val = 489;
-                return;
-            }
-            if( p_val == '\r' ) {
-                p_val = 489;
-                return;
-            }
-
-            return;
-        }
+        const u16 charPage00[ 256 ] = {
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 489, 14, 15,
+            16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+            489, 120, 130, 141, 117, 159, 143, 128, 134, 135, 140, 138, 122, 139, 123, 126,
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 145, 146, 132, 132, 133, 121,
+            157, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+            25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 91, 92, 93, 94, 173,
+            96, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+            51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 136, 124, 137, 144, 127,
+            128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+            144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+            160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+            176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+            62, 63, 194, 195, 65, 64, 198, 66, 67, 68, 69, 70, 71, 72, 73, 74,
+            208, 75, 76, 77, 78, 213, 79, 80, 216, 81, 82, 83, 84, 221, 222, 85,
+            86, 87, 88, 227, 89, 90, 230, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+            240, 100, 101, 102, 103, 245, 104, 105, 248, 106, 107, 108, 109, 253, 254, 255,
+        };
+        const u16 charPage13[ 256 ] = {
+            4864, 4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4879,
+            4880, 4881, 4882, 4883, 4884, 4885, 4886, 4887, 4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895,
+            4896, 4897, 4898, 4899, 4900, 4901, 4902, 4903, 4904, 4905, 4906, 4907, 4908, 4909, 4910, 4911,
+            4912, 4913, 4914, 4915, 4916, 4917, 4918, 4919, 4920, 4921, 4922, 4923, 4924, 4925, 4926, 4927,
+            4928, 4929, 4930, 4931, 4932, 4933, 4934, 4935, 4936, 4937, 4938, 4939, 4940, 4941, 4942, 4943,
+            4944, 4945, 4946, 4947, 4948, 4949, 4950, 4951, 4952, 4953, 4954, 4955, 4956, 4957, 4958, 4959,
+            4960, 4961, 4962, 4963, 4964, 4965, 4966, 4967, 4968, 4969, 4970, 4971, 4972, 4973, 4974, 4975,
+            4976, 4977, 4978, 4979, 4980, 4981, 4982, 4983, 4984, 4985, 4986, 4987, 4988, 4989, 4990, 4991,
+            4992, 4993, 4994, 4995, 4996, 4997, 4998, 4999, 195, 196, 197, 198, 199, 200, 201, 202,
+            203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+            219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234,
+            235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250,
+            251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266,
+            267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282,
+            283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298,
+            299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314,
+        };
+        const u16 charPage14[ 256 ] = {
+            315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330,
+            331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346,
+            347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362,
+            363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378,
+            379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+            395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+            411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+            427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+            443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+            459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+            475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+            491, 492, 493, 494, 495, 5301, 5302, 5303, 5304, 5305, 5306, 5307, 5308, 5309, 5310, 5311,
+            5312, 5313, 5314, 5315, 5316, 5317, 5318, 5319, 5320, 5321, 5322, 5323, 5324, 5325, 5326, 5327,
+            5328, 5329, 5330, 5331, 5332, 5333, 5334, 5335, 5336, 5337, 5338, 5339, 5340, 5341, 5342, 5343,
+            5344, 5345, 5346, 5347, 5348, 5349, 5350, 5351, 5352, 5353, 5354, 5355, 5356, 5357, 5358, 5359,
+            5360, 5361, 5362, 5363, 5364, 5365, 5366, 5367, 5368, 5369, 5370, 5371, 5372, 5373, 5374, 5375,
+        };
+        const u16 charPagec2[ 256 ] = {
+            49664, 49665, 49666, 49667, 49668, 49669, 49670, 49671, 49672, 49673, 49674, 49675, 49676, 49677, 49678, 49679,
+            49680, 49681, 49682, 49683, 49684, 49685, 49686, 49687, 49688, 49689, 49690, 49691, 49692, 49693, 49694, 49695,
+            49696, 49697, 49698, 49699, 49700, 49701, 49702, 49703, 49704, 49705, 49706, 49707, 49708, 49709, 49710, 49711,
+            49712, 49713, 49714, 49715, 49716, 49717, 49718, 49719, 49720, 49721, 49722, 49723, 49724, 49725, 49726, 49727,
+            49728, 49729, 49730, 49731, 49732, 49733, 49734, 49735, 49736, 49737, 49738, 49739, 49740, 49741, 49742, 49743,
+            49744, 49745, 49746, 49747, 49748, 49749, 49750, 49751, 49752, 49753, 49754, 49755, 49756, 49757, 49758, 49759,
+            49760, 49761, 49762, 49763, 49764, 49765, 49766, 49767, 49768, 49769, 49770, 49771, 49772, 49773, 49774, 49775,
+            49776, 49777, 49778, 49779, 49780, 49781, 49782, 49783, 49784, 49785, 49786, 49787, 49788, 49789, 49790, 49791,
+            49792, 49793, 49794, 49795, 131, 124, 49798, 49799, 49800, 49801, 49802, 49803, 110, 49805, 49806, 49807,
+            49808, 127, 128, 129, 130, 49813, 49814, 49815, 49816, 49817, 49818, 49819, 111, 49821, 49822, 49823,
+            49824, 118, 49826, 49827, 49828, 49829, 49830, 49831, 49832, 49833, 49834, 132, 49836, 49837, 49838, 49839,
+            49840, 49841, 49842, 49843, 49844, 49845, 49846, 125, 49848, 49849, 49850, 133, 49852, 49853, 49854, 119,
+            49856, 49857, 49858, 49859, 49860, 49861, 49862, 49863, 49864, 49865, 49866, 49867, 49868, 49869, 49870, 49871,
+            49872, 49873, 49874, 49875, 49876, 49877, 49878, 49879, 49880, 49881, 49882, 49883, 49884, 49885, 49886, 49887,
+            49888, 49889, 49890, 49891, 49892, 49893, 49894, 49895, 49896, 49897, 49898, 49899, 49900, 49901, 49902, 49903,
+            49904, 49905, 49906, 49907, 49908, 49909, 49910, 49911, 49912, 49913, 49914, 49915, 49916, 49917, 49918, 49919,
+        };
+        const u16* const charPages[ 256 ] = {
+            charPage00, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, charPage13, charPage14, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, charPagec2, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+        };
         /* clang-format off */
         u8 fontWidths[ NUM_CHARS ] = {
 
@@ -492,8319 +181,933 @@ namespace IO {
             10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 14, 15, 14, 14, 13, 14, 14, 15, 9,  8,  8,  9,
             8,  11, 1,  4,  4,  4,  4,  4,  4,  4, 4
         };
-        u8 fontData[ NUM_CHARS * 256 ] = {
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 2, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 4, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 3, 4, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 3, 4, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 4, 4, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 4, 4, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 3, 3, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 3, 3, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 4, 3, 4, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 3, 3, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 4, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 4, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 4, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 4, 4, 3, 3, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 0, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 0, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 0, 3, 3, 4, 3, 3, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 0, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 4, 4, 4, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 3, 3, 4, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 4, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 4, 4, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 4, 4, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 4, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 3, 4, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 4, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 4, 3, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 4, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 3, 3, 3, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 4, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 4, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 3, 3, 4, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 4, 4, 4, 4, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0,
- 0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 0, 0,
- 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 1, 1, 0,
- 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 1, 2, 2, 1, 0,
- 0, 0, 0, 1, 1, 2, 2, 2, 2, 1, 2, 2, 1, 2, 1, 0,
- 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 1, 2, 1, 1, 1, 0,
- 0, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 1, 1, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 2, 2, 2, 2, 1, 1, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 2, 1, 1, 0, 0, 0,
- 0, 0, 0, 1, 1, 2, 2, 2, 1, 1, 2, 2, 1, 1, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 2, 1, 1, 1, 2, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 2, 1, 1, 1, 1, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 1, 1, 2, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 2, 1, 1, 1, 2, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 2, 1, 1, 0, 0,
- 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 2, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 2, 1, 1, 1, 1, 1, 2, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 1, 1, 1, 2, 1, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 2, 2, 2, 1, 1, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 2, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 2, 1, 1, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 2, 1, 1, 1, 1, 2, 1, 0, 0,
- 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0,
- 0, 0, 0, 1, 1, 2, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 2, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 0, 0,
- 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 0, 1, 2, 2, 2, 1, 1, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
- 0, 0, 0, 0, 1, 2, 2, 2, 1, 1, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 0, 0,
- 0, 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 1, 1, 1, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 2, 1, 1, 2, 2, 2, 1, 0, 0,
- 0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 1, 0, 0,
- 0, 0, 0, 0, 0, 1, 2, 1, 1, 1, 2, 2, 2, 2, 1, 0,
- 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 1, 1, 1, 0, 0,
- 0, 0, 0, 1, 2, 2, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 2, 1, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 1, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 1, 2, 1, 1, 1, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0,
- 0, 0, 1, 2, 2, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0,
- 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
- 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-
+        const packedGlyph glyphs[ NUM_CHARS ] = {
+            { 0, 1, 4, 7, 11 }, { 29, 2, 4, 5, 11 }, { 50, 1, 4, 7, 11 }, { 79, 1, 4, 7, 11 },
+            { 108, 1, 4, 7, 11 }, { 137, 1, 4, 7, 11 }, { 166, 1, 4, 7, 11 }, { 195, 1, 4, 7, 11 },
+            { 224, 1, 4, 7, 11 }, { 253, 1, 4, 7, 11 }, { 282, 1, 4, 7, 11 }, { 311, 1, 4, 7, 11 },
+            { 340, 1, 4, 7, 11 }, { 369, 1, 4, 7, 11 }, { 398, 1, 4, 7, 11 }, { 427, 1, 4, 7, 11 },
+            { 456, 1, 4, 7, 11 }, { 485, 1, 4, 7, 11 }, { 514, 2, 4, 5, 11 }, { 535, 1, 4, 7, 11 },
+            { 564, 1, 4, 7, 11 }, { 593, 1, 4, 7, 11 }, { 622, 1, 4, 7, 11 }, { 651, 1, 4, 7, 11 },
+            { 680, 1, 4, 7, 11 }, { 709, 1, 4, 7, 11 }, { 738, 1, 4, 7, 12 }, { 770, 1, 4, 7, 11 },
+            { 799, 1, 4, 7, 11 }, { 828, 1, 4, 7, 11 }, { 857, 1, 4, 7, 11 }, { 886, 1, 4, 7, 11 },
+            { 915, 1, 4, 7, 11 }, { 944, 1, 4, 7, 11 }, { 973, 1, 4, 7, 11 }, { 1002, 1, 4, 7, 11 },
+            { 1031, 1, 7, 7, 8 }, { 1052, 1, 4, 7, 11 }, { 1081, 1, 7, 7, 8 }, { 1102, 1, 4, 7, 11 },
+            { 1131, 1, 7, 7, 8 }, { 1152, 1, 4, 5, 11 }, { 1173, 1, 7, 7, 9 }, { 1197, 1, 4, 7, 11 },
+            { 1226, 1, 6, 3, 9 }, { 1237, 1, 5, 5, 10 }, { 1256, 1, 4, 7, 11 }, { 1285, 1, 4, 4, 11 },
+            { 1302, 1, 7, 7, 8 }, { 1323, 1, 7, 7, 8 }, { 1344, 1, 7, 7, 8 }, { 1365, 1, 7, 7, 9 },
+            { 1389, 1, 7, 7, 9 }, { 1413, 1, 7, 7, 8 }, { 1434, 1, 7, 7, 8 }, { 1455, 1, 6, 6, 9 },
+            { 1476, 1, 7, 7, 8 }, { 1497, 1, 7, 7, 8 }, { 1518, 1, 7, 7, 8 }, { 1539, 1, 7, 7, 8 },
+            { 1560, 1, 7, 7, 9 }, { 1584, 1, 7, 7, 8 }, { 1605, 1, 1, 7, 14 }, { 1642, 1, 1, 7, 14 },
+            { 1679, 1, 1, 7, 14 }, { 1716, 1, 2, 7, 13 }, { 1751, 1, 4, 7, 12 }, { 1783, 1, 1, 7, 14 },
+            { 1820, 1, 1, 7, 14 }, { 1857, 1, 1, 7, 14 }, { 1894, 1, 2, 7, 13 }, { 1929, 2, 1, 5, 14 },
+            { 1956, 2, 1, 5, 14 }, { 1983, 2, 1, 5, 14 }, { 2010, 2, 2, 5, 13 }, { 2035, 1, 1, 7, 14 },
+            { 2072, 1, 1, 7, 14 }, { 2109, 1, 1, 7, 14 }, { 2146, 1, 1, 7, 14 }, { 2183, 1, 2, 7, 13 },
+            { 2218, 1, 6, 7, 7 }, { 2237, 1, 1, 7, 14 }, { 2274, 1, 1, 7, 14 }, { 2311, 1, 1, 7, 14 },
+            { 2348, 1, 2, 7, 13 }, { 2383, 1, 5, 7, 11 }, { 2412, 1, 4, 7, 11 }, { 2441, 1, 4, 7, 11 },
+            { 2470, 1, 4, 7, 11 }, { 2499, 1, 4, 7, 10 }, { 2526, 1, 3, 7, 11 }, { 2555, 1, 6, 7, 9 },
+            { 2579, 1, 3, 7, 11 }, { 2608, 1, 3, 7, 11 }, { 2637, 1, 3, 7, 11 }, { 2666, 1, 4, 7, 10 },
+            { 2693, 2, 2, 4, 12 }, { 2711, 2, 2, 4, 12 }, { 2729, 1, 2, 5, 12 }, { 2752, 1, 3, 5, 11 },
+            { 2773, 1, 3, 7, 11 }, { 2802, 1, 3, 7, 11 }, { 2831, 1, 3, 7, 11 }, { 2860, 1, 3, 7, 11 },
+            { 2889, 1, 4, 7, 10 }, { 2916, 1, 4, 7, 9 }, { 2940, 1, 3, 7, 11 }, { 2969, 1, 3, 7, 11 },
+            { 2998, 1, 3, 7, 11 }, { 3027, 1, 4, 7, 10 }, { 3054, 1, 3, 8, 11 }, { 3087, 1, 6, 9, 8 },
+            { 3114, 1, 1, 7, 8 }, { 3135, 1, 1, 7, 8 }, { 3156, 1, 1, 9, 8 }, { 3183, 1, 1, 9, 8 },
+            { 3210, 1, 1, 6, 7 }, { 3226, 2, 3, 7, 12 }, { 3258, 2, 4, 3, 11 }, { 3271, 1, 4, 7, 11 },
+            { 3300, 3, 3, 3, 12 }, { 3314, 1, 3, 7, 12 }, { 3346, 2, 10, 4, 5 }, { 3354, 2, 10, 4, 4 },
+            { 3360, 1, 11, 7, 3 }, { 3368, 3, 7, 3, 3 }, { 3372, 1, 3, 7, 12 }, { 3404, 2, 2, 4, 6 },
+            { 3413, 2, 2, 4, 6 }, { 3422, 1, 2, 7, 6 }, { 3438, 1, 2, 7, 6 }, { 3454, 1, 10, 7, 5 },
+            { 3468, 1, 3, 7, 12 }, { 3500, 1, 3, 7, 12 }, { 3532, 2, 3, 5, 12 }, { 3555, 3, 3, 5, 12 },
+            { 3578, 1, 3, 7, 11 }, { 3607, 1, 3, 7, 11 }, { 3636, 1, 4, 7, 9 }, { 3660, 1, 7, 7, 3 },
+            { 3668, 1, 2, 7, 7 }, { 3687, 1, 4, 7, 10 }, { 3714, 1, 6, 7, 6 }, { 3730, 1, 4, 7, 10 },
+            { 3757, 1, 7, 8, 4 }, { 3769, 2, 5, 4, 9 }, { 3783, 2, 5, 4, 10 }, { 3798, 1, 3, 7, 10 },
+            { 3825, 1, 3, 7, 10 }, { 3852, 1, 3, 7, 10 }, { 3879, 1, 3, 7, 10 }, { 3906, 1, 3, 7, 10 },
+            { 3933, 1, 3, 7, 11 }, { 3962, 1, 3, 7, 11 }, { 3991, 1, 3, 7, 10 }, { 4018, 1, 3, 7, 10 },
+            { 4045, 1, 3, 7, 10 }, { 4072, 1, 3, 7, 11 }, { 4101, 1, 2, 7, 12 }, { 4133, 1, 3, 7, 11 },
+            { 4162, 1, 4, 8, 9 }, { 4189, 1, 3, 7, 11 }, { 4218, 1, 3, 7, 11 }, { 4247, 1, 3, 7, 11 },
+            { 4276, 1, 4, 7, 9 }, { 4300, 1, 4, 8, 9 }, { 4327, 1, 4, 7, 12 }, { 4359, 1, 5, 7, 11 },
+            { 4388, 1, 3, 7, 11 }, { 4417, 1, 3, 7, 11 }, { 4446, 1, 3, 7, 13 }, { 4481, 1, 1, 6, 8 },
+            { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 },
+            { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 },
+            { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 },
+            { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 },
+            { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 },
+            { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 0, 0, 0, 0 }, { 4499, 2, 5, 9, 9 },
+            { 4530, 1, 2, 11, 12 }, { 4580, 2, 6, 9, 8 }, { 4607, 1, 3, 11, 11 }, { 4653, 2, 5, 8, 9 },
+            { 4680, 2, 2, 10, 12 }, { 4725, 2, 5, 9, 9 }, { 4756, 1, 3, 11, 11 }, { 4802, 2, 5, 9, 9 },
+            { 4833, 1, 2, 11, 12 }, { 4883, 1, 2, 12, 12 }, { 4937, 1, 2, 12, 12 }, { 4991, 1, 2, 10, 12 },
+            { 5036, 1, 2, 12, 12 }, { 5090, 1, 3, 10, 11 }, { 5132, 1, 2, 12, 12 }, { 5186, 1, 2, 11, 12 },
+            { 5236, 1, 2, 12, 12 }, { 5290, 1, 3, 10, 11 }, { 5332, 1, 2, 12, 12 }, { 5386, 1, 2, 11, 12 },
+            { 5436, 1, 2, 12, 12 }, { 5490, 1, 3, 10, 11 }, { 5532, 1, 2, 11, 12 }, { 5582, 1, 2, 12, 12 },
+            { 5636, 1, 2, 12, 12 }, { 5690, 1, 2, 11, 12 }, { 5740, 1, 2, 12, 12 }, { 5794, 1, 3, 11, 11 },
+            { 5840, 1, 2, 12, 12 }, { 5894, 1, 2, 12, 12 }, { 5948, 1, 2, 12, 12 }, { 6002, 1, 2, 11, 12 },
+            { 6052, 1, 2, 12, 12 }, { 6106, 2, 6, 10, 8 }, { 6136, 1, 4, 11, 10 }, { 6178, 1, 2, 12, 12 },
+            { 6232, 1, 3, 11, 11 }, { 6278, 1, 2, 12, 12 }, { 6332, 1, 2, 10, 12 }, { 6377, 1, 2, 12, 12 },
+            { 6431, 1, 2, 11, 12 }, { 6481, 1, 3, 11, 11 }, { 6527, 1, 2, 11, 12 }, { 6577, 1, 2, 11, 12 },
+            { 6627, 1, 3, 11, 11 }, { 6673, 1, 2, 11, 12 }, { 6723, 1, 2, 12, 12 }, { 6777, 1, 2, 12, 12 },
+            { 6831, 1, 3, 11, 11 }, { 6877, 1, 2, 12, 12 }, { 6931, 1, 2, 12, 12 }, { 6985, 1, 2, 11, 12 },
+            { 7035, 1, 2, 12, 12 }, { 7089, 1, 2, 12, 12 }, { 7143, 1, 3, 12, 11 }, { 7193, 1, 2, 12, 12 },
+            { 7247, 1, 2, 12, 12 }, { 7301, 1, 2, 11, 12 }, { 7351, 1, 2, 12, 12 }, { 7405, 1, 2, 12, 12 },
+            { 7459, 1, 2, 11, 12 }, { 7509, 1, 2, 11, 12 }, { 7559, 1, 2, 11, 12 }, { 7609, 1, 2, 11, 12 },
+            { 7659, 1, 2, 11, 12 }, { 7709, 2, 5, 9, 9 }, { 7740, 1, 2, 11, 12 }, { 7790, 2, 5, 9, 9 },
+            { 7821, 1, 2, 11, 12 }, { 7871, 2, 5, 9, 9 }, { 7902, 1, 2, 11, 12 }, { 7952, 1, 2, 10, 12 },
+            { 7997, 1, 2, 10, 12 }, { 8042, 1, 2, 11, 12 }, { 8092, 1, 2, 11, 12 }, { 8142, 1, 2, 11, 12 },
+            { 8192, 1, 2, 11, 12 }, { 8242, 1, 2, 11, 12 }, { 8292, 1, 2, 11, 12 }, { 8342, 2, 5, 9, 9 },
+            { 8373, 1, 2, 11, 12 }, { 8423, 2, 5, 9, 9 }, { 8454, 1, 2, 11, 12 }, { 8504, 2, 4, 9, 10 },
+            { 8538, 1, 2, 11, 12 }, { 8588, 2, 6, 9, 8 }, { 8615, 1, 3, 11, 11 }, { 8661, 2, 5, 9, 9 },
+            { 8692, 1, 2, 11, 12 }, { 8742, 1, 2, 11, 12 }, { 8792, 1, 2, 12, 12 }, { 8846, 1, 2, 11, 12 },
+            { 8896, 1, 2, 12, 12 }, { 8950, 1, 3, 10, 11 }, { 8992, 1, 2, 12, 12 }, { 9046, 1, 2, 11, 12 },
+            { 9096, 1, 2, 12, 12 }, { 9150, 2, 3, 9, 11 }, { 9188, 2, 2, 11, 12 }, { 9238, 1, 2, 11, 12 },
+            { 9288, 1, 2, 12, 12 }, { 9342, 1, 2, 11, 12 }, { 9392, 1, 2, 12, 12 }, { 9446, 1, 3, 11, 11 },
+            { 9492, 1, 2, 12, 12 }, { 9546, 1, 2, 11, 12 }, { 9596, 1, 2, 12, 12 }, { 9650, 1, 3, 10, 11 },
+            { 9692, 1, 2, 12, 12 }, { 9746, 1, 3, 10, 11 }, { 9788, 1, 2, 12, 12 }, { 9842, 1, 2, 11, 12 },
+            { 9892, 1, 2, 12, 12 }, { 9946, 2, 5, 9, 9 }, { 9977, 1, 3, 11, 11 }, { 10023, 1, 2, 12, 12 },
+            { 10077, 1, 2, 11, 12 }, { 10127, 1, 2, 12, 12 }, { 10181, 1, 2, 10, 12 }, { 10226, 1, 2, 11, 12 },
+            { 10276, 1, 2, 11, 12 }, { 10326, 1, 3, 11, 11 }, { 10372, 1, 2, 11, 12 }, { 10422, 1, 2, 10, 12 },
+            { 10467, 1, 2, 10, 12 }, { 10512, 1, 2, 11, 12 }, { 10562, 1, 2, 12, 12 }, { 10616, 1, 2, 12, 12 },
+            { 10670, 1, 2, 10, 12 }, { 10715, 1, 2, 11, 12 }, { 10765, 1, 2, 11, 12 }, { 10815, 1, 3, 11, 11 },
+            { 10861, 1, 2, 12, 12 }, { 10915, 1, 2, 12, 12 }, { 10969, 1, 3, 11, 11 }, { 11015, 1, 2, 12, 12 },
+            { 11069, 1, 2, 12, 12 }, { 11123, 1, 2, 11, 12 }, { 11173, 1, 2, 12, 12 }, { 11227, 1, 2, 12, 12 },
+            { 11281, 1, 3, 11, 11 }, { 11327, 1, 2, 11, 12 }, { 11377, 1, 2, 11, 12 }, { 11427, 1, 2, 11, 12 },
+            { 11477, 1, 2, 11, 12 }, { 11527, 2, 5, 9, 9 }, { 11558, 1, 2, 11, 12 }, { 11608, 2, 6, 9, 8 },
+            { 11635, 1, 3, 11, 11 }, { 11681, 2, 5, 8, 9 }, { 11708, 2, 3, 10, 11 }, { 11750, 1, 2, 11, 12 },
+            { 11800, 1, 2, 10, 12 }, { 11845, 1, 2, 11, 12 }, { 11895, 1, 2, 10, 12 }, { 11940, 1, 3, 11, 11 },
+            { 11986, 1, 3, 11, 11 }, { 12032, 1, 3, 11, 11 }, { 12078, 1, 3, 11, 11 }, { 12124, 1, 2, 8, 12 },
+            { 12160, 2, 2, 5, 12 }, { 12183, 1, 2, 8, 12 }, { 12219, 1, 2, 8, 12 }, { 12255, 1, 2, 8, 12 },
+            { 12291, 1, 2, 8, 12 }, { 12327, 1, 2, 8, 12 }, { 12363, 1, 2, 8, 12 }, { 12399, 1, 2, 8, 12 },
+            { 12435, 1, 2, 8, 12 }, { 12471, 1, 2, 8, 12 }, { 12507, 1, 2, 8, 12 }, { 12543, 1, 2, 8, 12 },
+            { 12579, 1, 2, 8, 12 }, { 12615, 1, 2, 8, 12 }, { 12651, 1, 2, 8, 12 }, { 12687, 1, 2, 8, 12 },
+            { 12723, 1, 2, 8, 12 }, { 12759, 2, 2, 5, 12 }, { 12782, 1, 2, 8, 12 }, { 12818, 1, 2, 8, 12 },
+            { 12854, 1, 2, 8, 12 }, { 12890, 1, 2, 8, 12 }, { 12926, 1, 2, 8, 12 }, { 12962, 1, 2, 8, 12 },
+            { 12998, 1, 2, 8, 12 }, { 13034, 1, 2, 8, 13 }, { 13073, 1, 2, 8, 12 }, { 13109, 1, 2, 8, 12 },
+            { 13145, 1, 2, 8, 12 }, { 13181, 1, 2, 8, 12 }, { 13217, 1, 2, 8, 12 }, { 13253, 1, 2, 8, 12 },
+            { 13289, 1, 2, 8, 12 }, { 13325, 1, 2, 9, 12 }, { 13366, 1, 2, 8, 12 }, { 13402, 1, 6, 8, 8 },
+            { 13426, 1, 3, 8, 11 }, { 13459, 1, 6, 8, 8 }, { 13483, 1, 3, 8, 11 }, { 13516, 1, 6, 8, 8 },
+            { 13540, 1, 3, 7, 11 }, { 13569, 1, 6, 8, 9 }, { 13596, 1, 3, 8, 11 }, { 13629, 1, 4, 3, 10 },
+            { 13641, 1, 4, 6, 10 }, { 13664, 1, 3, 8, 11 }, { 13697, 1, 3, 4, 11 }, { 13714, 1, 6, 8, 8 },
+            { 13738, 1, 6, 8, 8 }, { 13762, 1, 6, 8, 8 }, { 13786, 1, 6, 8, 9 }, { 13813, 1, 6, 8, 9 },
+            { 13840, 1, 6, 7, 8 }, { 13861, 1, 6, 8, 8 }, { 13885, 1, 5, 7, 9 }, { 13909, 1, 6, 8, 8 },
+            { 13933, 1, 6, 8, 8 }, { 13957, 1, 6, 8, 8 }, { 13981, 1, 6, 8, 8 }, { 14005, 1, 6, 7, 9 },
+            { 14029, 1, 6, 8, 8 }, { 14053, 3, 2, 3, 12 }, { 14067, 2, 2, 9, 12 }, { 14108, 2, 10, 4, 4 },
+            { 14114, 2, 9, 5, 5 }, { 14124, 1, 7, 9, 3 }, { 14135, 2, 7, 4, 4 }, { 14141, 2, 2, 7, 12 },
+            { 14173, 2, 2, 6, 9 }, { 14194, 2, 6, 6, 9 }, { 14215, 2, 2, 7, 10 }, { 14242, 2, 5, 7, 10 },
+            { 14269, 2, 2, 5, 12 }, { 14292, 3, 2, 5, 12 }, { 14315, 1, 2, 9, 12 }, { 14356, 1, 2, 9, 12 },
+            { 14397, 1, 4, 9, 9 }, { 14428, 1, 7, 9, 3 }, { 14439, 1, 4, 9, 9 }, { 14470, 1, 4, 9, 9 },
+            { 14501, 2, 6, 8, 6 }, { 14519, 3, 7, 8, 4 }, { 14531, 2, 4, 4, 9 }, { 14545, 2, 4, 4, 11 },
+            { 14562, 2, 10, 4, 4 }, { 14568, 2, 10, 4, 5 }, { 14576, 1, 3, 9, 10 }, { 14610, 1, 3, 9, 10 },
+            { 14644, 1, 3, 9, 10 }, { 14678, 1, 3, 9, 13 }, { 14722, 1, 3, 9, 10 }, { 14756, 1, 3, 9, 11 },
+            { 14794, 1, 3, 9, 11 }, { 14832, 1, 3, 9, 10 }, { 14866, 1, 3, 9, 10 }, { 14900, 1, 3, 9, 10 },
+            { 14934, 1, 3, 9, 11 }, { 14972, 1, 2, 9, 12 }, { 15013, 1, 2, 9, 14 }, { 15061, 1, 3, 9, 13 },
+            { 15105, 1, 3, 9, 11 }, { 15143, 1, 3, 9, 11 }, { 15181, 1, 3, 9, 11 }, { 15219, 1, 4, 9, 9 },
+            { 15250, 1, 4, 9, 9 }, { 15281, 1, 4, 9, 9 }, { 15312, 1, 4, 9, 9 }, { 15343, 1, 3, 9, 13 },
+            { 15387, 1, 3, 9, 11 }, { 15425, 1, 3, 9, 11 }, { 15463, 1, 4, 9, 10 }, { 15497, 4, 3, 10, 11 },
+            { 15539, 3, 3, 12, 11 }, { 15589, 3, 3, 11, 11 }, { 15635, 3, 3, 11, 11 }, { 15681, 5, 3, 8, 11 },
+            { 15714, 3, 3, 11, 11 }, { 15760, 4, 3, 10, 11 }, { 15802, 2, 3, 13, 12 }, { 15861, 1, 5, 8, 7 },
+            { 15882, 1, 4, 7, 8 }, { 15903, 1, 5, 7, 8 }, { 15924, 1, 5, 8, 7 }, { 15945, 1, 3, 7, 11 },
+            { 15974, 1, 3, 10, 11 }, { 16016, 0, 0, 0, 0 }, { 16016, 0, 0, 0, 0 }, { 16016, 0, 0, 0, 0 },
+            { 16016, 0, 0, 0, 0 }, { 16016, 0, 0, 0, 0 }, { 16016, 0, 0, 0, 0 }, { 16016, 0, 0, 0, 0 },
+            { 16016, 0, 0, 0, 0 }, { 16016, 0, 0, 0, 0 },
+        };
+        const u8 fontData[ 16017 ] = {
+            0, 2, 0, 136, 2, 32, 138, 130, 40, 136, 18, 5, 81, 162, 32, 74, 20, 68, 137, 130,
+            40, 136, 162, 0, 136, 2, 0, 8, 0, 0, 2, 36, 74, 36, 5, 137, 2, 68, 1, 162,
+            0, 81, 128, 40, 64, 20, 32, 10, 128, 0, 64, 18, 0, 145, 20, 68, 73, 148, 40, 136,
+            130, 0, 81, 0, 68, 1, 16, 5, 64, 20, 0, 81, 146, 32, 146, 164, 32, 73, 2, 64,
+            18, 0, 145, 20, 68, 73, 148, 40, 136, 130, 32, 81, 128, 72, 1, 130, 68, 137, 130, 40,
+            81, 18, 5, 145, 20, 0, 73, 0, 0, 18, 0, 136, 20, 32, 138, 2, 68, 81, 16, 37,
+            10, 162, 68, 65, 148, 40, 136, 36, 41, 72, 162, 0, 64, 20, 0, 64, 0, 72, 146, 32,
+            146, 164, 68, 73, 130, 40, 0, 16, 37, 1, 34, 73, 1, 146, 68, 65, 128, 40, 81, 18,
+            5, 145, 20, 0, 73, 0, 64, 18, 0, 145, 20, 68, 73, 148, 40, 64, 16, 37, 1, 34,
+            73, 65, 148, 68, 137, 130, 40, 81, 18, 5, 145, 20, 0, 73, 0, 72, 146, 32, 146, 164,
+            32, 73, 20, 0, 136, 2, 32, 10, 0, 68, 1, 16, 5, 0, 162, 0, 136, 2, 0, 81,
+            0, 0, 1, 0, 64, 18, 0, 145, 20, 68, 73, 148, 40, 136, 18, 37, 81, 16, 73, 65,
+            148, 68, 137, 130, 40, 81, 18, 5, 145, 20, 0, 73, 0, 64, 18, 0, 145, 20, 68, 73,
+            148, 40, 136, 18, 37, 81, 16, 73, 10, 144, 68, 65, 128, 40, 81, 18, 5, 145, 20, 0,
+            73, 0, 64, 18, 0, 145, 20, 68, 73, 148, 40, 136, 18, 37, 81, 34, 73, 74, 148, 68,
+            137, 130, 40, 81, 16, 37, 10, 162, 32, 0, 2, 72, 18, 32, 146, 20, 68, 73, 148, 40,
+            136, 18, 37, 81, 34, 73, 65, 148, 68, 137, 130, 40, 81, 18, 37, 146, 20, 32, 73, 0,
+            64, 18, 0, 145, 20, 68, 73, 148, 40, 136, 18, 5, 8, 162, 0, 64, 20, 32, 136, 130,
+            40, 81, 18, 5, 145, 20, 0, 73, 0, 72, 18, 32, 146, 20, 68, 73, 148, 40, 136, 18,
+            5, 81, 162, 32, 74, 20, 68, 137, 130, 40, 81, 18, 37, 146, 20, 32, 73, 0, 72, 146,
+            32, 146, 164, 68, 73, 130, 40, 0, 16, 37, 9, 34, 73, 74, 148, 36, 136, 2, 0, 81,
+            146, 32, 146, 164, 32, 73, 2, 72, 146, 32, 146, 164, 68, 73, 130, 40, 0, 16, 37, 1,
+            34, 73, 65, 148, 4, 136, 2, 0, 81, 0, 32, 10, 0, 32, 0, 0, 64, 18, 0, 145,
+            20, 68, 73, 148, 40, 64, 16, 5, 9, 162, 68, 74, 20, 68, 137, 130, 40, 81, 18, 5,
+            145, 20, 0, 73, 0, 8, 128, 32, 10, 162, 68, 65, 148, 40, 136, 18, 37, 81, 34, 73,
+            74, 148, 68, 137, 130, 40, 81, 16, 37, 10, 162, 32, 0, 2, 72, 130, 72, 10, 162, 0,
+            81, 128, 40, 64, 20, 32, 10, 16, 5, 136, 130, 72, 10, 146, 0, 0, 128, 0, 0, 162,
+            0, 64, 20, 0, 136, 2, 0, 81, 0, 32, 10, 2, 68, 137, 130, 40, 81, 18, 5, 145,
+            20, 0, 73, 0, 8, 128, 32, 10, 162, 68, 137, 130, 40, 10, 16, 73, 1, 162, 40, 64,
+            148, 40, 136, 18, 5, 81, 16, 37, 10, 162, 32, 0, 2, 8, 0, 32, 10, 0, 68, 1,
+            128, 40, 0, 16, 5, 0, 162, 0, 64, 20, 0, 136, 2, 0, 81, 146, 32, 146, 164, 32,
+            73, 2, 8, 128, 32, 10, 162, 68, 65, 148, 72, 145, 18, 41, 82, 162, 40, 74, 20, 69,
+            137, 146, 40, 81, 16, 37, 10, 162, 32, 0, 2, 8, 128, 32, 10, 162, 68, 65, 148, 72,
+            137, 18, 41, 81, 162, 40, 74, 148, 72, 137, 18, 41, 81, 16, 37, 10, 162, 32, 0, 2,
+            64, 18, 0, 145, 20, 68, 73, 148, 40, 136, 18, 5, 81, 162, 32, 74, 20, 68, 137, 130,
+            40, 81, 18, 5, 145, 20, 0, 73, 0, 72, 18, 32, 146, 20, 68, 73, 148, 40, 136, 18,
+            37, 81, 34, 73, 65, 148, 4, 136, 2, 0, 81, 0, 32, 10, 0, 32, 0, 0, 64, 18,
+            0, 145, 20, 68, 73, 148, 40, 136, 18, 5, 81, 162, 32, 74, 20, 68, 137, 146, 40, 81,
+            20, 5, 145, 20, 0, 73, 20, 0, 64, 0, 72, 18, 32, 146, 20, 68, 73, 148, 40, 136,
+            18, 37, 81, 34, 73, 65, 148, 40, 136, 130, 40, 81, 16, 37, 10, 162, 32, 0, 2, 64,
+            18, 0, 145, 20, 68, 73, 148, 40, 64, 16, 37, 1, 16, 73, 1, 144, 68, 65, 128, 40,
+            81, 18, 5, 145, 20, 0, 73, 0, 72, 146, 32, 146, 164, 32, 81, 2, 32, 10, 0, 68,
+            1, 128, 40, 0, 16, 5, 0, 162, 0, 64, 20, 0, 136, 2, 0, 8, 0, 8, 128, 32,
+            10, 162, 68, 65, 148, 40, 136, 18, 5, 81, 162, 32, 74, 20, 68, 137, 130, 40, 81, 18,
+            5, 145, 20, 0, 73, 0, 8, 128, 32, 10, 162, 68, 65, 148, 40, 136, 18, 5, 81, 162,
+            32, 10, 162, 40, 64, 20, 5, 64, 20, 0, 136, 2, 0, 8, 0, 8, 128, 32, 10, 162,
+            68, 65, 148, 40, 136, 18, 5, 81, 162, 32, 74, 148, 68, 137, 162, 40, 145, 34, 37, 10,
+            162, 32, 0, 2, 8, 128, 32, 10, 162, 68, 65, 20, 68, 81, 128, 40, 10, 128, 40, 0,
+            162, 40, 64, 20, 5, 81, 16, 37, 10, 162, 32, 0, 2, 8, 128, 32, 10, 162, 68, 65,
+            148, 40, 136, 130, 40, 10, 16, 69, 1, 16, 5, 0, 162, 0, 64, 20, 0, 136, 2, 0,
+            8, 0, 72, 146, 32, 146, 164, 32, 73, 20, 0, 81, 0, 32, 10, 128, 40, 0, 162, 0,
+            64, 20, 0, 81, 146, 32, 146, 164, 32, 73, 2, 64, 18, 0, 145, 20, 0, 73, 20, 68,
+            146, 18, 37, 81, 162, 36, 10, 34, 73, 1, 146, 4, 8, 0, 32, 10, 0, 68, 1, 128,
+            40, 9, 16, 73, 10, 162, 36, 74, 20, 68, 137, 130, 40, 81, 18, 37, 146, 20, 32, 73,
+            0, 64, 18, 0, 145, 20, 68, 73, 148, 40, 64, 16, 5, 8, 162, 36, 10, 34, 41, 0,
+            146, 0, 0, 128, 0, 0, 162, 0, 64, 20, 32, 137, 130, 72, 82, 162, 36, 74, 20, 68,
+            137, 130, 40, 81, 18, 5, 145, 164, 0, 73, 2, 64, 18, 0, 145, 20, 68, 73, 148, 40,
+            137, 18, 73, 82, 162, 36, 1, 34, 73, 1, 146, 4, 0, 18, 32, 18, 162, 4, 81, 18,
+            73, 66, 148, 32, 10, 16, 5, 136, 2, 68, 1, 16, 0, 64, 146, 0, 145, 164, 68, 73,
+            148, 40, 136, 18, 37, 81, 16, 73, 10, 144, 68, 1, 146, 40, 136, 164, 0, 8, 0, 32,
+            10, 0, 68, 1, 128, 40, 9, 16, 73, 10, 162, 36, 74, 20, 68, 137, 130, 40, 81, 16,
+            37, 10, 162, 32, 0, 2, 8, 162, 32, 136, 18, 37, 74, 148, 40, 8, 0, 0, 2, 32,
+            10, 128, 0, 136, 2, 68, 1, 162, 0, 81, 144, 40, 145, 2, 36, 0, 8, 0, 32, 10,
+            0, 68, 1, 128, 40, 64, 16, 5, 81, 162, 68, 65, 36, 5, 136, 162, 0, 81, 162, 32,
+            10, 162, 32, 0, 2, 72, 16, 41, 136, 130, 40, 136, 130, 40, 136, 130, 40, 136, 130, 40,
+            64, 0, 72, 18, 32, 146, 20, 68, 81, 148, 40, 138, 18, 69, 81, 162, 40, 74, 20, 69,
+            65, 16, 4, 8, 18, 32, 138, 20, 68, 74, 148, 40, 136, 18, 5, 81, 162, 32, 74, 20,
+            68, 65, 0, 4, 64, 18, 0, 145, 20, 68, 73, 148, 40, 136, 18, 5, 81, 162, 36, 10,
+            34, 41, 0, 146, 0, 72, 18, 32, 146, 20, 68, 73, 148, 40, 136, 18, 37, 81, 34, 73,
+            65, 148, 4, 136, 2, 0, 81, 0, 0, 64, 146, 0, 145, 164, 68, 73, 148, 40, 136, 18,
+            37, 81, 16, 73, 10, 144, 68, 1, 128, 40, 0, 16, 5, 8, 18, 32, 138, 20, 68, 74,
+            148, 40, 64, 16, 5, 0, 162, 0, 64, 20, 0, 64, 0, 0, 64, 146, 0, 145, 164, 68,
+            73, 2, 68, 82, 128, 36, 81, 162, 36, 10, 34, 41, 0, 146, 0, 64, 0, 32, 74, 16,
+            73, 10, 162, 4, 136, 2, 32, 10, 128, 40, 1, 16, 41, 0, 18, 0, 8, 128, 32, 10,
+            162, 68, 65, 148, 40, 136, 18, 5, 81, 162, 36, 10, 34, 73, 1, 146, 4, 8, 128, 32,
+            10, 162, 68, 65, 20, 68, 81, 128, 40, 10, 128, 40, 0, 16, 5, 0, 16, 0, 8, 128,
+            32, 10, 162, 68, 73, 148, 40, 138, 18, 69, 81, 162, 40, 10, 162, 40, 0, 130, 0, 8,
+            128, 32, 10, 162, 32, 138, 2, 32, 10, 0, 68, 1, 16, 69, 65, 20, 68, 65, 0, 4,
+            8, 128, 32, 10, 162, 68, 65, 148, 40, 136, 18, 37, 81, 16, 73, 10, 144, 68, 1, 146,
+            40, 136, 164, 0, 72, 146, 32, 146, 164, 32, 73, 20, 0, 81, 0, 68, 1, 16, 37, 65,
+            36, 73, 65, 146, 4, 64, 0, 0, 81, 0, 0, 81, 0, 32, 9, 128, 72, 10, 162, 36,
+            74, 20, 68, 137, 146, 40, 145, 36, 37, 74, 162, 68, 65, 148, 40, 136, 18, 5, 81, 16,
+            0, 1, 0, 16, 0, 64, 20, 0, 81, 0, 32, 9, 128, 72, 10, 162, 36, 74, 20, 68,
+            137, 146, 40, 145, 36, 37, 74, 162, 68, 65, 148, 40, 136, 18, 5, 81, 16, 0, 1, 0,
+            2, 0, 136, 2, 32, 138, 2, 32, 9, 128, 72, 10, 162, 36, 74, 20, 68, 137, 146, 40,
+            145, 36, 37, 74, 162, 68, 65, 148, 40, 136, 18, 5, 81, 16, 0, 1, 64, 16, 0, 81,
+            20, 0, 73, 0, 68, 82, 16, 37, 81, 162, 32, 74, 148, 68, 137, 36, 41, 81, 18, 37,
+            10, 162, 68, 65, 148, 40, 136, 130, 0, 8, 0, 64, 18, 0, 145, 20, 68, 73, 148, 40,
+            136, 18, 5, 8, 162, 0, 64, 20, 32, 136, 130, 40, 81, 18, 5, 145, 20, 0, 81, 0,
+            68, 10, 0, 64, 0, 0, 81, 0, 0, 81, 0, 36, 73, 16, 73, 82, 162, 36, 65, 20,
+            0, 136, 146, 4, 145, 36, 37, 74, 18, 68, 1, 128, 40, 73, 16, 73, 82, 144, 36, 1,
+            0, 16, 0, 64, 20, 0, 81, 0, 36, 73, 16, 73, 82, 162, 36, 65, 20, 0, 136, 146,
+            4, 145, 36, 37, 74, 18, 68, 1, 128, 40, 73, 16, 73, 82, 144, 36, 1, 0, 2, 0,
+            136, 2, 32, 138, 2, 36, 73, 16, 73, 82, 162, 36, 65, 20, 0, 136, 146, 4, 145, 36,
+            37, 74, 18, 68, 1, 128, 40, 73, 16, 73, 82, 144, 36, 1, 64, 16, 0, 81, 20, 32,
+            73, 130, 72, 146, 18, 37, 9, 162, 0, 64, 148, 36, 136, 36, 41, 81, 146, 32, 10, 0,
+            68, 73, 130, 72, 146, 130, 36, 9, 0, 8, 128, 40, 0, 162, 0, 73, 16, 73, 65, 20,
+            32, 10, 16, 5, 136, 2, 68, 1, 162, 0, 81, 16, 73, 65, 18, 0, 0, 2, 32, 10,
+            162, 0, 73, 16, 73, 65, 20, 32, 10, 16, 5, 136, 2, 68, 1, 162, 0, 81, 16, 73,
+            65, 18, 0, 64, 0, 68, 65, 20, 5, 73, 16, 73, 65, 20, 32, 10, 16, 5, 136, 2,
+            68, 1, 162, 0, 81, 16, 73, 65, 18, 0, 8, 130, 40, 10, 146, 32, 146, 130, 40, 64,
+            20, 32, 10, 16, 5, 136, 2, 68, 1, 162, 32, 146, 130, 36, 0, 0, 130, 0, 136, 162,
+            32, 138, 2, 36, 72, 16, 5, 81, 162, 32, 74, 164, 68, 137, 148, 40, 81, 20, 37, 74,
+            164, 68, 137, 148, 40, 136, 18, 5, 81, 16, 0, 1, 64, 0, 0, 81, 0, 0, 81, 0,
+            32, 9, 128, 72, 10, 162, 36, 74, 20, 68, 137, 130, 40, 81, 16, 37, 10, 162, 68, 65,
+            148, 40, 137, 130, 72, 10, 128, 36, 0, 0, 16, 0, 64, 20, 0, 81, 0, 32, 9, 128,
+            72, 10, 162, 36, 74, 20, 68, 137, 130, 40, 81, 16, 37, 10, 162, 68, 65, 148, 40, 137,
+            130, 72, 10, 128, 36, 0, 0, 2, 0, 136, 2, 32, 138, 2, 32, 9, 128, 72, 10, 162,
+            36, 74, 20, 68, 137, 130, 40, 81, 16, 37, 10, 162, 68, 65, 148, 40, 137, 130, 72, 10,
+            128, 36, 0, 64, 16, 0, 81, 20, 0, 73, 0, 68, 82, 16, 37, 81, 162, 32, 74, 20,
+            68, 137, 130, 40, 81, 16, 37, 10, 162, 68, 73, 20, 68, 82, 0, 36, 1, 0, 8, 128,
+            32, 10, 162, 32, 138, 2, 32, 10, 128, 40, 10, 162, 32, 10, 2, 32, 0, 64, 0, 0,
+            81, 0, 0, 81, 0, 4, 65, 16, 5, 81, 162, 32, 74, 20, 68, 137, 130, 40, 81, 16,
+            37, 10, 162, 68, 65, 148, 40, 137, 130, 72, 10, 128, 36, 0, 0, 16, 0, 64, 20, 0,
+            81, 0, 4, 65, 16, 5, 81, 162, 32, 74, 20, 68, 137, 130, 40, 81, 16, 37, 10, 162,
+            68, 65, 148, 40, 137, 130, 72, 10, 128, 36, 0, 0, 2, 0, 136, 2, 32, 138, 2, 36,
+            72, 16, 5, 81, 162, 32, 74, 20, 68, 137, 130, 40, 81, 16, 37, 10, 162, 68, 65, 148,
+            40, 137, 130, 72, 10, 128, 36, 0, 64, 16, 0, 81, 20, 32, 65, 130, 40, 136, 18, 5,
+            81, 162, 32, 74, 20, 68, 137, 130, 40, 81, 16, 37, 10, 162, 68, 73, 20, 68, 82, 0,
+            36, 1, 0, 64, 2, 0, 145, 2, 68, 137, 130, 40, 81, 16, 69, 10, 162, 36, 74, 20,
+            68, 137, 146, 40, 81, 164, 32, 74, 2, 32, 0, 0, 64, 0, 0, 81, 0, 0, 81, 0,
+            32, 9, 128, 72, 10, 128, 36, 10, 34, 73, 137, 146, 40, 81, 18, 5, 145, 164, 0, 73,
+            2, 0, 16, 0, 64, 20, 0, 81, 0, 32, 9, 128, 72, 10, 128, 36, 10, 34, 73, 137,
+            146, 40, 81, 18, 5, 145, 164, 0, 73, 2, 0, 2, 0, 136, 2, 32, 138, 2, 32, 9,
+            128, 72, 10, 128, 36, 10, 34, 73, 137, 146, 40, 81, 18, 5, 145, 164, 0, 73, 2, 64,
+            16, 0, 81, 20, 0, 73, 0, 68, 82, 0, 36, 81, 16, 73, 74, 148, 68, 137, 146, 40,
+            136, 36, 5, 72, 18, 0, 0, 2, 0, 136, 2, 32, 138, 2, 32, 10, 128, 72, 10, 128,
+            36, 10, 34, 73, 137, 146, 40, 81, 18, 5, 145, 164, 0, 73, 2, 64, 18, 0, 145, 20,
+            68, 73, 148, 40, 64, 16, 5, 8, 162, 36, 10, 34, 41, 0, 162, 0, 136, 20, 0, 64,
+            0, 0, 81, 0, 0, 81, 0, 32, 9, 128, 72, 10, 162, 36, 74, 148, 68, 137, 36, 41,
+            81, 146, 0, 145, 164, 0, 73, 2, 0, 16, 0, 64, 20, 0, 81, 0, 32, 9, 128, 72,
+            10, 162, 36, 74, 148, 68, 137, 36, 41, 81, 146, 0, 145, 164, 0, 73, 2, 0, 2, 0,
+            136, 2, 32, 138, 2, 32, 9, 128, 72, 10, 162, 36, 74, 148, 68, 137, 36, 41, 81, 146,
+            0, 145, 164, 0, 73, 2, 64, 16, 0, 81, 20, 0, 73, 0, 68, 82, 16, 37, 81, 162,
+            36, 74, 36, 73, 137, 146, 4, 136, 36, 5, 72, 18, 0, 8, 16, 5, 136, 2, 4, 8,
+            16, 5, 81, 16, 5, 81, 16, 5, 81, 128, 0, 64, 128, 40, 81, 128, 0, 8, 16, 5,
+            81, 16, 5, 81, 16, 5, 81, 128, 0, 64, 0, 68, 65, 20, 5, 65, 0, 4, 64, 20,
+            32, 10, 16, 5, 136, 2, 68, 1, 162, 0, 8, 0, 8, 130, 40, 10, 130, 0, 8, 128,
+            40, 64, 20, 32, 10, 16, 5, 136, 2, 68, 1, 16, 0, 0, 130, 0, 136, 162, 32, 138,
+            2, 36, 9, 16, 69, 10, 34, 37, 74, 20, 68, 137, 130, 40, 81, 16, 37, 10, 162, 32,
+            0, 2, 64, 0, 0, 81, 0, 0, 81, 0, 32, 9, 128, 72, 10, 162, 36, 74, 20, 68,
+            137, 130, 40, 81, 18, 5, 145, 20, 0, 73, 0, 0, 16, 0, 64, 20, 0, 81, 0, 32,
+            9, 128, 72, 10, 162, 36, 74, 20, 68, 137, 130, 40, 81, 18, 5, 145, 20, 0, 73, 0,
+            0, 2, 0, 136, 2, 32, 138, 2, 32, 9, 128, 72, 10, 162, 36, 74, 20, 68, 137, 130,
+            40, 81, 18, 5, 145, 20, 0, 73, 0, 64, 16, 0, 81, 20, 0, 73, 0, 68, 82, 16,
+            37, 81, 162, 32, 74, 20, 68, 137, 146, 40, 136, 164, 0, 72, 2, 0, 0, 2, 0, 136,
+            2, 0, 8, 0, 36, 73, 16, 73, 82, 144, 36, 1, 128, 0, 0, 162, 0, 0, 2, 0,
+            64, 0, 0, 81, 0, 0, 81, 0, 4, 65, 16, 5, 81, 162, 32, 74, 20, 68, 137, 130,
+            40, 81, 18, 5, 145, 164, 0, 73, 2, 0, 16, 0, 64, 20, 0, 81, 0, 4, 65, 16,
+            5, 81, 162, 32, 74, 20, 68, 137, 130, 40, 81, 18, 5, 145, 164, 0, 73, 2, 0, 2,
+            0, 136, 2, 32, 138, 2, 36, 72, 16, 5, 81, 162, 32, 74, 20, 68, 137, 130, 40, 81,
+            18, 5, 145, 164, 0, 73, 2, 64, 16, 0, 81, 20, 32, 65, 130, 40, 136, 18, 5, 81,
+            162, 32, 74, 20, 68, 137, 146, 40, 136, 36, 5, 72, 18, 0, 64, 146, 4, 136, 36, 41,
+            81, 162, 4, 81, 162, 0, 81, 162, 4, 81, 34, 41, 81, 162, 4, 81, 162, 0, 81, 162,
+            4, 136, 36, 41, 64, 146, 4, 64, 130, 4, 64, 164, 72, 65, 148, 40, 81, 162, 68, 146,
+            18, 37, 74, 130, 40, 81, 18, 32, 82, 36, 5, 72, 144, 4, 64, 18, 0, 145, 20, 0,
+            73, 20, 68, 146, 18, 37, 81, 162, 36, 10, 34, 73, 1, 146, 4, 64, 18, 0, 145, 20,
+            68, 73, 148, 40, 136, 18, 5, 81, 162, 36, 10, 34, 41, 0, 146, 0, 64, 130, 32, 64,
+            164, 40, 74, 148, 72, 10, 162, 68, 10, 16, 73, 82, 128, 40, 137, 2, 32, 82, 20, 0,
+            72, 16, 0, 8, 130, 4, 136, 162, 72, 65, 164, 40, 81, 162, 68, 137, 18, 37, 146, 148,
+            40, 81, 18, 68, 65, 164, 0, 1, 144, 0, 8, 18, 68, 145, 18, 41, 65, 20, 0, 81,
+            0, 68, 1, 128, 0, 0, 64, 18, 0, 145, 20, 32, 74, 20, 68, 137, 130, 72, 82, 16,
+            37, 65, 36, 41, 64, 148, 0, 145, 164, 0, 81, 2, 32, 10, 0, 32, 0, 0, 8, 162,
+            68, 65, 128, 32, 74, 148, 40, 81, 162, 68, 1, 0, 2, 0, 136, 2, 0, 81, 0, 0,
+            1, 0, 68, 1, 128, 40, 0, 34, 37, 136, 146, 40, 81, 16, 37, 74, 162, 32, 146, 2,
+            8, 162, 68, 137, 18, 37, 74, 20, 4, 8, 162, 68, 65, 0, 64, 18, 0, 145, 20, 68,
+            73, 148, 40, 136, 130, 0, 81, 0, 68, 1, 16, 5, 0, 162, 0, 0, 2, 0, 136, 2,
+            0, 81, 0, 0, 1, 0, 72, 16, 41, 145, 130, 40, 81, 0, 72, 16, 41, 145, 130, 4,
+            8, 130, 32, 138, 162, 32, 8, 2, 8, 162, 32, 0, 0, 128, 0, 0, 162, 0, 64, 20,
+            0, 81, 0, 32, 10, 128, 40, 0, 16, 5, 64, 20, 0, 136, 2, 32, 10, 0, 68, 1,
+            0, 4, 0, 0, 64, 128, 40, 81, 16, 41, 145, 130, 4, 72, 16, 41, 145, 130, 40, 81,
+            128, 0, 64, 128, 0, 81, 162, 68, 137, 130, 72, 145, 18, 41, 82, 144, 32, 1, 72, 144,
+            32, 82, 164, 68, 138, 20, 68, 137, 18, 37, 10, 16, 32, 0, 72, 144, 32, 82, 164, 68,
+            138, 20, 68, 137, 18, 37, 10, 0, 0, 130, 0, 136, 162, 0, 81, 20, 68, 81, 128, 40,
+            10, 162, 40, 64, 20, 5, 64, 20, 5, 136, 162, 0, 136, 162, 0, 81, 20, 0, 65, 0,
+            8, 2, 32, 138, 2, 68, 81, 0, 68, 81, 128, 40, 10, 128, 40, 10, 16, 69, 65, 20,
+            5, 136, 162, 32, 138, 2, 68, 81, 0, 4, 1, 0, 0, 2, 32, 10, 162, 0, 81, 16,
+            5, 136, 2, 68, 1, 162, 0, 136, 2, 68, 1, 16, 5, 64, 0, 8, 128, 40, 0, 162,
+            0, 81, 0, 68, 1, 162, 0, 81, 128, 40, 136, 2, 68, 65, 20, 0, 1, 0, 0, 2,
+            0, 136, 2, 32, 146, 130, 40, 138, 130, 68, 9, 16, 73, 65, 148, 68, 137, 130, 40, 81,
+            18, 5, 145, 20, 0, 73, 0, 64, 18, 0, 145, 20, 68, 73, 148, 40, 136, 18, 37, 81,
+            16, 73, 1, 18, 37, 136, 36, 41, 72, 148, 0, 136, 2, 0, 8, 0, 0, 2, 0, 136,
+            2, 0, 81, 0, 36, 74, 16, 73, 82, 144, 40, 1, 16, 5, 0, 162, 0, 0, 2, 0,
+            72, 146, 32, 146, 164, 32, 73, 2, 0, 2, 0, 137, 18, 68, 146, 20, 36, 74, 128, 40,
+            10, 16, 69, 1, 16, 4, 0, 64, 16, 0, 81, 20, 32, 138, 130, 72, 146, 130, 40, 10,
+            16, 69, 65, 36, 73, 65, 20, 5, 136, 162, 0, 8, 2, 0, 72, 146, 32, 146, 164, 32,
+            73, 2, 36, 73, 16, 73, 82, 144, 36, 1, 64, 2, 0, 145, 2, 68, 137, 130, 40, 81,
+            128, 72, 9, 162, 40, 74, 148, 40, 136, 18, 5, 136, 20, 5, 72, 16, 0, 64, 2, 4,
+            136, 148, 40, 81, 34, 5, 8, 144, 0, 72, 16, 41, 145, 130, 4, 0, 128, 4, 145, 18,
+            41, 72, 0, 72, 16, 41, 145, 130, 4, 0, 128, 4, 145, 18, 41, 136, 18, 5, 0, 2,
+            0, 136, 2, 32, 146, 2, 68, 82, 16, 73, 82, 34, 73, 74, 164, 72, 65, 162, 4, 136,
+            164, 0, 72, 2, 0, 64, 18, 0, 145, 20, 32, 146, 2, 68, 82, 16, 73, 82, 34, 73,
+            74, 164, 72, 65, 162, 4, 136, 164, 0, 72, 2, 0, 64, 16, 0, 81, 20, 68, 138, 148,
+            72, 146, 18, 73, 82, 16, 73, 1, 34, 41, 0, 162, 0, 64, 20, 0, 64, 0, 0, 0,
+            2, 0, 136, 2, 32, 146, 2, 68, 82, 16, 73, 82, 34, 73, 10, 34, 41, 64, 36, 5,
+            64, 20, 0, 64, 0, 0, 0, 2, 0, 136, 2, 32, 81, 130, 72, 146, 130, 72, 10, 128,
+            40, 0, 34, 41, 64, 36, 5, 136, 162, 0, 8, 2, 0, 64, 18, 0, 145, 20, 68, 73,
+            148, 40, 137, 18, 69, 81, 162, 40, 74, 20, 69, 137, 146, 40, 81, 18, 5, 145, 20, 0,
+            73, 0, 64, 18, 0, 145, 20, 68, 73, 148, 40, 136, 18, 5, 81, 162, 32, 74, 20, 68,
+            137, 130, 40, 81, 18, 5, 145, 20, 0, 73, 0, 72, 146, 32, 146, 164, 68, 73, 148, 40,
+            136, 18, 5, 81, 162, 32, 74, 20, 68, 137, 146, 40, 145, 36, 5, 73, 18, 0, 0, 2,
+            0, 136, 2, 32, 138, 2, 68, 81, 128, 40, 10, 16, 69, 65, 20, 68, 137, 146, 40, 145,
+            36, 5, 73, 18, 0, 0, 2, 0, 136, 2, 32, 138, 2, 68, 81, 16, 5, 81, 162, 32,
+            10, 162, 40, 64, 20, 5, 64, 20, 0, 64, 0, 0, 0, 18, 0, 136, 20, 32, 74, 148,
+            40, 138, 18, 41, 82, 34, 69, 74, 164, 72, 137, 34, 5, 136, 18, 0, 136, 20, 0, 72,
+            0, 64, 18, 0, 136, 18, 0, 145, 18, 32, 146, 2, 68, 81, 128, 40, 10, 16, 37, 73,
+            162, 0, 145, 20, 32, 146, 2, 36, 74, 0, 36, 1, 0, 72, 16, 32, 82, 20, 68, 145,
+            130, 40, 82, 16, 73, 9, 144, 72, 10, 16, 69, 65, 164, 40, 136, 34, 5, 81, 18, 0,
+            1, 0, 64, 128, 0, 136, 18, 5, 64, 146, 0, 72, 164, 4, 81, 164, 40, 72, 164, 4,
+            64, 146, 0, 136, 18, 5, 64, 128, 0, 0, 18, 0, 136, 20, 32, 146, 20, 68, 146, 130,
+            72, 82, 34, 73, 65, 36, 73, 137, 36, 41, 136, 164, 0, 136, 164, 0, 72, 2, 0, 2,
+            0, 136, 2, 32, 146, 2, 68, 82, 16, 73, 82, 34, 73, 74, 20, 69, 65, 162, 4, 64,
+            20, 5, 64, 20, 0, 64, 0, 64, 18, 0, 145, 20, 68, 146, 148, 72, 146, 18, 73, 82,
+            16, 73, 65, 36, 73, 137, 36, 41, 145, 36, 5, 145, 20, 0, 73, 0, 8, 16, 32, 74,
+            20, 68, 137, 130, 40, 81, 128, 0, 1, 16, 0, 65, 148, 68, 65, 36, 5, 64, 18, 0,
+            64, 128, 0, 136, 18, 5, 81, 164, 40, 81, 164, 40, 8, 18, 4, 72, 146, 4, 145, 36,
+            41, 136, 36, 5, 64, 146, 0, 8, 128, 32, 10, 162, 32, 138, 130, 40, 136, 130, 32, 8,
+            128, 40, 0, 34, 41, 64, 36, 5, 136, 164, 0, 72, 2, 0, 0, 0, 32, 0, 0, 8,
+            128, 32, 10, 162, 32, 138, 2, 32, 8, 0, 32, 0, 128, 40, 0, 162, 40, 0, 130, 0,
+            0, 0, 0, 0, 0, 0, 73, 0, 0, 2, 0, 136, 2, 32, 146, 130, 72, 146, 130, 68,
+            9, 128, 40, 0, 16, 5, 0, 162, 0, 136, 2, 32, 10, 0, 32, 0, 0, 8, 0, 32,
+            10, 0, 32, 10, 0, 32, 10, 0, 68, 1, 128, 40, 0, 18, 37, 136, 36, 41, 136, 164,
+            0, 136, 2, 0, 8, 0, 72, 18, 32, 146, 20, 32, 81, 0, 68, 9, 16, 73, 10, 144,
+            36, 1, 34, 73, 1, 18, 5, 64, 148, 0, 145, 164, 0, 73, 2, 0, 0, 0, 4, 0,
+            0, 64, 2, 32, 82, 16, 37, 74, 148, 40, 145, 164, 68, 73, 128, 72, 1, 144, 0, 192,
+            54, 0, 216, 198, 109, 195, 72, 146, 28, 182, 113, 219, 128, 145, 36, 183, 113, 28, 199, 141,
+            27, 57, 110, 35, 55, 110, 216, 6, 108, 0, 0, 182, 1, 0, 0, 140, 3, 0, 108, 27,
+            183, 109, 24, 73, 146, 228, 176, 109, 220, 182, 1, 27, 73, 114, 195, 198, 113, 28, 183, 113,
+            227, 184, 113, 227, 198, 113, 227, 54, 110, 220, 198, 97, 35, 183, 113, 3, 182, 13, 219, 0,
+            219, 128, 109, 24, 7, 140, 219, 56, 96, 227, 198, 1, 24, 55, 110, 219, 184, 113, 227, 182,
+            109, 228, 6, 0, 219, 6, 0, 0, 0, 96, 27, 182, 1, 192, 56, 140, 3, 128, 113, 27,
+            7, 0, 27, 55, 14, 0, 48, 110, 28, 0, 96, 220, 56, 0, 192, 184, 113, 195, 134, 109,
+            27, 55, 14, 0, 176, 145, 27, 0, 0, 219, 6, 0, 0, 216, 182, 1, 24, 201, 1, 219,
+            182, 13, 35, 73, 110, 219, 182, 113, 0, 128, 113, 216, 182, 113, 24, 73, 110, 216, 182, 13,
+            216, 182, 1, 0, 70, 114, 27, 128, 109, 35, 7, 96, 219, 182, 13, 27, 73, 146, 219, 184,
+            109, 27, 183, 13, 0, 198, 1, 0, 128, 113, 0, 0, 108, 28, 176, 109, 227, 6, 140, 36,
+            55, 0, 219, 182, 1, 192, 182, 1, 0, 70, 14, 192, 182, 109, 27, 70, 146, 228, 176, 109,
+            228, 6, 108, 220, 6, 108, 28, 185, 109, 220, 54, 114, 219, 128, 109, 3, 192, 182, 109, 0,
+            128, 145, 228, 0, 96, 219, 182, 109, 192, 72, 146, 228, 128, 109, 219, 184, 1, 0, 54, 110,
+            0, 128, 141, 27, 0, 96, 35, 57, 0, 219, 184, 113, 219, 70, 110, 27, 201, 109, 27, 176,
+            109, 3, 0, 182, 109, 192, 54, 142, 27, 70, 146, 227, 176, 141, 27, 183, 145, 36, 183, 113,
+            227, 198, 141, 27, 55, 110, 35, 57, 110, 216, 182, 109, 0, 0, 182, 1, 0, 0, 140, 195,
+            54, 108, 27, 183, 113, 27, 73, 146, 27, 183, 109, 220, 54, 14, 27, 73, 114, 219, 198, 113,
+            27, 183, 113, 227, 176, 113, 227, 198, 1, 227, 54, 142, 3, 198, 97, 35, 135, 113, 0, 182,
+            1, 27, 0, 0, 182, 1, 0, 0, 96, 28, 0, 0, 219, 198, 109, 219, 48, 146, 36, 55,
+            110, 219, 184, 141, 27, 7, 140, 195, 184, 113, 216, 56, 140, 27, 135, 113, 195, 184, 113, 24,
+            7, 140, 219, 134, 109, 219, 56, 0, 0, 48, 114, 3, 0, 0, 219, 6, 0, 0, 182, 97,
+            219, 6, 96, 28, 198, 113, 219, 198, 109, 28, 55, 146, 36, 55, 110, 219, 184, 141, 27, 7,
+            140, 195, 184, 113, 216, 56, 140, 27, 135, 113, 195, 184, 113, 24, 7, 140, 219, 134, 109, 219,
+            56, 0, 0, 48, 114, 3, 0, 0, 219, 6, 0, 0, 176, 13, 0, 0, 140, 3, 176, 109,
+            227, 54, 140, 36, 73, 14, 219, 182, 113, 27, 70, 146, 36, 135, 109, 27, 183, 97, 35, 73,
+            14, 24, 183, 109, 3, 198, 109, 27, 128, 141, 36, 7, 0, 219, 182, 1, 0, 176, 109, 219,
+            6, 0, 227, 198, 113, 219, 54, 110, 28, 55, 146, 36, 185, 109, 219, 182, 113, 27, 128, 145,
+            36, 201, 1, 216, 182, 113, 27, 128, 141, 36, 57, 0, 24, 183, 109, 3, 128, 113, 219, 6,
+            0, 216, 72, 114, 0, 0, 108, 219, 6, 0, 0, 0, 96, 27, 0, 96, 27, 7, 96, 27,
+            185, 97, 27, 185, 13, 27, 185, 13, 192, 200, 13, 0, 176, 145, 219, 0, 96, 27, 185, 13,
+            0, 182, 145, 27, 0, 96, 27, 7, 0, 0, 182, 1, 0, 0, 96, 219, 6, 0, 0, 198,
+            113, 0, 128, 109, 28, 7, 96, 27, 185, 109, 216, 70, 110, 3, 176, 145, 219, 0, 0, 35,
+            55, 0, 0, 176, 145, 219, 0, 0, 216, 70, 110, 3, 0, 96, 27, 185, 1, 0, 128, 109,
+            28, 0, 0, 0, 182, 1, 0, 0, 96, 27, 182, 1, 192, 56, 140, 219, 182, 113, 27, 55,
+            146, 36, 55, 110, 219, 198, 109, 28, 0, 140, 195, 56, 0, 24, 135, 113, 0, 48, 14, 227,
+            0, 96, 28, 198, 13, 219, 56, 108, 28, 70, 110, 192, 54, 108, 27, 0, 0, 0, 96, 219,
+            182, 13, 0, 198, 113, 227, 182, 109, 28, 55, 110, 36, 73, 110, 227, 182, 109, 28, 48, 14,
+            0, 198, 1, 227, 0, 96, 28, 48, 14, 0, 198, 1, 227, 0, 96, 28, 48, 110, 216, 198,
+            1, 27, 135, 145, 27, 128, 109, 216, 54, 0, 216, 182, 109, 195, 70, 146, 228, 48, 110, 219,
+            54, 108, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 176, 13, 0, 0, 140, 3, 128, 109,
+            227, 182, 109, 220, 70, 146, 228, 134, 109, 219, 54, 0, 0, 0, 96, 219, 134, 109, 219, 198,
+            113, 27, 73, 146, 28, 55, 110, 219, 182, 109, 219, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 176, 13, 0, 0, 0, 227, 0, 96, 27, 48, 110, 219, 198, 1, 27, 73, 146,
+            27, 128, 109, 219, 54, 0, 0, 128, 109, 0, 0, 0, 227, 0, 108, 219, 198, 109, 27, 73,
+            146, 36, 183, 109, 219, 184, 13, 0, 0, 140, 3, 0, 0, 24, 7, 108, 3, 176, 13, 24,
+            7, 0, 0, 48, 110, 219, 54, 96, 35, 73, 114, 0, 182, 109, 219, 0, 0, 128, 109, 219,
+            6, 0, 24, 199, 113, 219, 182, 113, 28, 55, 146, 36, 73, 110, 219, 182, 141, 219, 0, 0,
+            0, 198, 1, 0, 0, 96, 28, 128, 109, 0, 182, 1, 24, 7, 0, 0, 128, 113, 219, 182,
+            1, 216, 72, 146, 28, 0, 108, 219, 182, 1, 219, 0, 0, 192, 56, 0, 0, 48, 14, 0,
+            0, 140, 3, 0, 0, 227, 0, 0, 192, 56, 0, 216, 54, 14, 0, 198, 141, 3, 176, 113,
+            27, 183, 141, 27, 54, 146, 220, 0, 108, 219, 6, 0, 0, 0, 108, 219, 182, 1, 24, 199,
+            141, 3, 48, 142, 27, 7, 96, 219, 54, 14, 0, 0, 96, 28, 0, 0, 192, 56, 0, 216,
+            134, 113, 0, 48, 14, 227, 0, 96, 28, 54, 110, 27, 55, 96, 35, 201, 13, 0, 182, 109,
+            3, 0, 0, 0, 96, 27, 0, 0, 0, 198, 1, 219, 182, 109, 220, 54, 146, 36, 73, 114,
+            219, 182, 109, 220, 0, 108, 36, 201, 1, 192, 184, 109, 28, 0, 140, 219, 198, 1, 192, 70,
+            146, 28, 0, 96, 219, 198, 1, 0, 48, 146, 27, 0, 0, 219, 54, 0, 0, 0, 96, 219,
+            6, 0, 0, 198, 113, 219, 182, 109, 28, 55, 146, 36, 73, 110, 219, 182, 109, 220, 0, 108,
+            36, 201, 1, 192, 184, 109, 28, 0, 140, 219, 198, 1, 192, 70, 146, 28, 0, 96, 219, 198,
+            1, 0, 48, 146, 27, 0, 0, 219, 54, 0, 0, 0, 96, 27, 128, 109, 192, 56, 108, 227,
+            182, 113, 27, 73, 146, 36, 183, 141, 219, 198, 13, 24, 7, 140, 3, 48, 14, 27, 7, 96,
+            28, 198, 13, 192, 56, 108, 3, 128, 113, 219, 54, 0, 27, 73, 114, 0, 176, 109, 219, 0,
+            0, 0, 96, 219, 6, 108, 3, 198, 113, 219, 184, 109, 28, 55, 146, 36, 73, 110, 219, 184,
+            109, 220, 0, 140, 3, 198, 1, 192, 56, 108, 28, 0, 140, 195, 184, 1, 192, 56, 108, 3,
+            0, 140, 219, 182, 1, 192, 70, 146, 28, 0, 96, 219, 182, 1, 192, 182, 109, 27, 128, 145,
+            36, 57, 0, 219, 54, 110, 0, 128, 145, 219, 182, 109, 36, 73, 110, 36, 201, 109, 219, 182,
+            113, 3, 0, 0, 227, 6, 0, 0, 54, 110, 27, 0, 96, 35, 57, 0, 0, 182, 109, 0,
+            0, 0, 96, 219, 6, 108, 219, 198, 113, 192, 72, 146, 28, 7, 108, 219, 184, 109, 0, 48,
+            114, 219, 176, 109, 36, 73, 14, 35, 73, 110, 219, 176, 109, 220, 0, 0, 0, 198, 1, 0,
+            0, 96, 227, 182, 1, 0, 176, 145, 28, 0, 0, 216, 182, 1, 0, 182, 1, 0, 0, 96,
+            28, 0, 0, 219, 198, 109, 3, 48, 146, 36, 57, 0, 219, 198, 109, 219, 0, 140, 27, 73,
+            14, 192, 184, 109, 219, 128, 141, 3, 0, 0, 24, 183, 13, 0, 128, 113, 227, 182, 109, 24,
+            183, 145, 36, 135, 109, 216, 182, 109, 0, 182, 97, 219, 6, 96, 28, 198, 113, 219, 198, 109,
+            28, 55, 146, 36, 185, 109, 219, 198, 109, 219, 0, 140, 27, 73, 14, 192, 184, 109, 219, 128,
+            141, 3, 0, 0, 24, 183, 1, 0, 128, 113, 227, 182, 109, 24, 183, 145, 36, 135, 109, 216,
+            182, 109, 0, 182, 1, 0, 0, 140, 3, 0, 108, 27, 183, 109, 27, 73, 146, 36, 183, 109,
+            220, 182, 13, 24, 183, 109, 3, 48, 146, 36, 55, 96, 220, 182, 113, 192, 54, 0, 227, 0,
+            108, 219, 198, 1, 24, 73, 114, 3, 176, 109, 219, 0, 0, 182, 97, 219, 6, 96, 28, 198,
+            113, 219, 198, 109, 28, 55, 146, 36, 73, 110, 219, 198, 109, 219, 0, 140, 219, 54, 0, 192,
+            72, 146, 220, 0, 140, 219, 54, 14, 192, 54, 0, 227, 0, 96, 219, 54, 14, 0, 70, 146,
+            220, 0, 96, 219, 182, 1, 219, 182, 109, 192, 72, 146, 220, 176, 109, 219, 184, 1, 0, 128,
+            113, 0, 0, 96, 28, 128, 109, 227, 6, 96, 36, 55, 0, 216, 182, 1, 192, 182, 109, 3,
+            182, 145, 36, 55, 140, 220, 182, 113, 219, 54, 0, 24, 7, 0, 0, 48, 14, 0, 0, 96,
+            28, 0, 0, 216, 56, 0, 216, 54, 110, 0, 48, 146, 27, 0, 96, 219, 6, 0, 0, 0,
+            96, 219, 6, 0, 0, 198, 113, 192, 182, 109, 28, 183, 141, 36, 185, 109, 35, 183, 109, 220,
+            176, 109, 0, 48, 14, 0, 0, 0, 227, 0, 0, 0, 48, 14, 0, 0, 96, 227, 0, 0,
+            219, 198, 13, 0, 48, 146, 27, 0, 0, 219, 54, 0, 0, 176, 109, 219, 182, 109, 36, 201,
+            141, 36, 55, 114, 219, 182, 141, 219, 0, 96, 227, 6, 0, 192, 184, 1, 0, 128, 113, 0,
+            0, 0, 227, 6, 0, 0, 54, 110, 27, 0, 96, 35, 57, 0, 0, 182, 109, 0, 0, 0,
+            96, 219, 6, 0, 219, 198, 113, 219, 54, 146, 28, 55, 146, 220, 200, 109, 219, 182, 113, 27,
+            0, 96, 227, 6, 0, 0, 198, 13, 0, 0, 96, 28, 0, 0, 0, 198, 13, 0, 0, 96,
+            227, 182, 1, 0, 176, 145, 28, 0, 0, 216, 182, 1, 216, 6, 0, 0, 198, 1, 0, 128,
+            113, 192, 182, 97, 220, 54, 114, 24, 55, 114, 27, 54, 114, 27, 176, 113, 27, 0, 140, 27,
+            0, 0, 227, 6, 0, 192, 198, 109, 219, 134, 141, 36, 201, 1, 219, 182, 109, 216, 6, 96,
+            219, 134, 113, 0, 198, 113, 24, 7, 108, 28, 135, 113, 219, 200, 109, 24, 55, 114, 27, 128,
+            141, 220, 6, 0, 27, 183, 1, 0, 48, 110, 0, 0, 0, 227, 6, 0, 0, 176, 113, 219,
+            182, 1, 216, 72, 146, 28, 0, 108, 219, 182, 1, 192, 54, 0, 0, 182, 113, 219, 54, 140,
+            36, 201, 113, 219, 198, 109, 27, 135, 113, 195, 184, 109, 227, 128, 113, 192, 184, 109, 227, 128,
+            113, 35, 201, 109, 219, 184, 141, 228, 128, 113, 27, 183, 1, 27, 201, 13, 0, 176, 109, 3,
+            0, 219, 176, 109, 27, 198, 97, 36, 57, 140, 195, 182, 109, 24, 7, 0, 0, 48, 14, 0,
+            0, 96, 28, 0, 0, 192, 184, 109, 0, 128, 113, 227, 0, 0, 227, 198, 109, 219, 54, 110,
+            36, 201, 97, 195, 182, 109, 3, 216, 134, 109, 0, 48, 14, 227, 0, 96, 220, 198, 13, 192,
+            56, 146, 220, 128, 145, 27, 199, 109, 35, 55, 110, 220, 56, 142, 219, 184, 113, 28, 71, 114,
+            227, 198, 113, 227, 198, 141, 227, 198, 109, 228, 54, 114, 195, 182, 97, 219, 0, 192, 54, 0,
+            0, 128, 113, 219, 6, 108, 227, 70, 110, 24, 201, 113, 227, 182, 141, 220, 54, 14, 24, 55,
+            96, 28, 54, 110, 219, 184, 141, 220, 72, 114, 227, 56, 110, 227, 182, 113, 220, 198, 1, 227,
+            70, 114, 3, 182, 97, 219, 0, 192, 182, 109, 3, 176, 145, 36, 55, 108, 220, 184, 113, 27,
+            183, 113, 27, 55, 14, 227, 48, 110, 28, 198, 97, 220, 184, 141, 195, 184, 113, 227, 182, 113,
+            27, 185, 109, 220, 176, 109, 24, 55, 0, 0, 176, 13, 0, 0, 0, 96, 27, 182, 1, 192,
+            56, 140, 219, 182, 113, 27, 55, 146, 36, 55, 110, 219, 198, 109, 28, 0, 140, 195, 56, 108,
+            27, 135, 113, 27, 73, 110, 227, 198, 109, 228, 198, 141, 219, 184, 109, 220, 72, 110, 192, 54,
+            108, 27, 0, 0, 0, 96, 219, 182, 13, 0, 198, 113, 227, 182, 109, 28, 55, 110, 36, 73,
+            110, 227, 182, 109, 28, 48, 14, 0, 198, 1, 227, 176, 109, 28, 48, 110, 35, 201, 13, 227,
+            198, 109, 228, 48, 110, 220, 198, 13, 27, 55, 146, 27, 128, 109, 216, 54, 0, 0, 0, 96,
+            219, 176, 13, 0, 70, 114, 227, 182, 109, 28, 55, 110, 36, 73, 114, 227, 182, 109, 220, 54,
+            14, 0, 198, 1, 227, 176, 109, 28, 48, 110, 35, 201, 13, 227, 198, 109, 228, 48, 110, 220,
+            198, 13, 27, 55, 146, 27, 128, 109, 216, 54, 0, 219, 182, 1, 0, 70, 146, 219, 54, 108,
+            227, 54, 110, 195, 184, 97, 35, 135, 113, 0, 198, 109, 220, 128, 141, 195, 56, 0, 227, 134,
+            113, 195, 198, 1, 27, 183, 113, 3, 176, 145, 220, 0, 0, 219, 54, 0, 0, 0, 0, 96,
+            219, 182, 109, 27, 198, 113, 35, 201, 109, 28, 183, 141, 219, 184, 109, 24, 55, 108, 228, 128,
+            113, 0, 198, 13, 227, 6, 108, 28, 48, 14, 192, 184, 1, 227, 134, 141, 3, 176, 113, 27,
+            55, 0, 216, 72, 110, 0, 0, 108, 219, 0, 0, 0, 0, 96, 219, 182, 109, 27, 70, 114,
+            35, 201, 109, 28, 183, 141, 219, 56, 114, 24, 55, 108, 228, 128, 113, 0, 198, 13, 227, 6,
+            108, 28, 48, 14, 192, 184, 1, 227, 134, 141, 3, 176, 113, 27, 55, 0, 216, 72, 110, 0,
+            0, 108, 219, 0, 0, 216, 54, 0, 0, 48, 146, 219, 0, 96, 219, 200, 1, 0, 176, 109,
+            3, 0, 108, 28, 0, 0, 219, 56, 108, 3, 198, 141, 27, 183, 141, 219, 184, 113, 227, 134,
+            113, 227, 198, 109, 227, 198, 109, 35, 57, 108, 3, 182, 109, 0, 0, 216, 54, 96, 219, 134,
+            145, 220, 198, 113, 216, 54, 114, 28, 7, 96, 219, 182, 109, 192, 198, 1, 0, 128, 109, 28,
+            182, 1, 24, 55, 110, 220, 176, 113, 27, 55, 14, 227, 134, 113, 227, 48, 110, 27, 55, 14,
+            219, 72, 14, 219, 0, 108, 219, 0, 0, 216, 54, 96, 219, 134, 145, 220, 70, 114, 216, 54,
+            114, 28, 7, 96, 219, 70, 114, 192, 198, 1, 219, 134, 109, 28, 182, 1, 24, 55, 110, 220,
+            176, 113, 27, 55, 14, 227, 134, 113, 227, 48, 110, 27, 55, 14, 219, 72, 14, 219, 0, 108,
+            219, 0, 0, 0, 182, 13, 0, 0, 108, 228, 6, 0, 192, 184, 113, 0, 128, 141, 27, 55,
+            0, 24, 183, 141, 3, 176, 113, 192, 184, 1, 227, 6, 108, 28, 176, 13, 0, 198, 13, 0,
+            0, 96, 227, 6, 0, 0, 176, 113, 0, 0, 0, 216, 6, 0, 0, 96, 219, 6, 96, 219,
+            198, 113, 192, 70, 110, 28, 7, 140, 27, 183, 109, 216, 184, 113, 3, 128, 113, 219, 56, 0,
+            27, 7, 140, 27, 48, 110, 192, 198, 1, 219, 0, 96, 220, 0, 0, 0, 54, 110, 0, 0,
+            0, 27, 7, 0, 0, 128, 109, 0, 0, 96, 219, 6, 96, 219, 70, 114, 192, 70, 110, 28,
+            7, 140, 27, 71, 114, 216, 184, 113, 219, 134, 113, 219, 56, 0, 27, 7, 140, 3, 48, 110,
+            192, 198, 1, 219, 0, 96, 28, 0, 0, 0, 54, 110, 0, 0, 0, 27, 7, 0, 0, 128,
+            109, 0, 182, 109, 219, 182, 141, 36, 201, 141, 219, 182, 113, 24, 135, 109, 227, 54, 110, 36,
+            73, 110, 220, 182, 141, 219, 56, 108, 27, 135, 113, 27, 73, 110, 227, 198, 109, 228, 198, 141,
+            219, 184, 109, 220, 72, 110, 192, 54, 108, 27, 0, 0, 182, 109, 219, 182, 109, 36, 201, 113,
+            227, 182, 109, 28, 55, 14, 219, 198, 109, 227, 70, 146, 228, 48, 110, 219, 198, 13, 227, 176,
+            109, 28, 48, 110, 35, 201, 13, 227, 198, 109, 228, 48, 110, 220, 198, 13, 27, 55, 146, 27,
+            128, 109, 216, 54, 0, 0, 182, 109, 219, 182, 109, 36, 73, 114, 227, 182, 109, 28, 55, 14,
+            219, 70, 114, 227, 70, 146, 220, 54, 110, 219, 198, 1, 227, 176, 109, 28, 48, 110, 35, 201,
+            13, 227, 198, 109, 228, 48, 110, 220, 198, 13, 27, 55, 146, 27, 128, 109, 216, 54, 0, 0,
+            176, 13, 0, 182, 109, 220, 182, 141, 36, 73, 146, 219, 182, 113, 219, 134, 145, 36, 201, 1,
+            219, 198, 109, 3, 182, 141, 27, 128, 141, 36, 185, 13, 227, 54, 142, 220, 198, 109, 220, 198,
+            109, 36, 55, 108, 195, 182, 13, 0, 0, 216, 182, 1, 0, 48, 146, 27, 0, 96, 219, 56,
+            0, 0, 128, 113, 219, 0, 108, 227, 198, 1, 27, 73, 146, 219, 198, 141, 27, 185, 113, 27,
+            55, 110, 227, 48, 110, 28, 54, 110, 220, 56, 96, 35, 55, 110, 0, 182, 97, 27, 0, 0,
+            182, 1, 0, 0, 140, 3, 0, 108, 27, 183, 109, 24, 73, 146, 227, 134, 109, 220, 54, 110,
+            35, 57, 96, 219, 184, 113, 0, 128, 113, 227, 128, 109, 27, 185, 1, 227, 176, 113, 219, 198,
+            1, 27, 73, 114, 3, 176, 109, 219, 0, 216, 134, 109, 0, 48, 14, 227, 0, 96, 220, 198,
+            13, 192, 56, 146, 220, 128, 145, 27, 199, 109, 35, 55, 110, 220, 56, 110, 220, 184, 113, 227,
+            184, 113, 227, 70, 110, 227, 198, 109, 28, 198, 109, 36, 183, 113, 195, 182, 13, 219, 0, 192,
+            54, 0, 0, 182, 113, 219, 54, 140, 36, 73, 114, 192, 198, 109, 27, 176, 141, 219, 182, 97,
+            36, 73, 146, 195, 54, 110, 219, 6, 96, 28, 0, 0, 192, 184, 1, 219, 128, 141, 219, 198,
+            1, 216, 72, 114, 3, 128, 109, 219, 0, 216, 182, 13, 192, 184, 113, 0, 198, 141, 27, 54,
+            146, 228, 54, 114, 219, 184, 109, 28, 198, 1, 227, 198, 13, 24, 183, 13, 192, 54, 0, 0,
+            192, 54, 108, 3, 128, 113, 24, 7, 0, 227, 54, 110, 0, 198, 145, 228, 182, 141, 220, 54,
+            110, 228, 56, 96, 220, 182, 113, 192, 56, 0, 227, 182, 113, 0, 54, 110, 220, 0, 96, 220,
+            54, 0, 192, 56, 0, 0, 128, 109, 0, 0, 0, 182, 1, 216, 54, 110, 195, 56, 146, 220,
+            70, 142, 27, 55, 110, 220, 184, 113, 227, 198, 109, 35, 201, 13, 216, 184, 13, 0, 182, 1,
+            0, 0, 176, 13, 0, 0, 96, 28, 0, 108, 219, 184, 13, 24, 55, 146, 220, 48, 142, 227,
+            198, 109, 228, 198, 109, 220, 200, 141, 195, 184, 113, 27, 183, 113, 219, 48, 110, 220, 0, 96,
+            36, 55, 0, 192, 184, 13, 0, 128, 109, 0, 0, 0, 182, 1, 0, 48, 110, 27, 128, 145,
+            228, 176, 141, 219, 176, 145, 36, 183, 113, 227, 198, 141, 27, 183, 109, 35, 55, 0, 216, 54,
+            0, 0, 0, 176, 13, 0, 0, 96, 28, 0, 0, 192, 184, 109, 3, 128, 145, 36, 7, 0,
+            227, 182, 13, 0, 198, 1, 0, 182, 141, 219, 128, 141, 36, 201, 13, 227, 54, 110, 220, 198,
+            109, 220, 198, 109, 36, 55, 108, 195, 182, 13, 0, 0, 0, 182, 13, 192, 182, 145, 27, 48,
+            110, 27, 7, 140, 3, 176, 1, 227, 182, 109, 192, 56, 146, 220, 48, 114, 219, 184, 109, 27,
+            128, 113, 0, 0, 96, 28, 182, 109, 227, 134, 145, 36, 55, 96, 219, 182, 1, 216, 6, 108,
+            195, 198, 1, 227, 54, 110, 192, 198, 141, 3, 128, 113, 227, 0, 96, 220, 184, 1, 24, 183,
+            113, 0, 198, 97, 27, 128, 113, 0, 0, 108, 28, 128, 109, 227, 6, 96, 36, 55, 0, 216,
+            182, 1, 219, 182, 109, 27, 70, 146, 36, 57, 108, 219, 198, 109, 0, 176, 113, 27, 0, 108,
+            36, 185, 1, 27, 183, 141, 219, 198, 109, 195, 184, 113, 35, 185, 113, 219, 184, 141, 227, 176,
+            113, 27, 185, 1, 27, 73, 110, 0, 176, 109, 27, 0, 192, 54, 0, 0, 128, 113, 219, 6,
+            108, 227, 70, 110, 24, 201, 113, 227, 176, 141, 220, 198, 1, 24, 55, 140, 3, 54, 14, 27,
+            135, 141, 28, 198, 13, 227, 56, 140, 3, 182, 113, 24, 183, 1, 227, 176, 145, 3, 182, 1,
+            219, 6, 219, 182, 109, 27, 70, 146, 36, 57, 108, 219, 198, 109, 0, 176, 113, 27, 0, 108,
+            36, 185, 1, 27, 183, 141, 219, 198, 13, 216, 184, 113, 3, 128, 113, 219, 0, 0, 227, 0,
+            108, 219, 184, 1, 24, 73, 110, 0, 176, 109, 27, 0, 192, 54, 0, 0, 128, 113, 219, 6,
+            108, 227, 70, 110, 24, 201, 113, 227, 182, 141, 220, 54, 14, 24, 55, 96, 28, 54, 14, 192,
+            184, 141, 28, 128, 113, 227, 56, 0, 227, 182, 113, 216, 198, 1, 227, 48, 114, 3, 182, 97,
+            219, 0, 0, 176, 13, 0, 182, 109, 220, 54, 140, 36, 73, 114, 216, 54, 110, 219, 0, 108,
+            228, 182, 13, 27, 55, 146, 28, 198, 141, 227, 54, 108, 227, 198, 1, 192, 56, 108, 3, 128,
+            113, 219, 182, 1, 27, 73, 146, 3, 176, 109, 219, 6, 0, 176, 13, 0, 0, 96, 28, 0,
+            0, 216, 56, 0, 0, 48, 110, 0, 0, 108, 28, 0, 0, 24, 55, 0, 0, 54, 114, 195,
+            54, 140, 27, 183, 113, 27, 183, 113, 227, 198, 13, 227, 198, 141, 3, 54, 114, 219, 6, 96,
+            219, 0, 219, 182, 109, 27, 73, 146, 220, 182, 109, 227, 128, 109, 27, 7, 140, 35, 55, 96,
+            220, 54, 96, 227, 0, 0, 227, 6, 0, 216, 6, 0, 0, 219, 182, 109, 219, 70, 146, 36,
+            201, 109, 219, 182, 141, 3, 128, 109, 24, 7, 0, 227, 198, 13, 0, 198, 113, 3, 0, 140,
+            219, 0, 0, 24, 7, 0, 0, 48, 14, 0, 128, 109, 28, 0, 0, 35, 55, 0, 0, 182,
+            13, 0, 0, 0, 0, 108, 3, 128, 109, 28, 176, 141, 220, 182, 145, 219, 48, 114, 28, 128,
+            109, 227, 0, 0, 24, 7, 0, 192, 56, 0, 0, 182, 1, 0, 0, 0, 0, 219, 0, 0,
+            0, 198, 1, 0, 128, 141, 3, 0, 96, 227, 6, 0, 219, 184, 97, 219, 70, 110, 192, 72,
+            114, 28, 128, 109, 219, 56, 0, 0, 128, 113, 0, 0, 0, 227, 0, 0, 0, 198, 1, 0,
+            0, 108, 3, 0, 0, 182, 1, 0, 48, 14, 192, 182, 113, 219, 70, 146, 36, 55, 110, 219,
+            184, 113, 0, 198, 109, 3, 54, 14, 219, 54, 110, 24, 73, 110, 192, 182, 109, 0, 0, 176,
+            13, 0, 0, 96, 28, 0, 108, 219, 184, 109, 27, 73, 146, 36, 55, 110, 219, 54, 110, 28,
+            0, 96, 220, 54, 0, 192, 56, 0, 0, 176, 113, 0, 0, 108, 220, 128, 109, 27, 55, 0,
+            35, 201, 13, 0, 182, 109, 3, 0, 216, 182, 109, 192, 72, 146, 3, 182, 113, 27, 0, 140,
+            3, 0, 96, 28, 128, 109, 227, 182, 141, 36, 73, 110, 219, 182, 109, 216, 182, 109, 27, 48,
+            146, 36, 57, 96, 219, 184, 109, 0, 128, 113, 0, 0, 0, 227, 0, 0, 0, 198, 1, 0,
+            0, 140, 3, 0, 0, 24, 7, 0, 219, 54, 110, 219, 70, 146, 36, 201, 109, 219, 182, 109,
+            3, 0, 176, 13, 216, 182, 113, 219, 72, 146, 228, 182, 113, 220, 134, 141, 227, 128, 141, 27,
+            7, 140, 219, 56, 96, 219, 200, 1, 0, 182, 13, 0, 0, 0, 108, 3, 0, 0, 24, 7,
+            108, 219, 54, 110, 27, 73, 146, 36, 183, 109, 219, 184, 13, 0, 54, 114, 0, 128, 141, 227,
+            0, 96, 227, 198, 1, 216, 184, 141, 3, 54, 110, 24, 7, 140, 27, 70, 14, 216, 6, 108,
+            27, 0, 0, 182, 1, 0, 0, 140, 3, 0, 108, 27, 183, 109, 27, 73, 146, 36, 183, 109,
+            220, 54, 14, 192, 56, 96, 28, 128, 113, 192, 56, 96, 227, 128, 113, 192, 184, 1, 227, 176,
+            113, 219, 198, 97, 220, 70, 114, 195, 54, 108, 219, 0, 0, 182, 97, 219, 6, 96, 28, 198,
+            113, 219, 198, 109, 28, 55, 146, 36, 73, 110, 219, 198, 109, 227, 0, 96, 28, 48, 14, 0,
+            198, 1, 227, 0, 108, 28, 48, 14, 192, 184, 1, 227, 128, 141, 219, 54, 14, 24, 183, 145,
+            220, 128, 109, 216, 182, 1, 0, 128, 109, 0, 0, 0, 227, 0, 96, 219, 198, 109, 192, 72,
+            146, 228, 128, 109, 27, 183, 97, 219, 54, 110, 219, 72, 146, 36, 185, 109, 219, 198, 109, 0,
+            0, 140, 3, 0, 0, 24, 7, 0, 0, 48, 14, 0, 0, 96, 27, 0, 0, 128, 109, 219,
+            6, 0, 24, 199, 113, 216, 182, 113, 28, 135, 145, 36, 201, 109, 216, 182, 113, 3, 176, 109,
+            27, 183, 13, 35, 73, 146, 228, 176, 109, 219, 184, 13, 0, 0, 140, 3, 0, 0, 192, 56,
+            0, 0, 0, 140, 3, 0, 0, 192, 54, 0, 192, 182, 109, 27, 54, 146, 36, 135, 113, 219,
+            198, 109, 28, 128, 113, 227, 6, 96, 220, 54, 0, 24, 7, 0, 192, 198, 1, 0, 54, 110,
+            0, 182, 113, 3, 128, 145, 27, 0, 96, 219, 0, 0, 0, 0, 96, 219, 6, 108, 219, 198,
+            113, 216, 72, 146, 28, 135, 113, 219, 198, 109, 27, 7, 96, 28, 48, 110, 0, 198, 1, 219,
+            0, 96, 28, 0, 0, 192, 198, 1, 0, 128, 141, 27, 0, 96, 27, 55, 0, 0, 70, 110,
+            0, 0, 96, 219, 0, 0, 192, 54, 0, 0, 128, 113, 0, 0, 0, 227, 182, 109, 195, 70,
+            146, 36, 183, 113, 219, 184, 109, 220, 128, 113, 192, 54, 0, 227, 0, 0, 0, 198, 1, 0,
+            128, 141, 3, 128, 109, 227, 6, 0, 35, 185, 1, 0, 182, 109, 0, 0, 192, 54, 96, 219,
+            6, 140, 3, 198, 113, 192, 184, 109, 28, 135, 141, 36, 73, 110, 27, 183, 141, 219, 48, 110,
+            192, 56, 0, 219, 0, 140, 3, 0, 0, 192, 56, 0, 0, 128, 141, 3, 0, 108, 27, 55,
+            0, 192, 72, 110, 0, 0, 108, 219, 0, 0, 219, 182, 109, 27, 73, 146, 220, 182, 109, 227,
+            0, 0, 24, 7, 0, 192, 56, 0, 0, 198, 1, 0, 48, 14, 0, 128, 113, 219, 182, 141,
+            27, 73, 146, 220, 182, 109, 219, 0, 0, 0, 108, 219, 182, 109, 27, 199, 141, 36, 73, 142,
+            219, 182, 109, 220, 6, 0, 192, 56, 0, 0, 128, 113, 0, 0, 0, 227, 0, 0, 0, 198,
+            1, 0, 0, 140, 3, 182, 109, 27, 7, 140, 36, 73, 14, 216, 182, 109, 3, 0, 192, 54,
+            96, 27, 128, 113, 192, 56, 108, 227, 182, 113, 27, 73, 146, 36, 183, 141, 219, 198, 13, 24,
+            7, 140, 3, 48, 14, 24, 7, 96, 27, 48, 14, 0, 0, 108, 28, 0, 108, 27, 55, 0,
+            24, 201, 13, 0, 176, 109, 3, 0, 192, 54, 96, 219, 6, 140, 3, 198, 113, 219, 184, 109,
+            28, 55, 146, 36, 73, 110, 219, 184, 109, 28, 0, 140, 3, 198, 1, 192, 56, 96, 28, 0,
+            108, 3, 198, 1, 0, 0, 108, 28, 0, 96, 219, 184, 1, 0, 70, 114, 3, 0, 96, 219,
+            6, 0, 219, 182, 1, 0, 70, 146, 3, 0, 108, 219, 6, 0, 216, 182, 13, 0, 48, 146,
+            28, 176, 109, 219, 54, 96, 28, 0, 0, 192, 56, 0, 0, 176, 113, 0, 128, 109, 220, 176,
+            109, 35, 55, 96, 36, 185, 13, 192, 182, 109, 0, 0, 219, 182, 97, 219, 54, 146, 28, 198,
+            113, 219, 182, 97, 28, 183, 109, 27, 182, 109, 35, 201, 1, 219, 176, 109, 27, 48, 14, 0,
+            0, 0, 227, 0, 0, 0, 54, 14, 0, 128, 109, 220, 128, 109, 27, 185, 1, 24, 73, 110,
+            3, 128, 109, 219, 0, 0, 219, 182, 109, 27, 70, 146, 36, 57, 108, 219, 182, 113, 0, 0,
+            96, 227, 0, 0, 216, 184, 1, 0, 54, 110, 0, 128, 141, 227, 6, 96, 227, 54, 110, 219,
+            184, 97, 227, 70, 110, 0, 198, 109, 27, 0, 108, 3, 0, 0, 96, 219, 182, 109, 219, 198,
+            113, 35, 73, 146, 28, 183, 109, 219, 198, 109, 0, 0, 108, 28, 0, 0, 216, 184, 1, 0,
+            176, 113, 3, 0, 96, 227, 184, 1, 192, 198, 109, 220, 176, 141, 27, 54, 14, 35, 55, 0,
+            227, 176, 109, 0, 176, 13, 192, 54, 0, 0, 128, 113, 0, 0, 108, 227, 182, 109, 27, 73,
+            146, 36, 183, 141, 219, 54, 14, 24, 7, 140, 27, 48, 14, 216, 6, 96, 28, 0, 0, 192,
+            56, 0, 0, 128, 113, 219, 54, 0, 27, 73, 114, 0, 176, 109, 219, 0, 192, 54, 96, 219,
+            6, 140, 3, 198, 113, 219, 184, 109, 28, 55, 146, 36, 73, 110, 219, 184, 109, 227, 0, 140,
+            3, 198, 13, 192, 56, 96, 27, 0, 140, 3, 0, 0, 192, 56, 0, 0, 0, 140, 219, 182,
+            1, 192, 70, 146, 28, 0, 96, 219, 182, 1, 219, 0, 96, 219, 56, 0, 24, 55, 110, 0,
+            198, 97, 28, 128, 113, 24, 7, 96, 28, 182, 1, 24, 7, 0, 192, 198, 1, 0, 54, 110,
+            192, 182, 113, 3, 48, 146, 27, 0, 108, 219, 0, 0, 0, 0, 96, 219, 182, 13, 0, 198,
+            113, 227, 0, 96, 28, 55, 110, 0, 182, 109, 24, 7, 96, 28, 128, 113, 0, 198, 1, 216,
+            6, 96, 28, 0, 0, 192, 198, 1, 0, 128, 141, 27, 0, 108, 27, 55, 0, 192, 72, 110,
+            0, 0, 108, 219, 0, 0, 216, 182, 109, 27, 70, 146, 36, 135, 113, 219, 198, 109, 220, 182,
+            113, 227, 70, 110, 220, 182, 109, 28, 7, 0, 216, 200, 1, 0, 48, 110, 192, 182, 113, 3,
+            48, 146, 27, 0, 108, 219, 0, 0, 0, 0, 96, 219, 134, 109, 219, 198, 113, 24, 73, 146,
+            28, 135, 113, 219, 198, 109, 27, 183, 109, 28, 48, 110, 228, 198, 1, 219, 182, 113, 28, 0,
+            0, 216, 200, 1, 0, 0, 140, 27, 0, 108, 27, 55, 0, 192, 72, 110, 0, 0, 108, 219,
+            0, 0, 0, 0, 96, 27, 176, 109, 219, 56, 96, 36, 73, 110, 192, 182, 141, 27, 176, 109,
+            27, 183, 109, 36, 73, 146, 220, 182, 109, 220, 54, 0, 192, 56, 0, 0, 128, 113, 0, 0,
+            108, 227, 0, 0, 24, 185, 1, 0, 176, 109, 0, 0, 0, 0, 96, 219, 134, 109, 219, 198,
+            113, 24, 73, 146, 28, 135, 109, 27, 183, 109, 219, 182, 113, 219, 48, 146, 36, 73, 14, 219,
+            182, 113, 219, 0, 0, 24, 7, 0, 0, 128, 113, 0, 0, 96, 27, 7, 0, 0, 70, 110,
+            0, 0, 96, 219, 0, 0, 219, 54, 0, 24, 199, 97, 219, 56, 14, 227, 198, 113, 24, 183,
+            109, 195, 56, 0, 192, 198, 1, 219, 198, 13, 24, 201, 13, 192, 182, 13, 0, 219, 182, 1,
+            219, 198, 141, 3, 198, 141, 27, 7, 140, 27, 55, 14, 24, 183, 109, 27, 48, 14, 0, 0,
+            96, 28, 0, 0, 216, 56, 0, 0, 54, 110, 216, 182, 141, 27, 48, 146, 228, 6, 96, 219,
+            182, 1, 0, 0, 0, 96, 219, 182, 109, 27, 198, 113, 227, 198, 97, 28, 55, 110, 28, 54,
+            110, 227, 198, 1, 227, 176, 109, 27, 48, 14, 0, 0, 0, 227, 0, 0, 0, 54, 14, 0,
+            0, 108, 220, 128, 109, 219, 184, 1, 24, 73, 114, 3, 128, 109, 219, 6, 0, 216, 182, 109,
+            27, 48, 146, 36, 57, 96, 219, 182, 109, 216, 182, 109, 219, 54, 146, 36, 73, 110, 219, 182,
+            113, 27, 0, 0, 227, 0, 0, 0, 198, 1, 0, 128, 141, 3, 128, 109, 227, 6, 0, 35,
+            185, 1, 0, 182, 109, 0, 0, 216, 182, 109, 219, 134, 145, 36, 201, 113, 216, 182, 109, 28,
+            183, 109, 219, 182, 109, 35, 73, 146, 228, 176, 109, 219, 184, 13, 0, 0, 140, 3, 0, 0,
+            192, 56, 0, 0, 128, 141, 3, 0, 108, 27, 55, 0, 192, 72, 110, 0, 0, 108, 219, 0,
+            0, 219, 0, 0, 192, 56, 0, 0, 48, 14, 0, 0, 140, 3, 0, 0, 227, 182, 13, 192,
+            72, 146, 219, 54, 110, 27, 201, 141, 3, 182, 109, 227, 0, 0, 192, 56, 0, 0, 48, 14,
+            0, 0, 108, 3, 0, 0, 219, 0, 108, 219, 198, 1, 24, 199, 141, 3, 48, 142, 27, 7,
+            96, 219, 54, 110, 219, 0, 96, 36, 201, 109, 195, 184, 109, 36, 135, 113, 192, 182, 13, 227,
+            0, 0, 0, 198, 1, 0, 0, 140, 3, 0, 0, 216, 6, 0, 0, 0, 0, 128, 109, 0,
+            0, 0, 227, 0, 108, 219, 198, 109, 27, 73, 146, 36, 183, 109, 27, 183, 13, 0, 48, 14,
+            0, 0, 96, 28, 0, 0, 192, 56, 0, 0, 176, 113, 0, 176, 109, 220, 0, 96, 36, 55,
+            0, 192, 182, 13, 0, 0, 216, 182, 109, 27, 48, 146, 36, 57, 96, 219, 182, 109, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219,
+            182, 109, 219, 70, 146, 36, 201, 109, 219, 182, 109, 3, 216, 182, 109, 27, 48, 146, 36, 57,
+            96, 219, 182, 113, 0, 0, 0, 227, 0, 108, 195, 198, 1, 24, 185, 113, 3, 176, 141, 228,
+            0, 0, 27, 199, 13, 192, 198, 109, 220, 182, 113, 195, 198, 141, 220, 0, 140, 219, 54, 0,
+            216, 6, 0, 182, 1, 192, 182, 113, 219, 54, 146, 36, 201, 109, 219, 182, 113, 0, 0, 108,
+            28, 0, 108, 227, 6, 96, 35, 55, 108, 27, 57, 110, 35, 57, 110, 220, 182, 141, 195, 6,
+            0, 227, 0, 0, 192, 54, 0, 0, 0, 96, 27, 0, 0, 24, 7, 0, 0, 198, 1, 0,
+            128, 113, 0, 0, 96, 28, 0, 0, 27, 7, 0, 216, 184, 1, 192, 198, 13, 192, 54, 110,
+            192, 54, 114, 3, 48, 114, 27, 0, 108, 27, 0, 0, 192, 54, 0, 0, 128, 113, 216, 6,
+            0, 227, 48, 14, 0, 198, 97, 220, 0, 140, 195, 198, 1, 24, 7, 140, 3, 48, 14, 24,
+            55, 108, 28, 176, 113, 24, 55, 0, 227, 54, 14, 0, 198, 141, 27, 0, 140, 219, 6, 0,
+            216, 6, 192, 54, 96, 219, 6, 140, 195, 198, 113, 192, 56, 140, 28, 7, 140, 195, 184, 109,
+            192, 56, 108, 28, 0, 140, 3, 198, 1, 192, 56, 96, 220, 128, 141, 3, 54, 14, 24, 55,
+            0, 227, 176, 113, 0, 48, 14, 227, 6, 0, 227, 176, 13, 0, 176, 13, 192, 54, 0, 219,
+            6, 140, 195, 70, 114, 192, 56, 140, 28, 7, 140, 195, 72, 114, 192, 56, 108, 220, 6, 140,
+            3, 198, 1, 192, 56, 96, 220, 128, 141, 3, 54, 14, 24, 55, 0, 227, 176, 113, 0, 48,
+            14, 227, 6, 0, 227, 176, 13, 0, 176, 13, 219, 0, 0, 192, 56, 0, 0, 48, 14, 219,
+            182, 141, 219, 72, 114, 35, 201, 109, 219, 184, 109, 0, 48, 14, 0, 0, 140, 3, 0, 0,
+            227, 0, 0, 192, 184, 109, 219, 182, 145, 36, 201, 97, 219, 182, 109, 219, 0, 108, 219, 198,
+            1, 24, 199, 141, 195, 54, 142, 27, 183, 145, 228, 54, 146, 220, 182, 97, 220, 54, 0, 192,
+            56, 0, 0, 128, 113, 0, 0, 0, 227, 0, 0, 0, 198, 109, 219, 54, 108, 36, 73, 114,
+            192, 182, 109, 219, 0, 219, 0, 108, 219, 198, 1, 24, 201, 141, 195, 54, 142, 27, 183, 145,
+            36, 55, 146, 220, 182, 109, 220, 54, 0, 192, 56, 0, 0, 128, 113, 0, 0, 0, 227, 0,
+            0, 0, 198, 109, 219, 54, 108, 36, 73, 114, 192, 182, 109, 219, 0, 219, 182, 109, 219, 70,
+            146, 36, 201, 109, 219, 182, 141, 3, 0, 0, 24, 7, 0, 0, 54, 14, 0, 0, 140, 27,
+            0, 0, 27, 7, 0, 216, 198, 13, 216, 54, 114, 3, 48, 146, 219, 0, 96, 219, 6, 0,
+            0, 0, 0, 96, 219, 182, 109, 219, 198, 113, 35, 73, 146, 28, 183, 109, 219, 54, 110, 0,
+            0, 0, 227, 0, 0, 0, 54, 14, 0, 0, 96, 220, 0, 0, 192, 198, 1, 0, 176, 141,
+            27, 128, 109, 35, 55, 0, 24, 201, 109, 0, 128, 109, 27, 0, 0, 0, 0, 96, 219, 182,
+            109, 219, 70, 114, 35, 73, 146, 28, 183, 109, 219, 70, 114, 0, 0, 0, 227, 6, 0, 0,
+            54, 14, 0, 0, 96, 220, 0, 0, 192, 198, 1, 0, 176, 141, 27, 128, 109, 35, 55, 0,
+            24, 201, 109, 0, 128, 109, 27, 0, 0, 0, 176, 13, 0, 0, 108, 220, 0, 0, 27, 199,
+            1, 192, 198, 141, 27, 176, 113, 219, 56, 96, 220, 128, 113, 195, 54, 0, 27, 7, 0, 0,
+            48, 110, 0, 0, 96, 227, 0, 0, 0, 198, 1, 0, 0, 108, 3, 0, 0, 96, 219, 6,
+            0, 219, 198, 113, 0, 54, 110, 28, 7, 108, 28, 183, 109, 216, 184, 113, 3, 176, 113, 219,
+            56, 0, 227, 6, 140, 27, 176, 13, 192, 198, 1, 0, 0, 96, 220, 0, 0, 0, 54, 14,
+            0, 0, 0, 227, 0, 0, 0, 176, 13, 0, 0, 96, 219, 6, 0, 219, 70, 114, 0, 54,
+            110, 28, 7, 108, 28, 71, 114, 216, 184, 113, 219, 182, 113, 219, 56, 0, 227, 6, 140, 27,
+            176, 13, 192, 198, 1, 0, 0, 96, 220, 0, 0, 0, 54, 14, 0, 0, 0, 227, 0, 0,
+            0, 176, 13, 0, 176, 13, 0, 0, 96, 28, 0, 108, 219, 184, 109, 27, 73, 146, 36, 183,
+            109, 227, 182, 13, 219, 198, 109, 3, 198, 141, 27, 135, 141, 27, 55, 110, 227, 48, 110, 227,
+            198, 109, 28, 198, 109, 27, 57, 108, 3, 176, 109, 0, 0, 0, 176, 109, 219, 6, 0, 227,
+            198, 113, 219, 54, 110, 28, 55, 146, 36, 73, 110, 219, 54, 110, 219, 128, 109, 227, 182, 1,
+            24, 55, 110, 28, 176, 113, 227, 198, 13, 227, 48, 110, 227, 48, 110, 227, 48, 14, 219, 70,
+            14, 219, 0, 96, 219, 0, 0, 0, 176, 109, 219, 6, 0, 227, 70, 114, 219, 54, 110, 28,
+            55, 146, 36, 73, 114, 219, 54, 110, 219, 134, 109, 227, 182, 1, 24, 55, 110, 28, 176, 113,
+            227, 198, 13, 227, 48, 110, 227, 48, 110, 227, 48, 14, 219, 70, 14, 219, 0, 96, 219, 0,
+            0, 219, 182, 109, 219, 70, 146, 36, 201, 109, 219, 182, 141, 3, 0, 0, 27, 135, 109, 192,
+            198, 13, 227, 182, 113, 3, 54, 110, 220, 0, 96, 35, 55, 0, 0, 54, 110, 0, 0, 96,
+            227, 0, 0, 0, 182, 1, 0, 219, 182, 1, 0, 70, 146, 219, 54, 108, 219, 72, 114, 216,
+            182, 109, 219, 48, 146, 220, 182, 97, 219, 70, 146, 3, 0, 108, 219, 134, 109, 27, 0, 0,
+            35, 185, 109, 0, 182, 141, 228, 182, 1, 216, 54, 146, 3, 0, 96, 219, 6, 0, 182, 1,
+            0, 0, 140, 3, 0, 0, 24, 7, 0, 0, 54, 14, 0, 0, 140, 27, 0, 0, 24, 7,
+            108, 3, 54, 14, 24, 7, 140, 27, 48, 110, 27, 7, 96, 227, 198, 109, 219, 198, 141, 36,
+            73, 146, 219, 182, 109, 219, 6, 0, 0, 0, 219, 0, 0, 0, 198, 1, 0, 0, 140, 3,
+            182, 1, 27, 7, 140, 220, 198, 13, 216, 70, 142, 3, 0, 108, 227, 6, 0, 216, 56, 14,
+            192, 54, 110, 220, 182, 145, 219, 198, 141, 220, 6, 140, 219, 54, 0, 216, 6, 216, 182, 109,
+            27, 48, 146, 36, 57, 96, 27, 183, 109, 0, 48, 14, 0, 176, 109, 220, 182, 109, 36, 73,
+            146, 220, 182, 113, 219, 54, 0, 227, 0, 0, 0, 198, 1, 0, 0, 140, 219, 182, 1, 216,
+            72, 146, 3, 128, 109, 219, 6, 192, 54, 0, 216, 198, 109, 219, 72, 146, 228, 182, 113, 27,
+            7, 140, 219, 56, 96, 220, 184, 1, 227, 182, 1, 24, 7, 0, 192, 54, 0, 0, 216, 6,
+            0, 0, 48, 14, 0, 0, 96, 220, 182, 109, 219, 198, 145, 36, 55, 146, 220, 54, 110, 27,
+            55, 108, 28, 48, 110, 24, 55, 96, 227, 176, 13, 0, 198, 13, 0, 0, 108, 28, 0, 0,
+            192, 56, 0, 0, 128, 109, 0, 0, 216, 182, 13, 192, 72, 114, 0, 182, 141, 3, 0, 96,
+            28, 0, 0, 227, 128, 109, 27, 183, 141, 36, 73, 110, 219, 182, 109, 216, 182, 109, 3, 48,
+            146, 36, 7, 96, 219, 54, 14, 0, 0, 96, 28, 0, 0, 192, 56, 0, 0, 128, 113, 0,
+            0, 0, 227, 0, 0, 0, 198, 1, 219, 182, 141, 219, 70, 146, 36, 201, 109, 219, 182, 109,
+            3, 219, 182, 109, 35, 73, 114, 219, 182, 113, 219, 182, 113, 35, 73, 114, 219, 182, 113, 219,
+            182, 113, 35, 73, 114, 219, 182, 109, 219, 182, 109, 219, 72, 146, 36, 183, 109, 219, 198, 1,
+            0, 128, 113, 219, 182, 109, 220, 72, 146, 36, 183, 109, 219, 198, 1, 0, 128, 113, 219, 182,
+            109, 220, 72, 146, 36, 183, 109, 219, 182, 1, 216, 182, 109, 27, 48, 146, 36, 57, 96, 219,
+            182, 109, 216, 182, 109, 219, 54, 146, 36, 73, 110, 219, 182, 109, 28, 0, 0, 192, 56, 0,
+            0, 176, 113, 0, 128, 109, 220, 128, 109, 35, 55, 0, 35, 185, 13, 0, 182, 109, 0, 0,
+            219, 0, 96, 219, 56, 0, 24, 55, 14, 0, 198, 141, 3, 128, 113, 227, 0, 96, 220, 56,
+            0, 24, 183, 13, 0, 198, 1, 0, 128, 113, 0, 0, 108, 28, 176, 109, 227, 6, 140, 36,
+            55, 0, 219, 182, 1, 216, 182, 13, 0, 48, 110, 28, 0, 96, 220, 56, 0, 192, 184, 113,
+            0, 128, 113, 227, 0, 0, 227, 198, 1, 0, 198, 141, 195, 54, 140, 27, 135, 113, 24, 55,
+            110, 227, 54, 110, 220, 184, 141, 219, 72, 110, 216, 134, 109, 27, 0, 219, 0, 0, 192, 56,
+            0, 0, 48, 14, 0, 0, 140, 3, 0, 0, 227, 0, 0, 192, 56, 0, 0, 48, 14, 0,
+            0, 140, 3, 176, 109, 227, 176, 141, 220, 184, 141, 220, 54, 146, 220, 6, 108, 219, 6, 0,
+            219, 182, 109, 219, 70, 146, 36, 201, 141, 219, 182, 141, 27, 7, 0, 24, 55, 14, 0, 48,
+            110, 28, 0, 96, 220, 56, 0, 192, 184, 113, 0, 128, 113, 227, 182, 109, 227, 70, 146, 36,
+            201, 109, 219, 182, 109, 3, 219, 182, 109, 219, 70, 146, 36, 201, 141, 219, 182, 141, 27, 7,
+            0, 24, 55, 14, 0, 48, 110, 27, 0, 96, 28, 0, 0, 216, 56, 0, 0, 54, 110, 192,
+            182, 141, 27, 128, 145, 228, 6, 0, 219, 182, 1, 0, 219, 182, 109, 219, 70, 146, 36, 201,
+            109, 219, 182, 141, 195, 182, 109, 27, 135, 145, 36, 73, 14, 219, 182, 109, 28, 0, 0, 216,
+            56, 0, 0, 54, 110, 192, 182, 141, 27, 128, 145, 228, 6, 0, 219, 182, 1, 0, 219, 182,
+            1, 0, 70, 146, 3, 0, 108, 219, 6, 0, 0, 0, 0, 216, 6, 0, 0, 48, 14, 0,
+            0, 96, 28, 0, 0, 216, 56, 0, 192, 54, 110, 216, 182, 145, 27, 48, 146, 220, 6, 96,
+            219, 54, 0, 0, 192, 182, 1, 216, 200, 13, 27, 55, 110, 227, 182, 113, 227, 128, 113, 227,
+            128, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 27, 55, 110, 216, 200, 13, 192, 182, 1,
+            192, 182, 109, 220, 72, 110, 27, 7, 140, 3, 198, 1, 227, 128, 113, 192, 56, 96, 28, 48,
+            14, 216, 6, 216, 182, 13, 27, 73, 110, 227, 182, 113, 227, 128, 113, 227, 176, 113, 219, 54,
+            110, 192, 198, 13, 216, 184, 1, 27, 55, 0, 227, 182, 109, 35, 73, 114, 219, 182, 109, 216,
+            182, 13, 27, 73, 110, 227, 182, 113, 227, 128, 113, 219, 182, 113, 216, 72, 110, 192, 182, 113,
+            219, 128, 113, 227, 128, 113, 227, 182, 113, 27, 73, 110, 216, 182, 13, 0, 182, 13, 192, 70,
+            14, 216, 56, 14, 27, 55, 14, 227, 54, 14, 227, 48, 14, 227, 48, 14, 227, 54, 110, 35,
+            73, 114, 219, 54, 110, 0, 48, 14, 0, 176, 13, 219, 182, 109, 35, 73, 114, 227, 182, 109,
+            227, 0, 0, 227, 182, 13, 35, 73, 110, 219, 182, 113, 0, 128, 113, 219, 128, 113, 227, 182,
+            113, 27, 73, 110, 216, 182, 13, 216, 182, 13, 27, 73, 110, 227, 182, 113, 227, 128, 109, 227,
+            182, 13, 35, 73, 110, 227, 182, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 27, 73, 110,
+            216, 182, 13, 219, 182, 109, 35, 73, 114, 219, 182, 113, 0, 128, 113, 0, 176, 113, 0, 48,
+            110, 0, 54, 14, 0, 198, 13, 192, 198, 1, 192, 184, 1, 192, 56, 0, 192, 54, 0, 216,
+            182, 13, 27, 73, 110, 227, 182, 113, 227, 128, 113, 227, 182, 113, 27, 73, 110, 227, 182, 113,
+            227, 128, 113, 227, 128, 113, 227, 182, 113, 27, 73, 110, 216, 182, 13, 216, 182, 13, 27, 73,
+            110, 227, 182, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 27, 73, 114, 216, 182, 113, 27,
+            128, 113, 227, 182, 113, 27, 73, 110, 216, 182, 13, 216, 182, 13, 27, 73, 110, 227, 182, 113,
+            227, 128, 113, 227, 128, 113, 227, 182, 113, 35, 73, 114, 227, 182, 113, 227, 128, 113, 227, 128,
+            113, 227, 128, 113, 219, 128, 109, 219, 182, 13, 35, 73, 110, 227, 182, 113, 227, 128, 113, 227,
+            182, 113, 35, 73, 110, 227, 182, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 35, 73, 110,
+            219, 182, 13, 216, 182, 13, 27, 73, 110, 227, 182, 113, 227, 128, 113, 227, 128, 109, 227, 0,
+            0, 227, 0, 0, 227, 128, 109, 227, 128, 113, 227, 182, 113, 27, 73, 110, 216, 182, 13, 219,
+            182, 13, 35, 73, 110, 227, 182, 113, 227, 128, 113, 227, 128, 113, 227, 128, 113, 227, 128, 113,
+            227, 128, 113, 227, 128, 113, 227, 182, 113, 35, 73, 110, 219, 182, 13, 219, 182, 109, 35, 73,
+            114, 227, 182, 109, 227, 0, 0, 227, 182, 13, 35, 73, 14, 227, 182, 13, 227, 0, 0, 227,
+            0, 0, 227, 182, 109, 35, 73, 114, 219, 182, 109, 219, 182, 109, 35, 73, 114, 227, 182, 109,
+            227, 0, 0, 227, 182, 13, 35, 73, 14, 227, 182, 13, 227, 0, 0, 227, 0, 0, 227, 0,
+            0, 227, 0, 0, 219, 0, 0, 216, 182, 13, 27, 73, 110, 227, 182, 113, 227, 128, 109, 227,
+            0, 0, 227, 182, 109, 227, 70, 114, 227, 182, 113, 227, 128, 113, 227, 182, 113, 27, 73, 110,
+            216, 182, 13, 219, 128, 109, 227, 128, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 35, 73,
+            114, 227, 182, 113, 227, 128, 113, 227, 128, 113, 227, 128, 113, 227, 128, 113, 219, 128, 109, 219,
+            182, 145, 220, 198, 13, 227, 128, 113, 192, 56, 96, 28, 48, 14, 24, 135, 141, 219, 72, 110,
+            219, 6, 0, 128, 109, 0, 128, 113, 0, 128, 113, 0, 128, 113, 0, 128, 113, 0, 128, 113,
+            0, 128, 113, 219, 128, 113, 227, 128, 113, 227, 182, 113, 27, 73, 110, 216, 182, 13, 219, 0,
+            0, 227, 128, 109, 227, 176, 113, 227, 54, 110, 227, 198, 13, 35, 185, 1, 35, 55, 0, 227,
+            184, 1, 227, 198, 13, 227, 54, 110, 227, 176, 113, 219, 128, 109, 219, 0, 0, 227, 0, 0,
+            227, 0, 0, 227, 0, 0, 227, 0, 0, 227, 0, 0, 227, 0, 0, 227, 0, 0, 227, 0,
+            0, 227, 182, 109, 35, 73, 114, 219, 182, 109, 219, 128, 109, 227, 128, 113, 227, 182, 113, 35,
+            55, 114, 35, 55, 114, 227, 200, 113, 227, 200, 113, 227, 182, 113, 227, 128, 113, 227, 128, 113,
+            227, 128, 113, 219, 128, 109, 219, 128, 109, 227, 134, 113, 35, 135, 113, 35, 183, 113, 227, 184,
+            113, 227, 184, 113, 227, 198, 113, 227, 198, 113, 227, 54, 114, 227, 48, 114, 227, 176, 113, 219,
+            128, 109, 216, 182, 13, 27, 73, 110, 227, 182, 113, 227, 128, 113, 227, 128, 113, 227, 128, 113,
+            227, 128, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 27, 73, 110, 216, 182, 13, 219, 182,
+            13, 35, 73, 110, 227, 182, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 35, 73, 110, 227,
+            182, 13, 227, 0, 0, 227, 0, 0, 227, 0, 0, 219, 0, 0, 216, 182, 13, 27, 73, 110,
+            227, 182, 113, 227, 128, 113, 227, 128, 113, 227, 128, 113, 227, 128, 113, 227, 128, 113, 227, 182,
+            113, 227, 184, 113, 27, 73, 110, 216, 198, 13, 0, 182, 1, 219, 182, 13, 35, 73, 110, 227,
+            182, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 35, 73, 110, 227, 54, 110, 227, 176, 113,
+            227, 128, 113, 227, 128, 113, 219, 128, 109, 216, 182, 13, 27, 73, 110, 227, 182, 113, 227, 128,
+            109, 227, 182, 13, 27, 73, 110, 216, 182, 113, 0, 128, 113, 219, 128, 113, 227, 182, 113, 27,
+            73, 110, 216, 182, 13, 219, 182, 109, 35, 73, 114, 219, 184, 109, 192, 56, 0, 192, 56, 0,
+            192, 56, 0, 192, 56, 0, 192, 56, 0, 192, 56, 0, 192, 56, 0, 192, 56, 0, 192, 54,
+            0, 219, 128, 109, 227, 128, 113, 227, 128, 113, 227, 128, 113, 227, 128, 113, 227, 128, 113, 227,
+            128, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 27, 73, 110, 216, 182, 13, 219, 128, 109,
+            227, 128, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 27, 55, 110, 24, 55, 14, 24, 55,
+            14, 216, 200, 13, 192, 200, 1, 192, 200, 1, 192, 182, 1, 219, 128, 109, 227, 128, 113, 227,
+            128, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 227, 200, 113, 227, 200, 113, 35, 55, 114,
+            35, 55, 114, 227, 182, 113, 219, 128, 109, 219, 128, 109, 227, 128, 113, 227, 128, 113, 27, 55,
+            110, 24, 55, 14, 216, 200, 13, 216, 200, 13, 24, 55, 14, 27, 55, 110, 227, 182, 113, 227,
+            128, 113, 219, 128, 109, 219, 0, 108, 27, 7, 96, 220, 184, 97, 227, 54, 14, 227, 134, 113,
+            27, 7, 108, 28, 55, 0, 227, 56, 0, 216, 184, 1, 0, 198, 1, 0, 48, 14, 0, 128,
+            113, 0, 0, 108, 3, 0, 219, 182, 109, 35, 73, 114, 219, 182, 113, 0, 176, 113, 0, 54,
+            110, 192, 198, 13, 216, 184, 1, 27, 55, 0, 227, 6, 0, 227, 182, 109, 35, 73, 114, 219,
+            182, 109, 216, 182, 13, 24, 73, 110, 216, 182, 113, 27, 73, 114, 227, 182, 113, 227, 182, 113,
+            27, 73, 114, 216, 182, 109, 219, 0, 0, 227, 0, 0, 227, 0, 0, 227, 182, 13, 35, 73,
+            110, 227, 182, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 35, 73, 110, 219, 182, 13, 216,
+            182, 13, 27, 73, 110, 227, 182, 113, 227, 128, 109, 227, 128, 109, 227, 182, 113, 27, 73, 110,
+            216, 182, 13, 0, 128, 109, 0, 128, 113, 0, 128, 113, 216, 182, 113, 27, 73, 114, 227, 182,
+            113, 227, 128, 113, 227, 128, 113, 227, 182, 113, 27, 73, 114, 216, 182, 109, 216, 182, 13, 27,
+            73, 110, 227, 182, 113, 227, 182, 113, 35, 73, 114, 227, 182, 109, 27, 73, 114, 216, 182, 109,
+            0, 182, 13, 216, 200, 1, 227, 182, 109, 220, 54, 146, 228, 182, 113, 27, 48, 14, 0, 198,
+            1, 192, 56, 0, 24, 7, 0, 219, 0, 216, 182, 109, 27, 73, 114, 227, 182, 113, 227, 128,
+            113, 227, 182, 113, 27, 73, 114, 216, 182, 113, 216, 182, 113, 24, 73, 110, 219, 0, 0, 227,
+            0, 0, 227, 0, 0, 227, 182, 13, 35, 73, 110, 227, 182, 113, 227, 128, 113, 227, 128, 113,
+            227, 128, 113, 227, 128, 113, 219, 128, 109, 219, 198, 109, 27, 55, 110, 220, 184, 113, 227, 182,
+            1, 0, 182, 1, 24, 7, 96, 27, 128, 113, 0, 198, 1, 24, 7, 96, 220, 182, 113, 35,
+            185, 109, 219, 0, 219, 0, 0, 227, 0, 0, 227, 128, 109, 227, 176, 113, 227, 54, 110, 227,
+            198, 13, 35, 185, 1, 227, 198, 13, 227, 54, 110, 227, 176, 113, 219, 128, 109, 219, 54, 114,
+            27, 135, 113, 24, 135, 113, 24, 135, 113, 24, 135, 113, 216, 6, 219, 182, 1, 35, 73, 14,
+            227, 184, 113, 227, 184, 113, 227, 184, 113, 227, 184, 113, 227, 184, 113, 219, 182, 13, 219, 182,
+            13, 227, 72, 110, 35, 183, 113, 227, 134, 113, 227, 128, 113, 227, 128, 113, 227, 128, 113, 219,
+            128, 109, 216, 182, 13, 27, 73, 110, 227, 182, 113, 227, 128, 113, 227, 128, 113, 227, 182, 113,
+            27, 73, 110, 216, 182, 13, 219, 182, 13, 35, 73, 110, 227, 182, 113, 227, 128, 113, 227, 182,
+            113, 35, 73, 110, 227, 182, 13, 227, 0, 0, 227, 0, 0, 216, 182, 109, 27, 73, 114, 227,
+            182, 113, 227, 128, 113, 227, 182, 113, 27, 73, 114, 216, 182, 113, 0, 128, 113, 0, 128, 113,
+            219, 182, 97, 28, 185, 141, 220, 184, 113, 195, 54, 14, 0, 198, 1, 192, 56, 0, 216, 6,
+            0, 216, 182, 109, 27, 73, 114, 227, 182, 109, 27, 73, 110, 219, 182, 113, 227, 182, 113, 27,
+            73, 110, 216, 182, 13, 192, 54, 96, 27, 183, 141, 36, 185, 109, 220, 0, 140, 3, 128, 113,
+            0, 48, 110, 3, 54, 114, 0, 182, 13, 219, 128, 109, 227, 128, 113, 227, 128, 113, 227, 128,
+            113, 227, 128, 113, 227, 182, 113, 27, 73, 114, 216, 182, 109, 219, 128, 109, 227, 128, 113, 227,
+            182, 113, 24, 55, 110, 24, 55, 14, 216, 200, 13, 192, 200, 1, 192, 182, 1, 219, 128, 109,
+            227, 128, 113, 227, 182, 113, 227, 184, 113, 227, 184, 113, 227, 184, 113, 27, 71, 110, 216, 182,
+            13, 219, 128, 109, 227, 182, 113, 27, 55, 110, 216, 200, 13, 216, 200, 13, 27, 55, 110, 227,
+            182, 113, 219, 128, 109, 219, 176, 109, 28, 198, 141, 195, 184, 113, 24, 55, 110, 227, 54, 146,
+            28, 182, 141, 195, 182, 113, 24, 201, 13, 219, 182, 109, 35, 73, 114, 219, 54, 110, 192, 198,
+            13, 216, 184, 1, 27, 183, 109, 35, 73, 114, 219, 182, 109, 219, 198, 141, 27, 55, 110, 220,
+            184, 109, 219, 198, 141, 219, 6, 216, 182, 109, 216, 72, 146, 219, 184, 109, 227, 198, 1, 27,
+            183, 13, 219, 56, 0, 27, 185, 1, 24, 183, 1, 192, 56, 0, 0, 182, 1, 0, 48, 14,
+            0, 128, 113, 0, 0, 108, 3, 0, 219, 48, 110, 27, 135, 109, 219, 182, 145, 220, 56, 110,
+            36, 183, 109, 3, 219, 182, 109, 27, 55, 110, 220, 182, 109, 219, 0, 219, 54, 114, 35, 183,
+            109, 0, 176, 13, 0, 198, 1, 216, 56, 0, 227, 6, 108, 28, 128, 113, 3, 54, 14, 192,
+            184, 1, 27, 7, 96, 220, 0, 140, 3, 128, 109, 0, 0, 219, 182, 141, 36, 55, 110, 219,
+            56, 0, 227, 0, 140, 3, 48, 14, 192, 56, 0, 219, 0, 0, 0, 182, 1, 24, 7, 96,
+            28, 128, 113, 0, 198, 1, 24, 183, 109, 220, 72, 114, 219, 182, 1, 219, 182, 109, 36, 201,
+            141, 219, 184, 113, 36, 55, 142, 219, 198, 113, 192, 56, 14, 24, 199, 1, 35, 57, 96, 219,
+            6, 0, 192, 182, 13, 24, 201, 1, 227, 56, 96, 28, 7, 140, 227, 182, 113, 220, 72, 142,
+            27, 183, 113, 35, 73, 110, 219, 182, 1, 192, 54, 108, 28, 198, 109, 227, 48, 110, 24, 7,
+            140, 3, 198, 13, 27, 7, 140, 27, 54, 14, 216, 6, 219, 128, 113, 195, 198, 1, 227, 134,
+            141, 3, 198, 1, 227, 176, 113, 24, 183, 141, 195, 184, 97, 27, 0, 0, 182, 1, 0, 54,
+            110, 0, 54, 146, 27, 54, 142, 227, 54, 110, 220, 184, 109, 227, 182, 97, 35, 185, 1, 227,
+            54, 14, 24, 183, 113, 192, 184, 141, 3, 54, 146, 27, 128, 109, 27, 0, 192, 182, 13, 192,
+            70, 114, 3, 198, 109, 28, 48, 110, 227, 128, 113, 27, 7, 108, 36, 55, 108, 27, 183, 109,
+            36, 73, 114, 219, 198, 109, 3, 48, 14, 0, 128, 113, 0, 0, 108, 3, 0, 0, 182, 1,
+            0, 48, 14, 0, 128, 113, 0, 182, 141, 219, 54, 146, 36, 185, 109, 227, 182, 1, 24, 7,
+            0, 192, 56, 0, 0, 182, 1, 0, 219, 182, 109, 27, 73, 146, 220, 182, 109, 219, 0, 219,
+            0, 108, 27, 55, 108, 220, 198, 109, 220, 176, 113, 220, 0, 108, 220, 0, 108, 28, 55, 108,
+            220, 198, 109, 220, 176, 113, 219, 0, 108, 3, 0, 182, 1, 0, 48, 14, 0, 128, 109, 0,
+            182, 109, 219, 54, 146, 36, 185, 109, 219, 182, 1, 216, 6, 0, 192, 56, 0, 0, 182, 1,
+            0, 219, 182, 109, 35, 73, 114, 219, 182, 109, 219, 182, 109, 35, 73, 114, 219, 182, 109, 216,
+            182, 109, 27, 185, 113, 227, 70, 110, 219, 182, 13, 219, 54, 114, 35, 183, 109, 0, 176, 109,
+            35, 55, 114, 219, 6, 219, 54, 114, 35, 183, 109, 0, 176, 109, 35, 55, 114, 27, 55, 110,
+            219, 0, 219, 54, 114, 35, 183, 109, 219, 54, 114, 35, 183, 113, 227, 6, 0, 182, 1, 0,
+            54, 110, 0, 54, 146, 27, 54, 146, 228, 54, 146, 36, 185, 145, 36, 201, 141, 28, 71, 110,
+            27, 201, 13, 192, 72, 14, 0, 182, 109, 0, 192, 182, 13, 0, 70, 114, 0, 54, 146, 27,
+            182, 145, 220, 54, 146, 36, 185, 145, 36, 201, 141, 28, 71, 110, 27, 201, 109, 192, 72, 14,
+            0, 182, 109, 0, 216, 182, 109, 216, 200, 145, 219, 72, 142, 228, 70, 146, 36, 55, 146, 36,
+            185, 141, 36, 185, 97, 35, 185, 1, 216, 184, 1, 0, 198, 1, 0, 176, 13, 0, 0, 182,
+            1, 0, 54, 110, 0, 54, 146, 27, 54, 146, 228, 54, 146, 36, 185, 145, 36, 201, 109, 36,
+            201, 13, 27, 201, 13, 192, 198, 13, 0, 176, 13, 0, 0, 0, 0, 0, 0, 0, 128, 109,
+            219, 0, 0, 182, 1, 0, 48, 14, 192, 182, 113, 219, 70, 146, 36, 183, 145, 36, 55, 108,
+            36, 55, 96, 35, 185, 1, 35, 71, 14, 24, 183, 113, 192, 54, 108, 3, 192, 182, 13, 192,
+            70, 114, 195, 198, 109, 220, 198, 141, 27, 55, 142, 227, 184, 113, 28, 199, 141, 227, 56, 110,
+            220, 184, 113, 27, 183, 113, 195, 70, 114, 3, 176, 109, 3, 0, 192, 182, 13, 192, 70, 114,
+            195, 198, 109, 220, 198, 13, 27, 55, 14, 192, 184, 113, 0, 198, 141, 3, 48, 110, 220, 176,
+            113, 27, 183, 113, 195, 70, 114, 3, 176, 109, 3, 0, 219, 182, 109, 27, 73, 146, 220, 184,
+            109, 227, 198, 1, 24, 55, 14, 192, 184, 113, 0, 198, 141, 3, 48, 110, 220, 182, 113, 35,
+            73, 146, 219, 182, 109, 27, 0, 182, 1, 0, 54, 110, 0, 48, 142, 3, 176, 113, 220, 128,
+            113, 24, 7, 140, 195, 56, 108, 28, 198, 109, 220, 182, 113, 35, 73, 146, 219, 182, 109, 27,
+            0, 182, 1, 0, 54, 110, 0, 54, 142, 27, 54, 14, 227, 54, 14, 192, 184, 113, 0, 198,
+            109, 28, 198, 13, 27, 199, 13, 192, 198, 13, 0, 176, 13, 0, 192, 182, 13, 192, 70, 114,
+            195, 198, 109, 220, 198, 141, 27, 55, 142, 227, 184, 113, 28, 199, 141, 227, 56, 110, 220, 72,
+            110, 27, 183, 109, 192, 70, 114, 0, 176, 109, 3, 0, 0, 182, 1, 0, 48, 110, 0, 128,
+            145, 27, 0, 140, 228, 6, 96, 28, 57, 0, 227, 198, 1, 24, 183, 13, 219, 56, 0, 27,
+            201, 1, 24, 73, 14, 192, 70, 110, 0, 176, 109, 0, 0, 216, 134, 109, 216, 184, 141, 195,
+            56, 110, 28, 198, 113, 220, 48, 142, 227, 128, 141, 227, 54, 96, 27, 199, 13, 24, 199, 113,
+            216, 56, 142, 195, 184, 113, 28, 198, 109, 220, 176, 13, 219, 0, 0, 0, 128, 109, 0, 0,
+            0, 0, 54, 0, 192, 54, 110, 3, 198, 109, 28, 176, 141, 219, 176, 141, 228, 134, 113, 36,
+            199, 109, 35, 185, 13, 219, 184, 13, 24, 183, 113, 192, 54, 110, 3, 128, 109, 0, 0, 0,
+            0, 0, 0, 216, 6, 192, 182, 1, 192, 70, 14, 0, 70, 114, 3, 48, 146, 28, 176, 145,
+            228, 134, 145, 36, 57, 140, 36, 201, 97, 36, 201, 13, 27, 73, 110, 195, 54, 146, 28, 128,
+            109, 219, 0, 0, 182, 1, 0, 54, 110, 0, 54, 146, 27, 54, 146, 228, 54, 146, 36, 185,
+            145, 36, 201, 141, 35, 57, 110, 219, 184, 109, 0, 198, 113, 0, 176, 113, 3, 0, 108, 3,
+            0, 192, 182, 13, 192, 70, 114, 3, 70, 146, 28, 48, 146, 228, 128, 145, 36, 7, 108, 36,
+            55, 108, 36, 201, 109, 36, 73, 114, 35, 73, 146, 219, 72, 146, 27, 182, 109, 27, 0, 216,
+            182, 109, 216, 184, 141, 219, 198, 109, 220, 54, 110, 227, 182, 109, 219, 182, 109, 219, 182, 141,
+            219, 54, 110, 35, 73, 110, 216, 182, 109, 0, 216, 182, 109, 216, 184, 141, 219, 56, 142, 227,
+            198, 113, 28, 183, 109, 219, 182, 109, 219, 182, 141, 36, 73, 110, 35, 73, 110, 216, 182, 109,
+            0, 216, 182, 109, 24, 183, 109, 220, 198, 109, 220, 198, 109, 27, 183, 141, 228, 182, 141, 36,
+            185, 109, 36, 201, 109, 35, 73, 110, 216, 182, 109, 0, 216, 182, 109, 216, 182, 109, 219, 184,
+            109, 227, 54, 110, 227, 182, 109, 219, 182, 109, 219, 182, 109, 35, 185, 109, 227, 54, 110, 216,
+            182, 109, 0, 0, 176, 13, 0, 176, 113, 3, 176, 145, 220, 128, 145, 36, 7, 108, 227, 54,
+            0, 24, 7, 0, 192, 56, 0, 192, 198, 1, 219, 198, 13, 24, 201, 13, 192, 182, 13, 0,
+            0, 0, 0, 128, 109, 27, 0, 219, 54, 0, 24, 201, 13, 192, 182, 113, 3, 0, 108, 28,
+            0, 0, 227, 0, 0, 24, 7, 0, 219, 184, 13, 24, 73, 114, 192, 70, 114, 3, 176, 113,
+            3, 0, 108, 3, 0, 219, 182, 1, 24, 73, 14, 192, 54, 110, 0, 54, 110, 3, 48, 146,
+            28, 128, 109, 219, 182, 1, 24, 73, 14, 192, 54, 110, 0, 54, 110, 3, 48, 146, 28, 128,
+            109, 219, 0, 73, 146, 36, 137, 36, 73, 74, 148, 40, 81, 162, 68, 137, 18, 73, 146, 148,
+            40, 73, 162, 68, 1, 16, 37, 10, 144, 40, 81, 128, 40, 73, 2, 36, 1, 72, 146, 36,
+            1, 34, 73, 82, 128, 72, 146, 20, 32, 145, 164, 4, 72, 146, 36, 65, 34, 73, 82, 18,
+            73, 146, 164, 68, 146, 36, 41, 145, 36, 73, 74, 34, 73, 82, 130, 36, 73, 18, 0, 0,
+            0, 36, 9, 0, 0, 72, 164, 4, 0, 144, 72, 82, 130, 36, 145, 20, 41, 137, 36, 69,
+            138, 18, 73, 146, 162, 36, 145, 18, 41, 9, 16, 41, 145, 2, 0, 145, 36, 41, 0, 144,
+            72, 82, 2, 0, 72, 146, 4, 0, 0, 64, 146, 36, 1, 144, 72, 146, 18, 36, 146, 18,
+            41, 137, 36, 37, 145, 18, 73, 74, 18, 37, 74, 146, 36, 74, 148, 36, 146, 148, 72, 73,
+            36, 41, 137, 148, 72, 74, 144, 72, 146, 18, 0, 73, 146, 4, 0, 73, 146, 36, 73, 34,
+            73, 146, 164, 68, 73, 146, 68, 137, 148, 36, 145, 18, 69, 73, 20, 37, 74, 36, 37, 74,
+            148, 36, 73, 148, 40, 73, 146, 40, 81, 146, 36, 81, 34, 73, 146, 164, 36, 73, 146, 36,
+            1, 72, 146, 4, 136, 36, 5, 136, 36, 5, 73, 146, 36, 145, 36, 41, 145, 36, 41, 73,
+            146, 36, 145, 36, 41, 145, 36, 41, 145, 36, 41, 73, 146, 36, 0, 144, 36, 1, 0, 36,
+            146, 18, 0, 137, 36, 41, 1, 34, 37, 137, 130, 36, 9, 144, 36, 145, 148, 0, 64, 20,
+            73, 1, 128, 72, 146, 2, 0, 145, 36, 5, 0, 18, 73, 9, 0, 32, 73, 2, 0, 0,
+            64, 146, 36, 0, 18, 73, 74, 144, 72, 146, 148, 68, 146, 36, 41, 145, 148, 72, 74, 146,
+            36, 73, 18, 73, 137, 164, 68, 146, 36, 41, 137, 36, 73, 9, 18, 73, 74, 0, 36, 73,
+            2, 0, 0, 16, 0, 0, 0, 0, 81, 128, 36, 0, 128, 72, 137, 164, 0, 73, 36, 73,
+            10, 16, 73, 74, 162, 0, 64, 34, 37, 82, 0, 0, 136, 148, 72, 9, 0, 68, 73, 36,
+            41, 64, 36, 73, 74, 2, 68, 82, 34, 5, 0, 144, 4, 136, 2, 0, 0, 0, 32, 0,
+            0, 0, 2, 0, 64, 20, 0, 136, 148, 4, 145, 36, 41, 136, 148, 4, 64, 20, 0, 0,
+            2, 0, 0, 2, 0, 136, 2, 32, 146, 130, 72, 146, 130, 68, 9, 128, 40, 0, 16, 5,
+            0, 16, 0, 0, 2, 0, 136, 2, 0, 81, 0, 36, 74, 16, 73, 82, 16, 73, 1, 16,
+            5, 0, 16, 0, 0, 16, 0, 0, 162, 0, 72, 34, 5, 145, 36, 41, 72, 34, 5, 0,
+            162, 0, 0, 16, 0, 8, 0, 32, 10, 0, 68, 10, 128, 72, 10, 16, 73, 10, 34, 73,
+            74, 36, 41, 136, 164, 0, 145, 2, 32, 10, 0, 32, 0, 0, 64, 18, 0, 0, 34, 41,
+            0, 16, 37, 81, 0, 68, 65, 20, 0, 136, 162, 4, 0, 34, 37, 10, 16, 37, 138, 2,
+            68, 65, 20, 0, 81, 18, 41, 1, 34, 41, 145, 2, 36, 1, 18, 0, 0,
         };
     } // namespace BOLD_FONT
 } // namespace IO
@@ -41,6 +41,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "battle/battleTrainer.h"
 #include "defines.h"
 #include "fs/fs.h"
+#include "io/backBuffer.h"
 #include "io/choiceBox.h"
 #include "io/keyboard.h"
 #include "io/menu.h"
@@ -54,6 +55,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "map/mapObject.h"
 #include "map/mapSlice.h"
 #include "pokemon.h"
+#include "prof/profiler.h"
 #include "save/saveGame.h"
 #include "save/startScreen.h"
 #include "sound/sound.h"
@@ -167,6 +169,8 @@ constexpr u8 getMonthBound( u8 p_month, u8 p_year ) {
 }
 
 void vblankIRQ( ) {
+    IO::BACK_BUFFER.vblank( );
+
     auto ct      = std::time( nullptr );
     auto tStruct = std::gmtime( &ct );
     if( ( ++TIME_COUNT % 60 ) == 0 ) {
@@ -236,6 +240,9 @@ START:
     // sysSetBusOwners( true, true );
 
     irqEnable( IRQ_VBLANK );
+#ifdef DESQUID
+    PROF::init( );
+#endif
     initGraphics( );
 #ifdef DESQUID
     printf( "\n\nBooting NEO.\n"
@@ -41,6 +41,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "io/strings.h"
 #include "io/uio.h"
 #include "map/mapDrawer.h"
+#include "prof/profiler.h"
 #include "save/gameStart.h"
 #include "save/saveGame.h"
 #include "sound/sound.h"
@@ -200,6 +201,7 @@ namespace MAP {
     }
 
     BATTLE::battle::battleEndReason mapDrawer::battleWildPkmn( wildPkmnType p_type ) {
+        PROFILE_BLOCKING( );
         u8 platform = 0, plat2 = 0;
         u8 battleBack = p_type == WATER ? currentData( ).m_surfBattleBG : currentData( ).m_battleBG;
         switch( p_type ) {
@@ -288,6 +290,7 @@ namespace MAP {
         if( rn > 40 || !level ) {
             if( p_type == OLD_ROD || p_type == GOOD_ROD || p_type == SUPER_ROD ) {
                 _playerIsFast = false;
+                PROFILE_BLOCKING( );
                 IO::printMessage( GET_STRING( IO::STR_MAP_FISH_FAIL_OLD_BALL ) );
             }
             return false;
@@ -298,6 +301,7 @@ namespace MAP {
         if( !getWildPkmnSpecies( p_type, pkmnId, pkmnForme ) ) {
             if( p_type == OLD_ROD || p_type == GOOD_ROD || p_type == SUPER_ROD ) {
                 _playerIsFast = false;
+                PROFILE_BLOCKING( );
                 IO::printMessage( GET_STRING( IO::STR_MAP_FISH_FAIL_OLD_BALL ) );
             }
             return false;
@@ -305,6 +309,7 @@ namespace MAP {
 
         if( p_type == OLD_ROD || p_type == GOOD_ROD || p_type == SUPER_ROD ) {
             _playerIsFast = false;
+            PROFILE_BLOCKING( );
             IO::printMessage( GET_STRING( IO::STR_MAP_FISH_SUCCESSS_PKMN ) );
         } else if( SAVE::SAV.getActiveFile( ).m_repelSteps && !p_forceEncounter ) {
             return false;
@@ -28,6 +28,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "fs/fs.h"
 #include "gen/trainerClassNames.h"
 #include "map/mapBattleFacilityDefines.h"
+#include "map/mapBattleFacilityPool.h"
 #include "map/mapDrawer.h"
 
 namespace MAP {
@@ -111,35 +112,11 @@ namespace MAP {
             return false;
         }
 
-        NEXT_OPPONENT.m_data.m_numPokemon = p_rules.m_battleMode == BATTLE::BM_SINGLE ? 3 : 4;
         if( p_randomTeam ) {
             // choose random pkmn
-            for( u8 i = 0; i < NEXT_OPPONENT.m_data.m_numPokemon; ++i ) {
-                u16 species = 0;
-                u8  variant = NO_VARIANT;
-
-                while( !species || variant == NO_VARIANT ) {
-                    species = rand( ) % MAX_PKMN;
-                    variant = getSpeciesVariantForStreak( species, p_streak );
-
-                    if( variant == NO_VARIANT ) { continue; }
-
-                    if( !FS::loadBattleFacilityPkmn( species, variant, p_rules.m_level, p_streak,
-                                                     &NEXT_OPPONENT.m_data.m_pokemon[ i ] ) ) {
-                        species = 0;
-                        continue;
-                    }
-
-                    for( u8 j = 0; j < i; ++j ) {
-                        if( NEXT_OPPONENT.m_data.m_pokemon[ j ].getSpecies( ) == species
-                            || ( NEXT_OPPONENT.m_data.m_pokemon[ i ].getItem( )
-                                 && NEXT_OPPONENT.m_data.m_pokemon[ j ].getItem( )
-                                        == NEXT_OPPONENT.m_data.m_pokemon[ i ].getItem( ) ) ) {
-                            species = 0;
-                            continue;
-                        }
-                    }
-                }
+            BATTLE::battleRandom rng( rand( ) );
+            if( !drawFacilityTeam( p_rules, p_streak, NEXT_OPPONENT.m_data, rng ) ) {
+                return false;
             }
         } else {
             // load team
@@ -0,0 +1,252 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : mapBattleFacilityPool.cpp
+author      : Philip Wellnitz
+description : Pools of pre-built pkmn sets for the opponents in the battle facilities.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "fs/data.h"
+#include "map/mapBattleFacilityPool.h"
+
+#ifdef DESQUID
+#include "io/message.h"
+#include "prof/profiler.h"
+#endif
+
+namespace MAP {
+    facilityPool FACILITY_POOL;
+
+    bool facilityPool::load( u8 p_tier ) {
+        if( p_tier == _tier && _count ) { return true; }
+
+        clear( );
+        _count = FS::loadBattleFacilitySets( p_tier, _sets, MAX_FACILITY_SETS );
+
+        // find relies on the sets being sorted by species
+        if( !std::is_sorted( _sets, _sets + _count,
+                             []( const facilitySet& p_a, const facilitySet& p_b ) {
+                                 return p_a.m_speciesId < p_b.m_speciesId;
+                             } ) ) {
+            _count = 0;
+        }
+        for( u16 i = 0; i < _count; ++i ) { _order[ i ] = i; }
+        if( _count ) { _tier = p_tier; }
+        return _count;
+    }
+
+    void facilityPool::clear( ) {
+        _count = 0;
+        _tier  = NUM_FACILITY_TIERS;
+    }
+
+    bool facilityPool::add( const facilitySet& p_set ) {
+        if( _count >= MAX_FACILITY_SETS ) { return false; }
+        _sets[ _count ]  = p_set;
+        _order[ _count ] = _count;
+        _count++;
+        return true;
+    }
+
+    u16 facilityPool::find( u16 p_species, u8 p_variant ) const {
+        auto first = std::lower_bound(
+            _sets, _sets + _count, p_species,
+            []( const facilitySet& p_set, u16 p_sp ) { return p_set.m_speciesId < p_sp; } );
+        auto last = first;
+        while( last != _sets + _count && last->m_speciesId == p_species ) { ++last; }
+        if( first == last ) { return NO_FACILITY_SET; }
+        return u16( first - _sets ) + p_variant % u16( last - first );
+    }
+
+    u8 facilityPool::drawSets( u8 p_count, u16* p_out, BATTLE::battleRandom& p_rng ) {
+        u16 live = _count, draws = 0;
+        u8  res  = 0;
+        while( res < p_count && live ) {
+            u16 pos = p_rng.next( ) % live;
+            u16 set = _order[ pos ];
+
+            // move the set behind the range that is drawn from
+            _order[ pos ]     = _order[ --live ];
+            _order[ live ]    = set;
+            _draws[ draws++ ] = pos;
+
+            const auto& s = _sets[ set ];
+            if( test( _usedSpecies, s.m_speciesId )
+                || ( s.m_heldItem && test( _usedItems, s.m_heldItem ) ) ) {
+                continue;
+            }
+            flip( _usedSpecies, s.m_speciesId );
+            if( s.m_heldItem ) { flip( _usedItems, s.m_heldItem ); }
+            p_out[ res++ ] = set;
+        }
+
+#ifdef DESQUID
+        _teams++;
+        _drawn += draws;
+        _discarded += draws - res;
+#endif
+
+        // restore the permutation (the i-th draw swapped with position _count - 1 - i)
+        while( draws-- ) { std::swap( _order[ _draws[ draws ] ], _order[ _count - 1 - draws ] ); }
+        for( u8 i = 0; i < res; ++i ) {
+            flip( _usedSpecies, _sets[ p_out[ i ] ].m_speciesId );
+            if( _sets[ p_out[ i ] ].m_heldItem ) {
+                flip( _usedItems, _sets[ p_out[ i ] ].m_heldItem );
+            }
+        }
+        return res;
+    }
+
+    void facilityPool::createPkmn( u16 p_set, u8 p_level, u16 p_streak,
+                                   trainerPokemon* p_out ) const {
+        const auto& s      = _sets[ p_set ];
+        u16         streak = p_streak >= IV_MAX_STREAK ? IV_MAX_STREAK - 1 : p_streak;
+
+        p_out->m_speciesId = s.m_speciesId;
+        p_out->m_forme     = s.m_forme;
+        p_out->m_level     = p_level;
+        p_out->m_ability   = s.m_ability;
+        p_out->m_heldItem  = s.m_heldItem;
+        std::memcpy( p_out->m_moves, s.m_moves, sizeof( s.m_moves ) );
+        std::memcpy( p_out->m_ev, s.m_ev, sizeof( s.m_ev ) );
+        std::memset( p_out->m_iv, IV_FOR_STREAK[ streak ], sizeof( p_out->m_iv ) );
+        p_out->m_shiny  = 0;
+        p_out->m_nature = s.m_nature;
+    }
+
+    bool facilityPool::drawTeam( const ruleSet& p_rules, u16 p_streak,
+                                 BATTLE::trainerData& p_out, BATTLE::battleRandom& p_rng ) {
+        if( !load( getFacilityTierForStreak( p_streak ) ) ) { return false; }
+
+        u8  count = p_rules.m_battleMode == BATTLE::BM_SINGLE ? 3 : 4;
+        u16 sets[ BATTLE::trainerData::NUM_PKMN ];
+        if( drawSets( count, sets, p_rng ) < count ) { return false; }
+
+        p_out.m_numPokemon = count;
+        for( u8 i = 0; i < count; ++i ) {
+            createPkmn( sets[ i ], p_rules.m_level, p_streak, &p_out.m_pokemon[ i ] );
+        }
+        return true;
+    }
+
+    void drawSpeciesTeam( const ruleSet& p_rules, u16 p_streak, BATTLE::trainerData& p_out,
+                          BATTLE::battleRandom& p_rng ) {
+        p_out.m_numPokemon = p_rules.m_battleMode == BATTLE::BM_SINGLE ? 3 : 4;
+        for( u8 i = 0; i < p_out.m_numPokemon; ++i ) {
+            u16 species = 0;
+            u8  variant = NO_VARIANT;
+
+            while( !species || variant == NO_VARIANT ) {
+                species = p_rng.next( ) % MAX_PKMN;
+                variant = getSpeciesVariantForStreak( species, p_streak, p_rng.next( ) );
+
+                if( variant == NO_VARIANT ) { continue; }
+
+                if( !FS::loadBattleFacilityPkmn( species, variant, p_rules.m_level, p_streak,
+                                                 &p_out.m_pokemon[ i ] ) ) {
+                    species = 0;
+                    continue;
+                }
+
+                for( u8 j = 0; j < i; ++j ) {
+                    if( p_out.m_pokemon[ j ].getSpecies( ) == species
+                        || ( p_out.m_pokemon[ i ].getItem( )
+                             && p_out.m_pokemon[ j ].getItem( )
+                                    == p_out.m_pokemon[ i ].getItem( ) ) ) {
+                        species = 0;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    bool drawFacilityTeam( const ruleSet& p_rules, u16 p_streak, BATTLE::trainerData& p_out,
+                           BATTLE::battleRandom& p_rng ) {
+        if( FACILITY_POOL.load( getFacilityTierForStreak( p_streak ) ) ) {
+            return FACILITY_POOL.drawTeam( p_rules, p_streak, p_out, p_rng );
+        }
+        drawSpeciesTeam( p_rules, p_streak, p_out, p_rng );
+        return true;
+    }
+
+#ifdef DESQUID
+    void facilityPool::printStats( ) const {
+        char buffer[ 100 ];
+        snprintf( buffer, 99, "%hu sets (tier %hhu)\n%lu teams, %lu sets drawn\n%lu discarded",
+                  _count, _tier, _teams, _drawn, _discarded );
+        IO::printMessage( buffer, MSG_INFO );
+    }
+
+    void benchmarkFacilityPool( ) {
+        constexpr u16 NUM_TEAMS     = 10000;
+        constexpr u8  SETS_PER_PKMN = 3;
+        constexpr u8  NUM_ITEMS     = 40;
+
+        // synthetic pool: several sets per species, few different items
+        FACILITY_POOL.clear( );
+        for( u16 i = 0; i < MAX_FACILITY_SETS; ++i ) {
+            facilitySet s = { };
+            s.m_speciesId = 1 + i / SETS_PER_PKMN;
+            s.m_heldItem  = i % ( NUM_ITEMS + 1 ); // some sets hold no item
+            FACILITY_POOL.add( s );
+        }
+
+        BATTLE::battleRandom rng( 0 );
+        u16                  sets[ BATTLE::trainerData::NUM_PKMN ];
+        u32                  start = PROF::ticks( );
+        for( u16 t = 0; t < NUM_TEAMS; ++t ) {
+            FACILITY_POOL.drawSets( BATTLE::trainerData::NUM_PKMN, sets, rng );
+        }
+        u32 ticks = PROF::ticks( ) - start;
+
+        // check the teams (drawn again with the same seed)
+        u16 invalid = 0;
+        rng.seed( 0 );
+        for( u16 t = 0; t < NUM_TEAMS; ++t ) {
+            u8   cnt = FACILITY_POOL.drawSets( BATTLE::trainerData::NUM_PKMN, sets, rng );
+            bool ok  = cnt == BATTLE::trainerData::NUM_PKMN;
+            for( u8 i = 0; ok && i < cnt; ++i ) {
+                for( u8 j = 0; j < i; ++j ) {
+                    const auto &a = FACILITY_POOL[ sets[ i ] ], &b = FACILITY_POOL[ sets[ j ] ];
+                    if( a.m_speciesId == b.m_speciesId
+                        || ( a.m_heldItem && a.m_heldItem == b.m_heldItem ) ) {
+                        ok = false;
+                    }
+                }
+            }
+            if( !ok ) { invalid++; }
+        }
+        FACILITY_POOL.clear( );
+
+        char buffer[ 100 ];
+        snprintf( buffer, 99, "%hu teams of %hhu in %luus\nInvalid teams: %hu", NUM_TEAMS,
+                  BATTLE::trainerData::NUM_PKMN, u32( u64( ticks ) * 1000 / PROF::TICKS_PER_MS ),
+                  invalid );
+        IO::printMessage( buffer, MSG_INFO );
+    }
+#endif
+} // namespace MAP
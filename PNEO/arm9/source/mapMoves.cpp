@@ -90,33 +90,13 @@ namespace BATTLE {
             // Check for badge 1
             if( !( SAVE::SAV.getActiveFile( ).m_HOENN_Badges & ( 1 << 0 ) ) ) { return false; }
 
-            for( u8 i = 0; i < SAVE::SAV.getActiveFile( ).m_mapObjectCount; ++i ) {
-                auto o = SAVE::SAV.getActiveFile( ).m_mapObjects[ i ];
-
-                if( o.second.m_pos.m_posX != tx || o.second.m_pos.m_posY != ty ) { continue; }
-                if( o.second.m_event.m_type == MAP::EVENT_HMOBJECT
-                    && o.second.m_event.m_data.m_hmObject.m_hmType
-                           == MAP::mapSpriteManager::SPR_CUT ) {
-                    return true;
-                }
-            }
-            return false;
+            return MAP::curMap->hasHMObject( tx, ty, MAP::mapSpriteManager::SPR_CUT );
         }
         case M_ROCK_SMASH: {
             // Check for badge 3
             if( !( SAVE::SAV.getActiveFile( ).m_HOENN_Badges & ( 1 << 2 ) ) ) { return false; }
 
-            for( u8 i = 0; i < SAVE::SAV.getActiveFile( ).m_mapObjectCount; ++i ) {
-                auto o = SAVE::SAV.getActiveFile( ).m_mapObjects[ i ];
-
-                if( o.second.m_pos.m_posX != tx || o.second.m_pos.m_posY != ty ) { continue; }
-                if( o.second.m_event.m_type == MAP::EVENT_HMOBJECT
-                    && o.second.m_event.m_data.m_hmObject.m_hmType
-                           == MAP::mapSpriteManager::SPR_ROCKSMASH ) {
-                    return true;
-                }
-            }
-            return false;
+            return MAP::curMap->hasHMObject( tx, ty, MAP::mapSpriteManager::SPR_ROCKSMASH );
         }
         case M_STRENGTH: {
             // Check for badge 4
@@ -125,17 +105,7 @@ namespace BATTLE {
             // Check if strength has already been used
             if( MAP::curMap->strengthEnabled( ) ) { return false; }
 
-            for( u8 i = 0; i < SAVE::SAV.getActiveFile( ).m_mapObjectCount; ++i ) {
-                auto o = SAVE::SAV.getActiveFile( ).m_mapObjects[ i ];
-
-                if( o.second.m_pos.m_posX != tx || o.second.m_pos.m_posY != ty ) { continue; }
-                if( o.second.m_event.m_type == MAP::EVENT_HMOBJECT
-                    && o.second.m_event.m_data.m_hmObject.m_hmType
-                           == MAP::mapSpriteManager::SPR_STRENGTH ) {
-                    return true;
-                }
-            }
-            return false;
+            return MAP::curMap->hasHMObject( tx, ty, MAP::mapSpriteManager::SPR_STRENGTH );
         }
 
         case M_FLY: {
@@ -38,6 +38,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "io/sprite.h"
 #include "io/uio.h"
 #include "map/mapDrawer.h"
+#include "prof/profiler.h"
 #include "save/gameStart.h"
 #include "save/saveGame.h"
 #include "sound/sound.h"
@@ -49,6 +50,100 @@ namespace MAP {
 #define SPR_PKMN_GFX 303
 #define SPR_CIRC_GFX 447
 
+    static_assert( SAVE::MAX_MAPOBJECT <= mapObjectIndex::MAX_OBJECTS );
+
+    void mapObjectIndex::clear( ) {
+        std::memset( _head, NO_OBJECT, sizeof( _head ) );
+        std::memset( _bucket, NOT_INDEXED, sizeof( _bucket ) );
+    }
+
+    void mapObjectIndex::remove( u8 p_objectId ) {
+        if( _bucket[ p_objectId ] == NOT_INDEXED ) { return; }
+
+        u8* cur = &_head[ _bucket[ p_objectId ] ];
+        while( *cur != NO_OBJECT && *cur != p_objectId ) { cur = &_next[ *cur ]; }
+        if( *cur == p_objectId ) { *cur = _next[ p_objectId ]; }
+        _bucket[ p_objectId ] = NOT_INDEXED;
+    }
+
+    void mapObjectIndex::update( u8 p_objectId, u16 p_globX, u16 p_globY ) {
+        if( _bucket[ p_objectId ] != NOT_INDEXED && _posX[ p_objectId ] == p_globX
+            && _posY[ p_objectId ] == p_globY ) {
+            return;
+        }
+        remove( p_objectId );
+
+        u8 b                  = bucket( p_globX, p_globY );
+        _next[ p_objectId ]   = _head[ b ];
+        _head[ b ]            = p_objectId;
+        _bucket[ p_objectId ] = b;
+        _posX[ p_objectId ]   = p_globX;
+        _posY[ p_objectId ]   = p_globY;
+    }
+
+    bool mapObjectIndex::contains( u8 p_objectId, u16 p_globX, u16 p_globY ) const {
+        return _bucket[ p_objectId ] != NOT_INDEXED && _posX[ p_objectId ] == p_globX
+               && _posY[ p_objectId ] == p_globY;
+    }
+
+    u8 mapObjectIndex::objectsAt( u16 p_globX, u16 p_globY, u8* p_out, u8 p_maxCount ) const {
+        u8 res = 0;
+        for( u8 cur = _head[ bucket( p_globX, p_globY ) ]; cur != NO_OBJECT && res < p_maxCount;
+             cur = _next[ cur ] ) {
+            if( _posX[ cur ] != p_globX || _posY[ cur ] != p_globY ) { continue; }
+
+            // keep the ids sorted, so that callers see objects in array order
+            u8 pos = res++;
+            while( pos && p_out[ pos - 1 ] > cur ) {
+                p_out[ pos ] = p_out[ pos - 1 ];
+                --pos;
+            }
+            p_out[ pos ] = cur;
+        }
+        return res;
+    }
+
+#ifdef DESQUID
+    void benchmarkMapObjectIndex( ) {
+        constexpr u8  NUM_OBJECTS = 200;
+        constexpr u16 NUM_QUERIES = 4096;
+
+        // synthetic objects scattered over an area of 4 map slices
+        position       objects[ NUM_OBJECTS ];
+        mapObjectIndex index;
+        for( u8 i = 0; i < NUM_OBJECTS; ++i ) {
+            objects[ i ] = { u16( rand( ) % ( 2 * SIZE ) ), u16( rand( ) % ( 2 * SIZE ) ), 3 };
+            index.update( i, objects[ i ].m_posX, objects[ i ].m_posY );
+        }
+
+        u32 linearHits = 0, indexHits = 0;
+        u8  tmp[ NUM_OBJECTS ];
+
+        u32 start = PROF::ticks( );
+        for( u16 q = 0; q < NUM_QUERIES; ++q ) {
+            u16 x = q % ( 2 * SIZE ), y = ( q / ( 2 * SIZE ) ) % ( 2 * SIZE );
+            for( u8 i = 0; i < NUM_OBJECTS; ++i ) {
+                if( objects[ i ].m_posX == x && objects[ i ].m_posY == y ) { ++linearHits; }
+            }
+        }
+        u32 linearTicks = PROF::ticks( ) - start;
+
+        start = PROF::ticks( );
+        for( u16 q = 0; q < NUM_QUERIES; ++q ) {
+            u16 x = q % ( 2 * SIZE ), y = ( q / ( 2 * SIZE ) ) % ( 2 * SIZE );
+            indexHits += index.objectsAt( x, y, tmp, NUM_OBJECTS );
+        }
+        u32 indexTicks = PROF::ticks( ) - start;
+
+        char buffer[ 100 ];
+        snprintf( buffer, 99, "%hu queries, %hhu objs\nlinear %luus, index %luus",
+                  NUM_QUERIES, NUM_OBJECTS, u32( u64( linearTicks ) * 1000 / PROF::TICKS_PER_MS ),
+                  u32( u64( indexTicks ) * 1000 / PROF::TICKS_PER_MS ) );
+        IO::printMessage( buffer, MSG_INFO );
+        if( linearHits != indexHits ) { IO::printMessage( "Index lookup mismatch!", MSG_INFO ); }
+    }
+#endif
+
     direction getRandomLookDirection( moveMode p_movement ) {
         u8 st = rand( ) % 4;
 
@@ -171,9 +266,79 @@ namespace MAP {
         // swap mo to position 0
         std::swap( SAVE::SAV.getActiveFile( ).m_mapObjects[ p_objectId ],
                    SAVE::SAV.getActiveFile( ).m_mapObjects[ _fixedObjectCount ] );
+        updateMapObjectIndex( p_objectId );
+        updateMapObjectIndex( _fixedObjectCount );
         return _fixedObjectCount++;
     }
 
+    void mapDrawer::updateMapObjectIndex( u8 p_objectId ) {
+        const auto& o = SAVE::SAV.getActiveFile( ).m_mapObjects[ p_objectId ];
+        if( o.first == UNUSED_MAPOBJECT ) {
+            _mapObjectIndex.remove( p_objectId );
+            return;
+        }
+        _mapObjectIndex.update( p_objectId, o.second.m_pos.m_posX, o.second.m_pos.m_posY );
+    }
+
+    void mapDrawer::rebuildMapObjectIndex( ) {
+        _mapObjectIndex.clear( );
+        for( u8 i = 0; i < SAVE::SAV.getActiveFile( ).m_mapObjectCount; ++i ) {
+            updateMapObjectIndex( i );
+        }
+    }
+
+    u8 mapDrawer::mapObjectsAt( u16 p_globX, u16 p_globY, u8* p_out ) const {
+        u8 cnt = _mapObjectIndex.objectsAt( p_globX, p_globY, p_out, MAX_OBJECTS_PER_TILE );
+        u8 res = 0;
+        for( u8 i = 0; i < cnt; ++i ) {
+            // guard against position changes that bypassed updateMapObjectIndex (which
+            // checkMapObjectIndex reports in DESQUID builds)
+            if( p_out[ i ] >= SAVE::SAV.getActiveFile( ).m_mapObjectCount ) { continue; }
+            const auto& o = SAVE::SAV.getActiveFile( ).m_mapObjects[ p_out[ i ] ].second;
+            if( o.m_pos.m_posX != p_globX || o.m_pos.m_posY != p_globY ) { continue; }
+            p_out[ res++ ] = p_out[ i ];
+        }
+        return res;
+    }
+
+    bool mapDrawer::hasHMObject( u16 p_globX, u16 p_globY, u8 p_hmType ) const {
+        u8 objs[ MAX_OBJECTS_PER_TILE ];
+        u8 cnt = mapObjectsAt( p_globX, p_globY, objs );
+        for( u8 i = 0; i < cnt; ++i ) {
+            const auto& o = SAVE::SAV.getActiveFile( ).m_mapObjects[ objs[ i ] ].second;
+            if( o.m_event.m_type == EVENT_HMOBJECT
+                && o.m_event.m_data.m_hmObject.m_hmType == p_hmType ) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+#ifdef DESQUID
+    void mapDrawer::checkMapObjectIndex( ) {
+        u16 start       = _indexCheckSlot;
+        _indexCheckSlot = ( start + INDEX_CHECK_SLOTS ) % SAVE::MAX_MAPOBJECT;
+        for( u16 i = start; i < start + INDEX_CHECK_SLOTS; ++i ) {
+            const auto& o    = SAVE::SAV.getActiveFile( ).m_mapObjects[ i ];
+            bool        used = i < SAVE::SAV.getActiveFile( ).m_mapObjectCount
+                        && o.first != UNUSED_MAPOBJECT;
+            if( used ? _mapObjectIndex.contains( i, o.second.m_pos.m_posX,
+                                                 o.second.m_pos.m_posY )
+                     : !_mapObjectIndex.isIndexed( i ) ) {
+                continue;
+            }
+
+            // don't repair the index, the bug that broke it needs to be found
+            char buffer[ 100 ];
+            snprintf( buffer, 99, "Map object index out of sync: mo %hu (%s) at %hu, %hu", i,
+                      used ? "stale position" : "not removed", o.second.m_pos.m_posX,
+                      o.second.m_pos.m_posY );
+            IO::printMessage( buffer, MSG_INFO );
+            while( true ) { swiWaitForVBlank( ); }
+        }
+    }
+#endif
+
     void mapDrawer::unfixMapObject( ) {
         _fixedObjectCount = 0;
     }
@@ -288,6 +453,7 @@ namespace MAP {
         moveMapObject( SAVE::SAV.getActiveFile( ).m_mapObjects[ p_objectId ].second,
                        SAVE::SAV.getActiveFile( ).m_mapObjects[ p_objectId ].first, p_movement,
                        p_movePlayer, p_playerMovement, p_adjustAnim );
+        updateMapObjectIndex( p_objectId );
     }
 
     /*
@@ -305,6 +471,11 @@ namespace MAP {
         lstsh = p_shiny;
         fm    = p_forme;
 
+        if( auto cached = OW_PKMN_SPRITE_CACHE.fits( { p_pkmnId, p_forme, p_shiny }, 32, 32 );
+            cached != -1 ) {
+            return lstres = cached;
+        }
+
         char buf[ 100 ];
         if( !p_forme ) {
             snprintf( buf, 99, "%d/%hu%s", p_pkmnId / ITEMS_PER_DIR, p_pkmnId, p_shiny ? "s" : "" );
@@ -326,6 +497,17 @@ namespace MAP {
         return lstres = true;
     }
 
+    void mapDrawer::prefetchFollowPkmnSprites( ) {
+        owPkmnSpriteCache::key keys[ owPkmnSpriteCache::CACHE_SIZE ];
+        u8                     cnt = 0;
+        for( u8 i = 0; i < SAVE::SAV.getActiveFile( ).getTeamPkmnCount( ); ++i ) {
+            auto& pk = SAVE::SAV.getActiveFile( ).m_pkmnTeam[ i ];
+            if( pk.isEgg( ) ) { continue; }
+            keys[ cnt++ ] = { pk.getSpecies( ), pk.getForme( ), pk.isShiny( ) };
+        }
+        OW_PKMN_SPRITE_CACHE.prefetch( keys, cnt );
+    }
+
     bool mapDrawer::updateFollowPkmn( ) {
         _followPkmnData        = nullptr;
         _followPkmnSpeciesData = nullptr;
@@ -333,6 +515,8 @@ namespace MAP {
         if( !teamCnt ) { return false; }
         if( _forceNoFollow ) { return false; }
 
+        prefetchFollowPkmnSprites( );
+
         // only if first pkmn is not ko, it will follow the player.
         if( !SAVE::SAV.getActiveFile( ).m_pkmnTeam[ 0 ].canBattle( ) ) { return false; }
 
@@ -610,6 +794,7 @@ namespace MAP {
             SAVE::SAV.getActiveFile( ).m_mapObjects[ i ] = { UNUSED_MAPOBJECT, mapObject( ) };
         }
         SAVE::SAV.getActiveFile( ).m_mapObjectCount = 0;
+        _mapObjectIndex.clear( );
         unfixMapObject( );
         _mapSprites.reset( );
     }
@@ -802,6 +987,7 @@ namespace MAP {
         for( u8 i = 0; i < res.size( ); ++i ) {
             SAVE::SAV.getActiveFile( ).m_mapObjects[ i + _fixedObjectCount ] = res[ i ];
         }
+        rebuildMapObjectIndex( );
 
         // force an update
         _mapSprites.update( );
@@ -810,10 +996,11 @@ namespace MAP {
     }
 
     void mapDrawer::destroyHMObject( u16 p_globX, u16 p_globY ) {
-        for( u8 i = 0; i < SAVE::SAV.getActiveFile( ).m_mapObjectCount; ++i ) {
-            auto& o = SAVE::SAV.getActiveFile( ).m_mapObjects[ i ];
+        u8 objs[ MAX_OBJECTS_PER_TILE ];
+        u8 cnt = mapObjectsAt( p_globX, p_globY, objs );
+        for( u8 i = 0; i < cnt; ++i ) {
+            auto& o = SAVE::SAV.getActiveFile( ).m_mapObjects[ objs[ i ] ];
 
-            if( o.second.m_pos.m_posX != p_globX || o.second.m_pos.m_posY != p_globY ) { continue; }
             if( o.second.m_event.m_type == MAP::EVENT_HMOBJECT ) {
                 if( o.second.m_event.m_data.m_hmObject.m_hmType
                     == mapSpriteManager::SPR_ROCKSMASH ) {
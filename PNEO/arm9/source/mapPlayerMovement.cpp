@@ -41,6 +41,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "io/strings.h"
 #include "io/uio.h"
 #include "map/mapDrawer.h"
+#include "prof/profiler.h"
 #include "save/gameStart.h"
 #include "save/saveGame.h"
 #include "sound/sound.h"
@@ -118,6 +119,7 @@ namespace MAP {
                         // player has only a single pkmn, the battle is optional
                         if( !BATTLE::isDoubleBattleTrainerClass( tr.m_data.m_trainerClass )
                             || SAVE::SAV.getActiveFile( ).countAlivePkmn( ) >= 2 ) {
+                            PROFILE_BLOCKING( );
 
                             SAVE::SAV.getActiveFile( ).m_mapObjects[ i ].second.m_movement
                                 = NO_MOVEMENT;
@@ -171,35 +173,60 @@ namespace MAP {
 
     void mapDrawer::stepOn( u16 p_globX, u16 p_globY, u8 p_z, bool p_allowWildPkmn, bool p_unfade,
                             bool p_runScripts ) {
-        animateField( p_globX, p_globY );
+        PROFILE_PHASE( STEP_ON );
+        {
+            PROFILE_PHASE( STEP_ANIMATE_FIELD );
+            animateField( p_globX, p_globY );
+        }
         u8 behave = at( p_globX, p_globY ).m_bottombehave;
 
-        auto curLocId = getCurrentLocationId( );
-        for( const auto& fn : _newLocationCallbacks ) { fn( curLocId, false ); }
+        {
+            PROFILE_PHASE( STEP_LOCATION_CALLBACKS );
+            auto curLocId = getCurrentLocationId( );
+            for( const auto& fn : _newLocationCallbacks ) { fn( curLocId, false ); }
+        }
 
         // Check for things that activate upon stepping on a tile
 
-        switch( behave ) {
-        case BEH_GRASS_ASH: { // Add ash to the soot bag
-            if( SAVE::SAV.getActiveFile( ).m_bag.count( BAG::toBagType( BAG::ITEMTYPE_KEYITEM ),
-                                                        I_SOOT_SACK ) ) {
-                SAVE::SAV.getActiveFile( ).m_ashCount++;
-                if( SAVE::SAV.getActiveFile( ).m_ashCount > 999'999'999 ) {
-                    SAVE::SAV.getActiveFile( ).m_ashCount = 999'999'999;
+        {
+            PROFILE_PHASE( STEP_BEHAVIOR );
+            switch( behave ) {
+            case BEH_GRASS_ASH: { // Add ash to the soot bag
+                if( SAVE::SAV.getActiveFile( ).m_bag.count(
+                        BAG::toBagType( BAG::ITEMTYPE_KEYITEM ), I_SOOT_SACK ) ) {
+                    SAVE::SAV.getActiveFile( ).m_ashCount++;
+                    if( SAVE::SAV.getActiveFile( ).m_ashCount > 999'999'999 ) {
+                        SAVE::SAV.getActiveFile( ).m_ashCount = 999'999'999;
+                    }
                 }
+                break;
+            }
+            default: break;
             }
-            break;
-        }
-        default: break;
         }
 
         if( p_unfade ) { unfadeScreen( ); }
 
         if( p_allowWildPkmn && !_scriptRunning ) {
-            if( !checkTrainerEye( p_globX, p_globY ) ) { handleWildPkmn( p_globX, p_globY ); }
+            bool trainerSpotted;
+            {
+                PROFILE_PHASE( STEP_TRAINER_EYE );
+                trainerSpotted = checkTrainerEye( p_globX, p_globY );
+            }
+            if( !trainerSpotted ) {
+                PROFILE_PHASE( STEP_WILD_PKMN );
+                handleWildPkmn( p_globX, p_globY );
+            }
         }
 
-        if( p_runScripts && !_scriptRunning ) { handleEvents( p_globX, p_globY, p_z ); }
+        if( p_runScripts && !_scriptRunning ) {
+            PROFILE_PHASE( STEP_EVENTS );
+            handleEvents( p_globX, p_globY, p_z );
+        }
+
+#ifdef DESQUID
+        checkMapObjectIndex( );
+#endif
     }
 
     bool mapDrawer::canMove( position p_start, direction p_direction, moveMode p_moveMode,
@@ -214,44 +241,48 @@ namespace MAP {
 
         if( p_events ) {
             // Check if any event is occupying the target block
-            for( u8 i = 0; i < SAVE::SAV.getActiveFile( ).m_mapObjectCount; ++i ) {
-                auto o = SAVE::SAV.getActiveFile( ).m_mapObjects[ i ];
-                if( ( o.second.m_pos.m_posX == nx && o.second.m_pos.m_posY == ny )
-                    || ( o.second.m_currentMovement.m_frame
-                         && o.second.m_pos.m_posX
-                                    + dir[ o.second.m_currentMovement.m_direction ][ 0 ]
-                                == nx
-                         && o.second.m_pos.m_posY
-                                    + dir[ o.second.m_currentMovement.m_direction ][ 1 ]
-                                == ny ) ) {
-                    switch( o.second.m_event.m_type ) {
-                    case EVENT_HMOBJECT:
-                        if( o.second.m_event.m_data.m_hmObject.m_hmType
-                            == mapSpriteManager::SPR_STRENGTH ) {
-                            // Check if the boulder could be moved by using strength
-                            if( p_moveMode == STRENGTH
-                                || !canMove( { nx, ny, p_start.m_posZ }, p_direction, STRENGTH ) ) {
-                                return false;
-                            }
-                            // Check if the player has actually used strength
-                            if( !_strengthUsed ) { return false; }
-                            break;
+            auto blocks = [ & ]( const mapObject& p_object ) {
+                switch( p_object.m_event.m_type ) {
+                case EVENT_HMOBJECT:
+                    if( p_object.m_event.m_data.m_hmObject.m_hmType
+                        == mapSpriteManager::SPR_STRENGTH ) {
+                        // Check if the boulder could be moved by using strength
+                        if( p_moveMode == STRENGTH
+                            || !canMove( { nx, ny, p_start.m_posZ }, p_direction, STRENGTH ) ) {
+                            return true;
                         }
-                        if( o.second.m_event.m_data.m_hmObject.m_hmType ) { return false; }
-                        break;
-                    case EVENT_ITEM:
-                        if( o.second.m_event.m_data.m_item.m_itemType ) {
-                            return false;
-                        } // item is not hidden
-                        break;
-                    case EVENT_NPC:
-                    case EVENT_NPC_MESSAGE:
-                    case EVENT_TRAINER:
-                    case EVENT_OW_PKMN:
-                    case EVENT_BERRYTREE: return false;
-                    case EVENT_GENERIC:
-                        if( o.second.m_event.m_trigger & TRIGGER_INTERACT ) { return false; }
-                    default: break;
+                        // Check if the player has actually used strength
+                        return !_strengthUsed;
+                    }
+                    return !!p_object.m_event.m_data.m_hmObject.m_hmType;
+                case EVENT_ITEM:
+                    // item is not hidden
+                    return !!p_object.m_event.m_data.m_item.m_itemType;
+                case EVENT_NPC:
+                case EVENT_NPC_MESSAGE:
+                case EVENT_TRAINER:
+                case EVENT_OW_PKMN:
+                case EVENT_BERRYTREE: return true;
+                case EVENT_GENERIC: return !!( p_object.m_event.m_trigger & TRIGGER_INTERACT );
+                default: return false;
+                }
+            };
+
+            u8 objs[ MAX_OBJECTS_PER_TILE ];
+            u8 cnt = mapObjectsAt( nx, ny, objs );
+            for( u8 i = 0; i < cnt; ++i ) {
+                if( blocks( SAVE::SAV.getActiveFile( ).m_mapObjects[ objs[ i ] ].second ) ) {
+                    return false;
+                }
+            }
+            // objects that are currently moving onto the target block
+            for( u8 d = 0; d < 4; ++d ) {
+                cnt = mapObjectsAt( nx - dir[ d ][ 0 ], ny - dir[ d ][ 1 ], objs );
+                for( u8 i = 0; i < cnt; ++i ) {
+                    const auto& o = SAVE::SAV.getActiveFile( ).m_mapObjects[ objs[ i ] ].second;
+                    if( o.m_currentMovement.m_frame && o.m_currentMovement.m_direction == d
+                        && blocks( o ) ) {
+                        return false;
                     }
                 }
             }
@@ -433,30 +464,32 @@ namespace MAP {
         }
 
         // Check if any event is occupying the target block and push it if necessary
-        for( u8 i = 0; i < SAVE::SAV.getActiveFile( ).m_mapObjectCount; ++i ) {
+        u8 objs[ MAX_OBJECTS_PER_TILE ];
+        u8 cnt = mapObjectsAt( nx, ny, objs );
+        for( u8 j = 0; j < cnt; ++j ) {
+            u8    i = objs[ j ];
             auto& o = SAVE::SAV.getActiveFile( ).m_mapObjects[ i ];
-            if( o.second.m_pos.m_posX == nx && o.second.m_pos.m_posY == ny ) {
-                switch( o.second.m_event.m_type ) {
-                case EVENT_HMOBJECT:
-                    if( o.second.m_event.m_data.m_hmObject.m_hmType
-                        == mapSpriteManager::SPR_STRENGTH ) {
-                        // Check if the boulder could be moved by using strength
-                        if( !canMove( { nx, ny, curz }, p_direction, STRENGTH ) ) { continue; }
-                        // Check if the player has actually used strength
-                        if( !_strengthUsed ) { continue; }
-
-                        // push the boulder one block in the current direction
-                        SOUND::playSoundEffect( SFX_HM_STRENGTH );
-                        for( u8 f = 0; f < 16; ++f ) {
-                            _mapSprites.moveSprite( o.first, p_direction, 1 );
-                            swiWaitForVBlank( );
-                        }
-                        o.second.m_pos.m_posX += dir[ p_direction ][ 0 ];
-                        o.second.m_pos.m_posY += dir[ p_direction ][ 1 ];
+            switch( o.second.m_event.m_type ) {
+            case EVENT_HMOBJECT:
+                if( o.second.m_event.m_data.m_hmObject.m_hmType
+                    == mapSpriteManager::SPR_STRENGTH ) {
+                    // Check if the boulder could be moved by using strength
+                    if( !canMove( { nx, ny, curz }, p_direction, STRENGTH ) ) { continue; }
+                    // Check if the player has actually used strength
+                    if( !_strengthUsed ) { continue; }
+
+                    // push the boulder one block in the current direction
+                    SOUND::playSoundEffect( SFX_HM_STRENGTH );
+                    for( u8 f = 0; f < 16; ++f ) {
+                        _mapSprites.moveSprite( o.first, p_direction, 1 );
+                        swiWaitForVBlank( );
                     }
-                    break;
-                default: break;
+                    o.second.m_pos.m_posX += dir[ p_direction ][ 0 ];
+                    o.second.m_pos.m_posY += dir[ p_direction ][ 1 ];
+                    updateMapObjectIndex( i );
                 }
+                break;
+            default: break;
             }
         }
 
@@ -933,6 +966,7 @@ namespace MAP {
     }
 
     void mapDrawer::warpPlayer( warpType p_type, warpPos p_target ) {
+        PROFILE_PHASE( MAP_WARP );
         u8   oldMapType = u8( currentData( ).m_mapType );
         bool checkPos   = false;
         _fastBike       = 0;
@@ -942,6 +976,7 @@ namespace MAP {
         bool crossbank = false;
         if( p_target.first != SAVE::SAV.getActiveFile( ).m_currentMap ) {
             SAVE::SAV.getActiveFile( ).m_mapObjectCount = 0;
+            _mapObjectIndex.clear( );
         }
         if( !FSDATA.isOWMap( p_target.first )
             && FSDATA.isOWMap( SAVE::SAV.getActiveFile( ).m_currentMap ) ) {
@@ -42,6 +42,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "io/sprite.h"
 #include "io/uio.h"
 #include "map/mapDrawer.h"
+#include "prof/profiler.h"
 #include "save/saveGame.h"
 #include "sound/sound.h"
 #include "spx/specials.h"
@@ -312,6 +313,10 @@ namespace MAP {
         if( CURRENT_SCRIPT == p_scriptId ) { return; }
         CURRENT_SCRIPT = p_scriptId;
 
+#ifdef DESQUID
+        PROF::scriptProfile prof( p_scriptId );
+#endif
+
         FILE* f = FS::openScript( p_scriptId );
         if( !f ) {
             CURRENT_SCRIPT = -1;
@@ -368,6 +373,9 @@ namespace MAP {
             u16  parA  = PARAMA( SCRIPT_INS[ pc ] );
             u16  parB  = PARAMB( SCRIPT_INS[ pc ] );
 
+#ifdef DESQUID
+            prof.beginOpcode( ins );
+#endif
 #ifdef DESQUID_MORE
             IO::printMessage( ( std::to_string( pc ) + ": " + std::to_string( ins ) + " ( "
                                 + std::to_string( par1 ) + " , " + std::to_string( par2 ) + " , "
@@ -468,6 +476,7 @@ namespace MAP {
                 }
 
                 SAVE::SAV.getActiveFile( ).m_mapObjects[ registers[ 0 ] ] = cur;
+                updateMapObjectIndex( registers[ 0 ] );
                 break;
             }
             case WPL: {
@@ -564,6 +573,7 @@ namespace MAP {
                 _mapSprites.destroySprite( SAVE::SAV.getActiveFile( ).m_mapObjects[ par1 ].first );
                 SAVE::SAV.getActiveFile( ).m_mapObjects[ par1 ]
                     = { UNUSED_MAPOBJECT, mapObject( ) };
+                updateMapObjectIndex( par1 );
                 break;
             }
             case CFL: {
@@ -668,6 +678,7 @@ namespace MAP {
                     registers[ 0 ] = SAVE::SAV.getActiveFile( ).m_mapObjectCount++;
                 }
                 SAVE::SAV.getActiveFile( ).m_mapObjects[ registers[ 0 ] ] = cur;
+                updateMapObjectIndex( registers[ 0 ] );
                 break;
             }
             case MMOR: {
@@ -746,6 +757,7 @@ namespace MAP {
                     SAVE::SAV.getActiveFile( ).m_mapObjects[ registers[ par1 ] ].first );
                 SAVE::SAV.getActiveFile( ).m_mapObjects[ registers[ par1 ] ]
                     = { UNUSED_MAPOBJECT, mapObject( ) };
+                updateMapObjectIndex( registers[ par1 ] );
                 break;
             }
             case CFLR: {
@@ -2128,6 +2140,7 @@ namespace MAP {
                 }
             }
             if( mdata.m_events[ i ].m_trigger == TRIGGER_STEP_ON ) {
+                PROFILE_BLOCKING( );
                 runEvent( mdata.m_events[ i ] );
             }
         }
@@ -2263,7 +2276,13 @@ namespace MAP {
             }
         }
 
-        for( u8 i = 0; i < SAVE::SAV.getActiveFile( ).m_mapObjectCount; ++i ) {
+        // running an event may move or destroy other map objects, so the candidates are
+        // collected up front and re-checked individually
+        u8 objs[ MAX_OBJECTS_PER_TILE ];
+        u8 cnt = mapObjectsAt( p_globX, p_globY, objs );
+        for( u8 k = 0; k < cnt; ++k ) {
+            u8 i = objs[ k ];
+            if( i >= SAVE::SAV.getActiveFile( ).m_mapObjectCount ) { continue; }
             auto& o = SAVE::SAV.getActiveFile( ).m_mapObjects[ i ];
 
             if( o.second.m_pos.m_posX != p_globX || o.second.m_pos.m_posY != p_globY
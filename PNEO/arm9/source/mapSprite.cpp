@@ -85,22 +85,26 @@ namespace MAP {
     }
 
     char buf[ 100 ];
+    FILE* openPkmnSprite( u16 p_species, u8 p_forme, bool p_shiny, bool p_female ) {
+        if( !p_forme ) {
+            snprintf( buf, 99, "%d/%hu%s%s", p_species / ITEMS_PER_DIR, p_species,
+                      p_female ? "f" : "", p_shiny ? "s" : "" );
+        } else {
+            snprintf( buf, 99, "%d/%hu_%hhu%s%s", p_species / ITEMS_PER_DIR, p_species, p_forme,
+                      p_female ? "f" : "", p_shiny ? "s" : "" );
+        }
+        return FS::open( IO::OWP_PATH, buf, ".rsd" );
+    }
+
     mapSpriteData::mapSpriteData( u16 p_imageId, u8 p_forme, bool p_shiny, bool p_female ) {
         FILE* f;
         if( p_imageId > PKMN_SPRITE ) {
-            u16  species = p_imageId - PKMN_SPRITE;
-            u8   forme   = p_forme;
-            bool shiny   = p_shiny;
-            bool female  = p_female;
-
-            if( !forme ) {
-                snprintf( buf, 99, "%d/%hu%s%s", species / ITEMS_PER_DIR, species,
-                          female ? "f" : "", shiny ? "s" : "" );
-            } else {
-                snprintf( buf, 99, "%d/%hu_%hhu%s%s", species / ITEMS_PER_DIR, species, forme,
-                          female ? "f" : "", shiny ? "s" : "" );
+            u16 species = p_imageId - PKMN_SPRITE;
+
+            if( !p_female && OW_PKMN_SPRITE_CACHE.get( { species, p_forme, p_shiny }, *this ) ) {
+                return;
             }
-            f = FS::open( IO::OWP_PATH, buf, ".rsd" );
+            f = openPkmnSprite( species, p_forme, p_shiny, p_female );
 
 #ifdef DESQUID
             if( !f ) {
@@ -138,6 +142,138 @@ namespace MAP {
         readData( f );
     }
 
+    owPkmnSpriteCache OW_PKMN_SPRITE_CACHE;
+    mapSpriteData     TMP_PKMN_SPRITE_DATA;
+
+    /*
+     * @brief: PackBits style run length encoding: a header byte n < 128 is followed by
+     * n + 1 literal bytes, a header byte n >= 128 by a single byte that is repeated
+     * n - 125 times.
+     */
+    void compressRLE( const u8* p_data, u16 p_size, std::vector<u8>& p_out ) {
+        p_out.clear( );
+        for( u16 i = 0; i < p_size; ) {
+            u16 run = 1;
+            while( i + run < p_size && run < 130 && p_data[ i + run ] == p_data[ i ] ) { ++run; }
+            if( run >= 3 ) {
+                p_out.push_back( u8( run + 125 ) );
+                p_out.push_back( p_data[ i ] );
+                i += run;
+                continue;
+            }
+
+            // collect literals until the next run of at least 3 equal bytes
+            u16 start = i;
+            while( i < p_size && i - start < 128 ) {
+                if( i + 2 < p_size && p_data[ i ] == p_data[ i + 1 ]
+                    && p_data[ i ] == p_data[ i + 2 ] ) {
+                    break;
+                }
+                ++i;
+            }
+            p_out.push_back( u8( i - start - 1 ) );
+            p_out.insert( p_out.end( ), p_data + start, p_data + i );
+        }
+        p_out.shrink_to_fit( );
+    }
+
+    void decompressRLE( const std::vector<u8>& p_data, u8* p_out ) {
+        for( size_t i = 0; i < p_data.size( ); ) {
+            u8 header = p_data[ i++ ];
+            if( header < 128 ) {
+                std::memcpy( p_out, &p_data[ i ], header + 1 );
+                p_out += header + 1;
+                i += header + 1;
+            } else {
+                std::memset( p_out, p_data[ i++ ], header - 125 );
+                p_out += header - 125;
+            }
+        }
+    }
+
+    const owPkmnSpriteCache::entry* owPkmnSpriteCache::find( const key& p_key ) const {
+        for( u8 i = 0; i < _entryCount; ++i ) {
+            if( _entries[ i ].m_key == p_key ) { return &_entries[ i ]; }
+        }
+        return nullptr;
+    }
+
+    void owPkmnSpriteCache::prefetch( const key* p_keys, u8 p_count ) {
+        if( p_count > CACHE_SIZE ) { p_count = CACHE_SIZE; }
+
+        entry res[ CACHE_SIZE ];
+        u8    resCount = 0;
+        for( u8 i = 0; i < p_count; ++i ) {
+            bool known = false;
+            for( u8 j = 0; j < resCount; ++j ) {
+                if( res[ j ].m_key == p_keys[ i ] ) { known = true; }
+            }
+            if( known ) { continue; }
+
+            auto& e = res[ resCount++ ];
+            for( u8 j = 0; j < _entryCount; ++j ) {
+                if( _entries[ j ].m_key == p_keys[ i ] ) {
+                    e     = std::move( _entries[ j ] );
+                    known = true;
+                    break;
+                }
+            }
+            if( known ) { continue; }
+
+            e.m_key    = p_keys[ i ];
+            FILE* f    = openPkmnSprite( e.m_key.m_species, e.m_key.m_forme, e.m_key.m_shiny, false );
+            e.m_exists = !!f;
+            if( !f ) { continue; }
+
+            TMP_PKMN_SPRITE_DATA.readData( f );
+            e.m_width      = TMP_PKMN_SPRITE_DATA.m_width;
+            e.m_height     = TMP_PKMN_SPRITE_DATA.m_height;
+            e.m_frameCount = TMP_PKMN_SPRITE_DATA.m_frameCount;
+            std::memcpy( e.m_palData, TMP_PKMN_SPRITE_DATA.m_palData, sizeof( e.m_palData ) );
+            u16 size = e.m_width * e.m_height * e.m_frameCount / 2;
+            if( size > sizeof( TMP_PKMN_SPRITE_DATA.m_frameData ) ) {
+                // sprite too large to be a following pkmn anyway
+                e.m_exists = false;
+                continue;
+            }
+            compressRLE( reinterpret_cast<const u8*>( TMP_PKMN_SPRITE_DATA.m_frameData ), size,
+                         e.m_frameData );
+        }
+
+        for( u8 i = 0; i < resCount; ++i ) { _entries[ i ] = std::move( res[ i ] ); }
+        for( u8 i = resCount; i < _entryCount; ++i ) { _entries[ i ].m_frameData = { }; }
+        _entryCount = resCount;
+    }
+
+    bool owPkmnSpriteCache::get( const key& p_key, mapSpriteData& p_out ) const {
+        auto e = find( p_key );
+        if( e == nullptr || !e->m_exists ) { return false; }
+
+        p_out.m_width      = e->m_width;
+        p_out.m_height     = e->m_height;
+        p_out.m_frameCount = e->m_frameCount;
+        std::memcpy( p_out.m_palData, e->m_palData, sizeof( p_out.m_palData ) );
+        decompressRLE( e->m_frameData, reinterpret_cast<u8*>( p_out.m_frameData ) );
+        return true;
+    }
+
+    s8 owPkmnSpriteCache::fits( const key& p_key, u8 p_maxWidth, u8 p_maxHeight ) const {
+        auto e = find( p_key );
+        if( e == nullptr ) { return -1; }
+        return e->m_exists && e->m_width <= p_maxWidth && e->m_height <= p_maxHeight;
+    }
+
+    u32 owPkmnSpriteCache::memoryUsage( ) const {
+        u32 res = sizeof( *this );
+        for( u8 i = 0; i < _entryCount; ++i ) { res += _entries[ i ].m_frameData.capacity( ); }
+        return res;
+    }
+
+    void owPkmnSpriteCache::clear( ) {
+        for( u8 i = 0; i < _entryCount; ++i ) { _entries[ i ].m_frameData = { }; }
+        _entryCount = 0;
+    }
+
     mapSpriteData::mapSpriteData( u8 p_door, u16 p_palData[ 16 ] ) {
         FILE* f      = FS::openSplit( IO::DOOR_PATH, p_door, ".door", 52 );
         m_width      = 16;
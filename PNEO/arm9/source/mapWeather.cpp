@@ -25,6 +25,9 @@ You should have received a copy of the GNU General Public License
 along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <cstring>
+#include <vector>
+
 #include "bag/bagViewer.h"
 #include "battle/battle.h"
 #include "battle/battleDefines.h"
@@ -38,25 +41,122 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "io/sprite.h"
 #include "io/uio.h"
 #include "map/mapDrawer.h"
+#include "prof/profiler.h"
 #include "save/gameStart.h"
 #include "save/saveGame.h"
 #include "sound/sound.h"
 
 namespace MAP {
+    // Weather overlays are decoded once and then kept in main RAM, so that re-entering a
+    // weather only needs a DMA to VRAM instead of a file system read. Layers that consist
+    // of few distinct 8x8 tiles (rain, fog, ash) are stored and displayed as an 8bpp
+    // tiled background; all other layers stay full bitmaps, of which only the most
+    // recently used one is kept.
+    constexpr u16 WEATHER_MAX_TILES   = 256;
+    constexpr u8  WEATHER_BITMAP_BASE = 3;  // 48KB
+    constexpr u8  WEATHER_MAP_BASE    = 24; // 48KB
+    constexpr u8  WEATHER_TILE_BASE   = 4;  // 64KB
+
+    struct weatherLayer {
+        const char*      m_name;
+        u16              m_height;
+        bool             m_tiled;
+        u16              m_pal[ 16 ];
+        std::vector<u8>  m_data; // 8bpp tiles or raw bitmap
+        std::vector<u16> m_map;
+    };
+
+    std::vector<weatherLayer> WEATHER_LAYERS;
+
+    /*
+     * @brief: Tries to convert the bitmap in TEMP into at most WEATHER_MAX_TILES
+     * distinct tiles.
+     */
+    bool tileWeatherLayer( weatherLayer& p_layer ) {
+        const u8* bmp = reinterpret_cast<const u8*>( TEMP );
+        u8        tile[ 64 ];
+
+        p_layer.m_map.resize( 32 * 32 );
+        for( u16 t = 0; t < 32 * 32; ++t ) {
+            for( u8 y = 0; y < 8; ++y ) {
+                std::memcpy( tile + 8 * y, bmp + ( ( t / 32 ) * 8 + y ) * 256 + ( t % 32 ) * 8,
+                             8 );
+            }
+
+            u16 cnt = p_layer.m_data.size( ) / 64, idx = 0;
+            while( idx < cnt && std::memcmp( &p_layer.m_data[ 64 * idx ], tile, 64 ) ) { ++idx; }
+            if( idx == cnt ) {
+                if( cnt == WEATHER_MAX_TILES ) { return false; }
+                p_layer.m_data.insert( p_layer.m_data.end( ), tile, tile + 64 );
+            }
+            p_layer.m_map[ t ] = idx;
+        }
+        return true;
+    }
+
+    const weatherLayer* getWeatherLayer( const char* p_name, bool p_tileable,
+                                         u16 p_height = 256 ) {
+        for( const auto& l : WEATHER_LAYERS ) {
+            if( !std::strcmp( l.m_name, p_name ) ) { return &l; }
+        }
+
+        if( !FS::readData<unsigned int, unsigned short>( "nitro:/PICS/WEATHER/", p_name,
+                                                         256 * p_height / 4, TEMP, 256,
+                                                         TEMP_PAL ) ) {
+            return nullptr;
+        }
+
+        weatherLayer res{ p_name, p_height, false, { }, { }, { } };
+        std::memcpy( res.m_pal, TEMP_PAL, sizeof( res.m_pal ) );
+        if( p_tileable && p_height == 256 && tileWeatherLayer( res ) ) {
+            res.m_tiled = true;
+        } else {
+            res.m_data.assign( reinterpret_cast<const u8*>( TEMP ),
+                               reinterpret_cast<const u8*>( TEMP ) + 256 * p_height );
+            res.m_map.clear( );
+
+            // only keep a single bitmap layer around
+            std::erase_if( WEATHER_LAYERS,
+                           []( const weatherLayer& p_layer ) { return !p_layer.m_tiled; } );
+        }
+        DC_FlushRange( res.m_data.data( ), res.m_data.size( ) );
+        DC_FlushRange( res.m_map.data( ), res.m_map.size( ) * sizeof( u16 ) );
+
+        WEATHER_LAYERS.push_back( std::move( res ) );
+        return &WEATHER_LAYERS.back( );
+    }
+
+    /*
+     * @brief: Initializes BG3 with the specified weather layer.
+     */
+    void loadWeatherLayer( const char* p_name, bool p_tileable, u16 p_height = 256 ) {
+        auto layer = getWeatherLayer( p_name, p_tileable, p_height );
+        if( layer && layer->m_tiled ) {
+            IO::bg3 = bgInit( 3, BgType_ExRotation, BgSize_ER_256x256, WEATHER_MAP_BASE,
+                              WEATHER_TILE_BASE );
+            dmaCopy( layer->m_data.data( ), bgGetGfxPtr( IO::bg3 ), layer->m_data.size( ) );
+            dmaCopy( layer->m_map.data( ), bgGetMapPtr( IO::bg3 ), 32 * 32 * sizeof( u16 ) );
+        } else {
+            IO::bg3 = bgInit( 3, BgType_Bmp8, BgSize_B8_256x256, WEATHER_BITMAP_BASE, 0 );
+            if( !layer ) {
+                dmaFillWords( 0, bgGetGfxPtr( IO::bg3 ), 256 * 256 );
+                return;
+            }
+            dmaCopy( layer->m_data.data( ), bgGetGfxPtr( IO::bg3 ), 256 * p_height );
+        }
+        dmaCopy( layer->m_pal, BG_PALETTE + 240, sizeof( layer->m_pal ) );
+    }
+
     void mapDrawer::initWeather( ) {
+        PROFILE_PHASE( MAP_INIT_WEATHER );
         // TODO: get rid of magic constants
         _weatherScrollX = 0;
         _weatherScrollY = 0;
         REG_BLDALPHA    = 0;
         switch( getWeather( ) ) {
         case RAINY:
-            IO::bg3 = bgInit( 3, BgType_Bmp8, BgSize_B8_256x256, 3, 0 );
+            loadWeatherLayer( "rain", true );
             bgWrapOn( IO::bg3 );
-
-            FS::readData<unsigned int, unsigned short>( "nitro:/PICS/WEATHER/", "rain",
-                                                        256 * 256 / 4, TEMP, 256, TEMP_PAL );
-            dmaCopy( TEMP, bgGetGfxPtr( IO::bg3 ), 256 * 256 );
-            dmaCopy( TEMP_PAL, BG_PALETTE + 240, 32 );
             bgSetScroll( IO::bg3, 0, 0 );
             _weatherScrollX = 32;
             _weatherScrollY = -64;
@@ -65,13 +165,8 @@ namespace MAP {
             break;
 
         case FOG:
-            IO::bg3 = bgInit( 3, BgType_Bmp8, BgSize_B8_256x256, 3, 0 );
+            loadWeatherLayer( "fog", true );
             bgWrapOn( IO::bg3 );
-
-            FS::readData<unsigned int, unsigned short>( "nitro:/PICS/WEATHER/", "fog",
-                                                        256 * 256 / 4, TEMP, 256, TEMP_PAL );
-            dmaCopy( TEMP, bgGetGfxPtr( IO::bg3 ), 256 * 256 );
-            dmaCopy( TEMP_PAL, BG_PALETTE + 240, 32 );
             bgSetScroll( IO::bg3, 0, 0 );
             _weatherScrollX = 2;
             _weatherScrollY = 0;
@@ -81,13 +176,8 @@ namespace MAP {
 
         case MIST:
         case DENSE_MIST:
-            IO::bg3 = bgInit( 3, BgType_Bmp8, BgSize_B8_256x256, 3, 0 );
+            loadWeatherLayer( "mist", false );
             bgWrapOn( IO::bg3 );
-
-            FS::readData<unsigned int, unsigned short>( "nitro:/PICS/WEATHER/", "mist",
-                                                        256 * 256 / 4, TEMP, 256, TEMP_PAL );
-            dmaCopy( TEMP, bgGetGfxPtr( IO::bg3 ), 256 * 256 );
-            dmaCopy( TEMP_PAL, BG_PALETTE + 240, 32 );
             bgSetScroll( IO::bg3, 0, 0 );
             if( getWeather( ) == MIST ) {
                 _weatherScrollX = 1;
@@ -102,13 +192,8 @@ namespace MAP {
             break;
 
         case CLOUDY:
-            IO::bg3 = bgInit( 3, BgType_Bmp8, BgSize_B8_256x256, 3, 0 );
+            loadWeatherLayer( "clouds", false );
             bgWrapOn( IO::bg3 );
-
-            FS::readData<unsigned int, unsigned short>( "nitro:/PICS/WEATHER/", "clouds",
-                                                        256 * 256 / 4, TEMP, 256, TEMP_PAL );
-            dmaCopy( TEMP, bgGetGfxPtr( IO::bg3 ), 256 * 256 );
-            dmaCopy( TEMP_PAL, BG_PALETTE + 240, 32 );
             bgSetScroll( IO::bg3, 0, 0 );
             _weatherScrollX = 2;
             _weatherScrollY = 0;
@@ -117,13 +202,8 @@ namespace MAP {
             break;
 
         case FOREST_CLOUDS:
-            IO::bg3 = bgInit( 3, BgType_Bmp8, BgSize_B8_256x256, 3, 0 );
+            loadWeatherLayer( "forestcloud", false );
             bgWrapOn( IO::bg3 );
-
-            FS::readData<unsigned int, unsigned short>( "nitro:/PICS/WEATHER/", "forestcloud",
-                                                        256 * 256 / 4, TEMP, 256, TEMP_PAL );
-            dmaCopy( TEMP, bgGetGfxPtr( IO::bg3 ), 256 * 256 );
-            dmaCopy( TEMP_PAL, BG_PALETTE + 240, 32 );
             bgSetScroll( IO::bg3, 0, 0 );
             _weatherScrollX = 0;
             _weatherScrollY = 0;
@@ -132,13 +212,8 @@ namespace MAP {
             break;
 
         case ASH_RAIN:
-            IO::bg3 = bgInit( 3, BgType_Bmp8, BgSize_B8_256x256, 3, 0 );
+            loadWeatherLayer( "ashrain", true );
             bgWrapOn( IO::bg3 );
-
-            FS::readData<unsigned int, unsigned short>( "nitro:/PICS/WEATHER/", "ashrain",
-                                                        256 * 256 / 4, TEMP, 256, TEMP_PAL );
-            dmaCopy( TEMP, bgGetGfxPtr( IO::bg3 ), 256 * 256 );
-            dmaCopy( TEMP_PAL, BG_PALETTE + 240, 32 );
             bgSetScroll( IO::bg3, 0, 0 );
             _weatherScrollX = 2;
             _weatherScrollY = -4;
@@ -148,13 +223,8 @@ namespace MAP {
             bool goggles = SAVE::SAV.getActiveFile( ).m_bag.count(
                 BAG::toBagType( BAG::ITEMTYPE_KEYITEM ), I_GO_GOGGLES );
 
-            IO::bg3 = bgInit( 3, BgType_Bmp8, BgSize_B8_256x256, 3, 0 );
+            loadWeatherLayer( "sandstorm", false );
             bgWrapOn( IO::bg3 );
-
-            FS::readData<unsigned int, unsigned short>( "nitro:/PICS/WEATHER/", "sandstorm",
-                                                        256 * 256 / 4, TEMP, 256, TEMP_PAL );
-            dmaCopy( TEMP, bgGetGfxPtr( IO::bg3 ), 256 * 256 );
-            dmaCopy( TEMP_PAL, BG_PALETTE + 240, 32 );
             bgSetScroll( IO::bg3, 0, 0 );
 
             if( goggles ) { REG_BLDALPHA = 0xff | ( 0x05 << 8 ); }
@@ -169,11 +239,7 @@ namespace MAP {
         case DARK_FLASH_USED:
         case DARK_FLASH_1:
         case DARK_FLASH_2:
-            IO::bg3 = bgInit( 3, BgType_Bmp8, BgSize_B8_256x256, 3, 0 );
-            FS::readData<unsigned int, unsigned short>( "nitro:/PICS/WEATHER/", "flash",
-                                                        256 * 192 / 4, TEMP, 256, TEMP_PAL );
-            dmaCopy( TEMP, bgGetGfxPtr( IO::bg3 ), 256 * 192 );
-            dmaCopy( TEMP_PAL, BG_PALETTE + 240, 32 );
+            loadWeatherLayer( "flash", false, 192 );
             if( getWeather( ) == DARK_FLASH_USED ) {
                 bgSetScale( IO::bg3, 1 << 7, 1 << 7 );
                 bgSetScroll( IO::bg3, 64, 48 );
@@ -189,7 +255,7 @@ namespace MAP {
             _weatherFollow = false;
             break;
         default:
-            IO::bg3 = bgInit( 3, BgType_Bmp8, BgSize_B8_256x256, 3, 0 );
+            IO::bg3 = bgInit( 3, BgType_Bmp8, BgSize_B8_256x256, WEATHER_BITMAP_BASE, 0 );
             dmaFillWords( 0, bgGetGfxPtr( IO::bg3 ), 256 * 256 );
             break;
         }
@@ -31,7 +31,11 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "bag/bagViewer.h"
 #include "bag/item.h"
 #include "battle/battle.h"
+#include "battle/battleBenchmark.h"
+#include "battle/battleSearch.h"
+#include "battle/battleTournament.h"
 #include "battle/battleTrainer.h"
+#include "battle/moveTable.h"
 #include "box/boxViewer.h"
 #include "defines.h"
 #include "dex/dex.h"
@@ -39,8 +43,10 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "gen/itemNames.h"
 #include "gen/locationNames.h"
 #include "gen/moveNames.h"
+#include "io/backBuffer.h"
 #include "io/choiceBox.h"
 #include "io/counter.h"
+#include "io/decodedSpriteCache.h"
 #include "io/keyboard.h"
 #include "io/menu.h"
 #include "io/menuUI.h"
@@ -48,13 +54,17 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include "io/navApp.h"
 #include "io/screenFade.h"
 #include "io/sprite.h"
+#include "io/spriteAllocator.h"
+#include "io/stringAtlas.h"
 #include "io/strings.h"
 #include "io/uio.h"
 #include "io/yesNoBox.h"
+#include "map/mapBattleFacilityPool.h"
 #include "map/mapDrawer.h"
 #include "map/mapObject.h"
 #include "map/mapSlice.h"
 #include "pokemon.h"
+#include "prof/profiler.h"
 #include "sound/sound.h"
 #include "spx/specials.h"
 #include "sts/partyScreen.h"
@@ -166,6 +176,15 @@ namespace IO {
     }
 
 #ifdef DESQUID
+    // label of each entry of the profiling menu, indexed by desquidProfileOption
+    constexpr u16 DSQ_PROFILE_LABELS[ DSQ_PROF_COUNT ] = {
+        FS::DESQUID_STRING + 71, FS::DESQUID_STRING + 74, FS::DESQUID_STRING + 72,
+        FS::DESQUID_STRING + 73, FS::DESQUID_STRING + 75, FS::DESQUID_STRING + 76,
+        FS::DESQUID_STRING + 77, FS::DESQUID_STRING + 78, FS::DESQUID_STRING + 79,
+        FS::DESQUID_STRING + 80, FS::DESQUID_STRING + 81, FS::DESQUID_STRING + 82,
+        FS::DESQUID_STRING + 83, FS::DESQUID_STRING + 88, FS::DESQUID_STRING + 90,
+    };
+
     void handleDesquidMenuSelection( desquidMenuOption p_selection, const char* ) {
         switch( p_selection ) {
         case DSQ_SPAWN_DEFAULT_TEAM: {
@@ -359,6 +378,238 @@ namespace IO {
             break;
         }
         case DSQ_BATTLE_TRAINER: {
+            // simulate battles of the player's team against a trainer
+            constexpr u16 SIMULATED_BATTLES  = 50;
+            constexpr u16 TOURNAMENT_BATTLES = 10; // per matchup
+
+            init( );
+            s32 trainerId = IO::counter( 0, 999 ).getResult(
+                GET_STRING( FS::DESQUID_STRING + 84 ), MSG_INFO_NOCLOSE );
+            init( );
+            if( !trainerId ) { break; }
+
+            IO::choiceBox menu = IO::choiceBox( IO::choiceBox::MODE_UP_DOWN_LEFT_RIGHT );
+            auto          mode = menu.getResult(
+                GET_STRING( FS::DESQUID_STRING + 46 ), MSG_NOCLOSE,
+                std::vector<u16>{ FS::DESQUID_STRING + 85, FS::DESQUID_STRING + 86,
+                                  FS::DESQUID_STRING + 87, FS::DESQUID_STRING + 89 },
+                true );
+            init( );
+            if( mode > 3 ) { break; }
+
+            auto& sf       = SAVE::SAV.getActiveFile( );
+            auto  opponent = FS::getBattleTrainer( trainerId );
+            auto  policy   = BATTLE::battlePolicy( opponent.m_data.m_forceDoubleBattle
+                                                       ? BATTLE::DEFAULT_DOUBLE_TRAINER_POLICY
+                                                       : BATTLE::DEFAULT_TRAINER_POLICY );
+            char  buffer[ 150 ];
+
+            if( mode == 3 ) {
+                // all trainers up to the chosen one at each difficulty, and the battle
+                // facility; results go to a csv file next to the rom
+                FILE* f     = FS::open( ARGV[ 0 ], "TOURNAMENT", ".csv", "w" );
+                u32   start = PROF::ticks( );
+                auto  res   = BATTLE::runTournament( sf.m_pkmnTeam, sf.getTeamPkmnCount( ),
+                                                     trainerId, TOURNAMENT_BATTLES, f );
+                u32   ticks = PROF::ticks( ) - start;
+                if( f ) { FS::close( f ); }
+
+                snprintf( buffer, 149,
+                          "%hu matchups, %lu battles\nWin rate: %lu%% %lu rounds\n%lu s%s%s%s",
+                          res.m_matchups, res.m_battles,
+                          res.m_playerWins * 100 / std::max<u32>( 1, res.m_battles ),
+                          res.m_rounds, ticks / PROF::TICKS_PER_MS / 1000,
+                          res.m_failed ? "\nSome facility matchups failed" : "",
+                          res.m_replayMismatches ? "\nSome replays differ" : "",
+                          f ? "" : "\nCould not write TOURNAMENT.csv" );
+                IO::printMessage( buffer, MSG_INFO );
+                init( );
+                break;
+            }
+
+            if( mode == 1 ) {
+                // the player's side plays with the best heuristic ai, then with the search
+                // ai, on the same seeds
+                policy.m_aiLevel = BATTLE::SEARCH_MIN_AI_LEVEL - 1;
+                auto heuristic   = BATTLE::simulateBattles( sf.m_pkmnTeam, sf.getTeamPkmnCount( ),
+                                                            opponent, policy, SIMULATED_BATTLES,
+                                                            trainerId );
+
+                policy.m_aiLevel     = BATTLE::SEARCH_DEEP_AI_LEVEL;
+                BATTLE::SEARCH_STATS = BATTLE::searchStats( );
+                auto search = BATTLE::simulateBattles( sf.m_pkmnTeam, sf.getTeamPkmnCount( ),
+                                                       opponent, policy, SIMULATED_BATTLES,
+                                                       trainerId );
+                auto stats  = BATTLE::SEARCH_STATS;
+                u32  ms     = std::max<u32>( 1, stats.m_ticks / PROF::TICKS_PER_MS );
+
+                snprintf( buffer, 149,
+                          "%hu battles vs. %s\nAI %hu: %hu-%hu-%hu AI %hu: %hu-%hu-%hu\n%lu turns"
+                          " searched (%lu/s)\n%lu decisions, %lu cut",
+                          SIMULATED_BATTLES, opponent.m_strings.m_name,
+                          u16( BATTLE::SEARCH_MIN_AI_LEVEL - 1 ), heuristic.m_playerWins,
+                          heuristic.m_opponentWins, heuristic.m_draws,
+                          BATTLE::SEARCH_DEEP_AI_LEVEL, search.m_playerWins,
+                          search.m_opponentWins, search.m_draws, stats.m_nodes,
+                          stats.m_nodes * 1000 / ms, stats.m_decisions, stats.m_cuts );
+                IO::printMessage( buffer, MSG_INFO );
+                init( );
+                break;
+            }
+
+            if( mode == 2 ) {
+                // the player's side plays with and without switching pkmn on the same seeds
+                policy.m_aiLevel = BATTLE::SEARCH_MIN_AI_LEVEL - 1;
+                u32 results[ 2 ][ 5 ];
+                for( u8 i = 0; i < 2; ++i ) {
+                    BATTLE::DISABLE_AI_SWITCHES = !i;
+                    BATTLE::MATCHUP_STATS       = BATTLE::matchupStats( );
+
+                    u32  start = PROF::ticks( );
+                    auto res   = BATTLE::simulateBattles( sf.m_pkmnTeam, sf.getTeamPkmnCount( ),
+                                                          opponent, policy, SIMULATED_BATTLES,
+                                                          trainerId );
+                    u32  ticks = PROF::ticks( ) - start;
+
+                    results[ i ][ 0 ] = res.m_playerWins;
+                    results[ i ][ 1 ] = res.m_opponentWins;
+                    results[ i ][ 2 ] = res.m_draws;
+                    // time per round in us
+                    results[ i ][ 3 ] = u64( ticks ) * 1000 / PROF::TICKS_PER_MS
+                                        / std::max<u32>( 1, res.m_rounds );
+                    results[ i ][ 4 ] = BATTLE::MATCHUP_STATS.m_switches;
+                }
+                BATTLE::DISABLE_AI_SWITCHES = false;
+                auto stats                  = BATTLE::MATCHUP_STATS;
+
+                snprintf( buffer, 149,
+                          "%hu battles vs. %s\nNo switches: %lu-%lu-%lu, %lu us/round\nSwitches:"
+                          " %lu-%lu-%lu, %lu us/round\n%lu switches, init %lu us, update %lu us",
+                          SIMULATED_BATTLES, opponent.m_strings.m_name, results[ 0 ][ 0 ],
+                          results[ 0 ][ 1 ], results[ 0 ][ 2 ], results[ 0 ][ 3 ],
+                          results[ 1 ][ 0 ], results[ 1 ][ 1 ], results[ 1 ][ 2 ],
+                          results[ 1 ][ 3 ], results[ 1 ][ 4 ],
+                          u32( u64( stats.m_initTicks ) * 1000 / PROF::TICKS_PER_MS ),
+                          u32( u64( stats.m_updateTicks ) * 1000 / PROF::TICKS_PER_MS
+                               / std::max<u32>( 1, stats.m_updates ) ) );
+                IO::printMessage( buffer, MSG_INFO );
+                init( );
+                break;
+            }
+
+            // fixed seeds, so that runs of different builds are comparable
+            BATTLE::MOVE_TABLE.resetStats( );
+            u32  start = PROF::ticks( );
+            auto res   = BATTLE::simulateBattles( sf.m_pkmnTeam, sf.getTeamPkmnCount( ), opponent,
+                                                  policy, SIMULATED_BATTLES, trainerId );
+            u32  ticks = PROF::ticks( ) - start;
+
+            snprintf( buffer, 149,
+                      "%hu battles vs. %s\nWon: %hu Lost: %hu Draw: %hu\n%lu rounds in %lu ms"
+                      "\nReplay: %s Move file reads: %lu",
+                      SIMULATED_BATTLES, opponent.m_strings.m_name, res.m_playerWins,
+                      res.m_opponentWins, res.m_draws, res.m_rounds, ticks / PROF::TICKS_PER_MS,
+                      res.m_replayMatches ? "ok" : "MISMATCH", BATTLE::MOVE_TABLE.getFileReads( ) );
+            IO::printMessage( buffer, MSG_INFO );
+            init( );
+            break;
+        }
+        case DSQ_PROFILE: {
+            init( );
+            IO::choiceBox    menu = IO::choiceBox( IO::choiceBox::MODE_UP_DOWN_LEFT_RIGHT );
+            std::vector<u16> labels( std::begin( DSQ_PROFILE_LABELS ),
+                                     std::end( DSQ_PROFILE_LABELS ) );
+            auto res = menu.getResult( GET_STRING( FS::DESQUID_STRING + 46 ), MSG_NOCLOSE, labels,
+                                       true );
+            init( );
+            switch( desquidProfileOption( res ) ) {
+            case DSQ_PROF_SCRIPT_STATS: {
+                PROF::printScriptStats( );
+                break;
+            }
+            case DSQ_PROF_PHASE_STATS: {
+                PROF::printPhaseStats( );
+                break;
+            }
+            case DSQ_PROF_DUMP_STATS: {
+                PROF::dumpScriptStats( ARGV[ 0 ] );
+                PROF::dumpPhaseStats( ARGV[ 0 ] );
+                break;
+            }
+            case DSQ_PROF_RESET_STATS: {
+                PROF::resetScriptStats( );
+                PROF::resetPhaseStats( );
+                break;
+            }
+            case DSQ_PROF_MAP_OBJECT_INDEX: {
+                MAP::benchmarkMapObjectIndex( );
+                break;
+            }
+            case DSQ_PROF_OW_SPRITE_CACHE: {
+                char buffer[ 100 ];
+                snprintf( buffer, 99, "%hhu sprites cached\n%lu bytes",
+                          MAP::OW_PKMN_SPRITE_CACHE.size( ),
+                          MAP::OW_PKMN_SPRITE_CACHE.memoryUsage( ) );
+                IO::printMessage( buffer, MSG_INFO );
+                break;
+            }
+            case DSQ_PROF_GLYPH_BLITTER: {
+                IO::regularFont->benchmarkBlitter( true, 1, IO::REGULAR_FONT::NUM_CHARS );
+                break;
+            }
+            case DSQ_PROF_RECTANGLES: {
+                IO::benchmarkRectangles( true, 1 );
+                break;
+            }
+            case DSQ_PROF_BACK_BUFFER: {
+                IO::BACK_BUFFER.printStats( );
+                break;
+            }
+            case DSQ_PROF_STRING_ATLAS: {
+                IO::STRING_ATLAS.printStats( );
+                break;
+            }
+            case DSQ_PROF_SPRITE_VRAM: {
+                IO::SPRITE_ALLOCATOR[ true ].printStats( "Bottom" );
+                IO::SPRITE_ALLOCATOR[ false ].printStats( "Top" );
+                break;
+            }
+            case DSQ_PROF_SPRITE_PALETTES: {
+                IO::SPRITE_PALETTES[ true ].printStats( "Bottom" );
+                IO::SPRITE_PALETTES[ false ].printStats( "Top" );
+                break;
+            }
+            case DSQ_PROF_DECODED_SPRITES: {
+                IO::DECODED_SPRITE_CACHE.printStats( );
+                break;
+            }
+            case DSQ_PROF_FACILITY_POOL: {
+                MAP::FACILITY_POOL.printStats( );
+                MAP::benchmarkFacilityPool( );
+                break;
+            }
+            case DSQ_PROF_BATTLE_BENCH: {
+                auto bench = BATTLE::benchmarkBattleTurns( ARGV[ 0 ] );
+                char buffer[ 100 ];
+                if( bench.m_hasBaseline ) {
+                    snprintf( buffer, 99,
+                              "%hu scenarios, %lu.%lu allocs/turn\n%hu phases slower than"
+                              " baseline\n%hu phases changed",
+                              bench.m_scenarios, bench.m_turnAllocations / 10,
+                              bench.m_turnAllocations % 10, bench.m_regressions,
+                              bench.m_changed );
+                } else {
+                    snprintf( buffer, 99, "%hu scenarios, %lu.%lu allocs/turn\nSaved as new"
+                              " baseline",
+                              bench.m_scenarios, bench.m_turnAllocations / 10,
+                              bench.m_turnAllocations % 10 );
+                }
+                IO::printMessage( buffer, MSG_INFO );
+                break;
+            }
+            default: break;
+            }
+
             init( );
             break;
         }
@@ -371,6 +622,7 @@ namespace IO {
         std::vector<u16> choices = {
             FS::DESQUID_STRING + 47, FS::DESQUID_STRING + 48, FS::DESQUID_STRING + 49,
             FS::DESQUID_STRING + 50, FS::DESQUID_STRING + 51, FS::DESQUID_STRING + 52,
+            FS::DESQUID_STRING + 70,
         };
 
         IO::choiceBox menu = IO::choiceBox( IO::choiceBox::MODE_UP_DOWN_LEFT_RIGHT );
@@ -494,10 +494,10 @@ namespace IO {
                                                   oam[ SPR_CHOICE_START_OAM_SUB( i ) ].y + 8, true,
                                                   IO::font::CENTER );
                 } else {
-                    IO::regularFont->printString( GET_STRING( IO::STR_UI_MENU_ITEM_NAME_START + i ),
-                                                  oam[ SPR_CHOICE_START_OAM_SUB( i ) ].x + 48 + 13,
-                                                  oam[ SPR_CHOICE_START_OAM_SUB( i ) ].y + 8, true,
-                                                  IO::font::CENTER );
+                    IO::regularFont->printStaticString(
+                        IO::STR_UI_MENU_ITEM_NAME_START + i,
+                        oam[ SPR_CHOICE_START_OAM_SUB( i ) ].x + 48 + 13,
+                        oam[ SPR_CHOICE_START_OAM_SUB( i ) ].y + 8, true, IO::font::CENTER );
                 }
 
                 res.push_back(
@@ -998,10 +998,10 @@ namespace IO {
                     IO::regularFont->printStringC(
                         buffer, oam[ SPR_CHOICE_START_OAM_SUB( i ) ].x + 36 + 40 * ( j % 3 ),
                         142 + ( 14 * ( j / 3 ) ), true, IO::font::RIGHT );
-                    IO::regularFont->printStringC( GET_STRING( IO::STR_UI_PKMN_STAT_START + j ),
-                                                   oam[ SPR_CHOICE_START_OAM_SUB( i ) ].x + 4
-                                                       + 40 * ( j % 3 ),
-                                                   142 + ( 14 * ( j / 3 ) ), true, IO::font::LEFT );
+                    IO::regularFont->printStaticStringC(
+                        IO::STR_UI_PKMN_STAT_START + j,
+                        oam[ SPR_CHOICE_START_OAM_SUB( i ) ].x + 4 + 40 * ( j % 3 ),
+                        142 + ( 14 * ( j / 3 ) ), true, IO::font::LEFT );
                 }
 
                 // moves
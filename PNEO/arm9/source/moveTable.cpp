@@ -0,0 +1,103 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : moveTable.cpp
+author      : Philip Wellnitz
+description : Table of the data of all moves used in the current battle.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstring>
+
+#include "battle/moveTable.h"
+#include "fs/data.h"
+#include "gen/moveNames.h"
+
+namespace BATTLE {
+    moveTable MOVE_TABLE;
+
+    u8 moveTable::find( u16 p_moveId ) const {
+        u8 lo = 0, hi = _count;
+        while( lo < hi ) {
+            u8 mid = ( lo + hi ) / 2;
+            if( _ids[ mid ] < p_moveId ) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    const moveData& moveTable::insert( u8 p_pos, u16 p_moveId ) {
+        std::memmove( _ids + p_pos + 1, _ids + p_pos, ( _count - p_pos ) * sizeof( u16 ) );
+        std::memmove( _data + p_pos + 1, _data + p_pos, ( _count - p_pos ) * sizeof( moveData ) );
+        _ids[ p_pos ]  = p_moveId;
+        _data[ p_pos ] = FS::getMoveData( p_moveId );
+        _count++;
+        return _data[ p_pos ];
+    }
+
+    void moveTable::load( const pokemon* p_team1, u8 p_teamSize1, const pokemon* p_team2,
+                          u8 p_teamSize2 ) {
+        _count  = 0;
+        _loaded = false;
+
+        insert( 0, M_STRUGGLE );
+        for( u8 t = 0; t < 2; ++t ) {
+            const pokemon* team = t ? p_team2 : p_team1;
+            u8             size = t ? p_teamSize2 : p_teamSize1;
+            for( u8 i = 0; team != nullptr && i < size && i < SAVE::NUM_PARTY_SLOTS; ++i ) {
+                for( u8 j = 0; j < 4; ++j ) {
+                    u16 mv = team[ i ].getMove( j );
+                    if( !mv ) { continue; }
+                    u8 pos = find( mv );
+                    if( pos < _count && _ids[ pos ] == mv ) { continue; }
+                    insert( pos, mv );
+                }
+            }
+        }
+        _loaded = true;
+    }
+
+    void moveTable::clear( ) {
+        _count  = 0;
+        _loaded = false;
+    }
+
+    moveData moveTable::get( u16 p_moveId ) {
+        if( !_loaded ) { return FS::getMoveData( p_moveId ); }
+
+        u8 pos = find( p_moveId );
+        if( pos < _count && _ids[ pos ] == p_moveId ) {
+#ifdef DESQUID
+            _hits++;
+#endif
+            return _data[ pos ];
+        }
+
+#ifdef DESQUID
+        _fileReads++;
+#endif
+        if( _count < MAX_TABLE_MOVES ) { return insert( pos, p_moveId ); }
+        return FS::getMoveData( p_moveId );
+    }
+} // namespace BATTLE
@@ -547,8 +547,7 @@ namespace STS {
         if( _team[ p_pos ].isEgg( ) ) {
             if( p_redraw ) {
                 // general data
-                IO::regularFont->printString( GET_STRING( 34 ), anchor_x + 32, anchor_y + 12,
-                                              false );
+                IO::regularFont->printStaticString( 34, anchor_x + 32, anchor_y + 12, false );
                 IO::loadEggIcon( oam[ SPR_PKMN_ICON_OAM( p_pos ) ].x,
                                  oam[ SPR_PKMN_ICON_OAM( p_pos ) ].y, SPR_PKMN_ICON_OAM( p_pos ),
                                  SPR_PKMN_ICON_PAL( p_pos ),
@@ -559,8 +558,7 @@ namespace STS {
             if( p_redraw ) {
                 // general data
                 if( p_pos < _inBattle ) {
-                    IO::regularFont->printString( GET_STRING( 150 ), anchor_x + 32, anchor_y + 12,
-                                                  false );
+                    IO::regularFont->printStaticString( 150, anchor_x + 32, anchor_y + 12, false );
                 } else if( IO::regularFont->stringWidth( _team[ p_pos ].m_boxdata.m_name ) > 80 ) {
                     IO::regularFont->printStringC( _team[ p_pos ].m_boxdata.m_name, anchor_x + 32,
                                                    anchor_y + 12, false );
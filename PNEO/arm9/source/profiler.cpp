@@ -0,0 +1,286 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : profiler.cpp
+author      : Philip Wellnitz
+description : Timing instrumentation for developer (DESQUID) builds.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef DESQUID
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+
+#include "defines.h"
+#include "fs/fs.h"
+#include "io/message.h"
+#include "prof/profiler.h"
+
+namespace PROF {
+    struct scriptTotal {
+        u32 m_runs;
+        u32 m_ticks;
+        u32 m_maxTicks;
+    };
+
+    const char* const PHASE_NAMES[ NUM_PHASES ] = {
+        "stepOn",        "locCallbacks", "animateField", "behavior",
+        "trainerEye",    "wildPkmn",     "events",       "stepIncrease",
+        "repel",         "dayCareExp",   "eggSteps",     "warpPlayer",
+        "initWeather",   "uiFlush",      "battleTurn",   "sortMoves",
+        "useMove",       "endOfTurn",
+    };
+
+    phaseStats  PHASE_STATS[ NUM_PHASES ];
+    opcodeStats SCRIPT_OPCODE_STATS[ NUM_OPCODES ];
+    scriptRun   SLOWEST_SCRIPTS[ SLOWEST_SCRIPT_COUNT ];
+
+    std::map<u16, scriptTotal> SCRIPT_TOTALS;
+
+    u32 ALLOCATIONS = 0;
+
+    u32 PAUSED_TICKS       = 0;
+    u32 PAUSED_ALLOCATIONS = 0;
+    u8  PAUSE_DEPTH        = 0;
+
+    char PROF_BUFFER[ 200 ];
+
+    void init( ) {
+        cpuStartTiming( PROFILE_TIMER );
+    }
+
+    u32 ticksToUs( u32 p_ticks ) {
+        return u32( u64( p_ticks ) * 1000 / TICKS_PER_MS );
+    }
+
+    void recordPhase( phase p_phase, u32 p_ticks, u32 p_allocations ) {
+        auto& st = PHASE_STATS[ p_phase ];
+        st.m_allocations += p_allocations;
+        if( !st.m_count || p_ticks < st.m_minTicks ) { st.m_minTicks = p_ticks; }
+        st.m_maxTicks = std::max( st.m_maxTicks, p_ticks );
+        st.m_count++;
+        st.m_totalTicks += p_ticks;
+
+        u8 bucket = 0;
+        for( u32 bound = HISTOGRAM_BASE_TICKS; bucket + 1 < HISTOGRAM_BUCKETS && p_ticks >= bound;
+             bound <<= 1 ) {
+            ++bucket;
+        }
+        st.m_histogram[ bucket ]++;
+    }
+
+    scriptProfile::scriptProfile( u16 p_scriptId ) : _scriptId( p_scriptId ) {
+        _start = _opcodeStart = ticks( );
+    }
+
+    void scriptProfile::endOpcode( u32 p_now ) {
+        if( !_instructions ) { return; }
+        SCRIPT_OPCODE_STATS[ _curOpcode ].m_count++;
+        SCRIPT_OPCODE_STATS[ _curOpcode ].m_ticks += p_now - _opcodeStart;
+    }
+
+    void scriptProfile::beginOpcode( u8 p_opcode ) {
+        u32 now = ticks( );
+        endOpcode( now );
+
+        _curOpcode   = p_opcode;
+        _opcodeStart = now;
+        _instructions++;
+    }
+
+    scriptProfile::~scriptProfile( ) {
+        u32 now = ticks( );
+        endOpcode( now );
+
+        u32   total = now - _start;
+        auto& tot   = SCRIPT_TOTALS[ _scriptId ];
+        tot.m_runs++;
+        tot.m_ticks += total;
+        tot.m_maxTicks = std::max( tot.m_maxTicks, total );
+
+        // keep the slowest invocations sorted by descending duration
+        for( u8 i = 0; i < SLOWEST_SCRIPT_COUNT; ++i ) {
+            if( SLOWEST_SCRIPTS[ i ].m_ticks < total ) {
+                std::memmove( &SLOWEST_SCRIPTS[ i + 1 ], &SLOWEST_SCRIPTS[ i ],
+                              ( SLOWEST_SCRIPT_COUNT - i - 1 ) * sizeof( scriptRun ) );
+                SLOWEST_SCRIPTS[ i ] = { _scriptId, _instructions, total };
+                break;
+            }
+        }
+    }
+
+    void resetScriptStats( ) {
+        std::memset( SCRIPT_OPCODE_STATS, 0, sizeof( SCRIPT_OPCODE_STATS ) );
+        std::memset( SLOWEST_SCRIPTS, 0, sizeof( SLOWEST_SCRIPTS ) );
+        SCRIPT_TOTALS.clear( );
+    }
+
+    void printScriptStats( ) {
+        // opcodes with the highest cumulative time
+        u8 ops[ NUM_OPCODES ];
+        for( u16 i = 0; i < NUM_OPCODES; ++i ) { ops[ i ] = i; }
+        std::sort( ops, ops + NUM_OPCODES, []( u8 p_a, u8 p_b ) {
+            return SCRIPT_OPCODE_STATS[ p_a ].m_ticks > SCRIPT_OPCODE_STATS[ p_b ].m_ticks;
+        } );
+
+        for( u8 i = 0; i < 6; i += 2 ) {
+            snprintf( PROF_BUFFER, 199, "OP %hhu: %lux %luus\nOP %hhu: %lux %luus", ops[ i ],
+                      SCRIPT_OPCODE_STATS[ ops[ i ] ].m_count,
+                      ticksToUs( SCRIPT_OPCODE_STATS[ ops[ i ] ].m_ticks ), ops[ i + 1 ],
+                      SCRIPT_OPCODE_STATS[ ops[ i + 1 ] ].m_count,
+                      ticksToUs( SCRIPT_OPCODE_STATS[ ops[ i + 1 ] ].m_ticks ) );
+            IO::printMessage( PROF_BUFFER, MSG_INFO );
+        }
+
+        for( u8 i = 0; i < SLOWEST_SCRIPT_COUNT && SLOWEST_SCRIPTS[ i ].m_ticks; i += 2 ) {
+            snprintf( PROF_BUFFER, 199, "SCR %hu: %hu ins %luus\nSCR %hu: %hu ins %luus",
+                      SLOWEST_SCRIPTS[ i ].m_scriptId, SLOWEST_SCRIPTS[ i ].m_instructions,
+                      ticksToUs( SLOWEST_SCRIPTS[ i ].m_ticks ),
+                      SLOWEST_SCRIPTS[ i + 1 ].m_scriptId,
+                      SLOWEST_SCRIPTS[ i + 1 ].m_instructions,
+                      ticksToUs( SLOWEST_SCRIPTS[ i + 1 ].m_ticks ) );
+            IO::printMessage( PROF_BUFFER, MSG_INFO );
+        }
+    }
+
+    bool dumpScriptStats( const char* p_path ) {
+        FILE* f = FS::open( p_path, "SCRIPTS", ".prof.csv", "w" );
+        if( !f ) { return false; }
+
+        fprintf( f, "opcode,count,us\n" );
+        for( u16 i = 0; i < NUM_OPCODES; ++i ) {
+            if( !SCRIPT_OPCODE_STATS[ i ].m_count ) { continue; }
+            fprintf( f, "%hu,%lu,%lu\n", i, SCRIPT_OPCODE_STATS[ i ].m_count,
+                     ticksToUs( SCRIPT_OPCODE_STATS[ i ].m_ticks ) );
+        }
+
+        fprintf( f, "\nscript,runs,total us,max us\n" );
+        for( const auto& [ id, tot ] : SCRIPT_TOTALS ) {
+            fprintf( f, "%hu,%lu,%lu,%lu\n", id, tot.m_runs, ticksToUs( tot.m_ticks ),
+                     ticksToUs( tot.m_maxTicks ) );
+        }
+
+        fprintf( f, "\nslowest script,instructions,us\n" );
+        for( u8 i = 0; i < SLOWEST_SCRIPT_COUNT && SLOWEST_SCRIPTS[ i ].m_ticks; ++i ) {
+            fprintf( f, "%hu,%hu,%lu\n", SLOWEST_SCRIPTS[ i ].m_scriptId,
+                     SLOWEST_SCRIPTS[ i ].m_instructions,
+                     ticksToUs( SLOWEST_SCRIPTS[ i ].m_ticks ) );
+        }
+
+        FS::close( f );
+        return true;
+    }
+
+    void resetPhaseStats( ) {
+        std::memset( PHASE_STATS, 0, sizeof( PHASE_STATS ) );
+    }
+
+    u32 averageTicks( const phaseStats& p_stats ) {
+        return p_stats.m_count ? p_stats.m_totalTicks / p_stats.m_count : 0;
+    }
+
+    void printPhaseStats( ) {
+        for( u8 i = 0; i < NUM_PHASES; i += 2 ) {
+            int len = 0;
+            for( u8 j = i; j < i + 2 && j < NUM_PHASES; ++j ) {
+                len += snprintf( PROF_BUFFER + len, 199 - len, "%s%s: %lu/%lu/%luus",
+                                 j == i ? "" : "\n", PHASE_NAMES[ j ],
+                                 ticksToUs( PHASE_STATS[ j ].m_minTicks ),
+                                 ticksToUs( averageTicks( PHASE_STATS[ j ] ) ),
+                                 ticksToUs( PHASE_STATS[ j ].m_maxTicks ) );
+            }
+            IO::printMessage( PROF_BUFFER, MSG_INFO );
+        }
+    }
+
+    bool dumpPhaseStats( const char* p_path ) {
+        FILE* f = FS::open( p_path, "PHASES", ".prof.csv", "w" );
+        if( !f ) { return false; }
+
+        fprintf( f, "# %s %s v%d (%s %s)\n", GAME_TITLE, VERSION_NAME, VERSION, __DATE__,
+                 __TIME__ );
+        fprintf( f, "phase,count,min us,avg us,max us" );
+        for( u8 j = 0; j < HISTOGRAM_BUCKETS; ++j ) {
+            if( j + 1 < HISTOGRAM_BUCKETS ) {
+                fprintf( f, ",<%luus", ticksToUs( HISTOGRAM_BASE_TICKS << j ) );
+            } else {
+                fprintf( f, ",rest" );
+            }
+        }
+        fprintf( f, ",allocs\n" );
+
+        for( u8 i = 0; i < NUM_PHASES; ++i ) {
+            const auto& st = PHASE_STATS[ i ];
+            fprintf( f, "%s,%lu,%lu,%lu,%lu", PHASE_NAMES[ i ], st.m_count,
+                     ticksToUs( st.m_minTicks ), ticksToUs( averageTicks( st ) ),
+                     ticksToUs( st.m_maxTicks ) );
+            for( u8 j = 0; j < HISTOGRAM_BUCKETS; ++j ) {
+                fprintf( f, ",%lu", st.m_histogram[ j ] );
+            }
+            fprintf( f, ",%lu\n", st.m_allocations );
+        }
+
+        FS::close( f );
+        return true;
+    }
+
+    /*
+     * @brief: Allocates p_size bytes. Without exceptions, new can't report a failure to
+     * its caller, so running out of memory stops the game with the size that failed.
+     */
+    void* allocate( std::size_t p_size ) {
+        ALLOCATIONS++;
+        if( auto res = std::malloc( p_size ? p_size : 1 ) ) { return res; }
+        fprintf( stderr, "operator new: out of memory (%u bytes, allocation %lu)\n",
+                 unsigned( p_size ), ALLOCATIONS );
+        std::abort( );
+    }
+} // namespace PROF
+
+// count all heap allocations made via new
+void* operator new( std::size_t p_size ) {
+    return PROF::allocate( p_size );
+}
+
+void* operator new[]( std::size_t p_size ) {
+    return PROF::allocate( p_size );
+}
+
+void operator delete( void* p_ptr ) noexcept {
+    std::free( p_ptr );
+}
+
+void operator delete[]( void* p_ptr ) noexcept {
+    std::free( p_ptr );
+}
+
+void operator delete( void* p_ptr, std::size_t ) noexcept {
+    std::free( p_ptr );
+}
+
+void operator delete[]( void* p_ptr, std::size_t ) noexcept {
+    std::free( p_ptr );
+}
+#endif
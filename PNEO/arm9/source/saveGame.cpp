@@ -40,6 +40,7 @@
 #include "io/screenFade.h"
 #include "io/uio.h"
 #include "map/mapDrawer.h"
+#include "prof/profiler.h"
 #include "save/saveGame.h"
 #include "sound/sound.h"
 
@@ -583,18 +584,27 @@ namespace SAVE {
     }
 
     void saveGame::playerInfo::stepIncrease( ) {
+        PROFILE_PHASE( STEP_INCREASE );
         m_stepCount++;
         if( m_repelSteps > 0 ) {
+            PROFILE_PHASE( STEP_INCREASE_REPEL );
             m_repelSteps--;
-            if( !m_repelSteps ) { IO::printMessage( GET_STRING( 4 ) ); }
+            if( !m_repelSteps ) {
+                PROFILE_BLOCKING( );
+                IO::printMessage( GET_STRING( 4 ) );
+            }
         }
 
-        // add exp to day care pkmn
-        for( u8 i = 0; i < 6; ++i ) {
-            if( m_dayCarePkmn[ i ].getSpecies( ) ) { m_dayCarePkmn[ i ].gainExperience( 1 ); }
+        {
+            PROFILE_PHASE( STEP_INCREASE_DAY_CARE );
+            // add exp to day care pkmn
+            for( u8 i = 0; i < 6; ++i ) {
+                if( m_dayCarePkmn[ i ].getSpecies( ) ) { m_dayCarePkmn[ i ].gainExperience( 1 ); }
+            }
         }
 
         if( !m_stepCount ) {
+            PROFILE_PHASE( STEP_INCREASE_EGGS );
             bool hasHatchSpdUp
                 = m_bag.count( BAG::toBagType( BAG::ITEMTYPE_KEYITEM ), I_OVAL_CHARM );
             for( size_t s = 0; s < 6; ++s ) {
@@ -612,6 +622,7 @@ namespace SAVE {
                     if( ac.m_boxdata.m_steps ) ac.m_boxdata.m_steps--;
                     if( hasHatchSpdUp && ac.m_boxdata.m_steps ) ac.m_boxdata.m_steps--;
                     if( !ac.m_boxdata.m_steps ) {
+                        PROFILE_BLOCKING( );
                         ac.hatch( );
                         MAP::curMap->stopPlayer( );
                         MAP::printMapMessage( GET_MAP_STRING( 493 ), (style) 0 );
@@ -31,6 +31,7 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "defines.h"
 #include "fs/fs.h"
+#include "io/backBuffer.h"
 #include "io/screenFade.h"
 #include "io/uio.h"
 
@@ -198,12 +199,14 @@ namespace IO {
 
     void clearScreen( bool p_bottom, bool p_both, bool p_dark ) {
         if( p_both || p_bottom ) {
+            if( BACK_BUFFER.isActive( true ) ) { BACK_BUFFER.disable( false ); }
             dmaFillWords( 0, bgGetGfxPtr( IO::bg2sub ), 256 * 192 );
             dmaFillWords( 0, bgGetGfxPtr( IO::bg3sub ), 256 * 192 );
             dmaFillHalfWords( 0, BG_PALETTE_SUB, 256 );
             if( !p_dark ) { BG_PALETTE_SUB[ 0 ] = WHITE; }
         }
         if( p_both || !p_bottom ) {
+            if( BACK_BUFFER.isActive( false ) ) { BACK_BUFFER.disable( false ); }
             dmaFillWords( 0, bgGetGfxPtr( IO::bg2 ), 256 * 192 );
             dmaFillWords( 0, bgGetGfxPtr( IO::bg3 ), 256 * 192 );
             dmaFillHalfWords( 0, BG_PALETTE, 256 );
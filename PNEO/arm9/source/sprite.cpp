@@ -31,7 +31,9 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "fs/fs.h"
 #include "gen/pokemonNames.h"
+#include "io/decodedSpriteCache.h"
 #include "io/sprite.h"
+#include "io/spriteAllocator.h"
 #include "io/uio.h"
 
 #include "NoItem.h"
@@ -160,6 +162,8 @@ namespace IO {
             // This is bad style, but fast.
             memset( SPRITE_GFX, 0, 1024 );
         }
+        SPRITE_ALLOCATOR[ p_bottom ].disable( );
+        SPRITE_PALETTES[ p_bottom ].disable( );
         updateOAM( p_bottom );
     }
 
@@ -241,11 +245,17 @@ namespace IO {
                     const unsigned short* p_spritePal, const unsigned int* p_spriteData,
                     const u32 p_spriteDataLen, bool p_flipX, bool p_flipY, bool p_hidden,
                     ObjPriority p_priority, bool p_bottom, ObjBlendMode p_blendMode ) {
-        auto res = setSpriteData( p_oamIdx, p_palIdx, p_tileCnt, p_posX, p_posY, p_width, p_height,
+        u8 palIdx = p_palIdx;
+        if( p_palIdx == SHARED_PALETTE ) {
+            palIdx = SPRITE_PALETTES[ p_bottom ].acquire( p_oamIdx, p_spritePal );
+        } else {
+            SPRITE_PALETTES[ p_bottom ].release( p_oamIdx );
+            copySpritePal( p_spritePal, palIdx, p_bottom );
+        }
+        auto res = setSpriteData( p_oamIdx, palIdx, p_tileCnt, p_posX, p_posY, p_width, p_height,
                                   p_spriteDataLen, p_flipX, p_flipY, p_hidden, p_priority, p_bottom,
                                   p_blendMode, OBJCOLOR_16 );
         copySpriteData( p_spriteData, p_tileCnt, p_spriteDataLen, p_bottom );
-        copySpritePal( p_spritePal, p_palIdx, p_bottom );
         return res;
     }
 
@@ -462,8 +472,12 @@ namespace IO {
         return true;
     }
 
-    bool loadPKMNSpriteData( FILE* p_files[ 4 ], const char* p_path, const pkmnSpriteInfo& p_pkmn,
-                             bool p_blackOverlay, u16 p_dataSize = 96 * 96 / 8 ) {
+    /*
+     * @brief: Reads the given pkmn sprite to TEMP and TEMP_PAL and applies the pid
+     * dependent color variation (and spinda's spots).
+     */
+    bool decodePKMNSpriteData( FILE* p_files[ 4 ], const char* p_path,
+                               const pkmnSpriteInfo& p_pkmn, u16 p_dataSize ) {
         FILE* f = nullptr;
         if( !p_pkmn.m_forme ) {
             if( !( f = checkOrOpenPKMNFile( p_files, p_path, p_pkmn.m_female, p_pkmn.m_shiny ) ) ) {
@@ -538,13 +552,26 @@ namespace IO {
             }
         }
 
-        if( p_blackOverlay ) { std::memset( TEMP_PAL, 0, sizeof( TEMP_PAL ) ); }
-
         if( p_pkmn.m_forme && f ) { fclose( f ); }
 
         return true;
     }
 
+    bool loadPKMNSpriteData( FILE* p_files[ 4 ], const char* p_path, const pkmnSpriteInfo& p_pkmn,
+                             bool p_blackOverlay, u16 p_dataSize = 96 * 96 / 8 ) {
+        u8 source = p_files == PKMN_SPRITE_ICON_FILES   ? 0
+                    : p_files == PKMN_SPRITE_FRNT_FILES ? 1
+                                                        : 2;
+        u64 key = decodedSpriteKey( source, p_pkmn );
+        if( !DECODED_SPRITE_CACHE.load( key, p_dataSize ) ) {
+            if( !decodePKMNSpriteData( p_files, p_path, p_pkmn, p_dataSize ) ) { return false; }
+            DECODED_SPRITE_CACHE.store( key, p_dataSize );
+        }
+
+        if( p_blackOverlay ) { std::memset( TEMP_PAL, 0, sizeof( TEMP_PAL ) ); }
+        return true;
+    }
+
     u16 loadPKMNSprite( const s16 p_posX, const s16 p_posY, u8 p_oamIdx, u8 p_palCnt, u16 p_tileCnt,
                         bool p_bottom, bool p_flipx ) {
         loadSprite( p_oamIdx++, p_palCnt, p_tileCnt, p_flipx ? 32 + p_posX : p_posX, p_posY, 64, 64,
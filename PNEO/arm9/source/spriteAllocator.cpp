@@ -0,0 +1,250 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : spriteAllocator.cpp
+author      : Philip Wellnitz
+description : Allocator for sprite vram and cache of sprite images in vram.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "io/message.h"
+#include "io/spriteAllocator.h"
+
+namespace IO {
+    spriteAllocator SPRITE_ALLOCATOR[ 2 ];
+
+    // key of assets whose image is broken; such assets are never returned by acquire
+    constexpr u64 INVALID_ASSET_KEY = 0;
+
+    void spriteAllocator::init( u16 p_reserved ) {
+        _reserved = std::min( p_reserved, SPRITE_ALLOCATOR_UNITS );
+        _clock    = 0;
+        for( u8 i = 0; i < SPRITE_ALLOCATOR_ASSETS; ++i ) {
+            _assets[ i ].m_tile = NO_SPRITE_TILES;
+        }
+
+        // cover the units with the largest aligned blocks that are either completely
+        // reserved or completely free
+        for( u16 pos = 0; pos < SPRITE_ALLOCATOR_UNITS; ) {
+            u8 order = SPRITE_ALLOCATOR_ORDERS - 1;
+            while( ( pos & ( ( 1 << order ) - 1 ) )
+                   || ( pos < _reserved && pos + ( 1 << order ) > _reserved ) ) {
+                --order;
+            }
+            _blocks[ pos ] = order | ( pos < _reserved ? 0 : FREE_BLOCK );
+            pos += 1 << order;
+        }
+        _enabled = true;
+    }
+
+    void spriteAllocator::disable( ) {
+        _enabled = false;
+    }
+
+    u16 spriteAllocator::_take( u8 p_order ) {
+        // smallest free block that is large enough
+        u16 best      = NO_SPRITE_TILES;
+        u8  bestOrder = SPRITE_ALLOCATOR_ORDERS;
+        for( u16 pos = 0; pos < SPRITE_ALLOCATOR_UNITS; pos += 1 << ( _blocks[ pos ] & 0xF ) ) {
+            u8 order = _blocks[ pos ] & 0xF;
+            if( ( _blocks[ pos ] & FREE_BLOCK ) && order >= p_order && order < bestOrder ) {
+                best      = pos;
+                bestOrder = order;
+                if( order == p_order ) { break; }
+            }
+        }
+        if( best == NO_SPRITE_TILES ) { return NO_SPRITE_TILES; }
+
+        // split the block; the upper halves stay free
+        while( bestOrder > p_order ) {
+            --bestOrder;
+            _blocks[ best + ( 1 << bestOrder ) ] = bestOrder | FREE_BLOCK;
+        }
+        _blocks[ best ] = p_order;
+        return best;
+    }
+
+    bool spriteAllocator::_evict( ) {
+        u8 victim = NO_SPRITE_ASSET;
+        for( u8 i = 0; i < SPRITE_ALLOCATOR_ASSETS; ++i ) {
+            const auto& a = _assets[ i ];
+            if( a.m_tile == NO_SPRITE_TILES || a.m_refs ) { continue; }
+            if( victim == NO_SPRITE_ASSET
+                || u16( _clock - a.m_lastUse ) > u16( _clock - _assets[ victim ].m_lastUse ) ) {
+                victim = i;
+            }
+        }
+        if( victim == NO_SPRITE_ASSET ) { return false; }
+#ifdef DESQUID
+        _evictions++;
+#endif
+        _dropAsset( victim );
+        return true;
+    }
+
+    void spriteAllocator::_dropAsset( u8 p_handle ) {
+        free( _assets[ p_handle ].m_tile );
+        _assets[ p_handle ].m_tile = NO_SPRITE_TILES;
+    }
+
+    u16 spriteAllocator::allocate( u16 p_units ) {
+        if( !_enabled || !p_units || p_units > SPRITE_ALLOCATOR_UNITS ) {
+            return NO_SPRITE_TILES;
+        }
+        u8 order = 0;
+        while( ( 1 << order ) < p_units ) { ++order; }
+
+        u16 res;
+        while( ( res = _take( order ) ) == NO_SPRITE_TILES ) {
+            if( !_evict( ) ) { return NO_SPRITE_TILES; }
+        }
+        return res;
+    }
+
+    void spriteAllocator::free( u16 p_tile ) {
+        if( !_enabled || p_tile < _reserved || p_tile >= SPRITE_ALLOCATOR_UNITS
+            || ( _blocks[ p_tile ] & FREE_BLOCK ) ) {
+            return;
+        }
+
+        u8 order = _blocks[ p_tile ];
+        // merge with the buddy as long as it is a free block of the same size
+        while( order + 1 < SPRITE_ALLOCATOR_ORDERS ) {
+            u16 buddy = p_tile ^ ( 1 << order );
+            if( _blocks[ buddy ] != ( order | FREE_BLOCK ) ) { break; }
+            p_tile = std::min( p_tile, buddy );
+            ++order;
+        }
+        _blocks[ p_tile ] = order | FREE_BLOCK;
+    }
+
+    u8 spriteAllocator::acquire( u64 p_key, u16 p_units, bool& p_fresh ) {
+        p_fresh = false;
+        if( !_enabled ) { return NO_SPRITE_ASSET; }
+        ++_clock;
+
+        u8 slot = NO_SPRITE_ASSET;
+        for( u8 i = 0; i < SPRITE_ALLOCATOR_ASSETS; ++i ) {
+            auto& a = _assets[ i ];
+            if( a.m_tile == NO_SPRITE_TILES ) {
+                if( slot == NO_SPRITE_ASSET ) { slot = i; }
+                continue;
+            }
+            if( a.m_key == p_key && p_key != INVALID_ASSET_KEY ) {
+#ifdef DESQUID
+                _hits++;
+#endif
+                a.m_refs++;
+                a.m_lastUse = _clock;
+                return i;
+            }
+        }
+#ifdef DESQUID
+        _misses++;
+#endif
+
+        if( slot == NO_SPRITE_ASSET ) {
+            // all asset slots are taken, reuse the slot of an unused asset
+            if( !_evict( ) ) { return NO_SPRITE_ASSET; }
+            for( u8 i = 0; i < SPRITE_ALLOCATOR_ASSETS; ++i ) {
+                if( _assets[ i ].m_tile == NO_SPRITE_TILES ) {
+                    slot = i;
+                    break;
+                }
+            }
+        }
+
+        u16 tile = allocate( p_units );
+        if( tile == NO_SPRITE_TILES ) { return NO_SPRITE_ASSET; }
+
+        auto& a     = _assets[ slot ];
+        a.m_key     = p_key;
+        a.m_tile    = tile;
+        a.m_refs    = 1;
+        a.m_lastUse = _clock;
+        a.m_data    = 0;
+        std::memset( a.m_palette, 0, sizeof( a.m_palette ) );
+        p_fresh = true;
+        return slot;
+    }
+
+    void spriteAllocator::release( u8 p_handle, bool p_keep ) {
+        if( !_enabled || p_handle >= SPRITE_ALLOCATOR_ASSETS ) { return; }
+        auto& a = _assets[ p_handle ];
+        if( a.m_tile == NO_SPRITE_TILES ) { return; }
+
+        if( !p_keep ) { a.m_key = INVALID_ASSET_KEY; }
+        if( a.m_refs ) { a.m_refs--; }
+        if( !a.m_refs && a.m_key == INVALID_ASSET_KEY ) { _dropAsset( p_handle ); }
+    }
+
+#ifdef DESQUID
+    void spriteAllocator::printStats( const char* p_screen ) const {
+        u16 freeUnits = 0, largest = 0;
+        u8  assets = 0, used = 0;
+        // 0: free, 1: used, 2: partially used, 3: reserved
+        u8  usage[ SPRITE_ALLOCATOR_UNITS / 32 ];
+        std::memset( usage, 0xFF, sizeof( usage ) );
+
+        for( u16 pos = 0; pos < SPRITE_ALLOCATOR_UNITS; pos += 1 << ( _blocks[ pos ] & 0xF ) ) {
+            u16 size   = 1 << ( _blocks[ pos ] & 0xF );
+            u8  status = ( _blocks[ pos ] & FREE_BLOCK ) ? 0 : ( pos < _reserved ? 3 : 1 );
+            if( !status ) {
+                freeUnits += size;
+                if( size > largest ) { largest = size; }
+            }
+            for( u16 i = pos / 32; i <= ( pos + size - 1 ) / 32; ++i ) {
+                if( usage[ i ] == 0xFF ) {
+                    usage[ i ] = status;
+                } else if( usage[ i ] != status ) {
+                    usage[ i ] = ( usage[ i ] == 3 || status == 3 ) ? 3 : 2;
+                }
+            }
+        }
+        for( u8 i = 0; i < SPRITE_ALLOCATOR_ASSETS; ++i ) {
+            if( _assets[ i ].m_tile == NO_SPRITE_TILES ) { continue; }
+            assets++;
+            if( _assets[ i ].m_refs ) { used++; }
+        }
+
+        char map[ SPRITE_ALLOCATOR_UNITS / 32 + 2 ];
+        u8   pos = 0;
+        for( u8 i = 0; i < SPRITE_ALLOCATOR_UNITS / 32; ++i ) {
+            if( i == SPRITE_ALLOCATOR_UNITS / 64 ) { map[ pos++ ] = '\n'; }
+            map[ pos++ ] = ".#+r"[ usage[ i ] ];
+        }
+        map[ pos ] = 0;
+
+        char buffer[ 200 ];
+        snprintf( buffer, 199,
+                  "%s%s: %hu free, largest %hu (%hu%% frag.)\nAssets: %hhu (%hhu used) Hits: "
+                  "%lu Misses: %lu Evicted: %lu\n%s",
+                  p_screen, _enabled ? "" : " (inactive)", freeUnits, largest,
+                  freeUnits ? u16( 100 - largest * 100 / freeUnits ) : 0, assets, used, _hits,
+                  _misses, _evictions, map );
+        IO::printMessage( buffer, MSG_INFO );
+    }
+#endif
+} // namespace IO
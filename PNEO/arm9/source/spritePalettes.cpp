@@ -0,0 +1,164 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : spritePalettes.cpp
+author      : Philip Wellnitz
+description : Sharing of sprite palette slots between sprites with identical palettes.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "io/message.h"
+#include "io/sprite.h"
+#include "io/spritePalettes.h"
+
+namespace IO {
+    spritePalettes SPRITE_PALETTES[ 2 ] = { spritePalettes( false ), spritePalettes( true ) };
+
+    constexpr u8 NO_PALETTE_SLOT = 0xFF;
+
+    /*
+     * @brief: FNV-1a hash of the 16 colors of the given palette.
+     */
+    u32 hashPalette( const unsigned short* p_palette ) {
+        u32 res = 2166136261;
+        for( u8 i = 0; i < 16; ++i ) {
+            res = ( res ^ p_palette[ i ] ) * 16777619;
+        }
+        return res;
+    }
+
+    void spritePalettes::init( u8 p_first, u8 p_last ) {
+        _last  = std::min( p_last, SPRITE_PALETTE_SLOTS );
+        _first = std::min( p_first, _last );
+        _valid = 0;
+        _clock = 0;
+        std::memset( _refs, 0, sizeof( _refs ) );
+        std::memset( _oamSlots, NO_PALETTE_SLOT, sizeof( _oamSlots ) );
+        _enabled = true;
+    }
+
+    void spritePalettes::disable( ) {
+        _enabled = false;
+        _valid   = 0;
+        std::memset( _oamSlots, NO_PALETTE_SLOT, sizeof( _oamSlots ) );
+    }
+
+    u8 spritePalettes::usedSlots( ) const {
+        if( !_enabled ) { return 0; }
+        u8 res = 0;
+        for( u8 i = _first; i < _last; ++i ) {
+            if( _refs[ i ] ) { res++; }
+        }
+        return res;
+    }
+
+    void spritePalettes::release( u8 p_oamIdx ) {
+        if( !_enabled || p_oamIdx >= SPRITE_COUNT || _oamSlots[ p_oamIdx ] == NO_PALETTE_SLOT ) {
+            return;
+        }
+        _refs[ _oamSlots[ p_oamIdx ] ]--;
+        _oamSlots[ p_oamIdx ] = NO_PALETTE_SLOT;
+    }
+
+    u8 spritePalettes::acquire( u8 p_oamIdx, const unsigned short* p_palette ) {
+        release( p_oamIdx );
+        if( !_enabled || _first >= _last || p_oamIdx >= SPRITE_COUNT ) {
+#ifdef DESQUID
+            _failures++;
+#endif
+            copySpritePal( p_palette, SPRITE_PALETTE_SLOTS - 1, _bottom );
+            return SPRITE_PALETTE_SLOTS - 1;
+        }
+
+        ++_clock;
+        u32 hash = p_palette ? hashPalette( p_palette ) : 0;
+        u8  slot = NO_PALETTE_SLOT, victim = NO_PALETTE_SLOT;
+        for( u8 i = _first; i < _last; ++i ) {
+            bool valid = _valid & ( 1 << i );
+            if( valid && p_palette && _hashes[ i ] == hash
+                && !std::memcmp( _palettes[ i ], p_palette, sizeof( _palettes[ i ] ) ) ) {
+                slot = i;
+                break;
+            }
+            if( _refs[ i ] ) { continue; }
+
+            // prefer slots with unknown contents, then the least recently used ones
+            if( victim == NO_PALETTE_SLOT ) {
+                victim = i;
+            } else if( _valid & ( 1 << victim ) ) {
+                if( !valid
+                    || u16( _clock - _lastUse[ i ] ) > u16( _clock - _lastUse[ victim ] ) ) {
+                    victim = i;
+                }
+            }
+        }
+
+        if( slot == NO_PALETTE_SLOT ) {
+            if( victim == NO_PALETTE_SLOT ) {
+                // all slots are in use; sprites using the last slot get wrong colors
+#ifdef DESQUID
+                _failures++;
+#endif
+                victim = _last - 1;
+            }
+            slot = victim;
+            if( p_palette ) {
+                std::memcpy( _palettes[ slot ], p_palette, sizeof( _palettes[ slot ] ) );
+                _hashes[ slot ] = hash;
+                _valid |= 1 << slot;
+                copySpritePal( p_palette, slot, _bottom );
+            } else {
+                _valid &= ~( 1 << slot );
+            }
+#ifdef DESQUID
+            _uploads++;
+#endif
+        } else {
+#ifdef DESQUID
+            _shared++;
+#endif
+        }
+
+        _refs[ slot ]++;
+        _lastUse[ slot ]      = _clock;
+        _oamSlots[ p_oamIdx ] = slot;
+#ifdef DESQUID
+        _peak = std::max( _peak, usedSlots( ) );
+#endif
+        return slot;
+    }
+
+#ifdef DESQUID
+    void spritePalettes::printStats( const char* p_screen ) const {
+        char buffer[ 150 ];
+        snprintf( buffer, 149,
+                  "%s%s: %hhu of %hhu slots used (peak %hhu)\nUploads: %lu Shared: %lu\nAll "
+                  "slots taken: %lu times",
+                  p_screen, _enabled ? "" : " (inactive)", usedSlots( ), u8( _last - _first ),
+                  _peak, _uploads, _shared, _failures );
+        IO::printMessage( buffer, MSG_INFO );
+    }
+#endif
+} // namespace IO
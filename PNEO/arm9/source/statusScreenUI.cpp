@@ -571,8 +571,10 @@ namespace STS {
         IO::copySpritePal( ARR_X_SPR_PAL, SPR_ARROW_X_PAL_SUB, 0, 2 * 7, p_bottom );
         IO::copySpritePal( WINDOW_SPR_PAL, SPR_WINDOW_PAL_SUB, 0, 2 * 16, p_bottom );
 
+        // ribbons share palette slots, many of them have the same palette
+        IO::SPRITE_PALETTES[ p_bottom ].init( SPR_RIBBON_PAL_SUB( 0 ) );
         for( u8 r = 0; r < 12; ++r ) {
-            tileCnt = IO::loadRibbonIcon( 0, 0, 0, SPR_RIBBON_OAM_SUB( r ), SPR_RIBBON_PAL_SUB( r ),
+            tileCnt = IO::loadRibbonIcon( 0, 0, 0, SPR_RIBBON_OAM_SUB( r ), IO::SHARED_PALETTE,
                                           tileCnt, p_bottom );
             oam[ SPR_RIBBON_OAM_SUB( r ) ].isHidden = true;
         }
@@ -1288,9 +1290,11 @@ namespace STS {
                             oamSub[ SPR_ABILITY_OAM_SUB ].gfxIndex, INFO_X_SUB + 88, INFO_Y_SUB, 32,
                             64, false, false, false, OBJPRIORITY_3, true, OBJMODE_BLENDED );
 
-            IO::regularFont->printBreakingStringC(
-                FS::getAbilityDescr( p_pokemon->getAbility( ) ).c_str( ), INFO_X_SUB,
-                INFO_Y_SUB + 18, 188, true, IO::font::LEFT, 13 );
+            IO::regularFont->printLayout(
+                IO::regularFont->cachedLayout(
+                    FS::getAbilityDescr( p_pokemon->getAbility( ) ).c_str( ),
+                    p_pokemon->getAbility( ), 188, IO::font::LEFT, 13, ' ', 0, 1 ),
+                INFO_X_SUB, INFO_Y_SUB + 18, true );
 
             IO::regularFont->setColor( IO::WHITE_IDX, 1 );
             IO::regularFont->setColor( 0, 2 );
@@ -1434,9 +1438,10 @@ namespace STS {
                 for( u8 i = 0; i < 12; ++i ) {
                     IO::Oam->oamBuffer[ SPR_RIBBON_OAM_SUB( i ) ].isHidden = true;
                 }
+                IO::SPRITE_PALETTES[ true ].init( SPR_RIBBON_PAL_SUB( 0 ) );
                 for( u8 r = 0; r < 12 && r < ribs.size( ); ++r ) {
                     IO::loadRibbonIcon( ribs[ r ], 40 + 48 * ( r % 4 ), 16 + 44 * ( r / 4 ),
-                                        SPR_RIBBON_OAM_SUB( r ), SPR_RIBBON_PAL_SUB( r ),
+                                        SPR_RIBBON_OAM_SUB( r ), IO::SHARED_PALETTE,
                                         oamSub[ SPR_RIBBON_OAM_SUB( r ) ].gfxIndex, true );
                 }
             }
@@ -1615,9 +1620,12 @@ namespace STS {
                 IO::regularFont->setColor( 0, 2 );
 
                 // Move descr
-                IO::regularFont->printBreakingStringC(
-                    FS::getMoveDescr( p_pokemon->getMove( p_detailsPage ) ).c_str( ),
-                    INFO_X_SUB - 8, INFO_Y_SUB + 3 - 2, 200, true, IO::font::LEFT, 13 );
+                IO::regularFont->printLayout(
+                    IO::regularFont->cachedLayout(
+                        FS::getMoveDescr( p_pokemon->getMove( p_detailsPage ) ).c_str( ),
+                        p_pokemon->getMove( p_detailsPage ), 200, IO::font::LEFT, 13, ' ', 0,
+                        1 ),
+                    INFO_X_SUB - 8, INFO_Y_SUB + 3 - 2, true );
 
                 // power / acc
                 char buffer2[ 25 ] = { 0 }, buffer3[ 25 ] = { 0 };
@@ -1654,9 +1662,11 @@ namespace STS {
                                                true );
 
                 // Ability description
-                IO::regularFont->printBreakingStringC(
-                    FS::getAbilityDescr( p_pokemon->getAbility( ) ).c_str( ), INFO_X_SUB,
-                    INFO_Y_SUB + 18, 188, true, IO::font::LEFT, 13 );
+                IO::regularFont->printLayout(
+                    IO::regularFont->cachedLayout(
+                        FS::getAbilityDescr( p_pokemon->getAbility( ) ).c_str( ),
+                        p_pokemon->getAbility( ), 188, IO::font::LEFT, 13, ' ', 0, 1 ),
+                    INFO_X_SUB, INFO_Y_SUB + 18, true );
                 IO::regularFont->setColor( IO::WHITE_IDX, 1 );
                 IO::regularFont->setColor( 0, 2 );
             }
@@ -1717,9 +1727,10 @@ namespace STS {
                     IO::Oam->oamBuffer[ SPR_RIBBON_OAM_SUB( i ) ].isHidden = true;
                 }
 
+                IO::SPRITE_PALETTES[ true ].init( SPR_RIBBON_PAL_SUB( 0 ) );
                 for( u8 r = start, i = 0; r < end && r < ribs.size( ); ++r, ++i ) {
                     IO::loadRibbonIcon( ribs[ r ], 20 + 36 * ( i % 6 ), 84 + 36 * ( i / 6 ),
-                                        SPR_RIBBON_OAM_SUB( i ), SPR_RIBBON_PAL_SUB( i ),
+                                        SPR_RIBBON_OAM_SUB( i ), IO::SHARED_PALETTE,
                                         IO::Oam->oamBuffer[ SPR_RIBBON_OAM_SUB( i ) ].gfxIndex,
                                         true );
                 }
@@ -1767,9 +1778,10 @@ namespace STS {
                 for( u8 i = 0; i < 12; ++i ) {
                     IO::Oam->oamBuffer[ SPR_RIBBON_OAM_SUB( i ) ].isHidden = true;
                 }
+                IO::SPRITE_PALETTES[ true ].init( SPR_RIBBON_PAL_SUB( 0 ) );
                 for( u8 r = 0; r < 12 && r < ribs.size( ); ++r ) {
                     IO::loadRibbonIcon( ribs[ r ], 40 + 48 * ( r % 4 ), 16 + 44 * ( r / 4 ),
-                                        SPR_RIBBON_OAM_SUB( r ), SPR_RIBBON_PAL_SUB( r ),
+                                        SPR_RIBBON_OAM_SUB( r ), IO::SHARED_PALETTE,
                                         IO::Oam->oamBuffer[ SPR_RIBBON_OAM_SUB( r ) ].gfxIndex,
                                         true );
                 }
@@ -0,0 +1,150 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : stringAtlas.cpp
+author      : Philip Wellnitz
+description : Cache of pre-rendered static UI strings.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstdio>
+#include <cstring>
+
+#include "io/message.h"
+#include "io/stringAtlas.h"
+
+namespace IO {
+    stringAtlas STRING_ATLAS;
+
+    // a string may use a shelf that is at most this many pixels higher than the string
+    constexpr u8 SHELF_SLACK = 4;
+
+    void stringAtlas::clear( ) {
+#ifdef DESQUID
+        if( _entryCount ) { _resets++; }
+        _usedPixels = 0;
+#endif
+        _entryCount = 0;
+        _shelfCount = 0;
+        _usedHeight = 0;
+    }
+
+    const stringAtlas::entry *stringAtlas::find( const font *p_font, u16 p_stringId,
+                                                 const textLayout::params &p_params,
+                                                 u8 p_language ) {
+        if( p_language != _language ) {
+            clear( );
+            _language = p_language;
+        }
+
+        for( u8 i = 0; i < _entryCount; ++i ) {
+            const auto &e = _entries[ i ];
+            if( e.m_font != p_font || e.m_stringId != p_stringId
+                || !( e.m_params == p_params ) ) {
+                continue;
+            }
+            bool sameColors = true;
+            for( u8 j = 0; j < 5; ++j ) {
+                if( e.m_colors[ j ] != p_font->getColor( j ) ) {
+                    sameColors = false;
+                    break;
+                }
+            }
+            if( sameColors ) {
+#ifdef DESQUID
+                _hits++;
+#endif
+                return &e;
+            }
+        }
+#ifdef DESQUID
+        _misses++;
+#endif
+        return nullptr;
+    }
+
+    bool stringAtlas::_allocate( u16 p_width, u8 p_height, u8 &p_outX, u8 &p_outY ) {
+        for( u8 i = 0; i < _shelfCount; ++i ) {
+            auto &s = _shelves[ i ];
+            if( s.m_height >= p_height && s.m_height <= p_height + SHELF_SLACK
+                && s.m_used + p_width <= STRING_ATLAS_WIDTH ) {
+                p_outX = s.m_used;
+                p_outY = s.m_y;
+                s.m_used += p_width;
+                return true;
+            }
+        }
+
+        if( _shelfCount >= STRING_ATLAS_SHELVES
+            || _usedHeight + p_height > STRING_ATLAS_HEIGHT ) {
+            return false;
+        }
+        _shelves[ _shelfCount++ ] = { _usedHeight, p_height, p_width };
+        p_outX = 0;
+        p_outY = _usedHeight;
+        _usedHeight += p_height;
+        return true;
+    }
+
+    const stringAtlas::entry *stringAtlas::insert( const font *p_font, u16 p_stringId,
+                                                   const textLayout::params &p_params,
+                                                   u16 p_width, u16 p_height, s16 p_offsetX,
+                                                   s16 p_offsetY, u16 p_lines ) {
+        if( p_width > STRING_ATLAS_WIDTH || p_height > STRING_ATLAS_HEIGHT ) { return nullptr; }
+
+        u8 x, y;
+        if( _entryCount >= STRING_ATLAS_ENTRIES || !_allocate( p_width, p_height, x, y ) ) {
+            clear( );
+            _allocate( p_width, p_height, x, y );
+        }
+
+        auto &e      = _entries[ _entryCount++ ];
+        e.m_font     = p_font;
+        e.m_stringId = p_stringId;
+        e.m_params   = p_params;
+        e.m_x        = x;
+        e.m_y        = y;
+        e.m_width    = p_width;
+        e.m_height   = p_height;
+        e.m_offsetX  = p_offsetX;
+        e.m_offsetY  = p_offsetY;
+        e.m_lines    = p_lines;
+        for( u8 j = 0; j < 5; ++j ) { e.m_colors[ j ] = p_font->getColor( j ); }
+
+        for( u8 row = 0; row < p_height; ++row ) {
+            std::memset( pixels( e ) + row * STRING_ATLAS_WIDTH, 0, p_width );
+        }
+#ifdef DESQUID
+        _usedPixels += p_width * p_height;
+#endif
+        return &e;
+    }
+
+#ifdef DESQUID
+    void stringAtlas::printStats( ) const {
+        char buffer[ 100 ];
+        snprintf( buffer, 99, "%hhu strings, %lu%% used\nHits: %lu Misses: %lu\nResets: %lu",
+                  _entryCount, _usedPixels * 100 / ( STRING_ATLAS_WIDTH * STRING_ATLAS_HEIGHT ),
+                  _hits, _misses, _resets );
+        IO::printMessage( buffer, MSG_INFO );
+    }
+#endif
+} // namespace IO
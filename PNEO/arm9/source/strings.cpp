@@ -152,6 +152,30 @@ namespace FS {
         { "Route 2 (Aqu)" },
         { "Route 3 (Mgm)" },
         { "Route 4 (Non)" },
+
+        // 70
+
+        { "Profiling" },
+        { "Script Stats" },
+        { "Dump to SD" },
+        { "Reset Stats" },
+        { "Step Stats" },
+        { "Obj Index Bench" },
+        { "OW Sprite Cache" },
+        { "Glyph Blit Bench" },
+        { "Rect Fill Bench" },
+        { "UI Flush Stats" },
+        { "String Atlas" },
+        { "Sprite VRAM" },
+        { "Sprite Palettes" },
+        { "Decoded Sprites" },
+        { "Trainer to battle?" },
+        { "Simulate" },
+        { "AI Search Bench" },
+        { "AI Switch Bench" },
+        { "Facility Teams" },
+        { "Tournament" },
+        { "Battle Bench" },
     };
 
 #endif
@@ -28,22 +28,28 @@ along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
 #include <nds.h>
 
 #include <algorithm>
+#include <cstring>
 #include <ctime>
+#include <vector>
 
 #include "battle/type.h"
 #include "defines.h"
 #include "fs/data.h"
+#include "io/backBuffer.h"
+#include "io/message.h"
 #include "io/uio.h"
+#include "prof/profiler.h"
 #include "save/saveGame.h"
 
 namespace IO {
-    font *regularFont
-        = new font( REGULAR_FONT::fontData, REGULAR_FONT::fontWidths, REGULAR_FONT::shiftchar );
-    font *boldFont = new font( BOLD_FONT::fontData, BOLD_FONT::fontWidths, BOLD_FONT::shiftchar );
-    font *smallFont
-        = new font( SMALL_FONT::fontData, SMALL_FONT::fontWidths, SMALL_FONT::shiftchar );
-    font *brailleFont
-        = new font( BRAILLE_FONT::fontData, BRAILLE_FONT::fontWidths, BRAILLE_FONT::shiftchar );
+    font *regularFont = new font( REGULAR_FONT::glyphs, REGULAR_FONT::fontData,
+                                  REGULAR_FONT::fontWidths, REGULAR_FONT::charPages );
+    font *boldFont
+        = new font( BOLD_FONT::glyphs, BOLD_FONT::fontData, BOLD_FONT::fontWidths, BOLD_FONT::charPages );
+    font *smallFont   = new font( SMALL_FONT::glyphs, SMALL_FONT::fontData, SMALL_FONT::fontWidths,
+                                  SMALL_FONT::charPages );
+    font *brailleFont = new font( BRAILLE_FONT::glyphs, BRAILLE_FONT::fontData,
+                                  BRAILLE_FONT::fontWidths, BRAILLE_FONT::charPages );
     ConsoleFont *consoleFont = new ConsoleFont( );
 
     OAMTable  *Oam = new OAMTable( );
@@ -62,6 +68,7 @@ namespace IO {
     int bg2;
 
     void initVideo( bool p_noFade ) {
+        if( BACK_BUFFER.isActive( false ) ) { BACK_BUFFER.disable( false ); }
         vramSetBankA( VRAM_A_MAIN_BG_0x06000000 );
         //        vramSetBankB( VRAM_B_MAIN_BG_0x06020000 );
 
@@ -86,6 +93,7 @@ namespace IO {
         bgUpdate( );
     }
     void initVideoSub( bool p_noFade ) {
+        if( BACK_BUFFER.isActive( true ) ) { BACK_BUFFER.disable( false ); }
         // vramSetBankC( VRAM_C_SUB_BG_0x06200000 );
         vramSetBankC( VRAM_C_SUB_BG_0x06200000 );
         vramSetBankD( VRAM_D_SUB_SPRITE );
@@ -206,27 +214,15 @@ namespace IO {
      * @brief Sets a pixel to the specified color
      */
     void setPixel( u8 p_x, u8 p_y, bool p_bottom, u8 p_color, u8 p_layer ) {
-        if( p_bottom ) {
-            color old
-                = ( (color *) BG_BMP_RAM_SUB( p_layer ) )[ ( p_x + p_y * (u16) SCREEN_WIDTH ) / 2 ];
-            u8 bot = old, top = old >> 8;
-            if( p_x & 1 )
-                old = ( ( (u8) p_color ) << 8 ) | bot;
-            else
-                old = ( top << 8 ) | ( (u8) p_color );
-
-            ( (color *) BG_BMP_RAM_SUB( p_layer ) )[ ( p_x + p_y * (u16) SCREEN_WIDTH ) / 2 ] = old;
-        } else {
-            color old
-                = ( (color *) BG_BMP_RAM( p_layer ) )[ ( p_x + p_y * (u16) SCREEN_WIDTH ) / 2 ];
-            u8 bot = old, top = old >> 8;
-            if( p_x & 1 )
-                old = ( ( (u8) p_color ) << 8 ) | bot;
-            else
-                old = ( top << 8 ) | ( (u8) p_color );
-
-            ( (color *) BG_BMP_RAM( p_layer ) )[ ( p_x + p_y * (u16) SCREEN_WIDTH ) / 2 ] = old;
-        }
+        color *bmp = BACK_BUFFER.bitmap( p_bottom, p_layer, p_x, p_y, p_x, p_y );
+        color  old = bmp[ ( p_x + p_y * (u16) SCREEN_WIDTH ) / 2 ];
+        u8     bot = old, top = old >> 8;
+        if( p_x & 1 )
+            old = ( ( (u8) p_color ) << 8 ) | bot;
+        else
+            old = ( top << 8 ) | ( (u8) p_color );
+
+        bmp[ ( p_x + p_y * (u16) SCREEN_WIDTH ) / 2 ] = old;
     }
 
     void drawLine( u8 p_x1, u8 p_y1, u8 p_x2, u8 p_y2, bool p_bottom, u8 p_color, u8 p_layer ) {
@@ -273,12 +269,197 @@ namespace IO {
     /*
      * @brief Prints a rectangle to the screen, all coordinates inclusive
      */
+    // spans of at least this many words are filled via dma
+    constexpr u16 DMA_FILL_MIN_WORDS = 8;
+
+    void fillWords( u32 *p_dest, u32 p_value, u32 p_count ) {
+        // dma bypasses the data cache, so the back buffer in main RAM is filled by the cpu
+        if( p_count >= DMA_FILL_MIN_WORDS && !BACK_BUFFER.contains( p_dest ) ) {
+            dmaFillWords( p_value, p_dest, 4 * p_count );
+            return;
+        }
+        for( u32 i = 0; i < p_count; ++i ) { p_dest[ i ] = p_value; }
+    }
+
+    /*
+     * @brief: Sets the pixels p_x1, ..., p_x2 of a bitmap row to p_color. The vram only
+     * supports 16 and 32 bit writes, so only the pixels at odd edges need to be merged
+     * with their neighbors; everything else is written in whole words.
+     */
+    void fillSpan( u16 *p_row, u16 p_x1, u16 p_x2, u8 p_color ) {
+        if( p_x1 & 1 ) {
+            p_row[ p_x1 / 2 ] = ( p_row[ p_x1 / 2 ] & 0x00FF ) | ( p_color << 8 );
+            ++p_x1;
+        }
+        if( p_x1 > p_x2 ) { return; }
+        if( !( p_x2 & 1 ) ) { p_row[ p_x2 / 2 ] = ( p_row[ p_x2 / 2 ] & 0xFF00 ) | p_color; }
+
+        // half words [from, to) are covered completely
+        u16 from = p_x1 / 2, to = ( p_x2 + 1 ) / 2;
+        u16 fill = p_color | ( p_color << 8 );
+        if( from < to && ( from & 1 ) ) { p_row[ from++ ] = fill; }
+        if( from < to && ( to & 1 ) ) { p_row[ --to ] = fill; }
+        if( from < to ) {
+            fillWords( reinterpret_cast<u32 *>( p_row + from ), fill | ( fill << 16 ),
+                       ( to - from ) / 2 );
+        }
+    }
+
+    void fillRectangle( u16 *p_bmp, const rectangle &p_rect ) {
+        if( p_rect.m_x1 > p_rect.m_x2 || p_rect.m_y1 > p_rect.m_y2 ) { return; }
+        if( !p_rect.m_x1 && p_rect.m_x2 == SCREEN_WIDTH - 1 ) {
+            // full rows are contiguous
+            u32 fill = p_rect.m_color * 0x01010101;
+            fillWords( reinterpret_cast<u32 *>( p_bmp + p_rect.m_y1 * SCREEN_WIDTH / 2 ), fill,
+                       ( p_rect.m_y2 - p_rect.m_y1 + 1 ) * SCREEN_WIDTH / 4 );
+            return;
+        }
+        for( u16 y = p_rect.m_y1; y <= p_rect.m_y2; ++y ) {
+            fillSpan( p_bmp + y * SCREEN_WIDTH / 2, p_rect.m_x1, p_rect.m_x2, p_rect.m_color );
+        }
+    }
+
     void printRectangle( u8 p_x1, u8 p_y1, u8 p_x2, u8 p_y2, bool p_bottom, u8 p_color,
                          u8 p_layer ) {
+        fillRectangle( BACK_BUFFER.bitmap( p_bottom, p_layer, p_x1, p_y1, p_x2, p_y2 ),
+                       { p_x1, p_y1, p_x2, p_y2, p_color } );
+    }
+
+    void printRectangles( const rectangle *p_rectangles, u8 p_count, bool p_bottom,
+                          u8 p_layer ) {
+        for( u8 i = 0; i < p_count; ++i ) {
+            const auto &r = p_rectangles[ i ];
+            fillRectangle( BACK_BUFFER.bitmap( p_bottom, p_layer, r.m_x1, r.m_y1, r.m_x2, r.m_y2 ),
+                           r );
+        }
+    }
+
+    void blit8( const u8 *p_src, u8 p_x, u8 p_y, u16 p_width, u16 p_height, bool p_bottom,
+                u8 p_layer ) {
+        if( !p_width || !p_height ) { return; }
+        u16 *bmp = BACK_BUFFER.bitmap( p_bottom, p_layer, p_x, p_y, p_x + p_width - 1,
+                                       p_y + p_height - 1 );
+        u16  end = std::min( p_x + p_width, int( SCREEN_WIDTH ) );
+
+        for( u16 y = 0; y < p_height; ++y ) {
+            u16      *row = bmp + ( p_y + y ) * SCREEN_WIDTH / 2;
+            const u8 *src = p_src + y * p_width;
+            u16       x   = p_x;
+
+            if( x & 1 ) {
+                row[ x / 2 ] = ( row[ x / 2 ] & 0x00FF ) | ( *( src++ ) << 8 );
+                ++x;
+            }
+            for( ; x + 1 < end; x += 2, src += 2 ) { row[ x / 2 ] = src[ 0 ] | ( src[ 1 ] << 8 ); }
+            if( x < end ) { row[ x / 2 ] = ( row[ x / 2 ] & 0xFF00 ) | *src; }
+        }
+    }
+
+    void blit8Masked( const u8 *p_src, u16 p_stride, s16 p_x, s16 p_y, u16 p_width,
+                      u16 p_height, bool p_bottom, u8 p_layer ) {
+        s16 fromX = std::max( p_x, s16( 0 ) ), toX = std::min( p_x + p_width, SCREEN_WIDTH );
+        s16 fromY = std::max( p_y, s16( 0 ) ), toY = std::min( p_y + p_height, 256 );
+        if( fromX >= toX || fromY >= toY ) { return; }
+
+        u16 *bmp = BACK_BUFFER.bitmap( p_bottom, p_layer, fromX, fromY, toX - 1, toY - 1 );
+        for( s16 y = fromY; y < toY; ++y ) {
+            u16      *row = bmp + y * SCREEN_WIDTH / 2;
+            const u8 *src = p_src + ( y - p_y ) * p_stride - p_x;
+
+            // pixels outside of [fromX, toX) count as transparent
+            for( s16 x = fromX & ~1; x < toX; x += 2 ) {
+                u8 lo = x >= fromX ? src[ x ] : 0;
+                u8 hi = x + 1 < toX ? src[ x + 1 ] : 0;
+                if( lo && hi ) {
+                    row[ x / 2 ] = lo | ( hi << 8 );
+                } else if( lo ) {
+                    row[ x / 2 ] = ( row[ x / 2 ] & 0xFF00 ) | lo;
+                } else if( hi ) {
+                    row[ x / 2 ] = ( row[ x / 2 ] & 0x00FF ) | ( hi << 8 );
+                }
+            }
+        }
+    }
+
+#ifdef DESQUID
+    void printRectangleReference( u8 p_x1, u8 p_y1, u8 p_x2, u8 p_y2, bool p_bottom,
+                                  u8 p_color, u8 p_layer ) {
         for( u16 y = p_y1; y <= p_y2; ++y )
             for( u16 x = p_x1; x <= p_x2; ++x ) { setPixel( x, y, p_bottom, p_color, p_layer ); }
     }
 
+    void benchmarkRectangles( bool p_bottom, u8 p_layer ) {
+        // the rectangles printChoiceBox( 8, 40, 120, 72, 3, COLOR_IDX, false ) prints
+        constexpr rectangle CHOICE_BOX[] = {
+            { 118, 41, 120, 72, BLACK_IDX }, { 9, 71, 120, 72, BLACK_IDX },
+            { 8, 40, 11, 71, COLOR_IDX },    { 115, 40, 118, 71, COLOR_IDX },
+            { 8, 40, 118, 41, COLOR_IDX },   { 8, 72, 118, 71, COLOR_IDX },
+            { 116, 42, 117, 73, BLACK_IDX }, { 12, 71, 117, 73, BLACK_IDX },
+            { 11, 41, 115, 72, WHITE_IDX },
+        };
+        // printCounter( 123456, 6, 100, 80, 2, ... )
+        constexpr rectangle COUNTER[] = {
+            { 140, 82, 147, 94, 0 }, { 132, 82, 139, 94, 0 },         { 124, 82, 131, 94, 0 },
+            { 116, 82, 123, 94, 0 }, { 108, 82, 115, 94, COLOR_IDX }, { 100, 82, 107, 94, 0 },
+        };
+        // bagUI: clearing the party pkmn
+        constexpr rectangle BAG_PARTY[] = {
+            { 0, 28, 133, 54, 0 },   { 0, 54, 133, 80, 0 },   { 0, 80, 133, 106, 0 },
+            { 0, 106, 133, 132, 0 }, { 0, 132, 133, 158, 0 }, { 0, 158, 133, 184, 0 },
+        };
+        // bagUI: message box / item window
+        constexpr rectangle MESSAGE[] = { { 3, 152, 253, 183, 0 }, { 61, 40, 255, 60, 0 } };
+        constexpr rectangle CLEAR[]   = { { 0, 0, 255, 191, 0 } };
+
+        const struct {
+            const char      *m_name;
+            const rectangle *m_rectangles;
+            u8               m_count;
+        } WORKLOADS[] = {
+            { "choiceBox", CHOICE_BOX, sizeof( CHOICE_BOX ) / sizeof( rectangle ) },
+            { "counter", COUNTER, sizeof( COUNTER ) / sizeof( rectangle ) },
+            { "bagParty", BAG_PARTY, sizeof( BAG_PARTY ) / sizeof( rectangle ) },
+            { "message", MESSAGE, sizeof( MESSAGE ) / sizeof( rectangle ) },
+            { "clear", CLEAR, sizeof( CLEAR ) / sizeof( rectangle ) },
+        };
+        constexpr u16 SCREEN_HWORDS = SCREEN_WIDTH * SCREEN_HEIGHT / 2;
+
+        u16             *bmp = p_bottom ? BG_BMP_RAM_SUB( p_layer ) : BG_BMP_RAM( p_layer );
+        std::vector<u16> reference( SCREEN_HWORDS );
+        auto             fillPattern = [ & ]( ) {
+            for( u16 i = 0; i < SCREEN_HWORDS; ++i ) { bmp[ i ] = 0x0201 + ( i & 0x0f0f ); }
+        };
+
+        char buffer[ 100 ];
+        for( u8 i = 0; i < sizeof( WORKLOADS ) / sizeof( WORKLOADS[ 0 ] ); ++i ) {
+            const auto &w = WORKLOADS[ i ];
+
+            fillPattern( );
+            u32 start = PROF::ticks( );
+            for( u8 j = 0; j < w.m_count; ++j ) {
+                const auto &r = w.m_rectangles[ j ];
+                printRectangleReference( r.m_x1, r.m_y1, r.m_x2, r.m_y2, p_bottom, r.m_color,
+                                         p_layer );
+            }
+            u32 refTicks = PROF::ticks( ) - start;
+            std::memcpy( reference.data( ), bmp, 2 * SCREEN_HWORDS );
+
+            fillPattern( );
+            start = PROF::ticks( );
+            printRectangles( w.m_rectangles, w.m_count, p_bottom, p_layer );
+            u32 fastTicks = PROF::ticks( ) - start;
+
+            bool match = !std::memcmp( reference.data( ), bmp, 2 * SCREEN_HWORDS );
+
+            // one tick of the profiling timer corresponds to 2 cpu cycles
+            snprintf( buffer, 99, "%s: %s\nsetPixel %lu, fill %lu cyc", w.m_name,
+                      match ? "ok" : "MISMATCH", 2 * refTicks, 2 * fastTicks );
+            printMessage( buffer, MSG_INFO );
+        }
+        fillWords( reinterpret_cast<u32 *>( bmp ), 0, SCREEN_HWORDS / 2 );
+    }
+#endif
+
     void displayHP( u16 p_HPstart, u16 p_HP, u8 p_x, u8 p_y, u8 p_freecolor1, u8 p_freecolor2,
                     bool p_delay, bool p_big ) {
         if( p_big )
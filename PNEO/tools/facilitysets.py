@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+#
+# Pokémon neo
+# ------------------------------
+#
+# file        : facilitysets.py
+# author      : Philip Wellnitz
+# description : Builds the per-tier pools of pre-built battle facility sets
+#               (DATA/BFTR_PKMN/<tier>.sets.data, read by FS::loadBattleFacilitySets)
+#               from a text file with one set per line:
+#
+#                   <tier> <species>[/<forme>] <nature> <ability> <item> <moves> <evs>
+#
+#               where tier is bad, average or good (or 0 to 2), species, ability, item
+#               and moves are the names of the PKMN_, A_, I_ and M_ constants in
+#               arm9/include/gen without the prefix (e.g. GARCHOMP, ROUGH_SKIN,
+#               LIFE_ORB), item is - for no item, moves is a comma-separated list of up
+#               to 4 moves and evs are the 6 EVs (HP/ATK/DEF/SATK/SDEF/SPEED), separated
+#               by slashes. Everything after a # is a comment.
+#
+#               Each output file is a facilitySetsHeader (magic, version, number of sets)
+#               followed by the sets (struct facilitySet), sorted by species; sets of
+#               the same species keep the order of the input.
+#
+# usage       : facilitysets.py <sets file> <output directory>
+#
+# This file is part of Pokémon neo; see COPYING for license details.
+
+import os
+import re
+import struct
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+GEN = os.path.join(HERE, "..", "arm9", "include", "gen")
+PKMN_DATA = os.path.join(HERE, "..", "arm9", "include", "pokemonData.h")
+
+# keep in sync with arm9/include/map/mapBattleFacilityDefines.h
+FACILITY_SETS_MAGIC = 0x53544642
+FACILITY_SETS_VERSION = 1
+MAX_FACILITY_SETS = 512
+TIERS = {"bad": 0, "average": 1, "good": 2}
+
+HEADER = struct.Struct("<IHH")
+SET = struct.Struct("<HBBHH4H6B")
+assert HEADER.size == 8 and SET.size == 22
+
+
+def read_names(p_path, p_pattern):
+    names = {}
+    for match in re.finditer(p_pattern, open(p_path, encoding="utf-8").read()):
+        names[match.group(1)] = int(match.group(2), 0)
+    return names
+
+
+def lookup(p_names, p_kind, p_name, p_line):
+    if p_name not in p_names:
+        raise ValueError("line %d: unknown %s %s" % (p_line, p_kind, p_name))
+    return p_names[p_name]
+
+
+def parse(p_path):
+    species = read_names(os.path.join(GEN, "pokemonNames.h"), r"#define PKMN_(\w+) (\d+)")
+    moves = read_names(os.path.join(GEN, "moveNames.h"), r"#define M_(\w+) (\d+)")
+    items = read_names(os.path.join(GEN, "itemNames.h"), r"#define I_(\w+) (\d+)")
+    abilities = read_names(os.path.join(GEN, "abilityNames.h"), r"#define A_(\w+) (\d+)")
+    natures = read_names(PKMN_DATA, r"NATURE_(\w+)\s*=\s*(\d+)")
+
+    tiers = [[] for _ in TIERS]
+    for nr, line in enumerate(open(p_path, encoding="utf-8"), 1):
+        fields = line.split("#")[0].split()
+        if not fields:
+            continue
+        if len(fields) != 7:
+            raise ValueError("line %d: expected 7 fields, got %d" % (nr, len(fields)))
+        tier, pkmn, nature, ability, item, movelist, evs = fields
+
+        tier = TIERS[tier] if tier in TIERS else int(tier)
+        if tier not in TIERS.values():
+            raise ValueError("line %d: unknown tier %s" % (nr, fields[0]))
+        name, _, forme = pkmn.partition("/")
+        mvs = [lookup(moves, "move", m, nr) for m in movelist.split(",")]
+        evs = [int(e) for e in evs.split("/")]
+        if not 1 <= len(mvs) <= 4:
+            raise ValueError("line %d: a set needs 1 to 4 moves" % nr)
+        if len(evs) != 6 or min(evs) < 0 or max(evs) > 252 or sum(evs) > 510:
+            raise ValueError("line %d: invalid EVs %s" % (nr, fields[6]))
+
+        tiers[tier].append((lookup(species, "species", name, nr), int(forme or 0),
+                            lookup(natures, "nature", nature, nr),
+                            lookup(abilities, "ability", ability, nr),
+                            0 if item == "-" else lookup(items, "item", item, nr),
+                            mvs + [0] * (4 - len(mvs)), evs))
+    return tiers
+
+
+def write(p_sets, p_path):
+    # stable, so that the variants of a species keep their order
+    p_sets = sorted(p_sets, key=lambda p_set: p_set[0])
+    with open(p_path, "wb") as f:
+        f.write(HEADER.pack(FACILITY_SETS_MAGIC, FACILITY_SETS_VERSION, len(p_sets)))
+        for sp, forme, nature, ability, item, mvs, evs in p_sets:
+            f.write(SET.pack(sp, forme, nature, ability, item, *mvs, *evs))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print("usage: facilitysets.py <sets file> <output directory>")
+        sys.exit(1)
+    tiers = parse(sys.argv[1])
+    os.makedirs(sys.argv[2], exist_ok=True)
+    for tier, sets in enumerate(tiers):
+        if len(sets) > MAX_FACILITY_SETS:
+            print("tier %d: %d sets, at most %d fit" % (tier, len(sets), MAX_FACILITY_SETS))
+            sys.exit(1)
+        if not sets:
+            continue
+        write(sets, os.path.join(sys.argv[2], "%d.sets.data" % tier))
+        print("tier %d: %d sets" % (tier, len(sets)))
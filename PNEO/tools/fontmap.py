@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+#
+# Pokémon neo
+# ------------------------------
+#
+# file        : fontmap.py
+# author      : Philip Wellnitz
+# description : Replaces the shiftchar function of a font source file (e.g.
+#               arm9/source/fontRegular.cpp), a chain of
+#
+#                   if( <condition on p_val> ) { p_val = <expression>; return; }
+#
+#               statements that maps a char to the index of its glyph, by a two-level
+#               lookup table used by IO::font: charPages[ c >> 8 ] is either null (all
+#               chars of the page are used as glyph index directly) or points to the
+#               256 glyph indices of the chars of that page.
+#
+#               The function is evaluated for every possible (16 bit) char, where char
+#               literals are treated as the (arm) compiler does: single chars are
+#               unsigned, multi-byte chars (e.g. UTF-8 sequences) are multi-char
+#               constants.
+#
+# usage       : fontmap.py <font source file>...
+#
+# This file is part of Pokémon neo; see COPYING for license details.
+
+import re
+import sys
+
+ESCAPES = {"n": 10, "r": 13, "t": 9, "0": 0, "\\": 92, "'": 39, "\"": 34}
+
+
+def char_value(p_literal):
+    chars, i = [], 0
+    while i < len(p_literal):
+        if p_literal[i] == "\\":
+            if p_literal[i + 1] == "x":
+                match = re.match(r"[0-9a-fA-F]+", p_literal[i + 2:])
+                chars.append(int(match.group(0), 16) & 0xFF)
+                i += 2 + len(match.group(0))
+            else:
+                chars.append(ESCAPES[p_literal[i + 1]])
+                i += 2
+        else:
+            chars += p_literal[i].encode("utf-8")
+            i += 1
+    res = 0
+    for c in chars:
+        res = ((res << 8) | c) & 0xFFFFFFFF
+    # multi-char constants are ints
+    return res - (1 << 32) if res >= 1 << 31 else res
+
+
+def to_python(p_expression):
+    res = re.sub(r"'((?:\\.|[^'\\])+)'", lambda m: str(char_value(m.group(1))), p_expression)
+    res = res.replace("&&", " and ").replace("||", " or ")
+    if re.search(r"[^\w\s()+\-*<>=!]", res.replace(" and ", "").replace(" or ", "")):
+        raise ValueError("unsupported expression: " + p_expression)
+    return res
+
+
+def parse_rules(p_body):
+    body = re.sub(r"//[^\n]*", "", p_body)
+    rules = []
+    stmt = re.compile(r"\s*if\s*\((.*?)\)\s*\{\s*p_val\s*=\s*(.*?);\s*return;\s*\}", re.S)
+    pos = 0
+    while True:
+        match = stmt.match(body, pos)
+        if not match:
+            break
+        rules.append((eval("lambda p_val: " + to_python(match.group(1))),
+                      eval("lambda p_val: " + to_python(match.group(2)))))
+        pos = match.end()
+    if not re.fullmatch(r"\s*(return;)?\s*", body[pos:]):
+        raise ValueError("unsupported statement: " + body[pos:pos + 60].strip())
+    return rules
+
+
+def apply_rules(p_rules, p_ch):
+    for cond, expr in p_rules:
+        if cond(p_ch):
+            return expr(p_ch) & 0xFFFF
+    return p_ch
+
+
+def format_values(p_values, p_indent, p_perLine):
+    lines = []
+    for i in range(0, len(p_values), p_perLine):
+        lines.append(p_indent + ", ".join(p_values[i:i + p_perLine]) + ",")
+    return "\n".join(lines)
+
+
+def convert(p_path):
+    source = open(p_path, encoding="utf-8").read()
+    match = re.search(r"( *)void shiftchar\( u16& p_val \) \{\n", source)
+    if not match:
+        print("%s: no shiftchar function found, skipping" % p_path)
+        return
+    indent = match.group(1)
+    end = source.index("\n" + indent + "}\n", match.end())
+    rules = parse_rules(source[match.end():end])
+
+    mapping = [apply_rules(rules, ch) for ch in range(1 << 16)]
+    pages = [p for p in range(256)
+             if any(mapping[ch] != ch for ch in range(p << 8, (p + 1) << 8))]
+
+
+    res = ""
+    for p in pages:
+        res += "%sconst u16 charPage%02x[ 256 ] = {\n" % (indent, p)
+        res += format_values(["%d" % v for v in mapping[p << 8:(p + 1) << 8]],
+                             indent + "    ", 16)
+        res += "\n%s};\n" % indent
+    res += "%sconst u16* const charPages[ 256 ] = {\n" % indent
+    res += format_values(["charPage%02x" % p if p in pages else "nullptr" for p in range(256)],
+                         indent + "    ", 8)
+    res += "\n%s};" % indent
+
+    source = source[:match.start()] + res + source[end + len(indent) + 2:]
+    open(p_path, "w", encoding="utf-8").write(source)
+    print("%s: %d rules, %d pages" % (p_path, len(rules), len(pages)))
+
+
+if __name__ == "__main__":
+    for path in sys.argv[1:]:
+        convert(path)
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+#
+# Pokémon neo
+# ------------------------------
+#
+# file        : fontpack.py
+# author      : Philip Wellnitz
+# description : Converts the 8bpp glyph tables of a font source file (e.g.
+#               arm9/source/fontRegular.cpp) into the packed glyph format used by
+#               IO::font: every glyph is cropped to the bounding box of its visible
+#               (i.e. inside the glyph's width) non-zero pixels, which are then stored
+#               row by row with GLYPH_BPP bits per pixel (least significant bits first).
+#
+#               Before the file is rewritten, every glyph is rendered from both the
+#               old and the new table (with an opaque background, so that also the
+#               transparent pixels are compared) and the results are checked for
+#               equality.
+#
+# usage       : fontpack.py <font source file>...
+#
+# This file is part of Pokémon neo; see COPYING for license details.
+
+import re
+import sys
+
+GLYPH_BPP = 3
+FONT_WIDTH = 16
+FONT_HEIGHT = 16
+
+
+def parse_array(p_source, p_name):
+    # only matches the plain (non-const) tables; the packed output is declared const
+    match = re.search(r"(?<!const )\bu8\s+" + p_name + r"\[[^\]]*\]\s*=\s*\{", p_source)
+    if not match:
+        return None, None
+    end = p_source.index("}", match.end())
+    values = [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", p_source[match.end():end])]
+    return values, (match.start(), p_source.index(";", end) + 1)
+
+
+def bounding_box(p_glyph, p_width):
+    xs, ys = [], []
+    for y in range(FONT_HEIGHT):
+        for x in range(p_width):
+            if p_glyph[y * FONT_WIDTH + x]:
+                xs.append(x)
+                ys.append(y)
+    if not xs:
+        return 0, 0, 0, 0
+    return min(xs), min(ys), max(xs) - min(xs) + 1, max(ys) - min(ys) + 1
+
+
+def pack(p_data, p_widths):
+    glyphs, stream = [], bytearray()
+    for ch, width in enumerate(p_widths):
+        glyph = p_data[ch * 256:(ch + 1) * 256]
+        left, top, width, height = bounding_box(glyph, width)
+        glyphs.append((len(stream), left, top, width, height))
+
+        bits, cnt = 0, 0
+        for y in range(top, top + height):
+            for x in range(left, left + width):
+                val = glyph[y * FONT_WIDTH + x]
+                if val >= 1 << GLYPH_BPP:
+                    raise ValueError("glyph %d uses color %d" % (ch, val))
+                bits |= val << cnt
+                cnt += GLYPH_BPP
+        stream += bits.to_bytes((cnt + 7) // 8, "little")
+    if len(stream) >= 1 << 16:
+        raise ValueError("packed font too large")
+    # the renderer always reads two bytes at a time
+    stream.append(0)
+    return glyphs, stream
+
+
+def render_packed(p_glyph, p_stream, p_width):
+    offset, left, top, width, height = p_glyph
+    res = []
+    for y in range(FONT_HEIGHT):
+        for x in range(p_width):
+            val = 0
+            if top <= y < top + height and left <= x < left + width:
+                bit = offset * 8 + ((y - top) * width + x - left) * GLYPH_BPP
+                word = p_stream[bit >> 3] | (p_stream[(bit >> 3) + 1] << 8)
+                val = (word >> (bit & 7)) & ((1 << GLYPH_BPP) - 1)
+            res.append(val)
+    return res
+
+
+def render_plain(p_data, p_ch, p_width):
+    return [p_data[p_ch * 256 + y * FONT_WIDTH + x]
+            for y in range(FONT_HEIGHT) for x in range(p_width)]
+
+
+def format_values(p_values, p_indent, p_perLine):
+    lines = []
+    for i in range(0, len(p_values), p_perLine):
+        lines.append(p_indent + ", ".join(p_values[i:i + p_perLine]) + ",")
+    return "\n".join(lines)
+
+
+def convert(p_path):
+    source = open(p_path, encoding="utf-8").read()
+    if re.search(r"\bpackedGlyph\s+glyphs\[", source):
+        print("%s: already packed, skipping" % p_path)
+        return
+    data, span = parse_array(source, "fontData")
+    if data is None:
+        print("%s: no unpacked glyph table found, skipping" % p_path)
+        return
+    widths, _ = parse_array(source, "fontWidths")
+    num_chars = len(widths)
+    data += [0] * (num_chars * 256 - len(data))
+
+    glyphs, stream = pack(data, widths)
+    for ch in range(num_chars):
+        if render_packed(glyphs[ch], stream, widths[ch]) != render_plain(data, ch, widths[ch]):
+            raise ValueError("%s: glyph %d differs after packing" % (p_path, ch))
+
+    res = "const packedGlyph glyphs[ NUM_CHARS ] = {\n"
+    res += format_values(["{ %d, %d, %d, %d, %d }" % g for g in glyphs], "            ", 4)
+    res += "\n        };\n"
+    res += "        const u8 fontData[ %d ] = {\n" % len(stream)
+    res += format_values(["%d" % b for b in stream], "            ", 20)
+    res += "\n        };"
+
+    source = source[:span[0]] + res + source[span[1]:]
+    open(p_path, "w", encoding="utf-8").write(source)
+    print("%s: %d glyphs, %d bytes -> %d bytes" % (p_path, num_chars, num_chars * 256,
+                                                  len(stream) + 6 * num_chars))
+
+
+if __name__ == "__main__":
+    for path in sys.argv[1:]:
+        convert(path)
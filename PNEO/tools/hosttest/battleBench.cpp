@@ -0,0 +1,109 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleBench.cpp
+author      : Philip Wellnitz
+description : Host run of the battle turn benchmark (BATTLE::benchmarkBattleTurns):
+              plays the scripted scenarios and compares the results with the baseline
+              battleBench.base.csv next to this file. Fails if a phase ran a different
+              number of times than in the baseline (with the fixed seeds, this only
+              happens if the battle logic changed); phases that got slower are only
+              reported, since host timings vary between machines. If the baseline is
+              missing, the results are saved as the new baseline. Uses the hand-written
+              data of shim/game.cpp, not the game's data files.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/battle.cpp source/battleField.cpp source/battleSide.cpp
+// sources: source/battleSlot.cpp source/battleAI.cpp source/battleSearch.cpp
+// sources: source/battleReplay.cpp source/battleUI.cpp source/battleBenchmark.cpp
+// sources: source/moveTable.cpp source/pokemon.cpp source/boxPokemon.cpp
+// sources: source/profiler.cpp
+// shims: game.cpp
+
+#include <cstdlib>
+#include <string>
+
+#include "battle/battleBenchmark.h"
+#include "fs/fs.h"
+
+using namespace BATTLE;
+
+namespace FS {
+    // as in fs.cpp
+    FILE* open( const char* p_path, const char* p_name, const char* p_ext, const char* p_mode ) {
+        return fopen( ( std::string( p_path ) + p_name + p_ext ).c_str( ), p_mode );
+    }
+
+    void close( FILE* p_file ) {
+        fclose( p_file );
+    }
+} // namespace FS
+
+/*
+ * @brief: Copies the file p_from to p_to; returns false if p_from can't be read.
+ */
+bool copyFile( const std::string& p_from, const std::string& p_to ) {
+    FILE* in = fopen( p_from.c_str( ), "rb" );
+    if( !in ) { return false; }
+    FILE* out = fopen( p_to.c_str( ), "wb" );
+    char  buffer[ 512 ];
+    for( size_t n; out && ( n = fread( buffer, 1, sizeof( buffer ), in ) ); ) {
+        fwrite( buffer, 1, n, out );
+    }
+    fclose( in );
+    if( out ) { fclose( out ); }
+    return out;
+}
+
+int main( ) {
+    // hosttest.sh passes the absolute path of this file
+    std::string here = __FILE__;
+    here             = here.substr( 0, here.rfind( '/' ) + 1 );
+    std::string out  = std::string( getenv( "TMPDIR" ) ? getenv( "TMPDIR" ) : "/tmp" )
+                      + "/pneo-hosttest/";
+
+    std::remove( ( out + "BATTLEBENCH.base.csv" ).c_str( ) );
+    copyFile( here + "battleBench.base.csv", out + "BATTLEBENCH.base.csv" );
+
+    auto res = benchmarkBattleTurns( out.c_str( ) );
+
+    // print the results
+    FILE* f = fopen( ( out + "BATTLEBENCH.prof.csv" ).c_str( ), "r" );
+    char  line[ 100 ];
+    while( f && fgets( line, sizeof( line ), f ) ) { std::printf( "%s", line ); }
+    if( f ) { fclose( f ); }
+
+    if( !res.m_hasBaseline ) {
+        if( !copyFile( out + "BATTLEBENCH.base.csv", here + "battleBench.base.csv" ) ) {
+            std::printf( "could not save the baseline\n" );
+            return 1;
+        }
+        std::printf( "%hu scenarios, %u.%u allocs/turn; saved as new baseline\n",
+                     res.m_scenarios, res.m_turnAllocations / 10, res.m_turnAllocations % 10 );
+        return 0;
+    }
+    std::printf( "%hu scenarios, %u.%u allocs/turn; %hu phases slower than the baseline, %hu "
+                 "phases changed\n",
+                 res.m_scenarios, res.m_turnAllocations / 10, res.m_turnAllocations % 10,
+                 res.m_regressions, res.m_changed );
+    return res.m_changed != 0;
+}
@@ -0,0 +1,124 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleMatchup.cpp
+author      : Philip Wellnitz
+description : Host test of the matchup based switches of the ai: plays the battle
+              benchmark scenarios at ai level 7 with and without switches (on both
+              sides, see DISABLE_AI_SWITCHES) on the same seeds and prints the win
+              rates, the time per round, the number of switches and the cost of
+              setting up and updating the matchup table. Checks that no pkmn switches
+              if switches are disabled, that the ai does switch otherwise and that
+              replaying the last battle of each batch from its log has the same
+              outcome. Uses the hand-written data of shim/game.cpp, not the game's data
+              files.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/battle.cpp source/battleField.cpp source/battleSide.cpp
+// sources: source/battleSlot.cpp source/battleAI.cpp source/battleSearch.cpp
+// sources: source/battleReplay.cpp source/battleUI.cpp source/battleBenchmark.cpp
+// sources: source/moveTable.cpp source/pokemon.cpp source/boxPokemon.cpp
+// sources: source/profiler.cpp
+// shims: game.cpp
+
+#include <cstring>
+
+#include "battle/battle.h"
+#include "battle/battleBenchmark.h"
+#include "battle/battleSearch.h"
+#include "battle/battleTrainer.h"
+#include "prof/profiler.h"
+
+using namespace BATTLE;
+
+constexpr u16 BATTLES  = 100; // per scenario and setting
+constexpr u16 AI_LEVEL = SEARCH_MIN_AI_LEVEL - 1;
+
+int main( ) {
+    u32 wins[ 2 ] = { 0 }, switches = 0, battles = 0, mismatches = 0;
+    for( u8 s = 0; s < NUM_BENCHMARK_SCENARIOS; ++s ) {
+        const auto&   sc = BENCHMARK_SCENARIOS[ s ];
+        pokemon       team[ MAX_BENCHMARK_PKMN ];
+        battleTrainer opponent;
+        std::memset( &opponent, 0, sizeof( battleTrainer ) );
+        opponent.m_data.m_AILevel           = AI_LEVEL;
+        opponent.m_data.m_numPokemon        = sc.m_numPkmn;
+        opponent.m_data.m_forceDoubleBattle = sc.m_mode == BM_DOUBLE;
+        for( u8 i = 0; i < sc.m_numPkmn; ++i ) {
+            auto pkmn                      = sc.m_player[ i ];
+            team[ i ]                      = pokemon( pkmn );
+            opponent.m_data.m_pokemon[ i ] = sc.m_opponent[ i ];
+            team[ i ].heal( );
+        }
+        battlePolicy policy = DEFAULT_TRAINER_POLICY;
+        policy.m_mode       = sc.m_mode;
+        policy.m_weather    = sc.m_weather;
+        policy.m_aiLevel    = AI_LEVEL;
+
+        for( u8 sw = 0; sw < 2; ++sw ) {
+            DISABLE_AI_SWITCHES = !sw;
+            MATCHUP_STATS       = matchupStats( );
+
+            u32  start = PROF::ticks( );
+            auto res   = simulateBattles( team, sc.m_numPkmn, opponent, policy, BATTLES,
+                                          u32( s ) << 16 );
+            u32  ticks = PROF::ticks( ) - start;
+            auto st    = MATCHUP_STATS;
+            wins[ sw ] += res.m_playerWins;
+            battles += BATTLES;
+
+            std::printf( "%-11s %-11s: player %3u%%, opponent %3u%%, draws %hu, %5.1f rounds, "
+                         "%3u us/round; %4u switches, init %2u us, update %.1f us\n",
+                         sc.m_name, sw ? "switches" : "no switches",
+                         100u * res.m_playerWins / BATTLES, 100u * res.m_opponentWins / BATTLES,
+                         res.m_draws, double( res.m_rounds ) / BATTLES,
+                         PROF::ticksToUs( ticks ) / std::max<u32>( 1, res.m_rounds ),
+                         st.m_switches, PROF::ticksToUs( st.m_initTicks ),
+                         double( PROF::ticksToUs( st.m_updateTicks ) )
+                             / std::max<u32>( 1, st.m_updates ) );
+
+            if( res.m_playerWins + res.m_opponentWins + res.m_draws != BATTLES ) {
+                std::printf( "  battles missing from the result\n" );
+                ++mismatches;
+            }
+            if( !res.m_replayMatches ) {
+                std::printf( "  replay of the last battle differs\n" );
+                ++mismatches;
+            }
+            if( !sw && st.m_switches ) {
+                std::printf( "  switches although they are disabled\n" );
+                ++mismatches;
+            }
+            if( sw ) { switches += st.m_switches; }
+        }
+    }
+    DISABLE_AI_SWITCHES = false;
+
+    if( !switches ) {
+        std::printf( "the ai never switched\n" );
+        ++mismatches;
+    }
+    std::printf( "ai %hu vs %hu: player won %u of %u battles without and %u with switches\n",
+                 AI_LEVEL, AI_LEVEL, wins[ 0 ], battles / 2, wins[ 1 ] );
+    std::printf( "%u battles simulated, %u mismatches\n", battles, mismatches );
+    return mismatches != 0;
+}
@@ -0,0 +1,118 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleSearchAI.cpp
+author      : Philip Wellnitz
+description : Host test of the search AI (battle::searchAIMove): lets the player's side
+              play the battle benchmark scenarios with the best heuristic ai and with
+              both search ai levels against an opponent with the best heuristic ai, on
+              the same seeds, and prints the win rates and the time the search takes
+              per decision and per simulated turn. Checks that every battle ends and
+              that replaying the last battle of each batch from its log has the same
+              outcome. Uses the hand-written data of shim/game.cpp, not the game's data
+              files.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/battle.cpp source/battleField.cpp source/battleSide.cpp
+// sources: source/battleSlot.cpp source/battleAI.cpp source/battleSearch.cpp
+// sources: source/battleReplay.cpp source/battleUI.cpp source/battleBenchmark.cpp
+// sources: source/moveTable.cpp source/pokemon.cpp source/boxPokemon.cpp
+// sources: source/profiler.cpp
+// shims: game.cpp
+
+#include <cstring>
+
+#include "battle/battle.h"
+#include "battle/battleBenchmark.h"
+#include "battle/battleSearch.h"
+#include "battle/battleTrainer.h"
+#include "prof/profiler.h"
+
+using namespace BATTLE;
+
+constexpr u16 BATTLES           = 40; // per scenario and ai level
+constexpr u16 OPPONENT_LEVEL    = SEARCH_MIN_AI_LEVEL - 1;
+constexpr u16 PLAYER_LEVELS[]   = { OPPONENT_LEVEL, SEARCH_MIN_AI_LEVEL, SEARCH_DEEP_AI_LEVEL };
+constexpr u8  NUM_PLAYER_LEVELS = sizeof( PLAYER_LEVELS ) / sizeof( PLAYER_LEVELS[ 0 ] );
+
+int main( ) {
+    u32 wins[ NUM_PLAYER_LEVELS ] = { 0 }, battles = 0, mismatches = 0;
+    for( u8 s = 0; s < NUM_BENCHMARK_SCENARIOS; ++s ) {
+        const auto& sc = BENCHMARK_SCENARIOS[ s ];
+        for( u8 l = 0; l < NUM_PLAYER_LEVELS; ++l ) {
+            pokemon       team[ MAX_BENCHMARK_PKMN ];
+            battleTrainer opponent;
+            std::memset( &opponent, 0, sizeof( battleTrainer ) );
+            opponent.m_data.m_AILevel           = OPPONENT_LEVEL;
+            opponent.m_data.m_numPokemon        = sc.m_numPkmn;
+            opponent.m_data.m_forceDoubleBattle = sc.m_mode == BM_DOUBLE;
+            for( u8 i = 0; i < sc.m_numPkmn; ++i ) {
+                auto pkmn                      = sc.m_player[ i ];
+                team[ i ]                      = pokemon( pkmn );
+                opponent.m_data.m_pokemon[ i ] = sc.m_opponent[ i ];
+                team[ i ].heal( );
+            }
+            battlePolicy policy = DEFAULT_TRAINER_POLICY;
+            policy.m_mode       = sc.m_mode;
+            policy.m_weather    = sc.m_weather;
+            policy.m_aiLevel    = PLAYER_LEVELS[ l ];
+
+            SEARCH_STATS = searchStats( );
+            auto res     = simulateBattles( team, sc.m_numPkmn, opponent, policy, BATTLES,
+                                            u32( s ) << 16 );
+            auto st      = SEARCH_STATS;
+            wins[ l ] += res.m_playerWins;
+            battles += BATTLES;
+
+            std::printf( "%-11s ai %hu vs %hu: player %3u%%, opponent %3u%%, draws %hu", sc.m_name,
+                         PLAYER_LEVELS[ l ], OPPONENT_LEVEL, 100u * res.m_playerWins / BATTLES,
+                         100u * res.m_opponentWins / BATTLES, res.m_draws );
+            if( st.m_decisions ) {
+                std::printf( "; %5u decisions (%u cut), %6u turns searched, %5u us/decision,"
+                             " %3u us/turn",
+                             st.m_decisions, st.m_cuts, st.m_nodes,
+                             PROF::ticksToUs( st.m_ticks ) / st.m_decisions,
+                             PROF::ticksToUs( st.m_ticks ) / std::max<u32>( 1, st.m_nodes ) );
+            }
+            std::printf( "\n" );
+
+            if( res.m_playerWins + res.m_opponentWins + res.m_draws != BATTLES ) {
+                std::printf( "  battles missing from the result\n" );
+                ++mismatches;
+            }
+            if( !res.m_replayMatches ) {
+                std::printf( "  replay of the last battle differs\n" );
+                ++mismatches;
+            }
+            if( PLAYER_LEVELS[ l ] >= SEARCH_MIN_AI_LEVEL && !st.m_nodes ) {
+                std::printf( "  the search ai didn't search\n" );
+                ++mismatches;
+            }
+        }
+    }
+    for( u8 l = 0; l < NUM_PLAYER_LEVELS; ++l ) {
+        std::printf( "ai %hu vs %hu: player won %u of %u battles\n", PLAYER_LEVELS[ l ],
+                     OPPONENT_LEVEL, wins[ l ], battles / NUM_PLAYER_LEVELS );
+    }
+    std::printf( "%u battles simulated, %u mismatches\n", battles, mismatches );
+    return mismatches != 0;
+}
@@ -0,0 +1,118 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : battleSimulation.cpp
+author      : Philip Wellnitz
+description : Host test of BATTLE::simulateBattles: plays headless battles of the
+              battle benchmark teams at several ai levels and prints the win rates,
+              rounds and the time per battle. Checks that every battle ends, that
+              replaying the last battle of each batch from its log has the same
+              outcome and that playing a batch again with the same seed gives the same
+              results. Uses the hand-written data of shim/game.cpp, not the game's
+              data files.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/battle.cpp source/battleField.cpp source/battleSide.cpp
+// sources: source/battleSlot.cpp source/battleAI.cpp source/battleSearch.cpp
+// sources: source/battleReplay.cpp source/battleUI.cpp source/battleBenchmark.cpp
+// sources: source/moveTable.cpp source/pokemon.cpp source/boxPokemon.cpp
+// sources: source/profiler.cpp
+// shims: game.cpp
+
+#include <chrono>
+#include <cstring>
+
+#include "battle/battle.h"
+#include "battle/battleBenchmark.h"
+#include "battle/battleSearch.h"
+#include "battle/battleTrainer.h"
+
+using namespace BATTLE;
+
+constexpr u16 BATTLES        = 50; // per scenario and ai level
+constexpr u16 SEARCH_BATTLES = 10; // ai levels that search ahead are a lot slower
+constexpr u16 AI_LEVELS[]    = { 1, 5, 7, 9 };
+
+/*
+ * @brief: Sets up the teams of the given benchmark scenario for both sides.
+ */
+u8 setupScenario( const benchmarkScenario& p_scenario, u16 p_aiLevel, pokemon* p_team,
+                  battleTrainer& p_opponent, battlePolicy& p_policy ) {
+    std::memset( &p_opponent, 0, sizeof( battleTrainer ) );
+    p_opponent.m_data.m_AILevel           = p_aiLevel;
+    p_opponent.m_data.m_numPokemon        = p_scenario.m_numPkmn;
+    p_opponent.m_data.m_forceDoubleBattle = p_scenario.m_mode == BM_DOUBLE;
+    for( u8 i = 0; i < p_scenario.m_numPkmn; ++i ) {
+        auto pkmn                        = p_scenario.m_player[ i ];
+        p_team[ i ]                      = pokemon( pkmn );
+        p_opponent.m_data.m_pokemon[ i ] = p_scenario.m_opponent[ i ];
+        p_team[ i ].heal( );
+    }
+    p_policy           = DEFAULT_TRAINER_POLICY;
+    p_policy.m_mode    = p_scenario.m_mode;
+    p_policy.m_weather = p_scenario.m_weather;
+    p_policy.m_aiLevel = p_aiLevel;
+    return p_scenario.m_numPkmn;
+}
+
+int main( ) {
+    u32 battles = 0, mismatches = 0;
+    for( auto level : AI_LEVELS ) {
+        u16 count = level >= SEARCH_MIN_AI_LEVEL ? SEARCH_BATTLES : BATTLES;
+        for( u8 s = 0; s < NUM_BENCHMARK_SCENARIOS; ++s ) {
+            const auto&   sc = BENCHMARK_SCENARIOS[ s ];
+            pokemon       team[ MAX_BENCHMARK_PKMN ];
+            battleTrainer opponent;
+            battlePolicy  policy;
+            u8            size = setupScenario( sc, level, team, opponent, policy );
+
+            auto start = std::chrono::steady_clock::now( );
+            auto res   = simulateBattles( team, size, opponent, policy, count, u32( s ) << 16 );
+            auto us    = std::chrono::duration_cast<std::chrono::microseconds>(
+                             std::chrono::steady_clock::now( ) - start )
+                             .count( );
+            battles += count;
+
+            std::printf( "ai %hu %-11s: %3hu battles, player %3u%%, opponent %3u%%, draws %hu, "
+                         "%5.1f rounds, %6.2f ms/battle\n",
+                         level, sc.m_name, count, 100u * res.m_playerWins / count,
+                         100u * res.m_opponentWins / count, res.m_draws,
+                         double( res.m_rounds ) / count, us / 1000.0 / count );
+
+            if( res.m_playerWins + res.m_opponentWins + res.m_draws != count ) {
+                std::printf( "  battles missing from the result\n" );
+                ++mismatches;
+            }
+            if( !res.m_replayMatches ) {
+                std::printf( "  replay of the last battle differs\n" );
+                ++mismatches;
+            }
+            auto again = simulateBattles( team, size, opponent, policy, count, u32( s ) << 16 );
+            if( again.m_playerWins != res.m_playerWins || again.m_rounds != res.m_rounds ) {
+                std::printf( "  same seed, different results\n" );
+                ++mismatches;
+            }
+        }
+    }
+    std::printf( "%u battles simulated, %u mismatches\n", battles, mismatches );
+    return mismatches != 0;
+}
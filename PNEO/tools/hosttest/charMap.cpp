@@ -0,0 +1,77 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : charMap.cpp
+author      : Philip Wellnitz
+description : Host test of the char to glyph lookup tables of all fonts (see
+              tools/fontmap.py): maps every 16 bit char with the tables and with the
+              shiftchar functions they replaced (charMapReference.h) and compares the
+              resulting glyph indices.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/fontRegular.cpp source/fontBold.cpp source/fontSmall.cpp
+// sources: source/fontBraille.cpp
+
+#include <cstdio>
+
+#include "charMapReference.h"
+#include "io/font.h"
+
+struct fontInfo {
+    const char*             m_name;
+    const u16* const*       m_charPages;
+    void ( *m_reference )( u16& );
+};
+
+// same lookup as font::_shiftchar
+u16 lookup( const u16* const* p_charPages, u16 p_ch ) {
+    if( auto page = p_charPages[ p_ch >> 8 ] ) { return page[ p_ch & 0xFF ]; }
+    return p_ch;
+}
+
+int main( ) {
+    fontInfo fonts[] = {
+        { "regular", IO::REGULAR_FONT::charPages, REFERENCE_REGULAR_FONT::shiftchar },
+        { "bold", IO::BOLD_FONT::charPages, REFERENCE_BOLD_FONT::shiftchar },
+        { "small", IO::SMALL_FONT::charPages, REFERENCE_SMALL_FONT::shiftchar },
+        { "braille", IO::BRAILLE_FONT::charPages, REFERENCE_BRAILLE_FONT::shiftchar },
+    };
+
+    u32 mismatches = 0;
+    for( const auto& f : fonts ) {
+        u32 mapped = 0, fontMismatches = 0;
+        for( u32 ch = 0; ch < 0x10000; ++ch ) {
+            u16 ref = ch;
+            f.m_reference( ref );
+            u16 res = lookup( f.m_charPages, ch );
+            mapped += ref != ch;
+            if( res != ref && ++fontMismatches <= 10 ) {
+                std::printf( "mismatch: %s font, char 0x%04x: table %hu, reference %hu\n",
+                             f.m_name, ch, res, ref );
+            }
+        }
+        std::printf( "%s font: 65536 chars, %u remapped, %u mismatches\n", f.m_name, mapped,
+                     fontMismatches );
+        mismatches += fontMismatches;
+    }
+    return mismatches != 0;
+}
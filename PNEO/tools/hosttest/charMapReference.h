@@ -0,0 +1,958 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : charMapReference.h
+author      : Philip Wellnitz
+description : The per-font shiftchar functions as they were before they got replaced
+              by the lookup tables generated by tools/fontmap.py; reference for
+              charMap.cpp. Not part of the game.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <nds.h>
+
+// clang-format off
+namespace REFERENCE_REGULAR_FONT {
+    inline void shiftchar( u16& p_val ) {
+        if( '0' <= p_val && p_val <= '9' ) {
+            p_val = ( p_val - '0' );
+            return;
+        }
+        if( 'A' <= p_val && p_val <= 'Z' ) {
+            p_val = ( p_val - 'A' ) + 10;
+            return;
+        }
+        if( 'a' <= p_val && p_val <= 'z' ) {
+            p_val = ( p_val - 'a' ) + 36;
+            return;
+        }
+
+        if( 5000 <= p_val && p_val <= 5300 ) { // 平仮名
+            p_val = ( p_val - 5000 ) + 195;
+            return;
+        }
+
+        if( p_val == '\xc0' ) { // À
+            p_val = 62;
+            return;
+        }
+        if( p_val == '\xc1' ) { // Á
+            p_val = 63;
+            return;
+        }
+        if( p_val == '\xc5' ) { // Â
+            p_val = 64;
+            return;
+        }
+        if( p_val == '\xc4' ) { // Ä
+            p_val = 65;
+            return;
+        }
+        if( p_val == '\xc7' ) { // Ç
+            p_val = 66;
+            return;
+        }
+        if( p_val == '\xc8' ) { // È
+            p_val = 67;
+            return;
+        }
+        if( p_val == '\xc9' ) { // É
+            p_val = 68;
+            return;
+        }
+        if( p_val == '\xca' ) { // Ê
+            p_val = 69;
+            return;
+        }
+        if( p_val == '\xcb' ) { // Ë
+            p_val = 70;
+            return;
+        }
+        if( p_val == '\xcc' ) { // Ì
+            p_val = 71;
+            return;
+        }
+        if( p_val == '\xcd' ) { // Í
+            p_val = 72;
+            return;
+        }
+        if( p_val == '\xce' ) { // Î
+            p_val = 73;
+            return;
+        }
+        if( p_val == '\xcf' ) { // Ï
+            p_val = 74;
+            return;
+        }
+        if( p_val == '\xd1' ) { // Ñ
+            p_val = 75;
+            return;
+        }
+        if( p_val == '\xd2' ) { // Ò
+            p_val = 76;
+            return;
+        }
+        if( p_val == '\xd3' ) { // Ó
+            p_val = 77;
+            return;
+        }
+        if( p_val == '\xd4' ) { // Ô
+            p_val = 78;
+            return;
+        }
+        if( p_val == '\xd6' ) { // Ö
+            p_val = 79;
+            return;
+        }
+        if( p_val == '\xd7' ) { // ×
+            p_val = 80;
+            return;
+        }
+        if( p_val == '\xd9' ) { // Ù
+            p_val = 81;
+            return;
+        }
+        if( p_val == '\xda' ) { // Ú
+            p_val = 82;
+            return;
+        }
+        if( p_val == '\xdb' ) { // Û
+            p_val = 83;
+            return;
+        }
+        if( p_val == '\xdc' ) { // Ü
+            p_val = 84;
+            return;
+        }
+
+        if( p_val == '\xdf' ) { // ß
+            p_val = 85;
+            return;
+        }
+        if( p_val == '\xe0' ) { // à
+            p_val = 86;
+            return;
+        }
+        if( p_val == '\xe1' ) { // á
+            p_val = 87;
+            return;
+        }
+        if( p_val == '\xe2' ) { // â
+            p_val = 88;
+            return;
+        }
+        if( p_val == '\xe4' ) { // ä
+            p_val = 89;
+            return;
+        }
+        if( p_val == '\xe5' ) { // å
+            p_val = 90;
+            return;
+        }
+        if( p_val == '\xe7' ) { // ç
+            p_val = 91;
+            return;
+        }
+        if( p_val == '\xe8' ) { // è
+            p_val = 92;
+            return;
+        }
+        if( p_val == '\xe9' ) { // é
+            p_val = 93;
+            return;
+        }
+        if( p_val == '\xea' ) { // ê
+            p_val = 94;
+            return;
+        }
+        if( p_val == '\xeb' ) { // ë
+            p_val = 95;
+            return;
+        }
+        if( p_val == '\xec' ) { // ì
+            p_val = 96;
+            return;
+        }
+        if( p_val == '\xed' ) { // í
+            p_val = 97;
+            return;
+        }
+        if( p_val == '\xee' ) { // î
+            p_val = 98;
+            return;
+        }
+        if( p_val == '\xef' ) { // ï
+            p_val = 99;
+            return;
+        }
+        if( p_val == '\xf1' ) { // ñ
+            p_val = 100;
+            return;
+        }
+        if( p_val == '\xf2' ) { // ò
+            p_val = 101;
+            return;
+        }
+        if( p_val == '\xf3' ) { // ó
+            p_val = 102;
+            return;
+        }
+        if( p_val == '\xf4' ) { // ô
+            p_val = 103;
+            return;
+        }
+        if( p_val == '\xf6' ) { // ö
+            p_val = 104;
+            return;
+        }
+        if( p_val == '\xf7' ) { // ÷
+            p_val = 105;
+            return;
+        }
+        if( p_val == '\xf9' ) { // ù
+            p_val = 106;
+            return;
+        }
+        if( p_val == '\xfa' ) { // ú
+            p_val = 107;
+            return;
+        }
+        if( p_val == '\xfb' ) { // û
+            p_val = 108;
+            return;
+        }
+        if( p_val == '\xfc' ) { // ü
+            p_val = 109;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 110;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 111;
+            return;
+        }
+        if( p_val == '\x01' ) { // Heart
+            p_val = 444;
+            return;
+        }
+        if( p_val == '\x02' ) { // Battle
+            p_val = 474;
+            return;
+        }
+        if( p_val == '\x03' ) { // Full Circle
+            p_val = 447;
+            return;
+        }
+        if( p_val == '\x04' ) { // Empty Circle
+            p_val = 448;
+            return;
+        }
+        if( p_val == '\x05' ) { // Left
+            p_val = 475;
+            return;
+        }
+        if( p_val == '\x06' ) { // Up
+            p_val = 476;
+            return;
+        }
+        if( p_val == '\x07' ) { // Down
+            p_val = 477;
+            return;
+        }
+        if( p_val == '\x08' ) { // Right
+            p_val = 478;
+            return;
+        }
+
+        if( p_val == '$' ) {
+            p_val = 117;
+            return;
+        }
+        if( p_val == '¡' ) {
+            p_val = 118;
+            return;
+        }
+        if( p_val == '¿' ) {
+            p_val = 119;
+            return;
+        }
+        if( p_val == '!' ) {
+            p_val = 120;
+            return;
+        }
+        if( p_val == '?' ) {
+            p_val = 121;
+            return;
+        }
+        if( p_val == ',' ) {
+            p_val = 122;
+            return;
+        }
+        if( p_val == '.' ) {
+            p_val = 123;
+            return;
+        }
+        if( p_val == '\r' ) {
+            p_val = 124;
+            return;
+        }
+        if( p_val == '·' ) {
+            p_val = 124;
+            return;
+        }
+        if( p_val == '/' ) {
+            p_val = 126;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 127;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 128;
+            return;
+        }
+        if( p_val == '\'' ) {
+            p_val = 128;
+            return;
+        }
+        if( p_val == '\x5d' ) {
+            p_val = 129;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 129;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 130;
+            return;
+        }
+        if( p_val == '\"' ) {
+            p_val = 130;
+            return;
+        }
+        if( p_val == '\x5e' ) {
+            p_val = 131;
+            return;
+        }
+        if( p_val == '«' ) {
+            p_val = 132;
+            return;
+        }
+        if( p_val == '<' ) {
+            p_val = 132;
+            return;
+        }
+        if( p_val == '»' ) {
+            p_val = 133;
+            return;
+        }
+        if( p_val == '>' ) {
+            p_val = 133;
+            return;
+        }
+        if( p_val == '(' ) {
+            p_val = 134;
+            return;
+        }
+        if( p_val == ')' ) {
+            p_val = 135;
+            return;
+        }
+
+        if( p_val == '{' ) {
+            p_val = 136;
+            return;
+        } // male
+        if( p_val == '}' ) {
+            p_val = 137;
+            return;
+        } // female
+
+        if( p_val == '+' ) {
+            p_val = 138;
+            return;
+        }
+        if( p_val == '-' ) {
+            p_val = 139;
+            return;
+        }
+        if( p_val == '*' ) {
+            p_val = 140;
+            return;
+        }
+        if( p_val == '#' ) {
+            p_val = 141;
+            return;
+        }
+        if( p_val == '=' ) {
+            p_val = 132;
+            return;
+        }
+        if( p_val == '&' ) {
+            p_val = 143;
+            return;
+        }
+        if( p_val == '~' ) {
+            p_val = 144;
+            return;
+        }
+        if( p_val == ':' ) {
+            p_val = 145;
+            return;
+        }
+        if( p_val == ';' ) {
+            p_val = 146;
+            return;
+        }
+        // pik
+        // krz
+        // hrt
+        // karo
+        // star
+        // crcld pnt
+        // circle
+        // sqare
+        // triangle
+        // raute
+        if( p_val == '@' ) {
+            p_val = 157;
+            return;
+        }
+        // music
+        if( p_val == '%' ) {
+            p_val = 159;
+            return;
+        }
+        // sun
+        // wind
+        // rain
+        // snow
+        //:)
+        //^^
+        //><
+        //|(
+        //-^
+        //-v
+        // sleep
+        //^e
+        if( p_val == 173 ) { // continue (messageBox) / down (counter)
+            p_val = 173;
+            return;
+        }
+        if( p_val == '_' ) {
+            p_val = 173;
+            return;
+        }
+        if( p_val == 175 ) { // up (counter)
+            p_val = 175;
+            return;
+        }
+
+        if( p_val == ' ' ) {
+            p_val = 489;
+            return;
+        }
+        if( p_val == '\r' ) {
+            p_val = 489;
+            return;
+        }
+
+        return;
+    }
+} // namespace REFERENCE_REGULAR_FONT
+
+namespace REFERENCE_BOLD_FONT {
+    inline void shiftchar( u16& p_val ) {
+        if( '0' <= p_val && p_val <= '9' ) {
+            p_val = ( p_val - '0' );
+            return;
+        }
+        if( 'A' <= p_val && p_val <= 'Z' ) {
+            p_val = ( p_val - 'A' ) + 10;
+            return;
+        }
+        if( 'a' <= p_val && p_val <= 'z' ) {
+            p_val = ( p_val - 'a' ) + 36;
+            return;
+        }
+
+        if( 5000 <= p_val && p_val <= 5300 ) { // 平仮名
+            p_val = ( p_val - 5000 ) + 195;
+            return;
+        }
+
+        if( p_val == '\xc0' ) { // À
+            p_val = 62;
+            return;
+        }
+        if( p_val == '\xc1' ) { // Á
+            p_val = 63;
+            return;
+        }
+        if( p_val == '\xc5' ) { // Â
+            p_val = 64;
+            return;
+        }
+        if( p_val == '\xc4' ) { // Ä
+            p_val = 65;
+            return;
+        }
+        if( p_val == '\xc7' ) { // Ç
+            p_val = 66;
+            return;
+        }
+        if( p_val == '\xc8' ) { // È
+            p_val = 67;
+            return;
+        }
+        if( p_val == '\xc9' ) { // É
+            p_val = 68;
+            return;
+        }
+        if( p_val == '\xca' ) { // Ê
+            p_val = 69;
+            return;
+        }
+        if( p_val == '\xcb' ) { // Ë
+            p_val = 70;
+            return;
+        }
+        if( p_val == '\xcc' ) { // Ì
+            p_val = 71;
+            return;
+        }
+        if( p_val == '\xcd' ) { // Í
+            p_val = 72;
+            return;
+        }
+        if( p_val == '\xce' ) { // Î
+            p_val = 73;
+            return;
+        }
+        if( p_val == '\xcf' ) { // Ï
+            p_val = 74;
+            return;
+        }
+        if( p_val == '\xd1' ) { // Ñ
+            p_val = 75;
+            return;
+        }
+        if( p_val == '\xd2' ) { // Ò
+            p_val = 76;
+            return;
+        }
+        if( p_val == '\xd3' ) { // Ó
+            p_val = 77;
+            return;
+        }
+        if( p_val == '\xd4' ) { // Ô
+            p_val = 78;
+            return;
+        }
+        if( p_val == '\xd6' ) { // Ö
+            p_val = 79;
+            return;
+        }
+        if( p_val == '\xd7' ) { // ×
+            p_val = 80;
+            return;
+        }
+        if( p_val == '\xd9' ) { // Ù
+            p_val = 81;
+            return;
+        }
+        if( p_val == '\xda' ) { // Ú
+            p_val = 82;
+            return;
+        }
+        if( p_val == '\xdb' ) { // Û
+            p_val = 83;
+            return;
+        }
+        if( p_val == '\xdc' ) { // Ü
+            p_val = 84;
+            return;
+        }
+
+        if( p_val == '\xdf' ) { // ß
+            p_val = 85;
+            return;
+        }
+        if( p_val == '\xe0' ) { // à
+            p_val = 86;
+            return;
+        }
+        if( p_val == '\xe1' ) { // á
+            p_val = 87;
+            return;
+        }
+        if( p_val == '\xe2' ) { // â
+            p_val = 88;
+            return;
+        }
+
+        if( p_val == '\xe4' ) { // ä
+            p_val = 89;
+            return;
+        }
+        if( p_val == '\xe5' ) { // å
+            p_val = 90;
+            return;
+        }
+        if( p_val == '\xe7' ) { // ç
+            p_val = 91;
+            return;
+        }
+        if( p_val == '\xe8' ) { // è
+            p_val = 92;
+            return;
+        }
+        if( p_val == '\xe9' ) { // é
+            p_val = 93;
+            return;
+        }
+        if( p_val == '\xea' ) { // ê
+            p_val = 94;
+            return;
+        }
+        if( p_val == '\xeb' ) { // ë
+            p_val = 95;
+            return;
+        }
+        if( p_val == '\xec' ) { // ì
+            p_val = 96;
+            return;
+        }
+        if( p_val == '\xed' ) { // í
+            p_val = 97;
+            return;
+        }
+        if( p_val == '\xee' ) { // î
+            p_val = 98;
+            return;
+        }
+        if( p_val == '\xef' ) { // ï
+            p_val = 99;
+            return;
+        }
+        if( p_val == '\xf1' ) { // ñ
+            p_val = 100;
+            return;
+        }
+        if( p_val == '\xf2' ) { // ò
+            p_val = 101;
+            return;
+        }
+        if( p_val == '\xf3' ) { // ó
+            p_val = 102;
+            return;
+        }
+        if( p_val == '\xf4' ) { // ô
+            p_val = 103;
+            return;
+        }
+        if( p_val == '\xf6' ) { // ö
+            p_val = 104;
+            return;
+        }
+        if( p_val == '\xf7' ) { // ÷
+            p_val = 105;
+            return;
+        }
+        if( p_val == '\xf9' ) { // ù
+            p_val = 106;
+            return;
+        }
+        if( p_val == '\xfa' ) { // ú
+            p_val = 107;
+            return;
+        }
+        if( p_val == '\xfb' ) { // û
+            p_val = 108;
+            return;
+        }
+        if( p_val == '\xfc' ) { // ü
+            p_val = 109;
+            return;
+        }
+
+        if( p_val == '' ) {
+            p_val = 110;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 111;
+            return;
+        }
+
+        if( p_val == '$' ) {
+            p_val = 117;
+            return;
+        }
+        if( p_val == '¡' ) {
+            p_val = 118;
+            return;
+        }
+        if( p_val == '¿' ) {
+            p_val = 119;
+            return;
+        }
+        if( p_val == '!' ) {
+            p_val = 120;
+            return;
+        }
+        if( p_val == '?' ) {
+            p_val = 121;
+            return;
+        }
+        if( p_val == ',' ) {
+            p_val = 122;
+            return;
+        }
+        if( p_val == '.' ) {
+            p_val = 123;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 124;
+            return;
+        }
+        if( p_val == '·' ) {
+            p_val = 125;
+            return;
+        }
+        if( p_val == '/' ) {
+            p_val = 126;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 127;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 128;
+            return;
+        }
+        if( p_val == '\'' ) {
+            p_val = 128;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 129;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 130;
+            return;
+        }
+        if( p_val == '\"' ) {
+            p_val = 130;
+            return;
+        }
+        if( p_val == '' ) {
+            p_val = 131;
+            return;
+        }
+        if( p_val == '«' ) {
+            p_val = 132;
+            return;
+        }
+        if( p_val == '»' ) {
+            p_val = 133;
+            return;
+        }
+        if( p_val == '<' ) {
+            p_val = 132;
+            return;
+        }
+        if( p_val == '>' ) {
+            p_val = 133;
+            return;
+        }
+
+        if( p_val == '(' ) {
+            p_val = 134;
+            return;
+        }
+        if( p_val == ')' ) {
+            p_val = 135;
+            return;
+        }
+
+        if( p_val == '{' ) {
+            p_val = 136;
+            return;
+        } // male
+        if( p_val == '}' ) {
+            p_val = 137;
+            return;
+        } // female
+
+        if( p_val == '+' ) {
+            p_val = 138;
+            return;
+        }
+        if( p_val == '-' ) {
+            p_val = 139;
+            return;
+        }
+        if( p_val == '*' ) {
+            p_val = 140;
+            return;
+        }
+        if( p_val == '#' ) {
+            p_val = 141;
+            return;
+        }
+        if( p_val == '=' ) {
+            p_val = 132;
+            return;
+        }
+        if( p_val == '&' ) {
+            p_val = 143;
+            return;
+        }
+        if( p_val == '~' ) {
+            p_val = 144;
+            return;
+        }
+        if( p_val == ':' ) {
+            p_val = 145;
+            return;
+        }
+        if( p_val == ';' ) {
+            p_val = 146;
+            return;
+        }
+        // pik
+        // krz
+        // hrt
+        // karo
+        // star
+        // crcld pnt
+        // circle
+        // sqare
+        // triangle
+        // raute
+        if( p_val == '@' ) {
+            p_val = 157;
+            return;
+        }
+        // music
+        if( p_val == '%' ) {
+            p_val = 159;
+            return;
+        }
+        // sun
+        // wind
+        // rain
+        // snow
+        //:)
+        //^^
+        //><
+        //|(
+        //-^
+        //-v
+        // sleep
+        //^e
+        if( p_val == 173 ) { // continue (messageBox)
+            p_val = 173;
+            return;
+        }
+        if( p_val == '_' ) {
+            p_val = 173;
+            return;
+        }
+        if( p_val == 175 ) {
+            p_val = 175;
+            return;
+        }
+
+        if( p_val == ' ' ) {
+            p_val = 489;
+            return;
+        }
+        if( p_val == '\r' ) {
+            p_val = 489;
+            return;
+        }
+
+        return;
+    }
+} // namespace REFERENCE_BOLD_FONT
+
+namespace REFERENCE_SMALL_FONT {
+    inline void shiftchar( u16& p_val ) {
+        if( '0' <= p_val && p_val <= '9' ) {
+            p_val = p_val - '0';
+            return;
+        }
+        if( p_val == '!' ) { // Lv.
+            p_val = 10;
+            return;
+        }
+        if( p_val == '/' ) {
+            p_val = 11;
+            return;
+        }
+        if( p_val == ' ' ) {
+            p_val = 12;
+            return;
+        }
+        if( 'A' <= p_val && p_val <= 'Z' ) {
+            p_val = p_val - 'A' + 23;
+            return;
+        }
+    }
+} // namespace REFERENCE_SMALL_FONT
+
+namespace REFERENCE_BRAILLE_FONT {
+    inline void shiftchar( u16& p_val ) {
+        if( 'A' <= p_val && p_val <= 'Z' ) {
+            p_val = ( p_val - 'A' );
+            return;
+        }
+        if( 'a' <= p_val && p_val <= 'z' ) {
+            p_val = ( p_val - 'a' );
+            return;
+        }
+
+        if( p_val == '.' ) {
+            p_val = 26;
+            return;
+        }
+        if( p_val == ',' ) {
+            p_val = 27;
+            return;
+        }
+        if( p_val == ' ' ) {
+            p_val = 29;
+            return;
+        }
+        return;
+    }
+} // namespace REFERENCE_BRAILLE_FONT
+// clang-format on
@@ -0,0 +1,123 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : decodedSpriteCache.cpp
+author      : Philip Wellnitz
+description : Host test of IO::decodedSpriteCache: looks up random sprites and stores
+              the missing ones, as loadPkmnSprite does, and compares every lookup with an
+              LRU model of the cache; hits need to return exactly the image data and
+              palette that were stored under the key.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/decodedSpriteCache.cpp
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <random>
+#include <utility>
+
+#include "io/decodedSpriteCache.h"
+
+unsigned int   TEMP[ 256 * 256 / 4 ];
+unsigned short TEMP_PAL[ 256 ];
+
+/*
+ * @brief: Fills TEMP and TEMP_PAL with the contents of the given sprite.
+ */
+void decodeSprite( u64 p_key, u16 p_size ) {
+    std::mt19937 rng( p_key * 31 + p_size );
+    for( u16 i = 0; i < p_size; ++i ) { TEMP[ i ] = rng( ); }
+    for( u8 i = 0; i < 16; ++i ) { TEMP_PAL[ i ] = rng( ); }
+}
+
+int main( ) {
+    u32 lookups = 0, hits = 0, mismatches = 0;
+    for( u32 round = 0; round < 100; ++round ) {
+        std::mt19937 rng( round );
+        auto         cache = new IO::decodedSpriteCache( );
+
+        // LRU model: (key, size) -> time of the last lookup
+        std::map<std::pair<u64, u16>, u32> model;
+        u32                                modelBytes = 0;
+
+        u16 numSprites = 2 + rng( ) % 24;
+        for( u32 clock = 1; clock <= 20000; ++clock ) {
+            pkmnSpriteInfo pkmn = { };
+            pkmn.m_pkmnIdx      = 1 + rng( ) % numSprites;
+            pkmn.m_shiny        = !( rng( ) % 8 );
+            pkmn.m_pid          = rng( ) % 4;
+            u64 key             = IO::decodedSpriteKey( rng( ) % 2, pkmn );
+            // mostly the sizes of 64x64 and 96x96 sprites; rarely one too large to cache
+            u16 size = !( rng( ) % 500 ) ? IO::DECODED_SPRITE_CACHE_BYTES / 4 + 1
+                                         : ( ( pkmn.m_pkmnIdx & 1 ) ? 512 : 1152 );
+
+            std::memset( TEMP, 0, size * sizeof( u32 ) );
+            std::memset( TEMP_PAL, 0, 32 );
+            bool hit      = cache->load( key, size );
+            bool expected = model.count( { key, size } );
+            ++lookups;
+            if( hit != expected ) {
+                if( ++mismatches <= 10 ) {
+                    std::printf( "round %u, lookup %u: %s, expected %s\n", round, clock,
+                                 hit ? "hit" : "miss", expected ? "hit" : "miss" );
+                }
+            }
+            if( hit ) {
+                ++hits;
+                model[ { key, size } ] = clock;
+                u32 tmp[ 1152 ];
+                u16 pal[ 16 ];
+                std::memcpy( tmp, TEMP, size * sizeof( u32 ) );
+                std::memcpy( pal, TEMP_PAL, sizeof( pal ) );
+                decodeSprite( key, size );
+                if( std::memcmp( tmp, TEMP, size * sizeof( u32 ) )
+                    || std::memcmp( pal, TEMP_PAL, sizeof( pal ) ) ) {
+                    if( ++mismatches <= 10 ) {
+                        std::printf( "round %u, lookup %u: wrong sprite\n", round, clock );
+                    }
+                }
+                continue;
+            }
+
+            decodeSprite( key, size );
+            cache->store( key, size );
+            u32 bytes = size * sizeof( u32 );
+            if( bytes > IO::DECODED_SPRITE_CACHE_BYTES ) { continue; }
+            while( modelBytes + bytes > IO::DECODED_SPRITE_CACHE_BYTES
+                   || model.size( ) >= IO::DECODED_SPRITE_CACHE_ENTRIES ) {
+                auto lru = model.begin( );
+                for( auto it = model.begin( ); it != model.end( ); ++it ) {
+                    if( it->second < lru->second ) { lru = it; }
+                }
+                modelBytes -= lru->first.second * sizeof( u32 );
+                model.erase( lru );
+            }
+            model[ { key, size } ] = clock;
+            modelBytes += bytes;
+        }
+        delete cache;
+    }
+
+    std::printf( "%u lookups, %u hits, %u mismatches\n", lookups, hits, mismatches );
+    return mismatches != 0;
+}
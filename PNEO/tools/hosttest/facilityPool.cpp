@@ -0,0 +1,205 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : facilityPool.cpp
+author      : Philip Wellnitz
+description : Host test of MAP::facilityPool: draws 100000 single and double battle
+              teams over streaks 0 to 59 from synthetic per-tier pools with many
+              duplicate species and items and checks that every team is complete, has
+              pairwise distinct species and held items and comes from the tier and
+              with the IVs of its streak. Draws all teams again with the same seeds to
+              check that a seed always yields the same team, checks the species look-up
+              and that pools that aren't sorted by species are rejected. Without sets for
+              the tier, checks the teams drawn from random species the same way.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/mapBattleFacilityPool.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include "fs/data.h"
+#include "map/mapBattleFacilityPool.h"
+
+using namespace MAP;
+
+constexpr u32 NUM_TEAMS      = 100000;
+constexpr u16 NUM_STREAKS    = 60;
+constexpr u8  SETS_PER_PKMN  = 3;
+constexpr u8  NUM_ITEMS      = 40;
+constexpr u16 TIER_SPECIES   = 200; // species ids of different tiers don't overlap
+constexpr u8  FACILITY_LEVEL = 50;
+constexpr u32 SPECIES_TEAMS  = 10000;
+
+bool UNSORTED_SETS = false;
+bool NO_SETS       = false;
+
+fsdataInfo FSDATA;
+
+namespace FS {
+    // synthetic pools instead of the ROM's: several sets per species, few different
+    // items; the forme tells the tier, the first move the index of the set
+    u16 loadBattleFacilitySets( u8 p_tier, facilitySet* p_out, u16 p_maxCount ) {
+        if( NO_SETS ) { return 0; }
+        for( u16 i = 0; i < p_maxCount; ++i ) {
+            p_out[ i ]              = facilitySet( );
+            p_out[ i ].m_speciesId  = 1 + p_tier * TIER_SPECIES + i / SETS_PER_PKMN;
+            p_out[ i ].m_forme      = p_tier;
+            p_out[ i ].m_heldItem   = i % ( NUM_ITEMS + 1 ); // some sets hold no item
+            p_out[ i ].m_moves[ 0 ] = i;
+        }
+        if( UNSORTED_SETS ) { std::swap( p_out[ 0 ], p_out[ p_maxCount - 1 ] ); }
+        return p_maxCount;
+    }
+
+    // placeholder sets as in the game, but with few different items
+    bool loadBattleFacilityPkmn( u16 p_species, u8 p_variant, u8 p_level, u16 p_streak,
+                                 trainerPokemon* p_out ) {
+        *p_out              = trainerPokemon( );
+        p_out->m_speciesId  = p_species;
+        p_out->m_heldItem   = p_species % ( NUM_ITEMS + 1 );
+        p_out->m_moves[ 0 ] = p_variant;
+        p_out->m_level      = p_level;
+        std::memset( p_out->m_iv, IV_FOR_STREAK[ std::min<u16>( p_streak, IV_MAX_STREAK - 1 ) ],
+                     sizeof( p_out->m_iv ) );
+        return true;
+    }
+} // namespace FS
+
+/*
+ * @brief: Draws the t-th team of the test; returns a hash of its sets (0 if drawing
+ * failed).
+ */
+u32 drawTeam( u32 p_team, BATTLE::trainerData& p_out ) {
+    ruleSet rules      = { };
+    rules.m_level      = FACILITY_LEVEL;
+    rules.m_battleMode = p_team & 1 ? BATTLE::BM_DOUBLE : BATTLE::BM_SINGLE;
+
+    BATTLE::battleRandom rng( p_team );
+    p_out = BATTLE::trainerData( );
+    if( !drawFacilityTeam( rules, p_team % NUM_STREAKS, p_out, rng ) ) { return 0; }
+
+    u32 hash = 1;
+    for( u8 i = 0; i < p_out.m_numPokemon; ++i ) {
+        hash = hash * 31 + p_out.m_pokemon[ i ].m_speciesId;
+        hash = hash * 31 + p_out.m_pokemon[ i ].m_moves[ 0 ];
+    }
+    return hash;
+}
+
+/*
+ * @brief: Checks that the team has the right size, pairwise distinct species and held
+ * items, and that its pkmn fit the streak.
+ */
+bool validTeam( u32 p_team, const BATTLE::trainerData& p_data ) {
+    u16  streak = p_team % NUM_STREAKS;
+    u8   iv     = IV_FOR_STREAK[ std::min<u16>( streak, IV_MAX_STREAK - 1 ) ];
+    bool ok     = p_data.m_numPokemon == ( p_team & 1 ? 4 : 3 );
+    for( u8 i = 0; ok && i < p_data.m_numPokemon; ++i ) {
+        const auto& a = p_data.m_pokemon[ i ];
+        ok            = a.m_iv[ 0 ] == iv && a.m_level == FACILITY_LEVEL;
+        if( NO_SETS ) {
+            ok = ok && a.m_speciesId
+                 && getSpeciesVariantForStreak( a.m_speciesId, streak, 0 ) != NO_VARIANT;
+        } else {
+            ok = ok && a.m_forme == getFacilityTierForStreak( streak );
+        }
+        for( u8 j = 0; ok && j < i; ++j ) {
+            const auto& b = p_data.m_pokemon[ j ];
+            ok            = a.m_speciesId != b.m_speciesId
+                 && ( !a.m_heldItem || a.m_heldItem != b.m_heldItem );
+        }
+    }
+    return ok;
+}
+
+/*
+ * @brief: Draws p_count teams twice and checks them; returns the number of invalid,
+ * failed and differing teams.
+ */
+u32 checkTeams( u32 p_count ) {
+    u32 invalid = 0, failed = 0, mismatches = 0;
+
+    std::vector<u32>    hashes( p_count );
+    BATTLE::trainerData team;
+    auto                start = std::chrono::steady_clock::now( );
+    for( u32 t = 0; t < p_count; ++t ) { hashes[ t ] = drawTeam( t, team ); }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now( ) - start )
+                  .count( );
+
+    // check the teams, drawn again with the same seeds
+    for( u32 t = 0; t < p_count; ++t ) {
+        u32 hash = drawTeam( t, team );
+        if( !hash ) {
+            ++failed;
+            continue;
+        }
+        if( hash != hashes[ t ] ) {
+            if( ++mismatches <= 10 ) { std::printf( "team %u differs when drawn again\n", t ); }
+        }
+        if( !validTeam( t, team ) && ++invalid <= 10 ) { std::printf( "team %u is invalid\n", t ); }
+    }
+    std::printf( "%u teams drawn%s, %u invalid, %u failed, %u differ; %.3f us per team\n",
+                 p_count, NO_SETS ? " from species" : "", invalid, failed, mismatches,
+                 ns / 1000.0 / p_count );
+    return invalid + failed + mismatches;
+}
+
+int main( ) {
+    FSDATA.m_maxPkmn = PKMN_OGERPON + 1;
+
+    u32 errors = checkTeams( NUM_TEAMS );
+
+    // species look-up
+    u32 lookups = 0, wrong = 0;
+    FACILITY_POOL.load( TIER_GOOD );
+    for( u16 first = 0, cnt = 0; first < FACILITY_POOL.size( ); first += cnt ) {
+        u16 species = FACILITY_POOL[ first ].m_speciesId;
+        for( cnt = 0; first + cnt < FACILITY_POOL.size( )
+                      && FACILITY_POOL[ first + cnt ].m_speciesId == species;
+             ++cnt ) { }
+        for( u8 v = 0; v < 2 * SETS_PER_PKMN; ++v ) {
+            ++lookups;
+            if( FACILITY_POOL.find( species, v ) != first + v % cnt ) { ++wrong; }
+        }
+    }
+    if( FACILITY_POOL.find( 0, 0 ) != NO_FACILITY_SET ) { ++wrong; }
+    std::printf( "%u species look-ups, %u wrong\n", lookups, wrong );
+
+    // pools that aren't sorted by species
+    UNSORTED_SETS = true;
+    FACILITY_POOL.clear( );
+    bool rejected = !FACILITY_POOL.load( TIER_BAD ) && !FACILITY_POOL.size( );
+    UNSORTED_SETS = false;
+    std::printf( "unsorted pool %s\n", rejected ? "rejected" : "accepted" );
+
+    // no sets for the tier; teams are drawn from random species
+    NO_SETS = true;
+    FACILITY_POOL.clear( );
+    errors += checkTeams( SPECIES_TEAMS );
+    NO_SETS = false;
+
+    return errors || wrong || !rejected;
+}
@@ -0,0 +1,123 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : glyphBlit.cpp
+author      : Philip Wellnitz
+description : Host test of font::printChar: renders every glyph of all fonts with the
+              word-based blitter and with the per-pixel printCharReference at aligned,
+              unaligned and clipped positions on a random background, with transparent
+              and opaque background colors, and compares the whole layer afterwards.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/font.cpp source/fontRegular.cpp source/fontBold.cpp
+// sources: source/fontSmall.cpp source/fontBraille.cpp source/backBuffer.cpp source/uio.cpp
+
+#include <chrono>
+#include <cstring>
+#include <random>
+
+#include "io/font.h"
+#include "io/uio.h"
+
+constexpr u32 LAYER_BYTES = SCREEN_WIDTH * 256;
+constexpr s16 POSITIONS_X[] = { -15, -5, -1, 0, 1, 2, 3, 5, 127, 241, 243, 250, 255 };
+constexpr s16 POSITIONS_Y[] = { -15, -3, 0, 7, 100, 185, 190, 241, 250 };
+
+u8 BACKGROUND[ LAYER_BYTES ];
+u8 REFERENCE[ LAYER_BYTES ];
+
+struct fontInfo {
+    const char* m_name;
+    IO::font*   m_font;
+    u16         m_numChars;
+};
+
+u8* layer( ) {
+    return reinterpret_cast<u8*>( BG_BMP_RAM_SUB( 1 ) );
+}
+
+int main( ) {
+    fontInfo fonts[] = {
+        { "regular", IO::regularFont, IO::REGULAR_FONT::NUM_CHARS },
+        { "bold", IO::boldFont, IO::BOLD_FONT::NUM_CHARS },
+        { "small", IO::smallFont, IO::SMALL_FONT::NUM_CHARS },
+        { "braille", IO::brailleFont, IO::BRAILLE_FONT::NUM_CHARS },
+    };
+
+    std::mt19937 rng( 42 );
+    for( u32 i = 0; i < LAYER_BYTES; ++i ) { BACKGROUND[ i ] = rng( ); }
+
+    u32 checks = 0, mismatches = 0;
+    for( const auto& f : fonts ) {
+        for( u8 opaque = 0; opaque < 2; ++opaque ) {
+            f.m_font->setColor( opaque ? 17 : 0, 0 );
+            f.m_font->setColor( 1, 1 );
+            f.m_font->setColor( 2, 2 );
+            f.m_font->setColor( 3, 3 );
+            f.m_font->setColor( 4, 4 );
+            for( u16 ch = 0; ch < f.m_numChars; ++ch ) {
+                for( auto x : POSITIONS_X ) {
+                    for( auto y : POSITIONS_Y ) {
+                        std::memcpy( layer( ), BACKGROUND, LAYER_BYTES );
+                        f.m_font->printCharReference( ch, x, y, true, 1, false );
+                        std::memcpy( REFERENCE, layer( ), LAYER_BYTES );
+
+                        std::memcpy( layer( ), BACKGROUND, LAYER_BYTES );
+                        f.m_font->printChar( ch, x, y, true, 1, false );
+                        ++checks;
+                        if( std::memcmp( REFERENCE, layer( ), LAYER_BYTES ) ) {
+                            if( ++mismatches <= 10 ) {
+                                std::printf( "mismatch: %s font, char %hu at %hd, %hd%s\n",
+                                             f.m_name, ch, x, y, opaque ? " (opaque)" : "" );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        f.m_font->setColor( 0, 0 );
+    }
+    std::printf( "%u glyph renders compared, %u mismatches\n", checks, mismatches );
+
+    // time both renderers on the regular font
+    constexpr u32 ROUNDS = 200;
+    auto          time   = [ & ]( bool p_reference ) {
+        auto start = std::chrono::steady_clock::now( );
+        for( u32 r = 0; r < ROUNDS; ++r ) {
+            for( u16 ch = 0; ch < IO::REGULAR_FONT::NUM_CHARS; ++ch ) {
+                if( p_reference ) {
+                    IO::regularFont->printCharReference( ch, ch & 127, ch & 63, true, 1, false );
+                } else {
+                    IO::regularFont->printChar( ch, ch & 127, ch & 63, true, 1, false );
+                }
+            }
+        }
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now( ) - start )
+                      .count( );
+        return double( ns ) / ( ROUNDS * IO::REGULAR_FONT::NUM_CHARS );
+    };
+    double ref = time( true ), span = time( false );
+    std::printf( "regular font: setPixel %.1f ns/glyph, span %.1f ns/glyph\n", ref, span );
+
+    return mismatches != 0;
+}
@@ -0,0 +1,65 @@
+#!/bin/sh
+#
+# Pokémon neo
+# ------------------------------
+#
+# file        : hosttest.sh
+# author      : Philip Wellnitz
+# description : Builds and runs host-side checks of engine modules. Every *.cpp file
+#               next to this script is a stand-alone test program; its "// sources:"
+#               line lists the arm9 sources (relative to arm9/) it needs and its
+#               "// shims:" line the host stand-ins from shim/ for the game modules it
+#               doesn't link (see shim/game.cpp). The programs are compiled for the host
+#               against the libnds shim in shim/, with DESQUID enabled and unsigned chars
+#               (as on the DS), and exit with a non-zero status if a check fails.
+#
+#               Timings printed by the tests are host timings; they only allow
+#               comparing two implementations built the same way, not estimating the
+#               cost on the DS.
+#
+# usage       : hosttest.sh [test]...   (runs all tests if none are given)
+#
+# This file is part of Pokémon neo; see COPYING for license details.
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+ARM9="$HERE/../../arm9"
+CXX=${CXX:-g++}
+OUT=${TMPDIR:-/tmp}/pneo-hosttest
+mkdir -p "$OUT"
+
+TESTS="$*"
+if [ -z "$TESTS" ]; then
+    TESTS=$(cd "$HERE" && ls *.cpp | sed 's/\.cpp$//')
+fi
+
+FAILED=""
+for TEST in $TESTS; do
+    SOURCES=""
+    for SRC in $(sed -n 's|^// sources *: *||p' "$HERE/$TEST.cpp"); do
+        SOURCES="$SOURCES $ARM9/$SRC"
+    done
+    for SRC in $(sed -n 's|^// shims *: *||p' "$HERE/$TEST.cpp"); do
+        SOURCES="$SOURCES $HERE/shim/$SRC"
+    done
+    echo "== $TEST"
+    # unused functions of the linked sources are dropped, so that their dependencies
+    # don't need to be linked as well
+    if ! $CXX -std=c++23 -O2 -w -DARM9 -DDESQUID -DNO_SOUND -DVERSION=0 \
+        -DGAME_CODE='"HOST"' -DGAME_TITLE='"HOSTTEST"' -DVERSION_NAME='"host"' \
+        -funsigned-char -fno-exceptions -fno-rtti \
+        -ffunction-sections -fdata-sections -Wl,--gc-sections \
+        -I"$HERE/shim" -I"$ARM9/include" -I"$ARM9/../common" \
+        -o "$OUT/$TEST" "$HERE/$TEST.cpp" $SOURCES "$HERE/shim/nds.cpp"; then
+        FAILED="$FAILED $TEST"
+        continue
+    fi
+    if ! "$OUT/$TEST"; then
+        FAILED="$FAILED $TEST"
+    fi
+done
+
+if [ -n "$FAILED" ]; then
+    echo "FAILED:$FAILED"
+    exit 1
+fi
+echo "all tests passed"
@@ -0,0 +1,179 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : rectFill.cpp
+author      : Philip Wellnitz
+description : Host test of the word-based rectangle fills and bitmap blits of the
+              bitmap layers: compares printRectangle(s), blit8 and blit8Masked with
+              per-pixel implementations on random rectangles and bitmaps and times
+              printRectangles against printRectangleReference.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/uio.cpp source/backBuffer.cpp source/font.cpp source/fontRegular.cpp
+// sources: source/fontBold.cpp source/fontSmall.cpp source/fontBraille.cpp
+
+#include <chrono>
+#include <cstring>
+#include <random>
+
+#include "io/uio.h"
+
+constexpr u32 LAYER_BYTES = SCREEN_WIDTH * 256;
+
+u8 BACKGROUND[ LAYER_BYTES ];
+u8 REFERENCE[ LAYER_BYTES ];
+u8 SOURCE[ SCREEN_WIDTH * 256 ];
+
+u8* layer( ) {
+    return reinterpret_cast<u8*>( BG_BMP_RAM_SUB( 1 ) );
+}
+
+void reset( ) {
+    std::memcpy( layer( ), BACKGROUND, LAYER_BYTES );
+}
+
+void blit8Reference( const u8* p_src, u16 p_stride, s16 p_x, s16 p_y, u16 p_width,
+                     u16 p_height, bool p_masked ) {
+    for( s16 y = 0; y < p_height; ++y ) {
+        for( s16 x = 0; x < p_width; ++x ) {
+            s16 px = p_x + x, py = p_y + y;
+            u8  clr = p_src[ y * p_stride + x ];
+            if( px < 0 || px >= SCREEN_WIDTH || py < 0 || py >= 256 ) { continue; }
+            if( p_masked && !clr ) { continue; }
+            IO::setPixel( px, py, true, clr, 1 );
+        }
+    }
+}
+
+int main( ) {
+    std::mt19937 rng( 7 );
+    for( u32 i = 0; i < LAYER_BYTES; ++i ) { BACKGROUND[ i ] = rng( ); }
+
+    auto compare = [ & ]( u32& p_mismatches, const char* p_what, u32 p_case ) {
+        if( std::memcmp( REFERENCE, layer( ), LAYER_BYTES ) && ++p_mismatches <= 10 ) {
+            std::printf( "mismatch: %s, case %u\n", p_what, p_case );
+        }
+    };
+
+    // single rectangles; every 8th one covers full rows
+    constexpr u32 RECTANGLES = 200000;
+    u32           rectMismatches = 0;
+    for( u32 i = 0; i < RECTANGLES; ++i ) {
+        u8 x1 = rng( ), x2 = rng( ), y1 = rng( ), y2 = rng( ), clr = rng( );
+        if( x1 > x2 && ( i & 1 ) ) { std::swap( x1, x2 ); }
+        if( y1 > y2 && ( i & 3 ) ) { std::swap( y1, y2 ); }
+        if( !( i & 7 ) ) {
+            x1 = 0;
+            x2 = SCREEN_WIDTH - 1;
+        }
+        reset( );
+        IO::printRectangleReference( x1, y1, x2, y2, true, clr, 1 );
+        std::memcpy( REFERENCE, layer( ), LAYER_BYTES );
+        reset( );
+        IO::printRectangle( x1, y1, x2, y2, true, clr, 1 );
+        compare( rectMismatches, "printRectangle", i );
+    }
+    std::printf( "%u rectangles, %u mismatches\n", RECTANGLES, rectMismatches );
+
+    // batches of overlapping rectangles
+    constexpr u32 BATCHES = 20000;
+    u32           batchMismatches = 0;
+    for( u32 i = 0; i < BATCHES; ++i ) {
+        IO::rectangle rects[ 8 ];
+        u8            cnt = 1 + rng( ) % 8;
+        for( u8 j = 0; j < cnt; ++j ) {
+            u8 x1 = rng( ), x2 = rng( ), y1 = rng( ), y2 = rng( );
+            rects[ j ] = { std::min( x1, x2 ), std::min( y1, y2 ), std::max( x1, x2 ),
+                           std::max( y1, y2 ), u8( rng( ) ) };
+        }
+        reset( );
+        for( u8 j = 0; j < cnt; ++j ) {
+            IO::printRectangleReference( rects[ j ].m_x1, rects[ j ].m_y1, rects[ j ].m_x2,
+                                         rects[ j ].m_y2, true, rects[ j ].m_color, 1 );
+        }
+        std::memcpy( REFERENCE, layer( ), LAYER_BYTES );
+        reset( );
+        IO::printRectangles( rects, cnt, true, 1 );
+        compare( batchMismatches, "printRectangles", i );
+    }
+    std::printf( "%u rectangle batches, %u mismatches\n", BATCHES, batchMismatches );
+
+    // blits; blit8 only clips on the right, blit8Masked on all sides
+    for( u32 i = 0; i < sizeof( SOURCE ); ++i ) { SOURCE[ i ] = ( rng( ) & 3 ) ? rng( ) : 0; }
+    constexpr u32 BLITS = 50000;
+    u32           blitMismatches = 0, maskedMismatches = 0;
+    for( u32 i = 0; i < BLITS; ++i ) {
+        u8  x = rng( ), y = rng( ) % 256;
+        u16 w = rng( ) % 64, h = rng( ) % ( 257 - y );
+        if( h > 64 ) { h = 64; }
+        reset( );
+        blit8Reference( SOURCE, w, x, y, w, h, false );
+        std::memcpy( REFERENCE, layer( ), LAYER_BYTES );
+        reset( );
+        IO::blit8( SOURCE, x, y, w, h, true, 1 );
+        compare( blitMismatches, "blit8", i );
+
+        s16 mx = s16( rng( ) % 320 ) - 32, my = s16( rng( ) % 320 ) - 32;
+        u16 stride = w + rng( ) % 8;
+        reset( );
+        blit8Reference( SOURCE, stride, mx, my, w, h, true );
+        std::memcpy( REFERENCE, layer( ), LAYER_BYTES );
+        reset( );
+        IO::blit8Masked( SOURCE, stride, mx, my, w, h, true, 1 );
+        compare( maskedMismatches, "blit8Masked", i );
+    }
+    std::printf( "%u blits, %u mismatches; %u masked blits, %u mismatches\n", BLITS,
+                 blitMismatches, BLITS, maskedMismatches );
+
+    // time both implementations on the rectangles of a choice box and a full clear
+    constexpr IO::rectangle CHOICE_BOX[] = {
+        { 118, 41, 120, 72, 1 }, { 9, 71, 120, 72, 1 },   { 8, 40, 11, 71, 2 },
+        { 115, 40, 118, 71, 2 }, { 8, 40, 118, 41, 2 },   { 8, 72, 118, 71, 2 },
+        { 116, 42, 117, 73, 1 }, { 12, 71, 117, 73, 1 },  { 11, 41, 115, 72, 3 },
+    };
+    constexpr IO::rectangle CLEAR[] = { { 0, 0, 255, 191, 0 } };
+    auto time = [ & ]( const IO::rectangle* p_rects, u8 p_count, bool p_reference ) {
+        constexpr u32 ROUNDS = 2000;
+        auto          start  = std::chrono::steady_clock::now( );
+        for( u32 r = 0; r < ROUNDS; ++r ) {
+            if( !p_reference ) {
+                IO::printRectangles( p_rects, p_count, true, 1 );
+                continue;
+            }
+            for( u8 j = 0; j < p_count; ++j ) {
+                IO::printRectangleReference( p_rects[ j ].m_x1, p_rects[ j ].m_y1,
+                                             p_rects[ j ].m_x2, p_rects[ j ].m_y2, true,
+                                             p_rects[ j ].m_color, 1 );
+            }
+        }
+        return double( std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now( ) - start )
+                           .count( ) )
+               / ROUNDS / 1000;
+    };
+    std::printf( "choice box: setPixel %.2f us, words %.2f us\n", time( CHOICE_BOX, 9, true ),
+                 time( CHOICE_BOX, 9, false ) );
+    std::printf( "full clear: setPixel %.2f us, words %.2f us\n", time( CLEAR, 1, true ),
+                 time( CLEAR, 1, false ) );
+
+    return rectMismatches || batchMismatches || blitMismatches || maskedMismatches;
+}
@@ -0,0 +1,4 @@
+extern const unsigned int NoItemTiles[];
+extern const unsigned short NoItemPal[];
+#define NoItemTilesLen 512
+#define NoItemPalLen 32
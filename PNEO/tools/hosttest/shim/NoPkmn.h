@@ -0,0 +1,4 @@
+extern const unsigned int NoPkmnTiles[];
+extern const unsigned short NoPkmnPal[];
+#define NoPkmnTilesLen 512
+#define NoPkmnPalLen 32
@@ -0,0 +1,4 @@
+extern const unsigned int anti_pokerus_iconTiles[];
+extern const unsigned short anti_pokerus_iconPal[];
+#define anti_pokerus_iconTilesLen 512
+#define anti_pokerus_iconPalLen 32
@@ -0,0 +1,4 @@
+extern const unsigned int consoleFontTiles[];
+extern const unsigned short consoleFontPal[];
+#define consoleFontTilesLen 512
+#define consoleFontPalLen 32
@@ -0,0 +1 @@
+bool fatInitDefault();
@@ -0,0 +1,656 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : game.cpp
+author      : Philip Wellnitz
+description : Host stand-ins for the game modules that the battle engine calls (data
+              files, sprites, sound, bag, party screen, save game) for host tests that
+              play headless battles; link with "// shims: game.cpp".
+
+              There is no FSROOT on the host, so the species and move data below is
+              written by hand: the real types, base stats and main effects of the
+              species and moves of the battle benchmark teams, good enough to play
+              sensible battles, but not the game's data files. Species and moves that
+              aren't listed get plain placeholder data (a normal type species with 80
+              in all base stats, a 60 power normal type physical move).
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstring>
+
+#include "bag/bagViewer.h"
+#include "battle/battleDefines.h"
+#include "battle/move.h"
+#include "defines.h"
+#include "dex/dex.h"
+#include "fs/data.h"
+#include "gen/abilityNames.h"
+#include "gen/moveNames.h"
+#include "gen/pokemonNames.h"
+#include "io/animations.h"
+#include "io/choiceBox.h"
+#include "io/keyboard.h"
+#include "io/screenFade.h"
+#include "io/sprite.h"
+#include "io/uio.h"
+#include "io/yesNoBox.h"
+#include "map/mapDrawer.h"
+#include "save/saveGame.h"
+#include "sound/sound.h"
+#include "sts/partyScreen.h"
+
+using namespace BATTLE;
+
+bool          SCREENS_SWAPPED   = false;
+bool          PLAYER_IS_FISHING = false;
+int           pressed, held, last;
+touchPosition touch;
+u8            cooldown;
+
+u8 getCurrentDaytime( ) {
+    return 1;
+}
+
+namespace SAVE {
+    saveGame SAV;
+    date     CURRENT_DATE;
+
+    u8 saveGame::playerInfo::getTeamPkmnCount( ) {
+        return 0;
+    }
+
+    bool saveGame::playerInfo::localDexCompleted( ) const {
+        return false;
+    }
+
+    bool saveGame::playerInfo::setTeamPkmn( u8, pokemon* ) {
+        return false;
+    }
+
+    s8 saveGame::playerInfo::storePkmn( const pokemon& ) {
+        return -1;
+    }
+} // namespace SAVE
+
+namespace MAP {
+    mapDrawer* curMap = nullptr;
+
+    u16 mapDrawer::getCurrentLocationId( ) const {
+        return 0;
+    }
+} // namespace MAP
+
+namespace BAG {
+    u16 bag::count( bagType, u16 ) {
+        return 0;
+    }
+
+    void bag::erase( bagType, u16, u16 ) {
+    }
+
+    bagViewer::bagViewer( pokemon*, context ) {
+    }
+
+    u16 bagViewer::getItem( bool ) {
+        return 0;
+    }
+} // namespace BAG
+
+namespace BATTLE {
+    bool possible( const u16, u8 ) {
+        return false;
+    }
+} // namespace BATTLE
+
+namespace DEX {
+    dex::dex( ) {
+    }
+
+    void dex::run( u16, u8, bool, bool ) {
+    }
+} // namespace DEX
+
+namespace STS {
+    partyScreen::partyScreen( pokemon*, u8, bool, bool, bool, u8, bool, bool, bool, bool, u8,
+                              u8 ) {
+    }
+
+    partyScreen::~partyScreen( ) {
+    }
+
+    partyScreen::result partyScreen::run( u8 ) {
+        return result( );
+    }
+} // namespace STS
+
+namespace SOUND {
+    void initBattleSound( ) {
+    }
+
+    void deinitBattleSound( ) {
+    }
+
+    void playBGM( s16, bool, bool ) {
+    }
+
+    void playBGMOneshot( s16 ) {
+    }
+
+    void playSoundEffect( u16 ) {
+    }
+
+    void playCry( u16, u8, bool ) {
+    }
+
+    void setVolume( u16 ) {
+    }
+} // namespace SOUND
+
+namespace IO {
+    OAMTable* Oam;
+    OAMTable* OamTop;
+    int       bg2, bg3, bg2sub, bg3sub;
+    font*     regularFont = nullptr;
+    font*     smallFont   = nullptr;
+
+    void vramSetup( bool ) {
+    }
+
+    void fadeScreen( fadeType, bool, bool ) {
+    }
+
+    void initOAMTable( bool ) {
+    }
+
+    void updateOAM( bool ) {
+    }
+
+    void printRectangle( u8, u8, u8, u8, bool, u8, u8 ) {
+    }
+
+    void displayHP( u16, u16, u8, u8, u8, u8, bool, bool ) {
+    }
+
+    void copySpritePal( const unsigned short*, const u8, const u8, const u16, bool ) {
+    }
+
+    u16 pkmnSpriteHeight( const pkmnSpriteInfo& ) {
+        return 96;
+    }
+
+    u16 loadPKMNSprite( const pkmnSpriteInfo&, const s16, const s16, u8, u8, u16 p_tileCnt, bool,
+                        bool ) {
+        return p_tileCnt;
+    }
+
+    u16 loadPKMNSpriteBack( const pkmnSpriteInfo&, const s16, const s16, u8, u8, u16 p_tileCnt,
+                            bool, bool ) {
+        return p_tileCnt;
+    }
+
+    u16 loadPKMNIcon( const pkmnSpriteInfo&, const s16, const s16, u8, u8, u16 p_tileCnt, bool,
+                      bool ) {
+        return p_tileCnt;
+    }
+
+    u16 loadTrainerSprite( u8, const s16, const s16, u8, u8, u16 p_tileCnt, bool ) {
+        return p_tileCnt;
+    }
+
+    u16 loadPlatform( u8, const s16, const s16, u8, u8, u16 p_tileCnt, bool ) {
+        return p_tileCnt;
+    }
+
+    u16 loadTypeIcon( BATTLE::type, const s16, const s16, u8, u8, u16 p_tileCnt, bool,
+                      SAVE::language ) {
+        return p_tileCnt;
+    }
+
+    u16 loadDamageCategoryIcon( BATTLE::moveHitTypes, const s16, const s16, u8, u8,
+                                u16 p_tileCnt, bool ) {
+        return p_tileCnt;
+    }
+
+    u16 loadSprite( const char*, const u8, const u8, const u16 p_tileCnt, const s16, const s16,
+                    u8, u8, bool, bool, bool, ObjPriority, bool, ObjBlendMode ) {
+        return p_tileCnt;
+    }
+
+    u16 loadSprite( const u8, const u8, const u16 p_tileCnt, const s16, const s16, u8, u8,
+                    const unsigned short*, const unsigned int*, const u32, bool, bool, bool,
+                    ObjPriority, bool, ObjBlendMode ) {
+        return p_tileCnt;
+    }
+
+    u32 font::stringWidth( const char*, u8 ) const {
+        return 0;
+    }
+
+    u32 font::stringWidthC( const char* ) const {
+        return 0;
+    }
+
+    u16 font::printString( const char*, s16, s16, bool, alignment, u8, s8, u8, bool, u8 ) const {
+        return 0;
+    }
+
+    u16 font::printStringC( const char*, s16, s16, bool, alignment, u8, s8, bool, u8 ) const {
+        return 0;
+    }
+
+    u16 font::printBreakingStringC( const char*, s16, s16, s16, bool, alignment, u8, char, s8,
+                                    bool, u8 ) const {
+        return 0;
+    }
+
+    choiceBox::selection choiceBox::getResult(
+        std::function<std::vector<std::pair<inputTarget, selection>>( u8 )>,
+        std::function<void( selection )>, selection p_initialSelection, std::function<void( )>,
+        u8 ) {
+        return p_initialSelection;
+    }
+
+    yesNoBox::selection yesNoBox::getResult(
+        std::function<std::vector<std::pair<inputTarget, selection>>( )>,
+        std::function<void( selection )>, selection p_initialSelection,
+        std::function<void( )> ) {
+        return p_initialSelection;
+    }
+
+    std::string keyboard::getText( u8 ) {
+        return "";
+    }
+
+    namespace ANIM {
+        bool evolvePkmn( u16, u8, u16, u8, bool, bool, u32, bool ) {
+            return false;
+        }
+    } // namespace ANIM
+} // namespace IO
+
+namespace FS {
+    const char* HP_ICONS[ MAX_LANGUAGES ] = { };
+
+    struct speciesEntry {
+        u16          m_id;
+        BATTLE::type m_types[ 2 ];
+        u8           m_bases[ 6 ]; // hp, atk, def, satk, sdef, spd
+        u16          m_ability;
+        u16          m_weight; // in 100g
+    };
+
+    constexpr speciesEntry SPECIES[] = {
+        { PKMN_VENUSAUR, { TYPE_GRASS, TYPE_POISON }, { 80, 82, 83, 100, 100, 80 }, A_OVERGROW,
+          1000 },
+        { PKMN_CHARIZARD, { TYPE_FIRE, TYPE_FLYING }, { 78, 84, 78, 109, 85, 100 }, A_BLAZE, 905 },
+        { PKMN_NINETALES, { TYPE_FIRE, TYPE_FIRE }, { 73, 76, 75, 81, 100, 100 }, A_DROUGHT, 199 },
+        { PKMN_GENGAR, { TYPE_GHOST, TYPE_POISON }, { 60, 65, 60, 130, 75, 110 }, A_CURSED_BODY,
+          405 },
+        { PKMN_GYARADOS, { TYPE_WATER, TYPE_FLYING }, { 95, 125, 79, 60, 100, 81 },
+          A_INTIMIDATE, 2350 },
+        { PKMN_CLOYSTER, { TYPE_WATER, TYPE_ICE }, { 50, 95, 180, 85, 45, 70 }, A_SKILL_LINK,
+          1325 },
+        { PKMN_TYRANITAR, { TYPE_ROCK, TYPE_DARKNESS }, { 100, 134, 110, 95, 100, 61 },
+          A_SAND_STREAM, 2020 },
+        { PKMN_BRELOOM, { TYPE_GRASS, TYPE_FIGHTING }, { 60, 130, 80, 60, 60, 70 }, A_TECHNICIAN,
+          392 },
+        { PKMN_SABLEYE, { TYPE_DARKNESS, TYPE_GHOST }, { 50, 75, 75, 65, 65, 50 }, A_PRANKSTER,
+          110 },
+        { PKMN_METAGROSS, { TYPE_STEEL, TYPE_PSYCHIC }, { 80, 135, 130, 95, 90, 70 },
+          A_CLEAR_BODY, 5500 },
+        { PKMN_GARCHOMP, { TYPE_DRAGON, TYPE_GROUND }, { 108, 130, 95, 80, 85, 102 },
+          A_ROUGH_SKIN, 950 },
+        { PKMN_ABOMASNOW, { TYPE_GRASS, TYPE_ICE }, { 90, 92, 75, 92, 85, 60 }, A_SNOW_WARNING,
+          1355 },
+        { PKMN_ROTOM, { TYPE_LIGHTNING, TYPE_GHOST }, { 50, 50, 77, 95, 77, 91 }, A_LEVITATE, 3 },
+        { PKMN_CINCCINO, { TYPE_NORMAL, TYPE_NORMAL }, { 75, 95, 60, 65, 60, 115 }, A_SKILL_LINK,
+          75 },
+        { PKMN_AMOONGUSS, { TYPE_GRASS, TYPE_POISON }, { 114, 85, 70, 85, 80, 30 },
+          A_REGENERATOR, 105 },
+        { PKMN_FERROTHORN, { TYPE_GRASS, TYPE_STEEL }, { 74, 94, 131, 54, 116, 20 },
+          A_IRON_BARBS, 1100 },
+        { PKMN_PELIPPER, { TYPE_WATER, TYPE_FLYING }, { 60, 50, 100, 95, 70, 65 }, A_DRIZZLE,
+          280 },
+        { PKMN_TOXAPEX, { TYPE_POISON, TYPE_WATER }, { 50, 63, 152, 53, 142, 35 }, A_REGENERATOR,
+          145 },
+        { PKMN_TAPU_KOKO, { TYPE_LIGHTNING, TYPE_FAIRY }, { 70, 115, 85, 95, 75, 130 },
+          A_ELECTRIC_SURGE, 205 },
+        { PKMN_TAPU_LELE, { TYPE_PSYCHIC, TYPE_FAIRY }, { 70, 85, 75, 130, 115, 95 },
+          A_PSYCHIC_SURGE, 186 },
+    };
+
+    bool getPkmnData( const u16 p_pkmnId, const u8, pkmnData* p_out ) {
+        std::memset( p_out, 0, sizeof( pkmnData ) );
+        auto& fd                 = p_out->m_baseForme;
+        fd.m_types[ 0 ]          = TYPE_NORMAL;
+        fd.m_types[ 1 ]          = TYPE_NORMAL;
+        fd.m_genderRatio         = pkmnGenderType( 127 );
+        fd.m_weight              = 500;
+        fd.m_expYield            = 150;
+        p_out->m_catchrate       = 45;
+        p_out->m_baseFriend      = 70;
+        p_out->m_expTypeFormeCnt = 1 << 5; // medium fast
+        std::memset( fd.m_bases, 80, sizeof( fd.m_bases ) );
+        for( const auto& sp : SPECIES ) {
+            if( sp.m_id != p_pkmnId ) { continue; }
+            fd.m_types[ 0 ]     = sp.m_types[ 0 ];
+            fd.m_types[ 1 ]     = sp.m_types[ 1 ];
+            fd.m_abilities[ 0 ] = sp.m_ability;
+            fd.m_abilities[ 1 ] = sp.m_ability;
+            fd.m_weight         = sp.m_weight;
+            std::memcpy( fd.m_bases, sp.m_bases, sizeof( fd.m_bases ) );
+        }
+        return true;
+    }
+
+    pkmnData getPkmnData( const u16 p_pkmnId, const u8 p_forme ) {
+        pkmnData res;
+        getPkmnData( p_pkmnId, p_forme, &res );
+        return res;
+    }
+
+    pkmnEvolveData getPkmnEvolveData( const u16, const u8 ) {
+        pkmnEvolveData res;
+        std::memset( &res, 0, sizeof( pkmnEvolveData ) );
+        return res;
+    }
+
+    void getLearnMoves( u16, u8, u16, u16, u16 p_num, u16* p_res ) {
+        for( u16 i = 0; i < p_num; ++i ) { p_res[ i ] = i ? 0 : M_TACKLE; }
+    }
+
+    bool canLearn( u16, u8, u16, u16, u16 ) {
+        return false;
+    }
+
+    constexpr u64 HIT     = MF_PROTECT | MF_MIRROR;
+    constexpr u64 CONTACT = HIT | MF_CONTACT;
+    constexpr u8  ALWAYS  = 255;
+
+    struct moveEntry {
+        u16          m_id;
+        BATTLE::type m_type;
+        moveHitTypes m_category;
+        u8           m_power;
+        u8           m_accuracy;
+        u8           m_pp;
+        target       m_target;
+        u64          m_flags;
+    };
+
+    constexpr moveEntry MOVES[] = {
+        // physical attacks
+        { M_EARTHQUAKE, TYPE_GROUND, MH_PHYSICAL, 100, 100, 10, TG_ALL_FOES_AND_ALLY, HIT },
+        { M_DRAGON_CLAW, TYPE_DRAGON, MH_PHYSICAL, 80, 100, 15, TG_ANY, CONTACT },
+        { M_STONE_EDGE, TYPE_ROCK, MH_PHYSICAL, 100, 80, 5, TG_ANY, HIT },
+        { M_ROCK_SLIDE, TYPE_ROCK, MH_PHYSICAL, 75, 90, 10, TG_ALL_FOES, HIT },
+        { M_METEOR_MASH, TYPE_STEEL, MH_PHYSICAL, 90, 90, 10, TG_ANY, CONTACT | MF_PUNCH },
+        { M_ZEN_HEADBUTT, TYPE_PSYCHIC, MH_PHYSICAL, 80, 90, 15, TG_ANY, CONTACT },
+        { M_BULLET_PUNCH, TYPE_STEEL, MH_PHYSICAL, 40, 100, 30, TG_ANY, CONTACT | MF_PUNCH },
+        { M_MACH_PUNCH, TYPE_FIGHTING, MH_PHYSICAL, 40, 100, 30, TG_ANY, CONTACT | MF_PUNCH },
+        { M_WATERFALL, TYPE_WATER, MH_PHYSICAL, 80, 100, 15, TG_ANY, CONTACT },
+        { M_CRUNCH, TYPE_DARKNESS, MH_PHYSICAL, 80, 100, 15, TG_ANY, CONTACT | MF_BITE },
+        { M_KNOCK_OFF, TYPE_DARKNESS, MH_PHYSICAL, 65, 100, 20, TG_ANY, CONTACT },
+        { M_GYRO_BALL, TYPE_STEEL, MH_PHYSICAL, 1, 100, 5, TG_ANY, CONTACT | MF_BULLET },
+        { M_ICICLE_SPEAR, TYPE_ICE, MH_PHYSICAL, 25, 100, 30, TG_ANY, HIT },
+        { M_ROCK_BLAST, TYPE_ROCK, MH_PHYSICAL, 25, 90, 10, TG_ANY, HIT | MF_BULLET },
+        { M_BULLET_SEED, TYPE_GRASS, MH_PHYSICAL, 25, 100, 30, TG_ANY, HIT | MF_BULLET },
+        { M_TAIL_SLAP, TYPE_NORMAL, MH_PHYSICAL, 25, 85, 10, TG_ANY, CONTACT },
+        { M_PIN_MISSILE, TYPE_BUG, MH_PHYSICAL, 25, 95, 20, TG_ANY, HIT },
+        { M_SCALE_SHOT, TYPE_DRAGON, MH_PHYSICAL, 25, 90, 20, TG_ANY, HIT },
+        { M_ARM_THRUST, TYPE_FIGHTING, MH_PHYSICAL, 15, 100, 20, TG_ANY, CONTACT },
+        { M_DOUBLE_HIT, TYPE_NORMAL, MH_PHYSICAL, 35, 90, 10, TG_ANY, CONTACT },
+        { M_DRAGON_DARTS, TYPE_DRAGON, MH_PHYSICAL, 50, 100, 10, TG_ANY, HIT },
+
+        // special attacks
+        { M_FLAMETHROWER, TYPE_FIRE, MH_SPECIAL, 90, 100, 15, TG_ANY, HIT },
+        { M_HEAT_WAVE, TYPE_FIRE, MH_SPECIAL, 95, 90, 10, TG_ALL_FOES, HIT },
+        { M_SOLAR_BEAM, TYPE_GRASS, MH_SPECIAL, 120, 100, 10, TG_ANY, HIT | MF_CHARGE },
+        { M_HURRICANE, TYPE_FLYING, MH_SPECIAL, 110, 70, 10, TG_ANY, HIT },
+        { M_THUNDERBOLT, TYPE_LIGHTNING, MH_SPECIAL, 90, 100, 15, TG_ANY, HIT },
+        { M_THUNDER, TYPE_LIGHTNING, MH_SPECIAL, 110, 70, 10, TG_ANY, HIT },
+        { M_HEX, TYPE_GHOST, MH_SPECIAL, 65, 100, 10, TG_ANY, HIT },
+        { M_GIGA_DRAIN, TYPE_GRASS, MH_SPECIAL, 75, 100, 10, TG_ANY, HIT | MF_HEAL },
+        { M_SLUDGE_BOMB, TYPE_POISON, MH_SPECIAL, 90, 100, 10, TG_ANY, HIT | MF_BULLET },
+        { M_ICE_BEAM, TYPE_ICE, MH_SPECIAL, 90, 100, 10, TG_ANY, HIT },
+        { M_BLIZZARD, TYPE_ICE, MH_SPECIAL, 110, 70, 5, TG_ALL_FOES, HIT },
+        { M_SHADOW_BALL, TYPE_GHOST, MH_SPECIAL, 80, 100, 15, TG_ANY, HIT | MF_BULLET },
+        { M_SURF, TYPE_WATER, MH_SPECIAL, 90, 100, 15, TG_ALL_FOES_AND_ALLY, HIT },
+        { M_SCALD, TYPE_WATER, MH_SPECIAL, 80, 100, 15, TG_ANY, HIT | MF_DEFROST },
+        { M_WEATHER_BALL, TYPE_NORMAL, MH_SPECIAL, 50, 100, 10, TG_ANY, HIT | MF_BULLET },
+        { M_PSYCHIC, TYPE_PSYCHIC, MH_SPECIAL, 90, 100, 10, TG_ANY, HIT },
+        { M_MOONBLAST, TYPE_FAIRY, MH_SPECIAL, 95, 100, 15, TG_ANY, HIT },
+        { M_DAZZLING_GLEAM, TYPE_FAIRY, MH_SPECIAL, 80, 100, 10, TG_ALL_FOES, HIT },
+
+        // status moves
+        { M_SWORDS_DANCE, TYPE_NORMAL, MH_STATUS, 0, ALWAYS, 20, TG_SELF, MF_SNATCH | MF_DANCE },
+        { M_SHELL_SMASH, TYPE_NORMAL, MH_STATUS, 0, ALWAYS, 15, TG_SELF, MF_SNATCH },
+        { M_THUNDER_WAVE, TYPE_LIGHTNING, MH_STATUS, 0, 90, 20, TG_ANY, HIT | MF_REFLECTABLE },
+        { M_WILL_O_WISP, TYPE_FIRE, MH_STATUS, 0, 85, 15, TG_ANY, HIT | MF_REFLECTABLE },
+        { M_TOXIC, TYPE_POISON, MH_STATUS, 0, 90, 10, TG_ANY, HIT | MF_REFLECTABLE },
+        { M_SPORE, TYPE_GRASS, MH_STATUS, 0, 100, 15, TG_ANY, HIT | MF_REFLECTABLE | MF_POWDER },
+        { M_SLEEP_POWDER, TYPE_GRASS, MH_STATUS, 0, 75, 15, TG_ANY,
+          HIT | MF_REFLECTABLE | MF_POWDER },
+        { M_STUN_SPORE, TYPE_GRASS, MH_STATUS, 0, 75, 30, TG_ANY,
+          HIT | MF_REFLECTABLE | MF_POWDER },
+        { M_POISON_POWDER, TYPE_POISON, MH_STATUS, 0, 75, 35, TG_ANY,
+          HIT | MF_REFLECTABLE | MF_POWDER },
+        { M_CONFUSE_RAY, TYPE_GHOST, MH_STATUS, 0, 100, 10, TG_ANY, HIT | MF_REFLECTABLE },
+        { M_SWAGGER, TYPE_NORMAL, MH_STATUS, 0, 85, 15, TG_ANY, HIT | MF_REFLECTABLE },
+        { M_LEECH_SEED, TYPE_GRASS, MH_STATUS, 0, 90, 10, TG_ANY, HIT | MF_REFLECTABLE },
+        { M_TAUNT, TYPE_DARKNESS, MH_STATUS, 0, 100, 20, TG_ANY, HIT | MF_REFLECTABLE },
+        { M_ENCORE, TYPE_NORMAL, MH_STATUS, 0, 100, 5, TG_ANY, HIT | MF_REFLECTABLE },
+        { M_DISABLE, TYPE_NORMAL, MH_STATUS, 0, 100, 20, TG_ANY, HIT | MF_REFLECTABLE },
+        { M_YAWN, TYPE_NORMAL, MH_STATUS, 0, ALWAYS, 10, TG_ANY, HIT | MF_REFLECTABLE },
+        { M_STRENGTH_SAP, TYPE_GRASS, MH_STATUS, 0, 100, 10, TG_ANY,
+          HIT | MF_REFLECTABLE | MF_HEAL },
+        { M_PROTECT, TYPE_NORMAL, MH_STATUS, 0, ALWAYS, 10, TG_SELF, 0 },
+        { M_BANEFUL_BUNKER, TYPE_POISON, MH_STATUS, 0, ALWAYS, 10, TG_SELF, 0 },
+        { M_SUBSTITUTE, TYPE_NORMAL, MH_STATUS, 0, ALWAYS, 10, TG_SELF, MF_SNATCH },
+        { M_RAGE_POWDER, TYPE_BUG, MH_STATUS, 0, ALWAYS, 20, TG_SELF, MF_POWDER },
+        { M_HAZE, TYPE_ICE, MH_STATUS, 0, ALWAYS, 30, TG_FIELD, 0 },
+        { M_PERISH_SONG, TYPE_NORMAL, MH_STATUS, 0, ALWAYS, 5, TG_FIELD, MF_SOUND },
+        { M_RAIN_DANCE, TYPE_WATER, MH_STATUS, 0, ALWAYS, 5, TG_FIELD, 0 },
+        { M_SUNNY_DAY, TYPE_FIRE, MH_STATUS, 0, ALWAYS, 5, TG_FIELD, 0 },
+        { M_SANDSTORM, TYPE_ROCK, MH_STATUS, 0, ALWAYS, 10, TG_FIELD, 0 },
+        { M_HAIL, TYPE_ICE, MH_STATUS, 0, ALWAYS, 10, TG_FIELD, 0 },
+        { M_ELECTRIC_TERRAIN, TYPE_LIGHTNING, MH_STATUS, 0, ALWAYS, 10, TG_FIELD, 0 },
+        { M_PSYCHIC_TERRAIN, TYPE_PSYCHIC, MH_STATUS, 0, ALWAYS, 10, TG_FIELD, 0 },
+        { M_STEALTH_ROCK, TYPE_ROCK, MH_STATUS, 0, ALWAYS, 20, TG_FOE_SIDE, MF_REFLECTABLE },
+        { M_SPIKES, TYPE_GROUND, MH_STATUS, 0, ALWAYS, 20, TG_FOE_SIDE, MF_REFLECTABLE },
+        { M_TOXIC_SPIKES, TYPE_POISON, MH_STATUS, 0, ALWAYS, 20, TG_FOE_SIDE, MF_REFLECTABLE },
+    };
+
+    constexpr moveEntry PLACEHOLDER_MOVE
+        = { 0, TYPE_NORMAL, MH_PHYSICAL, 60, 100, 20, TG_ANY, CONTACT };
+
+    moveData syntheticMoveData( u16 p_moveId ) {
+        moveData res;
+        if( !p_moveId ) { return res; }
+
+        auto entry = PLACEHOLDER_MOVE;
+        for( const auto& mv : MOVES ) {
+            if( mv.m_id == p_moveId ) { entry = mv; }
+        }
+        res.m_type              = entry.m_type;
+        res.m_category          = entry.m_category;
+        res.m_defensiveCategory = entry.m_category;
+        res.m_basePower         = entry.m_power;
+        res.m_accuracy          = entry.m_accuracy;
+        res.m_pp                = entry.m_pp;
+        res.m_target            = entry.m_target;
+        res.m_pressureTarget    = entry.m_target;
+        res.m_flags             = moveFlags( entry.m_flags );
+
+        auto secondary = [ & ]( u8 p_chance, u8 p_status, volatileStatus p_volatileStatus ) {
+            res.m_secondaryChance         = p_chance;
+            res.m_secondaryStatus         = p_status;
+            res.m_secondaryVolatileStatus = p_volatileStatus;
+        };
+
+        switch( p_moveId ) {
+        case M_STONE_EDGE: res.m_critRatio = 2; break;
+        case M_ROCK_SLIDE: secondary( 30, 0, VS_FLINCH ); break;
+        case M_ZEN_HEADBUTT:
+        case M_WATERFALL: secondary( 20, 0, VS_FLINCH ); break;
+        case M_METEOR_MASH:
+            secondary( 20, 0, VS_NONE );
+            res.m_secondarySelfBoosts.setBoost( ATK, 1 );
+            break;
+        case M_CRUNCH:
+            secondary( 20, 0, VS_NONE );
+            res.m_secondaryBoosts.setBoost( DEF, -1 );
+            break;
+        case M_BULLET_PUNCH:
+        case M_MACH_PUNCH: res.m_priority = 1; break;
+
+        // multi-hit moves, as ( min << 4 ) | max
+        case M_ICICLE_SPEAR:
+        case M_ROCK_BLAST:
+        case M_BULLET_SEED:
+        case M_TAIL_SLAP:
+        case M_PIN_MISSILE:
+        case M_SCALE_SHOT:
+        case M_ARM_THRUST: res.m_multiHit = ( 2 << 4 ) | 5; break;
+        case M_DOUBLE_HIT:
+        case M_DRAGON_DARTS: res.m_multiHit = ( 2 << 4 ) | 2; break;
+
+        case M_FLAMETHROWER:
+        case M_HEAT_WAVE: secondary( 10, BURN, VS_NONE ); break;
+        case M_SCALD: secondary( 30, BURN, VS_NONE ); break;
+        case M_THUNDERBOLT: secondary( 10, PARALYSIS, VS_NONE ); break;
+        case M_THUNDER: secondary( 30, PARALYSIS, VS_NONE ); break;
+        case M_ICE_BEAM:
+        case M_BLIZZARD: secondary( 10, FROZEN, VS_NONE ); break;
+        case M_SLUDGE_BOMB: secondary( 30, POISON, VS_NONE ); break;
+        case M_HURRICANE: secondary( 30, 0, VS_CONFUSION ); break;
+        case M_GIGA_DRAIN: res.m_drain = 120; break;
+        case M_SHADOW_BALL:
+            secondary( 20, 0, VS_NONE );
+            res.m_secondaryBoosts.setBoost( SDEF, -1 );
+            break;
+        case M_PSYCHIC:
+            secondary( 10, 0, VS_NONE );
+            res.m_secondaryBoosts.setBoost( SDEF, -1 );
+            break;
+        case M_MOONBLAST:
+            secondary( 30, 0, VS_NONE );
+            res.m_secondaryBoosts.setBoost( SATK, -1 );
+            break;
+
+        case M_SWORDS_DANCE: res.m_boosts.setBoost( ATK, 2 ); break;
+        case M_SHELL_SMASH:
+            res.m_boosts.setBoost( ATK, 2 );
+            res.m_boosts.setBoost( SATK, 2 );
+            res.m_boosts.setBoost( SPEED, 2 );
+            res.m_boosts.setBoost( DEF, -1 );
+            res.m_boosts.setBoost( SDEF, -1 );
+            break;
+        case M_STRENGTH_SAP: res.m_boosts.setBoost( ATK, -1 ); break;
+        case M_THUNDER_WAVE:
+        case M_STUN_SPORE: res.m_status = PARALYSIS; break;
+        case M_WILL_O_WISP: res.m_status = BURN; break;
+        case M_TOXIC: res.m_status = TOXIC; break;
+        case M_POISON_POWDER: res.m_status = POISON; break;
+        case M_SPORE:
+        case M_SLEEP_POWDER: res.m_status = SLEEP; break;
+        case M_SWAGGER: res.m_boosts.setBoost( ATK, 2 ); [[fallthrough]];
+        case M_CONFUSE_RAY: res.m_volatileStatus = VS_CONFUSION; break;
+        case M_LEECH_SEED: res.m_volatileStatus = VS_LEECHSEED; break;
+        case M_TAUNT: res.m_volatileStatus = VS_TAUNT; break;
+        case M_ENCORE: res.m_volatileStatus = VS_ENCORE; break;
+        case M_DISABLE: res.m_volatileStatus = VS_DISABLE; break;
+        case M_YAWN: res.m_volatileStatus = VS_YAWN; break;
+        case M_SUBSTITUTE: res.m_volatileStatus = VS_SUBSTITUTE; break;
+        case M_PROTECT:
+            res.m_priority       = 4;
+            res.m_volatileStatus = VS_PROTECT;
+            break;
+        case M_BANEFUL_BUNKER:
+            res.m_priority       = 4;
+            res.m_volatileStatus = VS_BANEFULBUNKER;
+            break;
+        case M_RAGE_POWDER:
+            res.m_priority       = 2;
+            res.m_volatileStatus = VS_RAGEPOWDER;
+            break;
+        case M_RAIN_DANCE: res.m_weather = WE_RAIN; break;
+        case M_SUNNY_DAY: res.m_weather = WE_SUN; break;
+        case M_SANDSTORM: res.m_weather = WE_SANDSTORM; break;
+        case M_HAIL: res.m_weather = WE_HAIL; break;
+        case M_ELECTRIC_TERRAIN: res.m_terrain = TR_ELECTRICTERRAIN; break;
+        case M_PSYCHIC_TERRAIN: res.m_terrain = TR_PSYCHICTERRAIN; break;
+        case M_STEALTH_ROCK: res.m_sideCondition = SC_STEALTHROCK; break;
+        case M_SPIKES: res.m_sideCondition = SC_SPIKES; break;
+        case M_TOXIC_SPIKES: res.m_sideCondition = SC_TOXICSPIKES; break;
+        default: break;
+        }
+        return res;
+    }
+
+    bool getMoveData( const u16 p_moveId, BATTLE::moveData* p_out ) {
+        *p_out = syntheticMoveData( p_moveId );
+        return true;
+    }
+
+    BATTLE::moveData getMoveData( const u16 p_moveId ) {
+        return syntheticMoveData( p_moveId );
+    }
+
+    BAG::itemData getItemData( const u16 ) {
+        BAG::itemData res;
+        std::memset( &res, 0, sizeof( BAG::itemData ) );
+        return res;
+    }
+
+    const char* getUIString( u16, u8 ) {
+        return "";
+    }
+
+    std::string getDisplayName( u16, u8 ) {
+        return "";
+    }
+
+    bool getDisplayName( u16, char* p_name, u8, u8 ) {
+        p_name[ 0 ] = 0;
+        return true;
+    }
+
+    std::string getAbilityName( u16 ) {
+        return "";
+    }
+
+    std::string getItemName( const u16 ) {
+        return "";
+    }
+
+    std::string getMoveName( const u16 ) {
+        return "";
+    }
+
+    std::string getTrainerClassName( u16 ) {
+        return "";
+    }
+
+    bool readPictureData( u16*, const char*, const char*, u16, u32, bool ) {
+        return false;
+    }
+} // namespace FS
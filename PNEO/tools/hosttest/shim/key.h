@@ -0,0 +1,4 @@
+extern const unsigned int keyTiles[];
+extern const unsigned short keyPal[];
+#define keyTilesLen 512
+#define keyPalLen 32
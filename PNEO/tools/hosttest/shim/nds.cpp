@@ -0,0 +1,142 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : nds.cpp
+author      : Philip Wellnitz
+description : Host definitions of the libnds shim (see nds.h).
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstring>
+
+#include <nds.h>
+
+u16 HOST_BG_VRAM[ 2 ][ 0x40000 ];
+
+u32 cpuGetTiming( ) {
+    static auto start = std::chrono::steady_clock::now( );
+    auto        ns    = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now( ) - start )
+                  .count( );
+    return u32( u64( ns ) * ( BUS_CLOCK / 1000 ) / 1000000 );
+}
+
+void cpuStartTiming( int ) {
+    cpuGetTiming( );
+}
+
+void swiWaitForVBlank( ) {
+}
+
+void DC_FlushRange( const void*, u32 ) {
+}
+
+void DC_FlushAll( ) {
+}
+
+void dmaCopy( const void* p_source, void* p_dest, u32 p_size ) {
+    std::memmove( p_dest, p_source, p_size );
+}
+
+void dmaCopyWords( int, const void* p_source, void* p_dest, u32 p_size ) {
+    std::memmove( p_dest, p_source, p_size );
+}
+
+void dmaCopyHalfWords( int, const void* p_source, void* p_dest, u32 p_size ) {
+    std::memmove( p_dest, p_source, p_size );
+}
+
+void dmaFillWords( u32 p_value, void* p_dest, u32 p_size ) {
+    for( u32 i = 0; i < p_size / 4; ++i ) { reinterpret_cast<u32*>( p_dest )[ i ] = p_value; }
+}
+
+void dmaFillHalfWords( u16 p_value, void* p_dest, u32 p_size ) {
+    for( u32 i = 0; i < p_size / 2; ++i ) { reinterpret_cast<u16*>( p_dest )[ i ] = p_value; }
+}
+
+bool dmaBusy( int ) {
+    return false;
+}
+
+// display registers, backgrounds and input; the host has no screen and no keys
+
+u16 BG_PALETTE[ 256 ];
+u16 BG_PALETTE_SUB[ 256 ];
+
+vu16 REG_BLDCNT, REG_BLDCNT_SUB, REG_BLDY, REG_BLDY_SUB, REG_BLDALPHA, REG_BLDALPHA_SUB;
+
+int bgInit( int p_layer, BgType, BgSize, int, int ) {
+    return p_layer;
+}
+
+int bgInitSub( int p_layer, BgType, BgSize, int, int ) {
+    return p_layer + 4;
+}
+
+void bgUpdate( ) {
+}
+
+void bgSetPriority( int, unsigned ) {
+}
+
+u16* bgGetGfxPtr( int p_id ) {
+    return HOST_BG_VRAM[ p_id >= 4 ];
+}
+
+void videoSetMode( u32 ) {
+}
+
+void videoSetModeSub( u32 ) {
+}
+
+void vramSetBankA( VRAM_A_TYPE ) {
+}
+
+void vramSetBankB( VRAM_B_TYPE ) {
+}
+
+void vramSetBankC( VRAM_C_TYPE ) {
+}
+
+void vramSetBankD( VRAM_D_TYPE ) {
+}
+
+void vramSetBankG( VRAM_G_TYPE ) {
+}
+
+void vramSetBankH( VRAM_H_TYPE ) {
+}
+
+void scanKeys( ) {
+}
+
+u32 keysHeld( ) {
+    return 0;
+}
+
+u32 keysUp( ) {
+    return 0;
+}
+
+void touchRead( touchPosition* p_touch ) {
+    *p_touch = touchPosition( );
+}
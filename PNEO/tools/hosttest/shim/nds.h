@@ -0,0 +1,148 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : nds.h
+author      : Philip Wellnitz
+description : Host shim of the parts of libnds that the modules checked by the
+              host tests (see ../hosttest.sh) use. Video memory is backed by plain
+              arrays, the hardware timers by the host's steady clock, and everything
+              that would talk to other hardware does nothing.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+typedef uint8_t  u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t   s8;
+typedef int16_t  s16;
+typedef int32_t  s32;
+typedef int64_t  s64;
+
+typedef volatile u8  vu8;
+typedef volatile u16 vu16;
+typedef volatile u32 vu32;
+typedef volatile s16 vs16;
+typedef s32          fixed;
+
+#define BUS_CLOCK 33513982
+
+// libnds: shows the message and halts
+#define sassert( e, msg )                                                                      \
+    ( ( e ) ? (void) 0                                                                         \
+            : ( std::fprintf( stderr, "%s:%d: %s failed: %s\n", __FILE__, __LINE__, #e, msg ), \
+                std::abort( ) ) )
+
+// background vram of the main (HOST_BG_VRAM[ 0 ], 512KiB) and the sub engine
+extern u16 HOST_BG_VRAM[ 2 ][ 0x40000 ];
+#define BG_GFX                HOST_BG_VRAM[ 0 ]
+#define BG_GFX_SUB            HOST_BG_VRAM[ 1 ]
+#define BG_BMP_RAM( b )       ( HOST_BG_VRAM[ 0 ] + ( b ) * 0x2000 )
+#define BG_BMP_RAM_SUB( b )   ( HOST_BG_VRAM[ 1 ] + ( b ) * 0x2000 )
+#define BG_TILE_RAM( b )      ( HOST_BG_VRAM[ 0 ] + ( b ) * 0x2000 )
+#define BG_TILE_RAM_SUB( b )  ( HOST_BG_VRAM[ 1 ] + ( b ) * 0x2000 )
+#define BG_MAP_RAM( b )       ( HOST_BG_VRAM[ 0 ] + ( b ) * 0x400 )
+#define BG_MAP_RAM_SUB( b )   ( HOST_BG_VRAM[ 1 ] + ( b ) * 0x400 )
+
+#define SCREEN_WIDTH 256
+#define SCREEN_HEIGHT 192
+#define BIT(n) (1<<(n))
+#define RGB15(r,g,b) ((r)|((g)<<5)|((b)<<10))
+#define RGB5(r,g,b) RGB15(r,g,b)
+#define ARGB16(a,r,g,b) (((a)<<15)|RGB15(r,g,b))
+void cpuStartTiming(int); u32 cpuGetTiming(); u32 cpuEndTiming();
+void swiWaitForVBlank(); void DC_FlushRange(const void*, u32); void DC_FlushAll(); void swiDelay(u32);
+void swiCopy(const void*, void*, int); void swiFastCopy(const void*, void*, int);
+void swiDecompressLZSSWram(const void*, void*); void swiDecompressLZSSVram(const void*, void*, u32, void*);
+struct touchPosition { u16 rawx, rawy, px, py, z1, z2; };
+void touchRead(touchPosition*);
+struct ConsoleFont { u16* gfx; u16* pal; u16 numColors; u8 bpp; u16 asciiOffset; u16 numChars; bool convertSingleColor; };
+struct PrintConsole { ConsoleFont font; };
+PrintConsole* consoleInit(PrintConsole*, int, int, int, int, int, bool, bool);
+void consoleSetFont(PrintConsole*, ConsoleFont*); PrintConsole* consoleSelect(PrintConsole*); void consoleClear();
+void dmaCopy(const void*, void*, u32); void dmaCopyHalfWords(int, const void*, void*, u32); void dmaCopyWords(int, const void*, void*, u32);
+void dmaFillWords(u32, void*, u32); void dmaFillHalfWords(u16, void*, u32);
+void dmaCopyWordsAsynch(int, const void*, void*, u32); void dmaCopyHalfWordsAsynch(int, const void*, void*, u32);
+bool dmaBusy(int);
+enum KEYPAD_BITS { KEY_A=1, KEY_B=2, KEY_SELECT=4, KEY_START=8, KEY_RIGHT=16, KEY_LEFT=32, KEY_UP=64, KEY_DOWN=128, KEY_R=256, KEY_L=512, KEY_X=1024, KEY_Y=2048, KEY_TOUCH=4096, KEY_LID=8192 };
+void scanKeys(); u32 keysHeld(); u32 keysDown(); u32 keysUp(); u32 keysCurrent(); u32 keysDownRepeat(); void keysSetRepeat(u8,u8);
+enum ObjPriority { OBJPRIORITY_0, OBJPRIORITY_1, OBJPRIORITY_2, OBJPRIORITY_3 };
+enum ObjBlendMode { OBJMODE_NORMAL, OBJMODE_BLENDED, OBJMODE_WINDOWED, OBJMODE_BITMAP };
+enum ObjShape { OBJSHAPE_SQUARE, OBJSHAPE_WIDE, OBJSHAPE_TALL, OBJSHAPE_FORBIDDEN };
+enum ObjSize { OBJSIZE_8, OBJSIZE_16, OBJSIZE_32, OBJSIZE_64 };
+enum ObjColMode { OBJCOLOR_16, OBJCOLOR_256 };
+struct SpriteEntry { u16 y:8; bool isRotateScale:1; bool isSizeDouble:1; ObjBlendMode blendMode:2; bool isMosaic:1; ObjColMode colorMode:1; ObjShape shape:2;
+  u16 x:9; u8 rotationIndex:5; ObjSize size:2; ObjPriority priority:2; u16 gfxIndex:10; u8 palette:4; bool isHidden; bool hFlip; bool vFlip; u16 attribute[3]; };
+struct SpriteRotation { u16 filler1[3]; s16 hdx; u16 filler2[3]; s16 vdx; u16 filler3[3]; s16 hdy; u16 filler4[3]; s16 vdy; };
+#define SPRITE_COUNT 128
+#define MATRIX_COUNT 32
+union OAMTable { SpriteEntry oamBuffer[SPRITE_COUNT]; SpriteRotation matrixBuffer[MATRIX_COUNT]; };
+struct OamState { int gfxOffsetStep; s16 firstFree; s16 allocBufferSize; void* allocBuffer; union { SpriteEntry* oamMemory; SpriteRotation* oamRotationMemory; }; };
+extern OamState oamMain, oamSub;
+extern u16 OamTop[]; extern u16 OamBottom[]; extern u16 OAM[]; extern u16 OAM_SUB[];
+extern u16 BG_PALETTE[]; extern u16 BG_PALETTE_SUB[]; extern u16 SPRITE_PALETTE[]; extern u16 SPRITE_PALETTE_SUB[];
+extern u16 SPRITE_GFX[]; extern u16 SPRITE_GFX_SUB[]; extern u16 VRAM_A[]; extern u16 VRAM_B[]; extern u16 VRAM_C[]; extern u16 VRAM_D[]; extern u16 VRAM_E[]; extern u16 VRAM_F[]; extern u16 VRAM_G[]; extern u16 VRAM_H[]; extern u16 VRAM_I[];
+extern vu16 REG_BLDCNT, REG_BLDCNT_SUB, REG_BLDY, REG_BLDY_SUB, REG_BLDALPHA, REG_BLDALPHA_SUB, REG_BG0CNT, REG_BG1CNT, REG_BG2CNT, REG_BG3CNT, REG_BG3CNT_SUB, REG_BG2CNT_SUB, REG_MOSAIC, REG_AUXSPICNT, REG_MASTER_BRIGHT, REG_MASTER_BRIGHT_SUB, REG_DISPCNT_SUB16;
+extern vu8 REG_AUXSPIDATA; extern vu32 REG_DISPCNT, REG_DISPCNT_SUB; extern vu16 REG_VCOUNT; extern vu16 TIMER_DATA(int); extern vu16 REG_BG3X, REG_BG3Y;
+enum { BLEND_NONE=0, BLEND_ALPHA=1<<6, BLEND_FADE_WHITE=2<<6, BLEND_FADE_BLACK=3<<6, BLEND_SRC_BG0=1, BLEND_SRC_BG1=2, BLEND_SRC_BG2=4, BLEND_SRC_BG3=8, BLEND_SRC_SPRITE=16, BLEND_SRC_BACKDROP=32,
+ BLEND_DST_BG0=1<<8, BLEND_DST_BG1=1<<9, BLEND_DST_BG2=1<<10, BLEND_DST_BG3=1<<11, BLEND_DST_SPRITE=1<<12, BLEND_DST_BACKDROP=1<<13 };
+enum BgType { BgType_Text8bpp, BgType_Text4bpp, BgType_Rotation, BgType_ExRotation, BgType_Bmp8, BgType_Bmp16 };
+enum BgSize { BgSize_R_128x128, BgSize_T_256x256, BgSize_T_512x256, BgSize_T_256x512, BgSize_T_512x512, BgSize_ER_256x256, BgSize_B8_128x128, BgSize_B8_256x256, BgSize_B8_512x256, BgSize_B8_512x512, BgSize_B16_256x256 };
+int bgInit(int, BgType, BgSize, int, int); int bgInitSub(int, BgType, BgSize, int, int); void bgUpdate(); void bgSetPriority(int, unsigned); u16* bgGetGfxPtr(int); u16* bgGetMapPtr(int);
+void bgSetScale(int, s32, s32); void bgSetScroll(int, int, int); void bgScrollf(int, s32, s32); void bgScroll(int, int, int); void bgWrapOn(int); void bgWrapOff(int); void bgHide(int); void bgShow(int); void bgSetRotate(int,int); void bgSetCenter(int,int,int); void bgSetMapBase(int, unsigned); void bgSetTileBase(int, unsigned); void bgClearControlBits(int,u16); void bgSetControlBits(int,u16); vu16* bgSetScrollf(int,s32,s32);
+struct BgState { int angle; s32 centerX, centerY, scaleX, scaleY, scrollX, scrollY; int size; int type; bool dirty; };
+extern BgState bgState[8];
+#define degreesToAngle(d) ((d)*32768/360)
+enum VideoMode { MODE_0_2D=0x10000, MODE_3_2D=0x10003, MODE_5_2D=0x10005, MODE_FB0=0x20000 };
+enum { DISPLAY_BG0_ACTIVE=1<<8, DISPLAY_BG1_ACTIVE=1<<9, DISPLAY_BG2_ACTIVE=1<<10, DISPLAY_BG3_ACTIVE=1<<11, DISPLAY_SPR_ACTIVE=1<<12, DISPLAY_SPR_1D=1<<4, DISPLAY_SPR_1D_BMP=4<<4, DISPLAY_SPR_1D_SIZE_128=2<<20, DISPLAY_SPR_1D_BMP_SIZE_128=0, DISPLAY_SPR_EXT_PALETTE=1<<31, DISPLAY_BG_EXT_PALETTE=1<<30, DISPLAY_WIN0_ON=1<<13 };
+void videoSetMode(u32); void videoSetModeSub(u32); void lcdMainOnTop(); void lcdMainOnBottom(); void lcdSwap(); void powerOn(int); void setBrightness(int, int);
+#define POWER_ALL_2D 0
+enum VRAM_A_TYPE { VRAM_A_LCD, VRAM_A_MAIN_BG, VRAM_A_MAIN_BG_0x06000000, VRAM_A_MAIN_SPRITE };
+enum VRAM_B_TYPE { VRAM_B_LCD, VRAM_B_MAIN_SPRITE, VRAM_B_MAIN_BG_0x06020000, VRAM_B_MAIN_SPRITE_0x06400000 };
+enum VRAM_C_TYPE { VRAM_C_LCD, VRAM_C_SUB_BG, VRAM_C_SUB_BG_0x06200000, VRAM_C_MAIN_BG_0x06040000 };
+enum VRAM_D_TYPE { VRAM_D_LCD, VRAM_D_SUB_SPRITE, VRAM_D_MAIN_BG_0x06060000 };
+enum VRAM_E_TYPE { VRAM_E_LCD, VRAM_E_MAIN_BG, VRAM_E_BG_EXT_PALETTE, VRAM_E_MAIN_SPRITE };
+enum VRAM_F_TYPE { VRAM_F_LCD, VRAM_F_SPRITE_EXT_PALETTE, VRAM_F_BG_EXT_PALETTE };
+enum VRAM_G_TYPE { VRAM_G_LCD, VRAM_G_SPRITE_EXT_PALETTE, VRAM_G_BG_EXT_PALETTE };
+enum VRAM_H_TYPE { VRAM_H_LCD, VRAM_H_SUB_BG, VRAM_H_SUB_BG_EXT_PALETTE };
+enum VRAM_I_TYPE { VRAM_I_LCD, VRAM_I_SUB_SPRITE, VRAM_I_SUB_SPRITE_EXT_PALETTE };
+void vramSetBankA(VRAM_A_TYPE); void vramSetBankB(VRAM_B_TYPE); void vramSetBankC(VRAM_C_TYPE); void vramSetBankD(VRAM_D_TYPE); void vramSetBankE(VRAM_E_TYPE); void vramSetBankF(VRAM_F_TYPE); void vramSetBankG(VRAM_G_TYPE); void vramSetBankH(VRAM_H_TYPE); void vramSetBankI(VRAM_I_TYPE);
+u32 vramSetPrimaryBanks(int,int,int,int); void vramRestorePrimaryBanks(u32);
+enum { FIFO_USER_01 = 8, FIFO_USER_02, FIFO_USER_03, FIFO_USER_04, FIFO_SOUND };
+u32 fifoGetValue32(int); bool fifoCheckValue32(int); bool fifoSendValue32(int, u32); bool fifoSendDatamsg(int, int, u8*); int fifoGetDatamsg(int, int, u8*); bool fifoCheckDatamsg(int); void fifoSetDatamsgHandler(int, void(*)(int, void*), void*); void fifoSetValue32Handler(int, void(*)(u32, void*), void*); bool fifoSendAddress(int, void*);
+void irqEnable(u32); void irqSet(u32, void(*)()); void irqDisable(u32);
+enum { IRQ_VBLANK = 1, IRQ_HBLANK = 2, IRQ_TIMER0 = 8 };
+void cardReadHeader(u8*); bool isDSiMode(); void sysSetBusOwners(bool,bool);
+void systemSleep(); void systemShutDown();
+u32 getBatteryLevel();
+void consoleSetWindow(PrintConsole*, int, int, int, int);
+struct tPERSONAL_DATA { u8 birthMonth, birthDay; u16 name[10]; u16 nameLen; u8 language; };
+extern tPERSONAL_DATA* PersonalData;
+enum SpriteColorFormat { SpriteColorFormat_16Color, SpriteColorFormat_256Color, SpriteColorFormat_Bmp };
+#define ATTR0_DISABLED (2<<8)
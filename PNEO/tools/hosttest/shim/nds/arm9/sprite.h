@@ -0,0 +1 @@
+#include <nds.h>
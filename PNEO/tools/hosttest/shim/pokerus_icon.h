@@ -0,0 +1,4 @@
+extern const unsigned int pokerus_iconTiles[];
+extern const unsigned short pokerus_iconPal[];
+#define pokerus_iconTilesLen 512
+#define pokerus_iconPalLen 32
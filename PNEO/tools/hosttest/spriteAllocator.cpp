@@ -0,0 +1,187 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : spriteAllocator.cpp
+author      : Philip Wellnitz
+description : Host test of the sprite vram allocator: runs random sequences of
+              allocate / free / acquire / release against a model of the live blocks
+              and checks that blocks never overlap, are aligned buddy blocks outside
+              the reserved units, that allocations only fail if no suitable free
+              block exists and that all space is available again once everything has
+              been freed.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/spriteAllocator.cpp
+
+#include <bit>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "io/spriteAllocator.h"
+
+u32 ERRORS = 0;
+
+#define CHECK( p_cond, ... )                                          \
+    do {                                                              \
+        if( !( p_cond ) && ++ERRORS <= 10 ) {                         \
+            std::printf( "check failed: " #p_cond ": " __VA_ARGS__ ); \
+            std::printf( "\n" );                                      \
+        }                                                             \
+    } while( false )
+
+struct liveAsset {
+    u8  m_handle;
+    u16 m_tile;
+    u16 m_units;
+    u16 m_refs;
+};
+
+u16 roundUp( u16 p_units ) {
+    return std::bit_ceil( p_units );
+}
+
+int main( ) {
+    std::mt19937 rng( 99 );
+    IO::spriteAllocator alloc;
+
+    u32 ops = 0, failedAllocs = 0, hits = 0;
+    for( u32 round = 0; round < 200; ++round ) {
+        u16 reserved = ( round % 4 ) ? rng( ) % 600 : 0;
+        alloc.init( reserved );
+
+        std::map<u16, u16>       blocks; // tile -> units of allocate( )d blocks
+        std::map<u64, liveAsset> assets; // assets acquired at least once
+
+        // units used by blocks and referenced assets; unreferenced assets may be evicted
+        auto occupancy = [ & ]( ) {
+            std::vector<u8> used( IO::SPRITE_ALLOCATOR_UNITS, 0 );
+            auto mark = [ & ]( u16 p_tile, u16 p_units ) {
+                CHECK( p_tile >= reserved, "tile %hu, reserved %hu", p_tile, reserved );
+                CHECK( p_tile + p_units <= IO::SPRITE_ALLOCATOR_UNITS, "tile %hu", p_tile );
+                CHECK( !( p_tile % p_units ), "tile %hu of %hu units", p_tile, p_units );
+                for( u16 i = p_tile; i < p_tile + p_units && i < IO::SPRITE_ALLOCATOR_UNITS;
+                     ++i ) {
+                    CHECK( !used[ i ], "unit %hu used twice", i );
+                    used[ i ] = 1;
+                }
+            };
+            for( auto [ tile, units ] : blocks ) { mark( tile, units ); }
+            for( auto& [ key, a ] : assets ) {
+                if( a.m_refs ) { mark( a.m_tile, a.m_units ); }
+            }
+            return used;
+        };
+        auto hasFreeBlock = [ & ]( const std::vector<u8>& p_used, u16 p_units ) {
+            for( u16 pos = 0; pos + p_units <= IO::SPRITE_ALLOCATOR_UNITS; pos += p_units ) {
+                if( pos < reserved ) { continue; }
+                bool free = true;
+                for( u16 i = pos; i < pos + p_units; ++i ) { free &= !p_used[ i ]; }
+                if( free ) { return true; }
+            }
+            return false;
+        };
+
+        for( u32 op = 0; op < 3000; ++op, ++ops ) {
+            u8 kind = rng( ) % 4;
+            if( kind == 0 ) {
+                u16  units = 1 + rng( ) % ( ( rng( ) & 7 ) ? 16 : 256 );
+                auto used  = occupancy( );
+                u16  tile  = alloc.allocate( units );
+                if( tile == IO::NO_SPRITE_TILES ) {
+                    ++failedAllocs;
+                    CHECK( !hasFreeBlock( used, roundUp( units ) ), "allocate( %hu ) failed",
+                           units );
+                } else {
+                    CHECK( !blocks.count( tile ), "tile %hu handed out twice", tile );
+                    blocks[ tile ] = roundUp( units );
+                }
+            } else if( kind == 1 && !blocks.empty( ) ) {
+                auto it = blocks.begin( );
+                std::advance( it, rng( ) % blocks.size( ) );
+                alloc.free( it->first );
+                blocks.erase( it );
+            } else if( kind == 2 ) {
+                // few keys, so that assets get shared and reused from the cache
+                u64  key   = 1 + rng( ) % 96;
+                u16  units = roundUp( 1 + key % 32 );
+                auto used  = occupancy( );
+                bool fresh;
+                u8   handle = alloc.acquire( key, units, fresh );
+                auto it     = assets.find( key );
+                if( handle == IO::NO_SPRITE_ASSET ) {
+                    ++failedAllocs;
+                    u32 referenced = 0;
+                    for( auto& [ k, a ] : assets ) { referenced += !!a.m_refs; }
+                    CHECK( ( it == assets.end( ) || !it->second.m_refs )
+                               && ( referenced >= IO::SPRITE_ALLOCATOR_ASSETS
+                                    || !hasFreeBlock( used, units ) ),
+                           "acquire( %llu ) failed", (unsigned long long) key );
+                    continue;
+                }
+                if( it != assets.end( ) && it->second.m_refs ) {
+                    CHECK( !fresh && handle == it->second.m_handle
+                               && alloc.tile( handle ) == it->second.m_tile,
+                           "asset %llu not shared", (unsigned long long) key );
+                    it->second.m_refs++;
+                    ++hits;
+                    continue;
+                }
+                if( it != assets.end( ) && !fresh ) {
+                    // still cached
+                    CHECK( alloc.tile( handle ) == it->second.m_tile,
+                           "cached asset %llu moved", (unsigned long long) key );
+                    ++hits;
+                }
+                if( fresh ) { alloc.data( handle ) = u16( key ); }
+                CHECK( alloc.data( handle ) == u16( key ), "data of asset %llu lost",
+                       (unsigned long long) key );
+                assets[ key ] = { handle, alloc.tile( handle ), units, 1 };
+            } else if( kind == 3 ) {
+                std::vector<u64> referenced;
+                for( auto& [ k, a ] : assets ) {
+                    if( a.m_refs ) { referenced.push_back( k ); }
+                }
+                if( referenced.empty( ) ) { continue; }
+                auto& a = assets[ referenced[ rng( ) % referenced.size( ) ] ];
+                alloc.release( a.m_handle );
+                a.m_refs--;
+            }
+            occupancy( );
+        }
+
+        // with everything freed, all units need to be available again
+        for( auto [ tile, units ] : blocks ) { alloc.free( tile ); }
+        for( auto& [ key, a ] : assets ) {
+            for( ; a.m_refs; --a.m_refs ) { alloc.release( a.m_handle ); }
+        }
+        u16 units = 0;
+        while( alloc.allocate( 1 ) != IO::NO_SPRITE_TILES ) { ++units; }
+        CHECK( units == IO::SPRITE_ALLOCATOR_UNITS - reserved, "%hu of %hu units free", units,
+               IO::SPRITE_ALLOCATOR_UNITS - reserved );
+    }
+
+    std::printf( "%u operations, %u failed allocations, %u asset hits, %u errors\n", ops,
+                 failedAllocs, hits, ERRORS );
+    return ERRORS != 0;
+}
@@ -0,0 +1,158 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : spritePalettes.cpp
+author      : Philip Wellnitz
+description : Host test of IO::spritePalettes: acquires and releases palette slots for
+              random OAM entries and palettes and checks after every step that each
+              sprite's slot holds its palette, that sprites with identical palettes share
+              a slot (so the palette is uploaded only once) and that only the expected
+              sprites get wrong colors when all slots are taken.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/spritePalettes.cpp
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <random>
+#include <set>
+
+#include "io/sprite.h"
+#include "io/spritePalettes.h"
+
+u16 PALETTE_RAM[ 2 ][ IO::SPRITE_PALETTE_SLOTS ][ 16 ];
+u32 UPLOADS = 0;
+
+namespace IO {
+    void copySpritePal( const unsigned short* p_spritePal, const u8 p_palIdx, bool p_bottom ) {
+        std::memcpy( PALETTE_RAM[ p_bottom ][ p_palIdx ], p_spritePal, 32 );
+        UPLOADS++;
+    }
+} // namespace IO
+
+constexpr u8 NUM_PALETTES = 24;
+u16          PALETTES[ NUM_PALETTES ][ 16 ];
+
+int main( ) {
+    std::mt19937 rng( 7 );
+    for( u8 i = 0; i < NUM_PALETTES; ++i ) {
+        for( u8 j = 0; j < 16; ++j ) { PALETTES[ i ][ j ] = rng( ); }
+    }
+    // palettes that differ in a single color must not share a slot
+    for( u8 i = 1; i < NUM_PALETTES; i += 4 ) {
+        std::memcpy( PALETTES[ i ], PALETTES[ i - 1 ], 32 );
+        PALETTES[ i ][ rng( ) % 16 ] ^= 1 << ( rng( ) % 16 );
+    }
+
+    u32 ops = 0, mismatches = 0, overflows = 0, shared = 0;
+    for( u32 round = 0; round < 400; ++round ) {
+        bool  bottom = round & 1;
+        auto& pm     = IO::SPRITE_PALETTES[ bottom ];
+        u8    first = rng( ) % 8, last = first + 1 + rng( ) % ( IO::SPRITE_PALETTE_SLOTS - first );
+        pm.init( first, last );
+
+        std::map<u8, u8> palOf;    // oam index -> palette of the sprite
+        std::map<u8, u8> slotOf;   // oam index -> slot returned by acquire
+        std::set<u8>     garbled;  // sprites that may have wrong colors after an overflow
+        u8               oams = 1 + rng( ) % 32;
+
+        for( u32 op = 0; op < 2000; ++op, ++ops ) {
+            u8 oam = rng( ) % oams;
+            if( rng( ) % 3 ) {
+                u8 pal = rng( ) % ( 2 + round % ( NUM_PALETTES - 1 ) );
+
+                // slots used by the other sprites and whether one of them holds the palette
+                std::set<u8> busy;
+                for( auto [ o, s ] : slotOf ) {
+                    if( o != oam ) { busy.insert( s ); }
+                }
+                s32 holder = -1;
+                for( auto s : busy ) {
+                    if( !std::memcmp( PALETTE_RAM[ bottom ][ s ], PALETTES[ pal ], 32 ) ) {
+                        holder = s;
+                    }
+                }
+
+                u32 before = UPLOADS;
+                u8  slot   = pm.acquire( oam, PALETTES[ pal ] );
+                if( slot < first || slot >= last ) {
+                    if( ++mismatches <= 10 ) { std::printf( "slot %hhu out of range\n", slot ); }
+                }
+                if( holder >= 0 ) {
+                    ++shared;
+                    if( slot != holder || UPLOADS != before ) {
+                        if( ++mismatches <= 10 ) {
+                            std::printf( "palette %hhu not shared (slot %hhu, expected %d)\n",
+                                         pal, slot, holder );
+                        }
+                    }
+                } else if( busy.size( ) >= u32( last - first ) ) {
+                    // all slots taken: the last slot is overwritten
+                    ++overflows;
+                    if( slot != last - 1 ) {
+                        if( ++mismatches <= 10 ) {
+                            std::printf( "overflow used slot %hhu\n", slot );
+                        }
+                    }
+                    for( auto [ o, s ] : slotOf ) {
+                        if( s == slot && o != oam ) { garbled.insert( o ); }
+                    }
+                } else if( busy.count( slot ) ) {
+                    if( ++mismatches <= 10 ) {
+                        std::printf( "slot %hhu of another palette reused\n", slot );
+                    }
+                }
+                palOf[ oam ]  = pal;
+                slotOf[ oam ] = slot;
+                garbled.erase( oam );
+            } else {
+                pm.release( oam );
+                palOf.erase( oam );
+                slotOf.erase( oam );
+                garbled.erase( oam );
+            }
+
+            std::set<u8> used;
+            for( auto [ o, s ] : slotOf ) {
+                used.insert( s );
+                if( garbled.count( o ) ) { continue; }
+                if( std::memcmp( PALETTE_RAM[ bottom ][ s ], PALETTES[ palOf[ o ] ], 32 ) ) {
+                    if( ++mismatches <= 10 ) {
+                        std::printf( "sprite %hhu: slot %hhu doesn't hold palette %hhu\n", o, s,
+                                     palOf[ o ] );
+                    }
+                }
+            }
+            if( pm.usedSlots( ) != used.size( ) ) {
+                if( ++mismatches <= 10 ) {
+                    std::printf( "%hhu slots used, expected %zu\n", pm.usedSlots( ),
+                                 used.size( ) );
+                }
+            }
+        }
+    }
+    std::printf( "%u operations, %u shared acquires, %u overflows, %u mismatches\n", ops, shared,
+                 overflows, mismatches );
+
+    return mismatches != 0;
+}
@@ -0,0 +1,154 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : stringAtlas.cpp
+author      : Philip Wellnitz
+description : Host test of font::printStaticString: prints random UI strings via the
+              string atlas and via printString at random positions, alignments and
+              colors, switching the language now and then, and compares the layer
+              and the returned line counts.
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/stringAtlas.cpp source/font.cpp source/fontRegular.cpp
+// sources: source/fontBold.cpp source/fontSmall.cpp source/fontBraille.cpp
+// sources: source/uio.cpp source/backBuffer.cpp source/strings.cpp
+
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "fs/data.h"
+#include "io/font.h"
+#include "io/stringAtlas.h"
+#include "io/uio.h"
+#include "save/saveGame.h"
+
+namespace SAVE {
+    saveGame SAV;
+} // namespace SAVE
+
+constexpr u16 NUM_STRINGS   = 100;
+constexpr u8  NUM_LANGUAGES = 2;
+constexpr u32 LAYER_BYTES   = SCREEN_WIDTH * 256;
+
+std::string STRINGS[ NUM_STRINGS ][ NUM_LANGUAGES ];
+
+namespace FS {
+    // stands in for the ui string bank of the file system
+    const char* getUIString( u16 p_stringId, u8 p_language ) {
+        return STRINGS[ p_stringId % NUM_STRINGS ][ p_language % NUM_LANGUAGES ].c_str( );
+    }
+
+    const char* getMapString( u16 ) {
+        return "";
+    }
+} // namespace FS
+
+u8 BACKGROUND[ LAYER_BYTES ];
+u8 REFERENCE[ LAYER_BYTES ];
+
+u8* layer( ) {
+    return reinterpret_cast<u8*>( BG_BMP_RAM_SUB( 1 ) );
+}
+
+int main( ) {
+    std::mt19937 rng( 1234 );
+    for( u32 i = 0; i < LAYER_BYTES; ++i ) { BACKGROUND[ i ] = rng( ); }
+
+    // mostly short labels, some longer and multi-line ones (that may not fit the atlas)
+    const char CHARS[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 .,!?-/";
+    for( u16 i = 0; i < NUM_STRINGS; ++i ) {
+        for( u8 l = 0; l < NUM_LANGUAGES; ++l ) {
+            u16 len = ( i % 10 ) ? 1 + rng( ) % 16 : 1 + rng( ) % 80;
+            for( u16 j = 0; j < len; ++j ) {
+                STRINGS[ i ][ l ] += ( i % 10 == 0 && j % 20 == 19 )
+                                         ? '\n'
+                                         : CHARS[ rng( ) % ( sizeof( CHARS ) - 1 ) ];
+            }
+        }
+    }
+
+    IO::font* fonts[] = { IO::regularFont, IO::boldFont };
+
+    constexpr u32 PRINTS     = 20000;
+    u32           mismatches = 0;
+    for( u32 i = 0; i < PRINTS; ++i ) {
+        if( !( rng( ) % 500 ) ) {
+            SAVE::SAV.getActiveFile( ).m_options.m_language
+                = SAVE::language( rng( ) % NUM_LANGUAGES );
+        }
+        IO::font* f = fonts[ rng( ) % 2 ];
+        // a few color sets only, so that strings are printed from the atlas again
+        u8 colorSet = rng( ) % 3;
+        f->setColor( colorSet == 2 ? 240 : 0, 0 );
+        f->setColor( 1 + colorSet, 1 );
+        f->setColor( 10 + colorSet, 2 );
+        f->setColor( 20 + colorSet, 3 );
+        f->setColor( 30 + colorSet, 4 );
+
+        u16  id    = rng( ) % NUM_STRINGS;
+        s16  x     = s16( rng( ) % 300 ) - 20;
+        s16  y     = s16( rng( ) % 220 ) - 10;
+        auto align = IO::font::alignment( rng( ) % 3 );
+        u8   yDist = ( rng( ) & 1 ) ? 15 : 12;
+        u8   shift = rng( ) & 1;
+
+        std::memcpy( layer( ), BACKGROUND, LAYER_BYTES );
+        u16 refLines = f->printString( GET_STRING( id ), x, y, true, align, yDist, 0, shift,
+                                       false, 1 );
+        std::memcpy( REFERENCE, layer( ), LAYER_BYTES );
+
+        std::memcpy( layer( ), BACKGROUND, LAYER_BYTES );
+        u16 lines = f->printStaticString( id, x, y, true, align, yDist, shift, 1 );
+
+        if( ( lines != refLines || std::memcmp( REFERENCE, layer( ), LAYER_BYTES ) )
+            && ++mismatches <= 10 ) {
+            std::printf( "mismatch: string %hu at %hd, %hd, alignment %d, colors %hhu\n", id,
+                         x, y, align, colorSet );
+        }
+    }
+    std::printf( "%u prints compared, %u mismatches\n", PRINTS, mismatches );
+
+    // time repeated prints of a short label
+    SAVE::SAV.getActiveFile( ).m_options.m_language = SAVE::language( 0 );
+    IO::regularFont->setColor( 0, 0 );
+    auto time = [ & ]( bool p_static ) {
+        constexpr u32 ROUNDS = 20000;
+        auto          start  = std::chrono::steady_clock::now( );
+        for( u32 r = 0; r < ROUNDS; ++r ) {
+            if( p_static ) {
+                IO::regularFont->printStaticString( 1, 10, 10, true );
+            } else {
+                IO::regularFont->printString( GET_STRING( 1 ), 10, 10, true );
+            }
+        }
+        return double( std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now( ) - start )
+                           .count( ) )
+               / ROUNDS / 1000;
+    };
+    std::printf( "label \"%s\": printString %.2f us, printStaticString %.2f us\n",
+                 GET_STRING( 1 ), time( false ), time( true ) );
+
+    return mismatches != 0;
+}
@@ -0,0 +1,253 @@
+/*
+Pokémon neo
+------------------------------
+
+file        : typeEffectiveness.cpp
+author      : Philip Wellnitz
+description : Host test of the dual-type effectiveness table: compares
+              DUAL_TYPE_EFFECTIVENESS and getEffectivenessOnTypes with applying the
+              types one after another for every attack type and every set of up to
+              three defending types, and field::getEffectiveness with the per-type loop
+              it replaced for every attack type and pair of defending types (19^3
+              combinations), with plain moves and with the special cases that skip
+              the table (ground moves, freeze-dry, flying press, moves that ignore
+              immunities, foresight and miracle eye, heavy winds).
+
+Copyright (C) 2012 - 2023
+Philip Wellnitz
+
+This file is part of Pokémon neo.
+
+Pokémon neo is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Pokémon neo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Pokémon neo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// sources: source/battleField.cpp source/battleSide.cpp source/battleSlot.cpp
+// sources: source/battleUI.cpp source/battleBenchmark.cpp source/moveTable.cpp
+// sources: source/pokemon.cpp source/boxPokemon.cpp source/profiler.cpp
+// shims: game.cpp
+
+#include "battle/battleBenchmark.h"
+#include "battle/battleField.h"
+#include "battle/battleUI.h"
+#include "battle/moveTable.h"
+
+using namespace BATTLE;
+
+/*
+ * @brief: Applies the effectiveness of the types in p_types one after another.
+ */
+u16 sequentialEffectiveness( type p_t1, u32 p_types ) {
+    u16 res = 100;
+    for( u8 t = 0; t < NUM_TYPES; ++t ) {
+        if( p_types & ( 1 << t ) ) { res = res * getTypeEffectiveness( p_t1, type( t ) ) / 100; }
+    }
+    return res;
+}
+
+/*
+ * @brief: field::getEffectiveness as it was before the table, using the public
+ * interface of the field.
+ */
+u16 referenceEffectiveness( field& p_field, battleMove p_move, fieldPosition p_target ) {
+    u16 res = 100;
+
+    auto target = p_field.getPkmn( p_target.first, p_target.second );
+    if( target == nullptr ) { return 0; }
+
+    bool items = p_field.canUseItem( p_target.first, p_target.second );
+
+    bool abilities
+        = !p_field.suppressesAbilities( ) && !( p_move.m_moveData.m_flags & MF_IGNOREABILITY );
+
+    bool wonderguard = abilities && target->getAbility( ) == A_WONDER_GUARD;
+
+    type moveType = p_field.getMoveType( p_move );
+
+    if( p_field.getWeather( ) == WE_HEAVY_SUNSHINE && moveType == TYPE_WATER
+        && !p_field.suppressesWeather( ) ) {
+        return 0;
+    }
+    if( p_field.getWeather( ) == WE_HEAVY_RAIN && moveType == TYPE_FIRE
+        && !p_field.suppressesWeather( ) ) {
+        return 0;
+    }
+
+    if( ( p_move.m_moveData.m_flags & MF_SOUND )
+        && ( target->getAbility( ) == A_SOUNDPROOF || target->getAbility( ) == A_CACOPHONY )
+        && abilities ) {
+        return 0;
+    }
+
+    if( p_move.m_param == M_THOUSAND_ARROWS
+        || ( p_move.m_moveData.m_flags & MF_IGNOREIMMUNITYGROUND ) ) {
+        if( !p_field.isGrounded( p_target.first, p_target.second )
+            && p_field.hasType( p_target.first, p_target.second, TYPE_FLYING ) ) {
+            return res;
+        }
+    }
+
+    bool targetIsGrounded = p_field.isGrounded( p_target.first, p_target.second,
+                                                p_move.m_param != M_SUNSTEEL_STRIKE );
+    auto user             = p_field.getPkmn( p_move.m_user.first, p_move.m_user.second );
+    if( user == nullptr ) { return 0; }
+
+    auto vol = p_field.getVolatileStatus( p_target.first, p_target.second );
+    for( u8 i = 0; i < NUM_TYPES; ++i ) {
+        type t = type( i );
+        if( !p_field.hasType( p_target.first, p_target.second, t ) ) { continue; }
+        u16 curval = getTypeEffectiveness( moveType, t );
+
+        if( !targetIsGrounded && moveType == TYPE_GROUND ) {
+            curval = 0;
+        } else if( targetIsGrounded && moveType == TYPE_GROUND && t == TYPE_FLYING ) {
+            curval = 100;
+        }
+
+        if( p_move.m_param == M_FLYING_PRESS ) {
+            curval = ( curval * getTypeEffectiveness( TYPE_FLYING, t ) ) / 100;
+        }
+
+        if( !curval && ( p_move.m_moveData.m_flags & MF_IGNOREIMMUNITY ) ) { curval = 100; }
+
+        if( t == TYPE_GHOST && ( moveType == TYPE_NORMAL || moveType == TYPE_FIGHTING ) ) {
+            if( abilities && user->getAbility( ) == A_SCRAPPY ) { continue; }
+            if( vol & VS_FORESIGHT ) { continue; }
+        }
+
+        if( t == TYPE_DARKNESS && moveType == TYPE_PSYCHIC && ( vol & VS_MIRACLEEYE ) ) {
+            continue;
+        }
+
+        if( t == TYPE_WATER && p_move.m_param == M_FREEZE_DRY ) { curval = 200; }
+
+        if( t == TYPE_FLYING ) {
+            if( !p_field.suppressesWeather( ) && p_field.getWeather( ) == WE_HEAVY_WINDS ) {
+                continue;
+            }
+        }
+
+        if( !curval && items && target->getItem( ) == I_RING_TARGET ) { continue; }
+
+        res = ( res * curval / 100 );
+    }
+
+    if( wonderguard && res <= 100 ) { return 0; }
+
+    return res;
+}
+
+struct variant {
+    const char*    m_name;
+    u16            m_move;
+    moveFlags      m_flags;
+    volatileStatus m_volatile; // volatile status of the target
+    weather        m_weather;
+};
+
+constexpr variant VARIANTS[] = {
+    { "plain", M_TACKLE, moveFlags( 0 ), volatileStatus( 0 ), WE_NONE },
+    { "freeze-dry", M_FREEZE_DRY, moveFlags( 0 ), volatileStatus( 0 ), WE_NONE },
+    { "flying press", M_FLYING_PRESS, moveFlags( 0 ), volatileStatus( 0 ), WE_NONE },
+    { "ignore immunity", M_TACKLE, MF_IGNOREIMMUNITY, volatileStatus( 0 ), WE_NONE },
+    { "foresight", M_TACKLE, moveFlags( 0 ), VS_FORESIGHT, WE_NONE },
+    { "miracle eye", M_TACKLE, moveFlags( 0 ), VS_MIRACLEEYE, WE_NONE },
+    { "heavy winds", M_TACKLE, moveFlags( 0 ), volatileStatus( 0 ), WE_HEAVY_WINDS },
+};
+
+int main( ) {
+    u32 checks = 0, mismatches = 0;
+
+    // the table against applying the types one after another
+    for( u8 a = 0; a < NUM_TYPES; ++a ) {
+        for( u32 types = 0; types < ( 1 << NUM_TYPES ); ++types ) {
+            if( __builtin_popcount( types ) > 3 ) { continue; }
+            u16 expected = sequentialEffectiveness( type( a ), types );
+            ++checks;
+            if( getEffectivenessOnTypes( type( a ), types ) != expected ) {
+                if( ++mismatches <= 10 ) {
+                    std::printf( "mismatch: type %hhu on types %x: %hu, expected %hu\n", a,
+                                 types, getEffectivenessOnTypes( type( a ), types ), expected );
+                }
+            }
+        }
+        for( u8 t1 = 0; t1 < NUM_TYPES; ++t1 ) {
+            for( u8 t2 = 0; t2 < NUM_TYPES; ++t2 ) {
+                u16 expected = sequentialEffectiveness( type( a ), ( 1 << t1 ) | ( 1 << t2 ) );
+                ++checks;
+                if( DUAL_TYPE_EFFECTIVENESS.m_values[ a ][ t1 ][ t2 ] != expected ) {
+                    if( ++mismatches <= 10 ) {
+                        std::printf( "mismatch: table entry %hhu, %hhu, %hhu\n", a, t1, t2 );
+                    }
+                }
+            }
+        }
+    }
+    std::printf( "%u table entries compared, %u mismatches\n", checks, mismatches );
+
+    // field::getEffectiveness against the per-type loop
+    u32 fieldChecks = 0, fieldMismatches = 0;
+    for( const auto& v : VARIANTS ) {
+        battleUI ui = battleUI( 0, 0, 0, BM_SINGLE, false, true );
+        field    fd = field( BM_SINGLE, false, v.m_weather );
+
+        // the types of the target get replaced below
+        const auto& sc = BENCHMARK_SCENARIOS[ 0 ];
+        pokemon     teams[ field::NUM_SIDES ][ SAVE::NUM_PARTY_SLOTS ];
+        auto        pkmn                   = sc.m_player[ 0 ];
+        teams[ field::PLAYER_SIDE ][ 0 ]   = pokemon( pkmn );
+        pkmn                               = sc.m_player[ 1 ];
+        teams[ field::OPPONENT_SIDE ][ 0 ] = pokemon( pkmn );
+        fd.sendPokemon( &ui, false, 0, &teams[ field::PLAYER_SIDE ][ 0 ],
+                        teams[ field::PLAYER_SIDE ] );
+        fd.sendPokemon( &ui, true, 0, &teams[ field::OPPONENT_SIDE ][ 0 ],
+                        teams[ field::OPPONENT_SIDE ] );
+        if( v.m_volatile ) { fd.addVolatileStatus( &ui, true, 0, v.m_volatile, -1 ); }
+
+        battleMove mv = battleMove( );
+        mv.m_type     = MT_ATTACK;
+        mv.m_param    = v.m_move;
+        mv.m_user     = { field::PLAYER_SIDE, 0 };
+        mv.m_moveData = MOVE_TABLE.get( v.m_move );
+        mv.m_moveData.m_flags = moveFlags( mv.m_moveData.m_flags | v.m_flags );
+
+        u32 failed = 0;
+        for( u8 a = 0; a < NUM_TYPES; ++a ) {
+            mv.m_moveData.m_type = type( a );
+            for( u8 t1 = 0; t1 < NUM_TYPES; ++t1 ) {
+                for( u8 t2 = 0; t2 < NUM_TYPES; ++t2 ) {
+                    fd.setType( &ui, true, 0, type( t1 ) );
+                    fd.setExtraType( &ui, true, 0, type( t2 ) );
+
+                    u16 res      = fd.getEffectiveness( mv, { field::OPPONENT_SIDE, 0 } );
+                    u16 expected = referenceEffectiveness( fd, mv, { field::OPPONENT_SIDE, 0 } );
+                    ++fieldChecks;
+                    if( res != expected ) {
+                        ++failed;
+                        if( ++fieldMismatches <= 10 ) {
+                            std::printf( "mismatch (%s): type %hhu on %hhu/%hhu: %hu, expected "
+                                         "%hu\n",
+                                         v.m_name, a, t1, t2, res, expected );
+                        }
+                    }
+                }
+            }
+        }
+        std::printf( "%-15s: %u combinations, %u mismatches\n", v.m_name,
+                     NUM_TYPES * NUM_TYPES * NUM_TYPES, failed );
+    }
+    std::printf( "%u field effectiveness checks, %u mismatches\n", fieldChecks,
+                 fieldMismatches );
+
+    return mismatches + fieldMismatches != 0;
+}